@@ -0,0 +1,714 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <stb_image.h>
+#include "global.h"
+#include "clash.h"
+#include "platform.h"
+
+/*******************************************************************************
+ * Mode batch : une liste d'images (répertoire ou manifeste) répartie sur un
+ * pool de threads à vol de travail.
+ *
+ * Chaque thread décode une image (lecture + stb_image) puis pousse la tâche de
+ * traitement (palette, dithering, encodage, écriture) au fond de sa propre
+ * file. Il reprend ses tâches par le fond (LIFO, image encore chaude dans le
+ * cache) tandis que les threads inoccupés volent par le haut des autres files :
+ * le décodage d'une image se fait pendant le dithering des autres.
+ *
+ * Un nouveau décodage n'est lancé que si la mémoire estimée des images en vol
+ * (fichier + pixels décodés) reste sous le budget. Un thread qui ne peut ni
+ * traiter ni décoder s'endort jusqu'à la prochaine tâche ou libération.
+ *******************************************************************************/
+
+typedef struct {
+	char *input;
+	char *prefix;
+	char *palette_name; // NULL : palette de la machine
+	int dither, machine;
+	long long estimate; // mémoire réservée sur le budget pendant le traitement
+	int status;			// 0 = succès
+	DecodedImage image; // valide entre le décodage et la fin du traitement
+	double started_at, decoded_at;
+	double decode_ms, wait_ms, process_ms, latency_ms;
+} BatchEntry;
+
+typedef struct {
+	BatchEntry *entries;
+	int count, capacity;
+} BatchList;
+
+// File d'un thread (indices d'entrées décodées) : le propriétaire travaille au fond, les voleurs prennent en haut
+typedef struct {
+	platform_mutex lock;
+	int *tasks;
+	int top, bottom, capacity; // indices croissants, modulo capacity
+} WorkDeque;
+
+typedef struct {
+	BatchList *list;
+	WorkDeque *deques;
+	int threads;
+	int outputs;		 // masque OUT_* commun à toutes les images
+	ClashCache *cache;
+	const PaletteLibrary *palettes;
+	const DitherOptions *dither_options;
+	platform_mutex lock; // protège les champs ci-dessous
+	platform_cond wake;
+	int next_decode;	  // prochaine entrée à décoder
+	int pending;		  // tâches de traitement en attente dans les files
+	int remaining;		  // entrées non terminées
+	int done;
+	long long budget, in_flight;
+} BatchScheduler;
+
+typedef struct {
+	BatchScheduler *scheduler;
+	int id;
+	ClashScratch scratch;
+	int processed, stolen;
+} BatchWorker;
+
+static const char *image_extensions[] = {".png", ".jpg", ".jpeg", ".bmp", ".gif", ".tga",
+										 ".psd", ".pnm", ".ppm", ".pgm", ".hdr", ".pic"};
+
+static char *copy_string(const char *s)
+{
+	char *copy = malloc(strlen(s) + 1);
+	if (copy) strcpy(copy, s);
+	return copy;
+}
+
+static int has_image_extension(const char *name)
+{
+	const char *dot = strrchr(name, '.');
+	if (!dot) return 0;
+	for (int i = 0; i < (int)(sizeof(image_extensions) / sizeof(image_extensions[0])); i++) {
+		const char *ext = image_extensions[i];
+		size_t len = strlen(ext);
+		if (strlen(dot) != len) continue;
+		int same = 1;
+		for (size_t k = 0; k < len && same; k++) same = tolower((unsigned char)dot[k]) == ext[k];
+		if (same) return 1;
+	}
+	return 0;
+}
+
+// Préfixe par défaut : <préfixe global><nom sans répertoire ni extension>_
+static char *default_prefix(const char *global_prefix, const char *input)
+{
+	const char *base = input;
+	for (const char *p = input; *p; p++)
+		if (*p == '/' || *p == '\\') base = p + 1;
+	const char *dot = strrchr(base, '.');
+	size_t stem = dot ? (size_t)(dot - base) : strlen(base);
+	size_t size = strlen(global_prefix) + stem + 2;
+	char *prefix = malloc(size);
+	if (prefix) snprintf(prefix, size, "%s%.*s_", global_prefix, (int)stem, base);
+	return prefix;
+}
+
+static BatchEntry *add_entry(BatchList *list, const char *input, const ClashJob *defaults)
+{
+	if (list->count == list->capacity) {
+		int capacity = list->capacity ? list->capacity * 2 : 64;
+		BatchEntry *tmp = realloc(list->entries, capacity * sizeof(BatchEntry));
+		if (!tmp) return NULL;
+		list->entries = tmp;
+		list->capacity = capacity;
+	}
+	BatchEntry *entry = &list->entries[list->count++];
+	memset(entry, 0, sizeof(*entry));
+	entry->input = copy_string(input);
+	entry->dither = defaults->dither;
+	entry->machine = defaults->machine;
+	entry->palette_name = defaults->palette_name ? copy_string(defaults->palette_name) : NULL;
+	return entry;
+}
+
+typedef struct {
+	BatchList *list;
+	const char *directory;
+	const ClashJob *defaults;
+} DirectoryScan;
+
+static void add_directory_file(const char *name, void *context)
+{
+	DirectoryScan *scan = context;
+	if (!has_image_extension(name)) return;
+	char path[4096];
+	snprintf(path, sizeof(path), "%s/%s", scan->directory, name);
+	BatchEntry *entry = add_entry(scan->list, path, scan->defaults);
+	if (entry) entry->prefix = default_prefix(scan->defaults->outputs.prefix, name);
+}
+
+static int compare_entries(const void *a, const void *b)
+{
+	return strcmp(((const BatchEntry *)a)->input, ((const BatchEntry *)b)->input);
+}
+
+// Manifeste : "entrée [d [m [palette|- [préfixe]]]]" par ligne, séparateurs espace, tabulation, virgule ou ;
+static int load_manifest(BatchList *list, const char *filename, const ClashJob *defaults)
+{
+	FILE *f = fopen(filename, "r");
+	if (!f) {
+		fprintf(stderr, "Erreur: Impossible d'ouvrir le manifeste '%s'.\n", filename);
+		return -1;
+	}
+	char line[4096];
+	int line_number = 0;
+	while (fgets(line, sizeof(line), f)) {
+		line_number++;
+		char *fields[5] = {NULL};
+		int n = 0;
+		for (char *tok = strtok(line, " \t,;\r\n"); tok && n < 5; tok = strtok(NULL, " \t,;\r\n")) fields[n++] = tok;
+		if (n == 0 || fields[0][0] == '#') continue;
+
+		BatchEntry *entry = add_entry(list, fields[0], defaults);
+		if (!entry) break;
+		if (n > 1) entry->dither = atoi(fields[1]);
+		if (n > 2) entry->machine = atoi(fields[2]);
+		if (n > 3) {
+			free(entry->palette_name);
+			entry->palette_name = strcmp(fields[3], "-") == 0 ? NULL : copy_string(fields[3]);
+		}
+		entry->prefix = n > 4 ? copy_string(fields[4]) : default_prefix(defaults->outputs.prefix, fields[0]);
+		if (entry->dither < 0 || entry->dither > DITHER_MODE_MAX || entry->machine < 0 || entry->machine > 4) {
+			fprintf(stderr, "Erreur: %s:%d : valeur de -d ou -m invalide.\n", filename, line_number);
+			fclose(f);
+			return -1;
+		}
+	}
+	fclose(f);
+	return 0;
+}
+
+static void free_list(BatchList *list)
+{
+	for (int i = 0; i < list->count; i++) {
+		free(list->entries[i].input);
+		free(list->entries[i].prefix);
+		free(list->entries[i].palette_name);
+	}
+	free(list->entries);
+}
+
+static void deque_init(WorkDeque *deque)
+{
+	platform_mutex_init(&deque->lock);
+	deque->capacity = 16;
+	deque->tasks = malloc(deque->capacity * sizeof(int));
+	deque->top = deque->bottom = 0;
+}
+
+static void deque_free(WorkDeque *deque)
+{
+	platform_mutex_destroy(&deque->lock);
+	free(deque->tasks);
+}
+
+static int deque_push(WorkDeque *deque, int task)
+{
+	platform_mutex_lock(&deque->lock);
+	if (deque->bottom - deque->top == deque->capacity) {
+		int *tasks = malloc(deque->capacity * 2 * sizeof(int));
+		if (!tasks) {
+			platform_mutex_unlock(&deque->lock);
+			return -1;
+		}
+		for (int i = deque->top; i < deque->bottom; i++)
+			tasks[i - deque->top] = deque->tasks[i % deque->capacity];
+		free(deque->tasks);
+		deque->tasks = tasks;
+		deque->bottom -= deque->top;
+		deque->top = 0;
+		deque->capacity *= 2;
+	}
+	deque->tasks[deque->bottom % deque->capacity] = task;
+	deque->bottom++;
+	platform_mutex_unlock(&deque->lock);
+	return 0;
+}
+
+// -1 si la file est vide
+static int deque_pop(WorkDeque *deque)
+{
+	int task = -1;
+	platform_mutex_lock(&deque->lock);
+	if (deque->bottom > deque->top) {
+		deque->bottom--;
+		task = deque->tasks[deque->bottom % deque->capacity];
+	}
+	platform_mutex_unlock(&deque->lock);
+	return task;
+}
+
+static int deque_steal(WorkDeque *deque)
+{
+	int task = -1;
+	platform_mutex_lock(&deque->lock);
+	if (deque->bottom > deque->top) {
+		task = deque->tasks[deque->top % deque->capacity];
+		deque->top++;
+	}
+	platform_mutex_unlock(&deque->lock);
+	return task;
+}
+
+static void finish_entry(BatchScheduler *scheduler, BatchEntry *entry)
+{
+	platform_mutex_lock(&scheduler->lock);
+	scheduler->in_flight -= entry->estimate;
+	scheduler->remaining--;
+	scheduler->done++;
+	int done = scheduler->done;
+	platform_cond_broadcast(&scheduler->wake);
+	platform_mutex_unlock(&scheduler->lock);
+
+	if (entry->status == 0)
+		printf("[%d/%d] %s : %.1f ms (décodage %.1f, attente %.1f, traitement %.1f)\n", done,
+			   scheduler->list->count, entry->input, entry->latency_ms, entry->decode_ms, entry->wait_ms,
+			   entry->process_ms);
+	else
+		printf("[%d/%d] %s : ECHEC\n", done, scheduler->list->count, entry->input);
+}
+
+static void run_decode(BatchWorker *worker, int index)
+{
+	BatchScheduler *scheduler = worker->scheduler;
+	BatchEntry *entry = &scheduler->list->entries[index];
+
+	entry->started_at = platform_time_ms();
+	if (clash_decode(entry->input, scheduler->cache, &entry->image) != 0) {
+		entry->status = -1;
+		finish_entry(scheduler, entry);
+		return;
+	}
+	entry->decoded_at = platform_time_ms();
+	entry->decode_ms = entry->decoded_at - entry->started_at;
+
+	if (deque_push(&scheduler->deques[worker->id], index) != 0) {
+		clash_decoded_free(&entry->image);
+		entry->status = -1;
+		finish_entry(scheduler, entry);
+		return;
+	}
+	platform_mutex_lock(&scheduler->lock);
+	scheduler->pending++;
+	platform_cond_broadcast(&scheduler->wake);
+	platform_mutex_unlock(&scheduler->lock);
+}
+
+static void run_process(BatchWorker *worker, int index)
+{
+	BatchScheduler *scheduler = worker->scheduler;
+	BatchEntry *entry = &scheduler->list->entries[index];
+
+	ClashJob job;
+	job.input = entry->input;
+	job.dither = entry->dither;
+	job.machine = entry->machine;
+	job.palette_name = entry->palette_name;
+	job.palettes = scheduler->palettes;
+	job.outputs.prefix = entry->prefix;
+	job.outputs.selected = scheduler->outputs;
+	job.outputs.stdout_stream = NULL;
+	job.cache = scheduler->cache;
+	job.threads = 1;
+	job.shared_palette = NULL;
+	job.dither_options = scheduler->dither_options;
+
+	double start = platform_time_ms();
+	entry->wait_ms = start - entry->decoded_at;
+	entry->status = clash_process(&job, &entry->image, &worker->scratch);
+	double end = platform_time_ms();
+	entry->process_ms = end - start;
+	entry->latency_ms = end - entry->started_at;
+
+	clash_decoded_free(&entry->image);
+	worker->processed++;
+	finish_entry(scheduler, entry);
+}
+
+static void *batch_worker(void *arg)
+{
+	BatchWorker *worker = arg;
+	BatchScheduler *scheduler = worker->scheduler;
+
+	for (;;) {
+		// 1. Traiter une image déjà décodée : la sienne d'abord, sinon en voler une
+		int task = deque_pop(&scheduler->deques[worker->id]);
+		for (int i = 1; task < 0 && i < scheduler->threads; i++) {
+			task = deque_steal(&scheduler->deques[(worker->id + i) % scheduler->threads]);
+			if (task >= 0) worker->stolen++;
+		}
+		if (task >= 0) {
+			platform_mutex_lock(&scheduler->lock);
+			scheduler->pending--;
+			platform_mutex_unlock(&scheduler->lock);
+			run_process(worker, task);
+			continue;
+		}
+
+		// 2. Sinon décoder l'image suivante si le budget mémoire le permet
+		platform_mutex_lock(&scheduler->lock);
+		if (scheduler->remaining == 0) {
+			platform_mutex_unlock(&scheduler->lock);
+			break;
+		}
+		if (scheduler->pending > 0) {
+			// une tâche a été poussée entre-temps
+			platform_mutex_unlock(&scheduler->lock);
+			continue;
+		}
+		if (scheduler->next_decode < scheduler->list->count) {
+			int index = scheduler->next_decode;
+			long long estimate = scheduler->list->entries[index].estimate;
+			// une image plus grosse que le budget passe seule
+			if (scheduler->in_flight == 0 || scheduler->in_flight + estimate <= scheduler->budget) {
+				scheduler->next_decode++;
+				scheduler->in_flight += estimate;
+				platform_mutex_unlock(&scheduler->lock);
+				run_decode(worker, index);
+				continue;
+			}
+		}
+
+		// 3. Rien à faire : attendre une tâche, une libération de budget ou la fin
+		platform_cond_wait(&scheduler->wake, &scheduler->lock);
+		platform_mutex_unlock(&scheduler->lock);
+	}
+	return NULL;
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+	return x < y ? -1 : x > y;
+}
+
+static void print_summary(const BatchList *list, const BatchWorker *workers, int threads, double wall_ms)
+{
+	int ok = 0;
+	long long input_bytes = 0;
+	double decode = 0, process = 0, wait = 0, latency = 0;
+	double *latencies = malloc((list->count + 1) * sizeof(double));
+	for (int i = 0; i < list->count; i++) {
+		const BatchEntry *entry = &list->entries[i];
+		if (entry->status != 0) continue;
+		latencies[ok++] = entry->latency_ms;
+		latency += entry->latency_ms;
+		decode += entry->decode_ms;
+		process += entry->process_ms;
+		wait += entry->wait_ms;
+		long long size = platform_file_size(entry->input);
+		if (size > 0) input_bytes += size;
+	}
+
+	printf("\n--- Bilan batch ---\n");
+	printf("Images : %d traitées, %d en échec, %d threads\n", ok, list->count - ok, threads);
+	printf("Durée totale : %.1f ms\n", wall_ms);
+	if (ok > 0 && wall_ms > 0) {
+		qsort(latencies, ok, sizeof(double), compare_doubles);
+		printf("Débit : %.2f images/s, %.2f Mo/s en entrée\n", ok * 1000.0 / wall_ms,
+			   input_bytes / (1024.0 * 1024.0) / (wall_ms / 1000.0));
+		printf("Latence par image (ms) : moyenne %.1f, médiane %.1f, p95 %.1f, max %.1f\n",
+			   latency / ok, latencies[(ok - 1) / 2], latencies[(int)ceil(ok * 0.95) - 1],
+			   latencies[ok - 1]);
+		printf("Moyennes (ms) : décodage %.1f, attente %.1f, traitement %.1f\n", decode / ok, wait / ok,
+			   process / ok);
+	}
+	for (int i = 0; i < threads; i++)
+		printf("Thread %d : %d images traitées dont %d volées\n", i, workers[i].processed, workers[i].stolen);
+	free(latencies);
+}
+
+// Répertoire (images triées par nom) ou manifeste
+static int load_list(BatchList *list, const char *source, const ClashJob *defaults)
+{
+	if (platform_is_directory(source)) {
+		DirectoryScan scan = {list, source, defaults};
+		if (platform_list_directory(source, add_directory_file, &scan) != 0) {
+			fprintf(stderr, "Erreur: Impossible de lire le répertoire '%s'.\n", source);
+			return -1;
+		}
+		qsort(list->entries, list->count, sizeof(BatchEntry), compare_entries);
+	} else if (load_manifest(list, source, defaults) != 0) {
+		free_list(list);
+		return -1;
+	}
+	if (list->count == 0) {
+		fprintf(stderr, "Erreur: Aucune image à traiter dans '%s'.\n", source);
+		free_list(list);
+		return -1;
+	}
+	return 0;
+}
+
+int clash_batch(const char *source, const ClashJob *defaults, int threads, long long memory_budget)
+{
+	BatchList list = {NULL, 0, 0};
+	if (load_list(&list, source, defaults) != 0) return -1;
+
+	// Estimation mémoire à partir de l'en-tête : fichier compressé + pixels décodés
+	for (int i = 0; i < list.count; i++) {
+		BatchEntry *entry = &list.entries[i];
+		int w = 0, h = 0, comp = 0;
+		long long size = platform_file_size(entry->input);
+		entry->estimate = size > 0 ? size : 0;
+		if (stbi_info(entry->input, &w, &h, &comp)) entry->estimate += (long long)w * h * COLOR_COMP;
+	}
+
+	if (threads > list.count) threads = list.count;
+	clash_verbose = 0;
+
+	BatchScheduler scheduler;
+	memset(&scheduler, 0, sizeof(scheduler));
+	scheduler.list = &list;
+	scheduler.threads = threads;
+	scheduler.outputs = defaults->outputs.selected;
+	scheduler.cache = defaults->cache;
+	scheduler.palettes = defaults->palettes;
+	scheduler.dither_options = defaults->dither_options;
+	scheduler.remaining = list.count;
+	scheduler.budget = memory_budget;
+	platform_mutex_init(&scheduler.lock);
+	platform_cond_init(&scheduler.wake);
+	scheduler.deques = malloc(threads * sizeof(WorkDeque));
+	BatchWorker *workers = calloc(threads, sizeof(BatchWorker));
+	platform_thread *handles = malloc(threads * sizeof(platform_thread));
+	if (!scheduler.deques || !workers || !handles) {
+		fprintf(stderr, "Erreur: Impossible d'allouer le pool de threads.\n");
+		free(scheduler.deques);
+		free(workers);
+		free(handles);
+		free_list(&list);
+		return -1;
+	}
+
+	printf("Batch : %d images, %d threads, budget mémoire %lld Mo\n", list.count, threads, memory_budget >> 20);
+	for (int i = 0; i < threads; i++) deque_init(&scheduler.deques[i]);
+	int started = 0;
+	for (int i = 0; i < threads; i++) {
+		workers[i].scheduler = &scheduler;
+		workers[i].id = i;
+		if (clash_scratch_init(&workers[i].scratch) != 0) break;
+		started++;
+	}
+
+	double start = platform_time_ms();
+	int running = 0;
+	scheduler.threads = started;
+	for (int i = 0; i < started; i++) {
+		if (platform_thread_create(&handles[i], batch_worker, &workers[i]) != 0) break;
+		running++;
+	}
+	if (running == 0 && started > 0) batch_worker(&workers[0]);
+	for (int i = 0; i < running; i++) platform_thread_join(handles[i]);
+	double wall_ms = platform_time_ms() - start;
+
+	print_summary(&list, workers, started, wall_ms);
+
+	int failures = 0;
+	for (int i = 0; i < list.count; i++)
+		if (list.entries[i].status != 0) failures++;
+
+	for (int i = 0; i < threads; i++) {
+		if (i < started) clash_scratch_free(&workers[i].scratch);
+		deque_free(&scheduler.deques[i]);
+	}
+	platform_cond_destroy(&scheduler.wake);
+	platform_mutex_destroy(&scheduler.lock);
+	free(scheduler.deques);
+	free(workers);
+	free(handles);
+	free_list(&list);
+	return failures == 0 && started > 0 ? 0 : -1;
+}
+
+/*******************************************************************************
+ * Mode --set : une seule palette pour un jeu d'images (diaporama MO6), sans
+ * reprogrammer la palette ni scintiller d'une image à l'autre.
+ *
+ * 1. Les threads décodent et cadrent les images, chacun cumulant leurs cases
+ *    Thomson dans son propre histogramme ; seul le cadrage est conservé.
+ * 2. Les histogrammes fusionnés donnent une palette exoquant unique.
+ * 3. Les threads trament chaque image avec cette palette ; les MAP sont
+ *    regroupés dans une seule k7, tous avec le même pied TO-SNAP.
+ *******************************************************************************/
+
+#define SET_MAX_IMAGES 999 // CLASH001.MAP à CLASH999.MAP dans la k7
+
+typedef struct {
+	BatchList *list;
+	const ClashJob *defaults;
+	const Color *palette; // NULL pendant le cadrage, palette commune pendant le tramage
+	IntVector *maps;	  // MAP de chaque image tramée
+	platform_mutex lock;
+	int next;
+} SetScheduler;
+
+typedef struct {
+	SetScheduler *scheduler;
+	ClashScratch scratch;
+	uint64_t *histogram; // NUM_THOMSON_COLORS * 4 : cases des images cadrées par ce thread
+} SetWorker;
+
+static int next_set_entry(SetScheduler *scheduler)
+{
+	platform_mutex_lock(&scheduler->lock);
+	int index = scheduler->next < scheduler->list->count ? scheduler->next++ : -1;
+	platform_mutex_unlock(&scheduler->lock);
+	return index;
+}
+
+static void *set_worker(void *arg)
+{
+	SetWorker *worker = arg;
+	SetScheduler *scheduler = worker->scheduler;
+	for (int index = next_set_entry(scheduler); index >= 0; index = next_set_entry(scheduler)) {
+		BatchEntry *entry = &scheduler->list->entries[index];
+		if (entry->status != 0) continue;
+
+		// Le jeu est tramé pour MO6 : -m et -p du manifeste n'ont pas cours, la k7 est commune
+		ClashJob job = *scheduler->defaults;
+		job.input = entry->input;
+		job.dither = entry->dither;
+		job.machine = 1;
+		job.palette_name = NULL;
+		job.outputs.prefix = entry->prefix;
+		job.outputs.selected &= ~OUT_K7;
+		job.outputs.stdout_stream = NULL;
+		job.threads = 1;
+		job.shared_palette = scheduler->palette;
+
+		double start = platform_time_ms();
+		if (!scheduler->palette) {
+			if (clash_decode(entry->input, job.cache, &entry->image) != 0 ||
+				clash_set_frame(&job, &entry->image, &worker->scratch, worker->histogram) != 0) {
+				clash_decoded_free(&entry->image);
+				entry->status = -1;
+				printf("%s : ECHEC\n", entry->input);
+			}
+			entry->decode_ms = platform_time_ms() - start;
+			continue;
+		}
+		entry->status = clash_process(&job, &entry->image, &worker->scratch);
+		clash_decoded_free(&entry->image);
+		entry->process_ms = platform_time_ms() - start;
+		if (entry->status != 0) {
+			printf("%s : ECHEC\n", entry->input);
+			continue;
+		}
+		IntVector *map = &scheduler->maps[index];
+		for (size_t i = 0; i < worker->scratch.map.size; i++) push_back(map, worker->scratch.map.data[i]);
+		printf("%s : %.1f ms (cadrage %.1f, tramage %.1f)\n", entry->input, entry->decode_ms + entry->process_ms,
+			   entry->decode_ms, entry->process_ms);
+	}
+	return NULL;
+}
+
+static void run_set_phase(SetScheduler *scheduler, SetWorker *workers, platform_thread *handles, int threads)
+{
+	scheduler->next = 0;
+	int running = 0;
+	for (int i = 0; i < threads; i++) {
+		if (platform_thread_create(&handles[i], set_worker, &workers[i]) != 0) break;
+		running++;
+	}
+	if (running == 0) set_worker(&workers[0]);
+	for (int i = 0; i < running; i++) platform_thread_join(handles[i]);
+}
+
+int clash_set(const char *source, const ClashJob *defaults, int threads)
+{
+	BatchList list = {NULL, 0, 0};
+	if (load_list(&list, source, defaults) != 0) return -1;
+	if (list.count > SET_MAX_IMAGES) {
+		fprintf(stderr, "Erreur: %d images dans '%s', le mode --set en accepte %d au plus.\n", list.count, source,
+				SET_MAX_IMAGES);
+		free_list(&list);
+		return -1;
+	}
+	if (threads > list.count) threads = list.count;
+	clash_verbose = 0;
+
+	SetScheduler scheduler;
+	memset(&scheduler, 0, sizeof(scheduler));
+	scheduler.list = &list;
+	scheduler.defaults = defaults;
+	scheduler.maps = calloc(list.count, sizeof(IntVector));
+	platform_mutex_init(&scheduler.lock);
+	SetWorker *workers = calloc(threads, sizeof(SetWorker));
+	platform_thread *handles = malloc(threads * sizeof(platform_thread));
+	int started = 0;
+	if (scheduler.maps && workers && handles) {
+		for (; started < threads; started++) {
+			workers[started].scheduler = &scheduler;
+			workers[started].histogram = calloc(NUM_THOMSON_COLORS * 4, sizeof(uint64_t));
+			if (!workers[started].histogram) break;
+			if (clash_scratch_init(&workers[started].scratch) != 0) {
+				free(workers[started].histogram);
+				break;
+			}
+		}
+	}
+	if (started == 0) {
+		fprintf(stderr, "Erreur: Impossible d'allouer le pool de threads.\n");
+		free(scheduler.maps);
+		free(workers);
+		free(handles);
+		platform_mutex_destroy(&scheduler.lock);
+		free_list(&list);
+		return -1;
+	}
+	for (int i = 0; i < list.count; i++) init_vector(&scheduler.maps[i]);
+
+	printf("Set : %d images, %d threads\n", list.count, started);
+	double start = platform_time_ms();
+
+	// 1. Cadrage et histogrammes
+	run_set_phase(&scheduler, workers, handles, started);
+
+	// 2. Palette commune sur l'histogramme fusionné
+	uint64_t *merged = workers[0].histogram;
+	for (int w = 1; w < started; w++)
+		for (int i = 0; i < NUM_THOMSON_COLORS * 4; i++) merged[i] += workers[w].histogram[i];
+	Color palette[PALETTE_SIZE];
+	clash_histogram_palette(merged, workers[0].scratch.thomson_palette, palette);
+	printf("Palette commune :");
+	for (int i = 0; i < PALETTE_SIZE; i++) printf(" %03X", palette[i].thomson_idx);
+	printf("\n");
+
+	// 3. Tramage avec la palette commune, puis une seule k7
+	scheduler.palette = palette;
+	run_set_phase(&scheduler, workers, handles, started);
+
+	IntVector *maps = malloc(list.count * sizeof(IntVector));
+	int ok = 0;
+	for (int i = 0; i < list.count; i++)
+		if (list.entries[i].status == 0 && maps) maps[ok++] = scheduler.maps[i];
+	int k7_status = maps ? clash_write_set_k7(&defaults->outputs, maps, ok) : -1;
+	free(maps);
+
+	printf("\n--- Bilan set ---\n");
+	printf("Images : %d tramées, %d en échec, durée totale %.1f ms\n", ok, list.count - ok, platform_time_ms() - start);
+
+	for (int i = 0; i < list.count; i++) {
+		free_vector(&scheduler.maps[i]);
+		clash_decoded_free(&list.entries[i].image);
+	}
+	for (int i = 0; i < started; i++) {
+		clash_scratch_free(&workers[i].scratch);
+		free(workers[i].histogram);
+	}
+	platform_mutex_destroy(&scheduler.lock);
+	free(scheduler.maps);
+	free(workers);
+	free(handles);
+	free_list(&list);
+	return ok == list.count && k7_status == 0 ? 0 : -1;
+}
@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "cache.h"
+#include "platform.h"
+
+// À incrémenter quand le contenu d'une étape change (redimensionnement, dithering...)
+#define CACHE_VERSION 4
+#define CACHE_MAGIC "CLSH"
+
+typedef struct {
+	char magic[4];
+	uint32_t version;
+	uint64_t key;
+	uint64_t size; // taille des données qui suivent l'en-tête
+} CacheHeader;
+
+static const char *stage_names[CACHE_STAGES] = {"frame", "palette", "result"};
+
+uint64_t cache_hash(uint64_t hash, const void *data, size_t size)
+{
+	const uint8_t *bytes = data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+uint64_t cache_hash_int(uint64_t hash, int value)
+{
+	return cache_hash(hash, &value, sizeof(value));
+}
+
+uint64_t cache_hash_string(uint64_t hash, const char *s)
+{
+	// Le zéro final distingue NULL de "" et sépare les champs successifs
+	return s ? cache_hash(hash, s, strlen(s) + 1) : cache_hash_int(hash, -1);
+}
+
+static void entry_path(const ClashCache *cache, int stage, uint64_t key, char *path, size_t path_size)
+{
+	snprintf(path, path_size, "%s/%016llx.%s", cache->directory, (unsigned long long)key, stage_names[stage]);
+}
+
+// Seuls les fichiers <hash>.<étape> appartiennent au cache (les .tmp en cours d'écriture sont ignorés)
+static int is_entry_name(const char *name)
+{
+	const char *dot = strchr(name, '.');
+	if (!dot || dot - name != 16) return 0;
+	for (int i = 0; i < CACHE_STAGES; i++)
+		if (strcmp(dot + 1, stage_names[i]) == 0) return 1;
+	return 0;
+}
+
+typedef struct {
+	char *name;
+	long long size, mtime;
+} CacheFile;
+
+typedef struct {
+	const ClashCache *cache;
+	CacheFile *files;
+	int count, capacity;
+	long long total;
+} CacheScan;
+
+static void scan_callback(const char *name, void *context)
+{
+	CacheScan *scan = context;
+	if (!is_entry_name(name)) return;
+	if (scan->count == scan->capacity) {
+		int capacity = scan->capacity ? scan->capacity * 2 : 64;
+		CacheFile *files = realloc(scan->files, capacity * sizeof(CacheFile));
+		if (!files) return;
+		scan->files = files;
+		scan->capacity = capacity;
+	}
+	char path[4096];
+	snprintf(path, sizeof(path), "%s/%s", scan->cache->directory, name);
+	CacheFile *file = &scan->files[scan->count];
+	file->size = platform_file_size(path);
+	file->mtime = platform_file_mtime_ns(path);
+	if (file->size < 0) return;
+	file->name = malloc(strlen(name) + 1);
+	if (!file->name) return;
+	strcpy(file->name, name);
+	scan->total += file->size;
+	scan->count++;
+}
+
+static int compare_mtime(const void *a, const void *b)
+{
+	const CacheFile *x = a, *y = b;
+	return x->mtime < y->mtime ? -1 : x->mtime > y->mtime;
+}
+
+static void free_scan(CacheScan *scan)
+{
+	for (int i = 0; i < scan->count; i++) free(scan->files[i].name);
+	free(scan->files);
+}
+
+// Date de l'écriture ou de la lecture d'une entrée : l'horloge en nanosecondes, au moins 1 µs après la
+// précédente (au-dessus des 100 ns de NTFS), pour qu'aucun accès de ce processus ne soit ex aequo avec
+// un autre, même si l'horloge des fichiers avance par à-coups
+static void stamp_entry(ClashCache *cache, const char *path)
+{
+	platform_mutex_lock(&cache->lock);
+	long long now = platform_clock_ns(), stamp = cache->last_stamp + 1000;
+	cache->last_stamp = now > stamp ? now : stamp;
+	stamp = cache->last_stamp;
+	platform_mutex_unlock(&cache->lock);
+	platform_set_file_mtime_ns(path, stamp);
+}
+
+// LRU : les lectures rafraîchissent la date de modification, on supprime les plus anciennes
+// jusqu'à redescendre à 90 % de la limite. Appelée avec le verrou pris.
+static void evict(ClashCache *cache)
+{
+	CacheScan scan = {cache, NULL, 0, 0, 0};
+	platform_list_directory(cache->directory, scan_callback, &scan);
+	qsort(scan.files, scan.count, sizeof(CacheFile), compare_mtime);
+	long long target = cache->max_bytes / 10 * 9;
+	for (int i = 0; i < scan.count && scan.total > target; i++) {
+		char path[4096];
+		snprintf(path, sizeof(path), "%s/%s", cache->directory, scan.files[i].name);
+		if (remove(path) == 0) {
+			scan.total -= scan.files[i].size;
+			cache->evicted++;
+		}
+	}
+	cache->total_bytes = scan.total;
+	free_scan(&scan);
+}
+
+int cache_open(ClashCache *cache, const char *directory, long long max_bytes)
+{
+	memset(cache, 0, sizeof(*cache));
+	if (platform_make_directory(directory) != 0) {
+		fprintf(stderr, "Erreur: Impossible de créer le répertoire de cache '%s'.\n", directory);
+		return -1;
+	}
+	cache->directory = malloc(strlen(directory) + 1);
+	if (!cache->directory) return -1;
+	strcpy(cache->directory, directory);
+	cache->max_bytes = max_bytes;
+	platform_mutex_init(&cache->lock);
+
+	CacheScan scan = {cache, NULL, 0, 0, 0};
+	platform_list_directory(cache->directory, scan_callback, &scan);
+	cache->total_bytes = scan.total;
+	free_scan(&scan);
+	if (cache->max_bytes > 0 && cache->total_bytes > cache->max_bytes) evict(cache);
+	return 0;
+}
+
+void cache_close(ClashCache *cache)
+{
+	if (!cache->directory) return;
+	platform_mutex_destroy(&cache->lock);
+	free(cache->directory);
+	cache->directory = NULL;
+}
+
+static size_t chunks_size(const CacheChunk *chunks, int count)
+{
+	size_t size = 0;
+	for (int i = 0; i < count; i++) size += chunks[i].size;
+	return size;
+}
+
+int cache_load(ClashCache *cache, int stage, uint64_t key, const CacheChunk *chunks, int count)
+{
+	char path[4096];
+	entry_path(cache, stage, key, path, sizeof(path));
+
+	int found = 0;
+	FILE *f = fopen(path, "rb");
+	if (f) {
+		CacheHeader header;
+		found = fread(&header, sizeof(header), 1, f) == 1 && memcmp(header.magic, CACHE_MAGIC, 4) == 0 &&
+				header.version == CACHE_VERSION && header.key == key &&
+				header.size == chunks_size(chunks, count);
+		for (int i = 0; i < count && found; i++)
+			found = fread(chunks[i].data, 1, chunks[i].size, f) == chunks[i].size;
+		fclose(f);
+	}
+	if (found) stamp_entry(cache, path);
+
+	platform_mutex_lock(&cache->lock);
+	if (found)
+		cache->hits[stage]++;
+	else
+		cache->misses[stage]++;
+	platform_mutex_unlock(&cache->lock);
+	return found ? 0 : -1;
+}
+
+void cache_store(ClashCache *cache, int stage, uint64_t key, const CacheChunk *chunks, int count)
+{
+	char path[4096], temp[4160];
+	entry_path(cache, stage, key, path, sizeof(path));
+
+	platform_mutex_lock(&cache->lock);
+	unsigned serial = cache->temp_counter++;
+	platform_mutex_unlock(&cache->lock);
+	// Écriture dans un fichier temporaire puis renommage : un lecteur ne voit jamais d'entrée partielle
+	snprintf(temp, sizeof(temp), "%s.%d_%u.tmp", path, platform_process_id(), serial);
+
+	FILE *f = fopen(temp, "wb");
+	if (!f) return;
+	CacheHeader header;
+	memcpy(header.magic, CACHE_MAGIC, 4);
+	header.version = CACHE_VERSION;
+	header.key = key;
+	header.size = chunks_size(chunks, count);
+	int ok = fwrite(&header, sizeof(header), 1, f) == 1;
+	for (int i = 0; i < count && ok; i++) ok = fwrite(chunks[i].data, 1, chunks[i].size, f) == chunks[i].size;
+	ok = fclose(f) == 0 && ok;
+	if (!ok || rename(temp, path) != 0) {
+		// Sous Windows rename échoue si un autre worker a déjà produit la même entrée
+		remove(temp);
+		return;
+	}
+	stamp_entry(cache, path);
+
+	platform_mutex_lock(&cache->lock);
+	cache->total_bytes += (long long)(sizeof(header) + header.size);
+	if (cache->max_bytes > 0 && cache->total_bytes > cache->max_bytes) evict(cache);
+	platform_mutex_unlock(&cache->lock);
+}
+
+void cache_print_stats(ClashCache *cache)
+{
+	platform_mutex_lock(&cache->lock);
+	printf("Cache %s :", cache->directory);
+	for (int i = 0; i < CACHE_STAGES; i++)
+		printf(" %s %d/%d", stage_names[i], cache->hits[i], cache->hits[i] + cache->misses[i]);
+	printf(" (succès/accès), %.1f Mo", cache->total_bytes / (1024.0 * 1024.0));
+	if (cache->max_bytes > 0) printf(" sur %lld Mo", cache->max_bytes >> 20);
+	if (cache->evicted > 0) printf(", %d entrées évincées", cache->evicted);
+	printf("\n");
+	platform_mutex_unlock(&cache->lock);
+}
@@ -0,0 +1,46 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "platform.h"
+
+// Cache disque des étapes de conversion, indexé par un hash FNV-1a 64 bits
+// des octets source et des options qui influencent l'étape.
+#define CACHE_HASH_INIT 0xcbf29ce484222325ULL
+
+enum {
+	CACHE_FRAME,   // image cadrée 320x200 (dépend uniquement de la source)
+	CACHE_PALETTE, // palette exoquant ramenée aux 4096 couleurs (-m 1 et -m 3)
+	CACHE_RESULT,  // palette, rendu RGB et pré-tramage exoquant : de quoi produire tous les artefacts
+	CACHE_STAGES
+};
+
+typedef struct {
+	void *data;
+	size_t size;
+} CacheChunk;
+
+typedef struct {
+	char *directory;
+	long long max_bytes;   // 0 = taille illimitée
+	long long total_bytes; // taille des entrées connue de ce processus
+	int hits[CACHE_STAGES], misses[CACHE_STAGES];
+	int evicted;
+	unsigned temp_counter;
+	long long last_stamp; // dernière date donnée à une entrée (ns), strictement croissante dans le processus
+	platform_mutex lock; // les workers du mode batch partagent le cache
+} ClashCache;
+
+uint64_t cache_hash(uint64_t hash, const void *data, size_t size);
+uint64_t cache_hash_int(uint64_t hash, int value);
+uint64_t cache_hash_string(uint64_t hash, const char *s);
+
+int cache_open(ClashCache *cache, const char *directory, long long max_bytes);
+void cache_close(ClashCache *cache);
+// Remplit les morceaux si l'entrée existe avec exactement cette taille, 0 si trouvée
+int cache_load(ClashCache *cache, int stage, uint64_t key, const CacheChunk *chunks, int count);
+void cache_store(ClashCache *cache, int stage, uint64_t key, const CacheChunk *chunks, int count);
+void cache_print_stats(ClashCache *cache);
+
+#endif // !CACHE_H
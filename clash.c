@@ -4,26 +4,42 @@
 #include <stdbool.h>
 #include <getopt.h>
 #include <string.h>
-// #define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
-// #define STB_IMAGE_WRITE_IMPLEMENTATION
-#include <stb_image_write.h>
-// #define STB_IMAGE_RESIZE2_IMPLEMENTATION
-#include <stb_image_resize2.h>
-#include <exoquant.h>
 #include "global.h"
-#include "thomson.h"
-#include "image.h"
-#include "dither.h"
-#include "palettes.h"
-#include "matrix.h"
-#include "k7.h"
-
+#include "clash.h"
+#include "platform.h"
+#include "palette_select.h"
+#include "metric.h"
+#include "cpu.h"
+#include "ordered.h"
+
+
+static const struct option long_options[] = {{"out", required_argument, NULL, 'O'},
+											 {"prefix", required_argument, NULL, 'o'},
+											 {"batch", required_argument, NULL, 'B'},
+											 {"set", required_argument, NULL, 'S'},
+											 {"jobs", required_argument, NULL, 'j'},
+											 {"mem-budget", required_argument, NULL, 'M'},
+											 {"cache", required_argument, NULL, 'C'},
+											 {"cache-max", required_argument, NULL, 'X'},
+											 {"palette-lib", required_argument, NULL, 'L'},
+											 {"memo", required_argument, NULL, 'E'},
+											 {"bench", required_argument, NULL, 'N'},
+											 {"pairs", required_argument, NULL, 'P'},
+											 {"fast", optional_argument, NULL, 'F'},
+											 {"distance-cache", no_argument, NULL, 'K'},
+											 {"metric", required_argument, NULL, 'T'},
+											 {"linear", no_argument, NULL, 'Y'},
+											 {"cpu", required_argument, NULL, 'U'},
+											 {"cpu-info", no_argument, NULL, 'I'},
+											 {NULL, 0, NULL, 0}};
 
 void usage()
 {
 	fprintf(stderr, "\n");
-	fprintf(stderr, "Usage: clash <nom_fichier> [-d<chiffre>] [-m<chiffre>]\n");
+	fprintf(stderr, "Usage: clash <nom_fichier|-> [-d<chiffre>] [-m<chiffre>] [-p<chaine>] [-o<prefixe>] "
+					"[--out <liste>]\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, "- a la place du nom de fichier : lecture de l'image sur l'entree standard\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, "-d<chiffre> : matrice de dithering\n");
 	fprintf(stderr, "  0=Standard\n");
@@ -37,71 +53,93 @@ void usage()
 	fprintf(stderr, "  8=Atkinson\n");
 	fprintf(stderr, "  9=Vertical\n");
 	fprintf(stderr, "  10=Ostromoukhov\n");
+	fprintf(stderr, "  11=Ordonne Bayer 8x8 (sans diffusion, blocs en parallele)\n");
+	fprintf(stderr, "  12=Ordonne bruit bleu 32x32 (sans diffusion, blocs en parallele)\n");
+	fprintf(stderr, "  13=Diffusion par points de Knuth (classes de blocs, en parallele)\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, "-p<chaine> : palette prédéfinie\n");
+	fprintf(stderr, "  auto[:K] : note toutes les palettes sur l'histogramme de l'image et trame les K meilleures "
+					"(defaut: 5)\n");
+	fprintf(stderr, "  nearest[:K] : trame les K palettes les plus proches de la palette exoquant de l'image "
+					"(defaut: 3)\n");
+	fprintf(stderr, "--palette-lib <csv|bin> : palettes de -p lues dans un CSV au format palettes_hex.csv\n");
+	fprintf(stderr, "  au lieu des palettes compilees ; le CSV est mis en cache dans <csv>.bin\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, "-m<chiffre> : machine\n");
 	fprintf(stderr, "  0=MO5\n");
 	fprintf(stderr, "  1=MO6\n");
 	fprintf(stderr, "  2=MO5 pre-traitement exoquant dithering\n");
 	fprintf(stderr, "  3=MO6 pre-traitement exoquant dithering\n");
-}
-
-static void find_exo_palette(unsigned char *exo_palette, uint8_t *framed_image, int hf, int wf) {
-    exq_data *pExqPalette;
-    pExqPalette = exq_init();
-    uint8_t *exo_image_feed = convert_rgb_to_rgba(framed_image, wf, hf);
-    exq_feed(pExqPalette, exo_image_feed, wf * hf);
-    exq_quantize_hq(pExqPalette, PALETTE_SIZE);
-    exq_get_palette(pExqPalette, exo_palette, PALETTE_SIZE);
-    exq_free(pExqPalette);
-    free(exo_image_feed);
-}
-
-static void quantize_exo_to_4096(unsigned char *exo_palette, Color *palette, Color *thomson_palette) {
-    Color optimal_palette[PALETTE_SIZE];
-    for (int i = 0; i < PALETTE_SIZE; i++) {
-        optimal_palette[i].r = exo_palette[i * 4];
-        optimal_palette[i].g = exo_palette[i * 4 + 1];
-        optimal_palette[i].b = exo_palette[i * 4 + 2];
-    }
-    find_closest_thomson_palette(optimal_palette, thomson_palette, palette);
-    for (int i = 0; i < PALETTE_SIZE; i++) {
-        exo_palette[i * 4] = palette[i].r;
-        exo_palette[i * 4 + 1] = palette[i].g;
-        exo_palette[i * 4 + 2] = palette[i].b;
-        exo_palette[i * 4 + 3] = 255;
-    }
+	fprintf(stderr, "  4=MO6 palette exoquant optimisee pour la contrainte 2 couleurs par bloc de 8 pixels\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, "--memo <off|exact|fast> : memoisation du couple de couleurs par bloc (defaut: exact)\n");
+	fprintf(stderr, "  exact : blocs aux 8 couleurs effectives identiques, rendu inchange\n");
+	fprintf(stderr, "  fast : cle 5-6-5 bits, les blocs presque identiques partagent leur couple\n");
+	fprintf(stderr, "--pairs <exhaustive|bound|pca> : recherche du couple de couleurs par bloc (defaut: exhaustive)\n");
+	fprintf(stderr, "  bound : separation et evaluation, meme rendu en abandonnant les couples perdants\n");
+	fprintf(stderr, "  pca : couples encadrant le bloc sur l'axe principal de ses couleurs (approche)\n");
+	fprintf(stderr, "--fast[=K] : apercu, couples pris parmi les K couleurs les plus proches de chaque pixel\n");
+	fprintf(stderr, "  K de 2 a 4 (defaut: 3), erreur un peu plus elevee que la recherche exhaustive\n");
+	fprintf(stderr, "--distance-cache : distances couleur/palette lues dans un cache par case 15 bits (approche)\n");
+	fprintf(stderr, "--metric <rgb|oklab> : distance des couleurs (defaut: rgb)\n");
+	fprintf(stderr, "  oklab : perceptuelle, meilleurs couples dans les tons chair et les sombres\n");
+	fprintf(stderr, "--linear : erreur diffusee en lumiere lineaire (degrades sombres plus justes)\n");
+	fprintf(stderr, "--cpu <auto|scalar|sse4.2|avx2|avx512> : plafond du jeu d'instructions des noyaux (defaut: auto)\n");
+	fprintf(stderr, "--cpu-info : affiche les fonctionnalites du processeur et les noyaux retenus\n");
+	fprintf(stderr, "--bench <passes> : chronometre le dithering de l'image (temps, erreur, compteurs), sans sortie\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, "-o<prefixe>, --prefix <prefixe> : prefixe des fichiers produits (ex: sortie/ ou sortie/img_)\n");
+	fprintf(stderr, "  -o - : ecrit l'unique artefact selectionne sur la sortie standard\n");
+	fprintf(stderr, "--out <liste> : artefacts a produire, separes par des virgules (defaut: all)\n");
+	fprintf(stderr, "  resized,png,map,colors,pixels,k7,exo,all\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, "--batch <repertoire|manifeste> : traite plusieurs images (sans <nom_fichier>)\n");
+	fprintf(stderr, "  repertoire : toutes les images, options -d -m -p communes, sorties <prefixe><nom>_*\n");
+	fprintf(stderr, "  manifeste : une ligne par image \"entree [d [m [palette|- [prefixe]]]]\", # = commentaire\n");
+	fprintf(stderr, "--set <repertoire|manifeste> : une palette MO6 commune a toutes les images (diaporama)\n");
+	fprintf(stderr, "  histogrammes fusionnes, palette exoquant unique, MAP regroupes dans <prefixe>clash.k7\n");
+	fprintf(stderr, "-j<n>, --jobs <n> : nombre de threads (defaut: nombre de coeurs) : images en parallele en batch,\n");
+	fprintf(stderr, "  sinon calcul d'une image avec -m 4 ou -d 11 a 13\n");
+	fprintf(stderr, "--mem-budget <Mo> : memoire maximale des images en cours de traitement (defaut: 256)\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, "--cache <repertoire> : reutilise cadrage, palette et resultat des executions precedentes\n");
+	fprintf(stderr, "--cache-max <Mo> : taille maximale du cache, les entrees les moins recentes sont supprimees\n");
 }
 
 int main(int argc, char *argv[])
 {
-	Color thomson_palette[4096];
-	init_thomson_palette(thomson_palette);
-	Color palette[PALETTE_SIZE];
-
-
-
 	int opt;
 	char *nom_fichier = NULL;
 	int val_d = -1; // Initialisé à -1 pour indiquer qu'il n'a pas été défini
 	int val_m = -1; // Initialisé à -1 pour indiquer qu'il n'a pas été défini
-	int pal = 0;
 	char *pal_name = NULL;
+	char *batch_source = NULL;
+	int set_mode = 0;
+	int threads = 0;
+	long long memory_budget = 256LL << 20;
+	char *cache_dir = NULL;
+	long long cache_max = 0;
+	char *palette_lib = NULL;
+	OutputSpec outputs = {"", OUT_ALL, NULL};
+	DitherOptions dither_options = DITHER_OPTIONS_DEFAULT;
+	int bench_passes = 0;
+	int metric = METRIC_RGB;
+	int cpu_level = CPU_AUTO;
+	int cpu_info = 0;
 
 	// Chaîne d'options : "d:m:" signifie que -d prend un argument et -m prend un argument
-	while ((opt = getopt(argc, argv, "d:m:p:")) != -1) {
+	while ((opt = getopt_long(argc, argv, "d:m:p:o:O:j:", long_options, NULL)) != -1) {
 		switch (opt) {
 		case 'd':
 			val_d = atoi(optarg); // optarg contient la chaîne de l'argument (ex: "0")
-			if (val_d < 0 || val_d > 10) {
+			if (val_d < 0 || val_d > DITHER_MODE_MAX) {
 				usage();
 				return 1;
 			}
 			break;
 		case 'm':
 			val_m = atoi(optarg);
-			if (val_m < 0 || val_m > 3) {
+			if (val_m < 0 || val_m > 4) {
 				usage();
 				return 1;
 			};
@@ -109,17 +147,137 @@ int main(int argc, char *argv[])
 		case 'p':
 			pal_name = optarg;
 			break;
+		case 'o':
+			outputs.prefix = optarg;
+			break;
+		case 'O':
+			outputs.selected = parse_output_list(optarg);
+			if (outputs.selected <= 0) {
+				usage();
+				return 1;
+			}
+			break;
+		case 'B':
+		case 'S':
+			if (batch_source) {
+				fprintf(stderr, "Erreur: --batch et --set s'excluent.\n");
+				return 1;
+			}
+			batch_source = optarg;
+			set_mode = opt == 'S';
+			break;
+		case 'j':
+			threads = atoi(optarg);
+			if (threads < 1) {
+				usage();
+				return 1;
+			}
+			break;
+		case 'M':
+			memory_budget = atoll(optarg) << 20;
+			if (memory_budget <= 0) {
+				usage();
+				return 1;
+			}
+			break;
+		case 'C':
+			cache_dir = optarg;
+			break;
+		case 'X':
+			cache_max = atoll(optarg) << 20;
+			if (cache_max <= 0) {
+				usage();
+				return 1;
+			}
+			break;
+		case 'L':
+			palette_lib = optarg;
+			break;
+		case 'P':
+			if (strcmp(optarg, "exhaustive") == 0)
+				dither_options.pairs = DITHER_PAIRS_EXHAUSTIVE;
+			else if (strcmp(optarg, "bound") == 0)
+				dither_options.pairs = DITHER_PAIRS_BOUND;
+			else if (strcmp(optarg, "pca") == 0)
+				dither_options.pairs = DITHER_PAIRS_PCA;
+			else {
+				usage();
+				return 1;
+			}
+			break;
+		case 'F':
+			dither_options.pairs = DITHER_PAIRS_TOP_K;
+			if (optarg) {
+				dither_options.top_k = atoi(optarg);
+				if (dither_options.top_k < DITHER_TOP_K_MIN || dither_options.top_k > DITHER_TOP_K_MAX) {
+					usage();
+					return 1;
+				}
+			}
+			break;
+		case 'K':
+			dither_options.distance_cache = 1;
+			break;
+		case 'U':
+			cpu_level = cpu_level_parse(optarg);
+			if (cpu_level < CPU_AUTO) {
+				usage();
+				return 1;
+			}
+			break;
+		case 'I':
+			cpu_info = 1;
+			break;
+		case 'Y':
+			dither_options.linear_light = 1;
+			break;
+		case 'T':
+			if (strcmp(optarg, "rgb") == 0)
+				metric = METRIC_RGB;
+			else if (strcmp(optarg, "oklab") == 0)
+				metric = METRIC_OKLAB;
+			else {
+				usage();
+				return 1;
+			}
+			break;
+		case 'N':
+			bench_passes = atoi(optarg);
+			if (bench_passes < 1) {
+				usage();
+				return 1;
+			}
+			break;
+		case 'E':
+			if (strcmp(optarg, "off") == 0)
+				dither_options.memo = DITHER_MEMO_OFF;
+			else if (strcmp(optarg, "exact") == 0)
+				dither_options.memo = DITHER_MEMO_EXACT;
+			else if (strcmp(optarg, "fast") == 0)
+				dither_options.memo = DITHER_MEMO_FAST;
+			else {
+				usage();
+				return 1;
+			}
+			break;
 		case '?': // getopt renvoie '?' si une option est inconnue ou un argument manque
 			usage();
 			return 1; // Code d'erreur
 		}
 	}
 
+	// Noyaux choisis une fois, avant tout calcul et avant les threads du batch
+	cpu_select(cpu_level);
+	if (cpu_info) {
+		cpu_print_info(stdout);
+		return 0;
+	}
+
 	// Après la boucle getopt, optind est l'indice du premier argument non-optionnel.
 	// Dans votre cas, ce sera le nom de fichier.
 	if (optind < argc) {
 		nom_fichier = argv[optind]; // Le premier argument non-optionnel est notre nom de fichier
-	} else {
+	} else if (!batch_source) {
 		fprintf(stderr, "Erreur: Le nom de fichier est manquant.\n");
 		usage();
 		return 1;
@@ -133,199 +291,103 @@ int main(int argc, char *argv[])
 		val_m = 0;
 	}
 
-	printf("arguments: %s %d %d\n", nom_fichier, val_d, val_m);
-
-
-	int width, height, channels;
-	//unsigned char *original_image = stbi_load(argv[1], &width, &height, &channels, COLOR_COMP);
-	unsigned char *original_image = stbi_load(nom_fichier, &width, &height, &channels, COLOR_COMP);
-	if (!original_image) {
-		printf("Erreur: Impossible de charger l'image d'entrée '%s'. Vérifiez le chemin ou le format.\n", argv[1]);
-		return EXIT_FAILURE;
+	if (batch_source && strcmp(outputs.prefix, "-") == 0) {
+		fprintf(stderr, "Erreur: -o - n'est pas disponible en mode batch.\n");
+		return 1;
 	}
-
-	printf("Image chargée: %s (%dx%d pixels, %d canaux d'origine)\n", argv[1], width, height, channels);
-
-	uint8_t *resized_image = NULL;
-	int wr, hr;
-	resized_image = resize_if_necessary(original_image, width, height, resized_image, &wr, &hr);
-
-	uint8_t *framed_image = NULL;
-	int wf, hf;
-	framed_image = frame_into_canvas(resized_image, wr, hr, framed_image, &wf, &hf);
-
-	if (!stbi_write_png("resized.png", WIDTH, HEIGHT, COLOR_COMP, framed_image, WIDTH * 3)) {
-		printf("Erreur: Impossible d'écrire l'image PNG 'resized.png'\n");
-	} else {
-		printf("Image sauvée avec succès au format PNG: 'resized.png'\n");
+	if (batch_source && bench_passes) {
+		fprintf(stderr, "Erreur: --bench porte sur une seule image.\n");
+		return 1;
 	}
-
-	Color optimal_palette[PALETTE_SIZE];
-
-	if (pal_name) {
-		int chosen_index = 0;
-		Color chosen[16];
-		for (int i = 0; i < NUM_PALETTES; i++) {
-			if (strcmp(pal_name, palette_table[i].name) == 0) {
-				chosen_index = i;
-				break;
-			}
+	if (set_mode && pal_name) {
+		fprintf(stderr, "Erreur: -p n'est pas disponible avec --set, la palette est calculée sur le jeu.\n");
+		return 1;
+	}
+	// Tables de la métrique, cache de mo5 et tuile de bruit bleu construits avant les threads du batch,
+	// qui les partagent ensuite en lecture seule
+	metric_select(metric);
+	if (dither_options.distance_cache) dither_distance_cache_init();
+	if (dither_options.linear_light) dither_linear_init();
+	if (val_d == DITHER_BLUE_NOISE || batch_source) ordered_blue_noise_init();
+
+	// -o - : un seul artefact, écrit sur la sortie standard, les messages partent sur stderr
+	if (strcmp(outputs.prefix, "-") == 0) {
+		int selected = outputs.selected;
+		if (selected == OUT_EXO && val_m != 2 && val_m != 3) selected = 0;
+		if (selected == 0 || (selected & (selected - 1)) != 0) {
+			fprintf(stderr, "Erreur: -o - demande exactement un artefact produit (--out).\n");
+			usage();
+			return 1;
 		}
-		for (int i = 0; i < 16; i++) {
-			chosen[i] = palette_table[chosen_index].palette[i];
+		outputs.stdout_stream = platform_detach_stdout();
+		if (!outputs.stdout_stream) {
+			fprintf(stderr, "Erreur: Impossible de réserver la sortie standard.\n");
+			return EXIT_FAILURE;
 		}
-		find_closest_thomson_palette(chosen, thomson_palette, palette);
-	} else if (val_m == 1) {
-        // mo6 error diffusion
-//		generate_palette_wu_thomson_aware(framed_image, WIDTH, HEIGHT, thomson_palette, optimal_palette);
-//		find_closest_thomson_palette(optimal_palette, thomson_palette, palette);
-        unsigned char exo_palette[16 * 4];
-        find_exo_palette(exo_palette, framed_image, hf, wf);
-        quantize_exo_to_4096(exo_palette, palette, thomson_palette);
-
-    } else if (val_m == 2 || val_m == 3) {
-        // mo6 mo5 exoquant dithering
-        printf("exoquant mode");
-        // ici on va explorer une autre possibilite, on va d'abord tramer la source avec exoquant
-        find_closest_thomson_palette(mo5_palette, thomson_palette, palette);
-        unsigned char exo_palette[16 * 4];
-        
-        exq_data *pExq;
-        pExq = exq_init();
-        exq_no_transparency(pExq);
-        uint8_t *exo_image = convert_rgb_to_rgba(framed_image, wf, hf);
-        exq_feed(pExq, exo_image, wf * hf);
-
-        if (val_m == 2) {
-            for (int i = 0; i < PALETTE_SIZE; i++) {
-                exo_palette[i * 4] = mo5_palette[i].r;
-                exo_palette[i * 4 +1] = mo5_palette[i].g;
-                exo_palette[i * 4 +2] = mo5_palette[i].b;
-                exo_palette[i * 4 +3] = 255;
-            }
-        } else if (val_m == 3) {
-            find_exo_palette(exo_palette, framed_image, hf, wf);
-            quantize_exo_to_4096(exo_palette, palette, thomson_palette);
-        }
-        exq_set_palette(pExq, exo_palette, 16);
-        
-        // dithering
-        unsigned char *indexedPaletteData = malloc(wf * hf);
-        exq_map_image(pExq, wf * hf, exo_image, indexedPaletteData);
-        exq_map_image_ordered(pExq, wf, hf, exo_image, indexedPaletteData);
-//        exq_map_image_dither(pExq, wf, hf, exo_image, indexedPaletteData, 0);   // random
-        
-        for (int i = 0, j = 0; i < wf * hf * 4; i += 4, j++) {
-            exo_image[i] =  *(exo_palette + indexedPaletteData[j] * 4);
-            exo_image[i + 1] =  *(exo_palette + indexedPaletteData[j] * 4 + 1);
-            exo_image[i + 2] =  *(exo_palette + indexedPaletteData[j] * 4 + 2);
-            exo_image[i + 3] =  *(exo_palette + indexedPaletteData[j] * 4 + 3);
-        }
-
-        stbi_write_png("exo_dither.png", wf, hf, 4, exo_image, 4 * wf);
-        
-        free(framed_image);
-        framed_image = convert_rgba_to_rgb((const uint8_t *) exo_image, wf, hf);
-        
-        free(indexedPaletteData);
-        free(exo_image);
-        exq_free(pExq);
-    } else {
-        // mo5 error diffusion
-        find_closest_thomson_palette(mo5_palette, thomson_palette, palette);
-    }
-
+	}
 
-	DitheredPixel *dithered_image = (DitheredPixel *)malloc(sizeof(DitheredPixel) * WIDTH * HEIGHT);
-	if (!dithered_image) {
-		printf("Erreur: Impossible d'allouer la mémoire pour l'image ditherée.\n");
-		stbi_image_free(original_image);
+	// -p est vérifié une fois la bibliothèque chargée, --palette-lib pouvant suivre -p
+	PaletteLibrary palettes;
+	if (palette_lib ? palette_lib_open(&palettes, palette_lib) != 0 : palette_lib_builtin(&palettes) != 0)
 		return EXIT_FAILURE;
+	if (pal_name && check_palette_name(&palettes, pal_name) != 0) {
+		palette_lib_close(&palettes);
+		usage();
+		return 1;
 	}
-
-
-	// --- Appel de la NOUVELLE fonction de dithering avec propagation intelligente ---
-	block_dithering_thomson_smart_propagation(framed_image, dithered_image, WIDTH, HEIGHT, COLOR_COMP, palette,
-											  val_d == 10 ? NULL : floyd_matrix[val_d].matrix);
-
-	// --- Vérification finale (devrait toujours être 0 violations) ---
-	verify_color_clash(dithered_image, WIDTH, HEIGHT);
-
-	unsigned char *output_image_data = (unsigned char *)malloc(width * height * COLOR_COMP);
-	if (!output_image_data) {
-		printf("Erreur: Impossible d'allouer la mémoire pour l'image de sortie.\n");
-		free(dithered_image);
-		stbi_image_free(original_image);
+	// L'index des palettes compilées n'est construit que pour -p nearest
+	int nearest_k;
+	if (pal_name && parse_nearest_palette(pal_name, &nearest_k) == 1 && palette_lib_index(&palettes) != 0) {
+		palette_lib_close(&palettes);
 		return EXIT_FAILURE;
 	}
 
-	for (int y = 0; y < HEIGHT; ++y) {
-		for (int x = 0; x < WIDTH; ++x) {
-			int output_pixel_idx = (y * WIDTH + x) * COLOR_COMP;
-			Color dithered_color = palette[dithered_image[y * WIDTH + x].palette_idx];
-			output_image_data[output_pixel_idx] = dithered_color.r;
-			output_image_data[output_pixel_idx + 1] = dithered_color.g;
-			output_image_data[output_pixel_idx + 2] = dithered_color.b;
+	ClashCache cache;
+	ClashJob job = {nom_fichier, val_d, val_m, pal_name, &palettes, outputs, NULL, 1, NULL, &dither_options};
+
+	if (batch_source) {
+		if (cache_dir) {
+			if (cache_open(&cache, cache_dir, cache_max) != 0) return EXIT_FAILURE;
+			job.cache = &cache;
+		}
+		if (threads == 0) threads = platform_cpu_count();
+		int status = set_mode ? clash_set(batch_source, &job, threads)
+							  : clash_batch(batch_source, &job, threads, memory_budget);
+		if (job.cache) {
+			cache_print_stats(job.cache);
+			cache_close(job.cache);
 		}
+		palette_lib_close(&palettes);
+		return status == 0 ? 0 : EXIT_FAILURE;
 	}
 
-	// --- Nombre de couleurs
-	long num_unique_colors = count_unique_colors_hashed(output_image_data, WIDTH, HEIGHT);
-	printf("Nombre de couleurs %d\n", (int)num_unique_colors);
+	printf("arguments: %s %d %d\n", nom_fichier, val_d, val_m);
 
-	// --- Image rgb ---
-	if (!stbi_write_png("clash.png", WIDTH, HEIGHT, 3, output_image_data, WIDTH * 3)) {
-		printf("Erreur: Impossible d'écrire l'image PNG '%s'. Tentative en BMP...\n", "clash.png");
-	} else {
-		printf("clash.png créé\n");
+	if (cache_dir) {
+		if (cache_open(&cache, cache_dir, cache_max) != 0) return EXIT_FAILURE;
+		job.cache = &cache;
 	}
 
-	// --- Image TO-SNAP ---
-	IntVector pixels, colors;
-	init_vector(&pixels);
-	init_vector(&colors);
-	save_as_to_snap("CLASH", output_image_data, thomson_palette, palette, &pixels, &colors);
-	printf("CLASH.MAP créé\n");
-
-	// --- Création des fichiers binaires couleur et forme MO5
-	uint8_t header[] = {0x00, 0x1F, 0x40, 0x00, 0x00};
-	uint8_t footer[] = {0xFF, 0x00, 0x00, 0x00, 0x00};
-	uint8_t *c = (uint8_t *)malloc(colors.size);
-	if (c)
-		for (int i = 0; i < colors.size; i++) {
-			c[i] = colors.data[i];
-		}
-	FILE *fc = fopen("COLORS.BIN", "wb");
-	fwrite(header, 1, 5, fc);
-	if (c) fwrite(c, 1, colors.size, fc);
-	fwrite(footer, 1, 5, fc);
-	fclose(fc);
-	free(c);
-	uint8_t *p = (uint8_t *)malloc(pixels.size);
-	if (p)
-		for (int i = 0; i < pixels.size; i++) {
-			p[i] = pixels.data[i];
+	// Une seule image : ses calculs parallélisables (-m 4, -d 11 à 13) disposent de tous les threads
+	job.threads = threads ? threads : platform_cpu_count();
+
+	ClashScratch scratch;
+	DecodedImage image;
+	int status = -1;
+	if (clash_scratch_init(&scratch) == 0) {
+		if (clash_decode(nom_fichier, job.cache, &image) == 0) {
+			status = bench_passes ? clash_bench(&job, &image, &scratch, bench_passes)
+								  : clash_process(&job, &image, &scratch);
+			clash_decoded_free(&image);
 		}
-	FILE *fp = fopen("PIXELS.BIN", "wb");
-	fwrite(header, 1, 5, fc);
-	if (p) fwrite(p, 1, pixels.size, fp);
-	fwrite(footer, 1, 5, fc);
-	fclose(fp);
-	free(p);
-
-	// --- Ajout dans une k7 ---
- 	FILE *fick7 = fopen("clash.k7", "wb");
-	ajouterFichier(fick7, "CLASH.MAP");
-	ajouterFichier(fick7, "PIXELS.BIN");
-	ajouterFichier(fick7, "COLORS.BIN");
-	fclose(fick7);
-	printf("clash.k7 créé\n");
+		clash_scratch_free(&scratch);
+	}
+	if (job.cache) {
+		cache_print_stats(job.cache);
+		cache_close(job.cache);
+	}
+	palette_lib_close(&palettes);
 
-	free_vector(&pixels);
-	free_vector(&colors);
-	stbi_image_free(original_image);
-	free(resized_image);
-	free(framed_image);
-	free(dithered_image);
-	return 0;
+	if (job.outputs.stdout_stream) fclose(job.outputs.stdout_stream);
+	return status == 0 ? 0 : EXIT_FAILURE;
 }
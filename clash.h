@@ -0,0 +1,95 @@
+#ifndef CLASH_H
+#define CLASH_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "global.h"
+#include "thomson.h"
+#include "cache.h"
+#include "palette_lib.h"
+#include "dither.h"
+
+// Artefacts produits par clash, sélectionnables avec --out
+#define OUT_RESIZED 0x01 // resized.png : image cadrée en 320x200
+#define OUT_PNG 0x02	 // clash.png : rendu RGB du résultat
+#define OUT_MAP 0x04	 // CLASH.MAP : image TO-SNAP
+#define OUT_COLORS 0x08	 // COLORS.BIN : octets de couleur MO5
+#define OUT_PIXELS 0x10	 // PIXELS.BIN : octets de forme MO5
+#define OUT_K7 0x20		 // clash.k7 : MAP et BIN regroupés dans une k7
+#define OUT_EXO 0x40	 // exo_dither.png : pré-tramage exoquant (-m 2 et -m 3)
+#define OUT_ALL 0x7F
+
+typedef struct {
+	const char *prefix; // préfixe des fichiers produits (répertoire et/ou début de nom)
+	int selected;		// masque des artefacts OUT_* à écrire
+	FILE *stdout_stream; // non NULL : l'unique artefact sélectionné part sur la sortie standard
+} OutputSpec;
+
+// Paramètres d'une conversion : la ligne de commande ou une ligne de manifeste batch
+typedef struct {
+	const char *input;		  // chemin de l'image, "-" pour l'entrée standard
+	int dither;				  // -d : matrice de dithering (10 = Ostromoukhov, 11 à 13 : ordered.c)
+	int machine;			  // -m : 0=MO5, 1=MO6, 2 et 3=pré-tramage exoquant, 4=MO6 palette par blocs
+	const char *palette_name; // -p : palette prédéfinie, NULL sinon
+	const PaletteLibrary *palettes; // palettes compilées ou --palette-lib
+	OutputSpec outputs;
+	ClashCache *cache;		  // --cache : NULL si désactivé
+	int threads;			  // threads de calcul d'une image (-m 4, -d 11 à 13), 1 en batch où les images se partagent
+							  // les coeurs
+	const Color *shared_palette; // --set : palette commune à toutes les images, NULL sinon
+	const DitherOptions *dither_options; // --memo..., NULL : réglages par défaut
+} ClashJob;
+
+// Image décodée par stb_image, avant redimensionnement
+typedef struct {
+	uint8_t *pixels; // RGB, à libérer avec stbi_image_free (NULL si le cadrage vient du cache)
+	int width, height, channels;
+	uint64_t input_hash; // hash des octets source, base des clés de cache
+	uint8_t *framed;	 // image cadrée WIDTH * HEIGHT * COLOR_COMP lue dans le cache, NULL sinon
+} DecodedImage;
+
+// Tampons de travail réutilisés d'une image à l'autre (un jeu par thread en mode batch)
+typedef struct {
+	Color thomson_palette[NUM_THOMSON_COLORS];
+	uint8_t *resized;		 // image redimensionnée, agrandie au besoin (resized_capacity octets)
+	size_t resized_capacity;
+	uint8_t *framed;		 // WIDTH * HEIGHT * COLOR_COMP
+	uint8_t *rgba;			 // WIDTH * HEIGHT * 4 (exoquant)
+	uint8_t *indexed;		 // WIDTH * HEIGHT (exoquant)
+	uint64_t *histogram;	 // NUM_THOMSON_COLORS * 4 : pixels et somme RGB par case (exoquant)
+	int32_t *distances;		 // WIDTH * HEIGHT * PALETTE_SIZE : distances pixel / couleur (-m 4)
+	double *error;			 // WIDTH * HEIGHT * 3 : erreur propagée par le dithering
+	DitheredPixel *dithered; // WIDTH * HEIGHT
+	DitheredPixel *candidate; // WIDTH * HEIGHT : second rendu de -p auto
+	uint8_t *packed;		 // WIDTH * HEIGHT / 2 : rendu en 4 bits par pixel (cache des résultats)
+	ClashBlock *blocks;		 // CLASH_BLOCKS : rendu sous forme native (MAP, BIN et k7)
+	uint8_t *rgb;			 // WIDTH * HEIGHT * COLOR_COMP : rendu final
+	DitherMemo *memo;		 // table de --memo des dithering du job
+	IntVector map, pixels, colors, colors_bin, pixels_bin;
+} ClashScratch;
+
+// pipeline.c
+int parse_output_list(const char *list);
+int check_palette_name(const PaletteLibrary *palettes, const char *name);
+int clash_scratch_init(ClashScratch *scratch);
+void clash_scratch_free(ClashScratch *scratch);
+int clash_decode(const char *input, ClashCache *cache, DecodedImage *image);
+void clash_decoded_free(DecodedImage *image);
+int clash_process(const ClashJob *job, const DecodedImage *image, ClashScratch *scratch);
+// --bench : choisit la palette comme clash_process puis chronomètre passes dithering de l'image
+// cadrée avec les réglages du job ; affiche le temps par passe, l'erreur et les compteurs. Rien n'est écrit.
+int clash_bench(const ClashJob *job, const DecodedImage *image, ClashScratch *scratch, int passes);
+// --set : remplace l'image décodée par son cadrage (image->framed) et ajoute ses pixels aux
+// cases Thomson de histogram (NUM_THOMSON_COLORS * 4 : pixels et somme RGB)
+int clash_set_frame(const ClashJob *job, DecodedImage *image, ClashScratch *scratch, uint64_t *histogram);
+// Palette exoquant de l'histogramme fusionné, ramenée aux couleurs Thomson
+void clash_histogram_palette(const uint64_t *histogram, Color *thomson_palette, Color palette[PALETTE_SIZE]);
+// <prefixe>clash.k7 regroupant les MAP du jeu (CLASH001.MAP, CLASH002.MAP...), tous avec la même palette
+int clash_write_set_k7(const OutputSpec *outputs, const IntVector *maps, int count);
+
+// batch.c : source = répertoire d'images ou manifeste "entrée d m p préfixe"
+int clash_batch(const char *source, const ClashJob *defaults, int threads, long long memory_budget);
+// batch.c : --set, une palette commune à toutes les images de source et une seule k7
+int clash_set(const char *source, const ClashJob *defaults, int threads);
+
+#endif // !CLASH_H
@@ -14,12 +14,18 @@
 #include "thomson.h"
 #include "image.h"
 #include "dither.h"
-#include "palettes.h"
+#include "palette_lib.h"
 #include "matrix.h"
 #include "k7.h"
+#include "cpu.h"
+
+static const struct option long_options[] = {
+	{"palette-lib", required_argument, NULL, 'L'}, {"cpu", required_argument, NULL, 'U'}, {NULL, 0, NULL, 0}};
 
 void usage()
 {
+	fprintf(stderr, "Usage: clashall <nom_fichier> [--palette-lib <csv|bin>] [--cpu <niveau>]\n");
+	fprintf(stderr, "--cpu <auto|scalar|sse4.2|avx2|avx512> : plafond du jeu d'instructions des noyaux (defaut: auto)\n");
 }
 
 int main(int argc, char *argv[])
@@ -32,16 +38,30 @@ int main(int argc, char *argv[])
 	char *nom_fichier = NULL;
 	int pal = 0;
 	char *pal_name = NULL;
+	char *palette_lib = NULL;
+	int cpu_level = CPU_AUTO;
 
 	// Cha�ne d'options : "d:m:" signifie que -d prend un argument et -m prend un argument
-	while ((opt = getopt(argc, argv, "")) != -1) {
+	while ((opt = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
 		switch (opt) {
+		case 'L':
+			palette_lib = optarg;
+			break;
+		case 'U':
+			cpu_level = cpu_level_parse(optarg);
+			if (cpu_level < CPU_AUTO) {
+				usage();
+				return 1;
+			}
+			break;
 		case '?': // getopt renvoie '?' si une option est inconnue ou un argument manque
 			usage();
 			return 1; // Code d'erreur
 		}
 	}
 
+	cpu_select(cpu_level);
+
 	// Apr�s la boucle getopt, optind est l'indice du premier argument non-optionnel.
 	// Dans votre cas, ce sera le nom de fichier.
 	if (optind < argc) {
@@ -71,7 +91,28 @@ int main(int argc, char *argv[])
 	int wf, hf;
 	framed_image = frame_into_canvas(resized_image, wr, hr, framed_image, &wf, &hf);
 	
-	for (int i = 0; i < NUM_PALETTES; i++) {
+	// Palettes compilées ou --palette-lib
+	PaletteLibrary palettes;
+	if (palette_lib ? palette_lib_open(&palettes, palette_lib) != 0 : palette_lib_builtin(&palettes) != 0) {
+		stbi_image_free(original_image);
+		return EXIT_FAILURE;
+	}
+
+	// Les palettes qui donnent le même ensemble de couleurs Thomson ne sont tramées qu'une fois,
+	// les alias sont listés dans clash_aliases.csv (alias,rendu)
+	FILE *aliases = fopen("clash_aliases.csv", "w");
+	for (int i = 0; i < palettes.count; i++) {
+		int canonical = palette_lib_canonical(&palettes, i);
+		if (canonical != i) {
+			printf("clash_%s.png : même rendu que clash_%s.png\n", palette_lib_name(&palettes, i),
+				   palette_lib_name(&palettes, canonical));
+			if (aliases)
+				fprintf(aliases, "clash_%s.png,clash_%s.png\n", palette_lib_name(&palettes, i),
+						palette_lib_name(&palettes, canonical));
+			continue;
+		}
+		palette_lib_colors(&palettes, i, palette);
+
 		DitheredPixel *dithered_image = (DitheredPixel *)malloc(sizeof(DitheredPixel) * WIDTH * HEIGHT);
 		if (!dithered_image) {
 			printf("Erreur: Impossible d'allouer la m�moire pour l'image dither�e.\n");
@@ -81,12 +122,9 @@ int main(int argc, char *argv[])
 
 		// --- Appel de la NOUVELLE fonction de dithering avec propagation intelligente ---
 		block_dithering_thomson_smart_propagation(framed_image, dithered_image, WIDTH, HEIGHT, COLOR_COMP,
-												  palette_table[i].palette,
+												  palette,
 												  floyd_matrix[8].matrix /*NULL*/);
 
-		// --- V�rification finale (devrait toujours �tre 0 violations) ---
-		verify_color_clash(dithered_image, WIDTH, HEIGHT);
-
 		unsigned char *output_image_data = (unsigned char *)malloc(width * height * COLOR_COMP);
 		if (!output_image_data) {
 			printf("Erreur: Impossible d'allouer la m�moire pour l'image de sortie.\n");
@@ -95,25 +133,16 @@ int main(int argc, char *argv[])
 			return EXIT_FAILURE;
 		}
 
-		for (int y = 0; y < HEIGHT; ++y) {
-			for (int x = 0; x < WIDTH; ++x) {
-				int output_pixel_idx = (y * WIDTH + x) * COLOR_COMP;
-				Color dithered_color = palette_table[i].palette[dithered_image[y * WIDTH + x].palette_idx];
-				output_image_data[output_pixel_idx] = dithered_color.r;
-				output_image_data[output_pixel_idx + 1] = dithered_color.g;
-				output_image_data[output_pixel_idx + 2] = dithered_color.b;
-			}
-		}
-
-		// --- Nombre de couleurs
-		long num_unique_colors = count_unique_colors_hashed(output_image_data, WIDTH, HEIGHT);
-		printf("Nombre de couleurs %d\n", (int)num_unique_colors);
+		// --- Vérification (devrait toujours être 0 violations), rendu RGB et nombre de couleurs en une passe
+		ClashPostStats post;
+		thomson_post_pass(dithered_image, palette, NULL, output_image_data, &post);
+		printf("Nombre de couleurs %d\n", post.colors);
 
 		// --- Image rgb ---
-		char fname[50];
-		memset(fname, 0, 50);
+		char fname[PALETTE_LIB_NAME_SIZE + 16];
+		memset(fname, 0, sizeof(fname));
 		strcpy(fname, "clash_");
-		strcat(fname, palette_table[i].name);
+		strcat(fname, palette_lib_name(&palettes, i));
 		strcat(fname, ".png");
 		if (!stbi_write_png(fname, WIDTH, HEIGHT, 3, output_image_data, WIDTH * 3)) {
 			printf("Erreur: Impossible d'�crire l'image PNG '%s'. Tentative en BMP...\n", "clash.png");
@@ -121,8 +150,12 @@ int main(int argc, char *argv[])
 			printf("%s cr��\n", fname);
 		}
 
+		free(output_image_data);
 		free(dithered_image);
 	}
+	if (aliases) fclose(aliases);
+	printf("%d palettes, %d ensembles de couleurs Thomson tramés\n", palettes.count, palettes.unique_count);
+	palette_lib_close(&palettes);
 
 	stbi_image_free(original_image);
 	free(resized_image);
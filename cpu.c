@@ -0,0 +1,288 @@
+#include <string.h>
+#include "cpu.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CPU_X86 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define CPU_X86 1
+#endif
+
+// Les noyaux vectoriels (cpu_x86.c) utilisent les attributs target de GCC et Clang
+#if defined(CPU_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CPU_X86_KERNELS 1
+void sse42_block_distances(const MetricColor *block, int block_size, const CpuPalette *pal, int32_t dist[8][16]);
+void avx2_block_distances(const MetricColor *block, int block_size, const CpuPalette *pal, int32_t dist[8][16]);
+void avx512_block_distances(const MetricColor *block, int block_size, const CpuPalette *pal, int32_t dist[8][16]);
+void sse42_pair_search(int32_t dist[8][16], int block_size, int *best_idx1, int *best_idx2);
+void avx2_pair_search(int32_t dist[8][16], int block_size, int *best_idx1, int *best_idx2);
+void avx512_pair_search(int32_t dist[8][16], int block_size, int *best_idx1, int *best_idx2);
+void sse42_rgb_to_rgba(const uint8_t *rgb, uint8_t *rgba, int pixels);
+void sse42_rgba_to_rgb(const uint8_t *rgba, uint8_t *rgb, int pixels);
+void avx2_rgb_to_rgba(const uint8_t *rgb, uint8_t *rgba, int pixels);
+void avx2_rgba_to_rgb(const uint8_t *rgba, uint8_t *rgb, int pixels);
+void sse42_expand_indices(const DitheredPixel *indices, int pixels, const Color palette[16], uint8_t *rgb);
+float sse42_segment_error(const float pixels[3][8], const float weight[8], MetricColor a, MetricColor b);
+float avx2_segment_error(const float pixels[3][8], const float weight[8], MetricColor a, MetricColor b);
+int sse42_threshold_mask(const float pixels[3][8], const float thresholds[8], MetricColor a, MetricColor b);
+int avx2_threshold_mask(const float pixels[3][8], const float thresholds[8], MetricColor a, MetricColor b);
+#endif
+
+static const char *level_names[CPU_LEVEL_COUNT] = {"scalar", "sse4.2", "avx2", "avx512"};
+
+// --- Versions scalaires, toujours disponibles ---
+
+static void scalar_block_distances(const MetricColor *block, int block_size, const CpuPalette *pal,
+								   int32_t dist[8][16])
+{
+	for (int k = 0; k < block_size; ++k) {
+		for (int i = 0; i < 16; ++i) {
+			int d0 = block[k].c[0] - pal->c[0][i], d1 = block[k].c[1] - pal->c[1][i], d2 = block[k].c[2] - pal->c[2][i];
+			dist[k][i] = d0 * d0 + d1 * d1 + d2 * d2;
+		}
+	}
+}
+
+// Couple de couleurs de palette minimisant l'erreur du bloc, chaque pixel prenant la plus proche des deux.
+// i == j est permis (une seule couleur), le premier couple rencontré l'emporte en cas d'égalité.
+static void scalar_pair_search(int32_t dist[8][16], int block_size, int *best_idx1, int *best_idx2)
+{
+	int32_t min_total_error = INT32_MAX;
+	*best_idx1 = -1;
+	*best_idx2 = -1;
+
+	for (int i = 0; i < 16; ++i) {
+		for (int j = i; j < 16; ++j) { // j=i pour permettre le cas où une seule couleur est optimale
+			int32_t current_pair_total_error = 0;
+			for (int k = 0; k < block_size; ++k)
+				current_pair_total_error += dist[k][i] < dist[k][j] ? dist[k][i] : dist[k][j];
+
+			if (current_pair_total_error < min_total_error) {
+				min_total_error = current_pair_total_error;
+				*best_idx1 = i;
+				*best_idx2 = j;
+			}
+		}
+	}
+}
+
+static void scalar_rgb_to_rgba(const uint8_t *rgb, uint8_t *rgba, int pixels)
+{
+	for (int i = 0; i < pixels; i++) {
+		rgba[i * 4] = rgb[i * 3];
+		rgba[i * 4 + 1] = rgb[i * 3 + 1];
+		rgba[i * 4 + 2] = rgb[i * 3 + 2];
+		rgba[i * 4 + 3] = 255;
+	}
+}
+
+static void scalar_rgba_to_rgb(const uint8_t *rgba, uint8_t *rgb, int pixels)
+{
+	for (int i = 0; i < pixels; i++) {
+		rgb[i * 3] = rgba[i * 4];
+		rgb[i * 3 + 1] = rgba[i * 4 + 1];
+		rgb[i * 3 + 2] = rgba[i * 4 + 2];
+	}
+}
+
+static void scalar_expand_indices(const DitheredPixel *indices, int pixels, const Color palette[16], uint8_t *rgb)
+{
+	for (int i = 0; i < pixels; i++) {
+		Color c = palette[indices[i].palette_idx];
+		rgb[i * 3] = c.r;
+		rgb[i * 3 + 1] = c.g;
+		rgb[i * 3 + 2] = c.b;
+	}
+}
+
+// Accès dispersés à 4096 cases : aucun gain vectoriel, la version scalaire sert à tous les niveaux
+static void scalar_thomson_histogram(const uint8_t *rgb, int pixels, uint64_t *histogram)
+{
+	uint16_t level[256];
+	for (int v = 0; v < 256; v++) level[v] = (uint16_t)nearest_thomson_level(v);
+	for (int i = 0; i < pixels; i++) {
+		const uint8_t *p = &rgb[i * 3];
+		uint64_t *bin = &histogram[(level[p[0]] + 16 * level[p[1]] + 256 * level[p[2]]) * 4];
+		bin[0]++;
+		bin[1] += p[0];
+		bin[2] += p[1];
+		bin[3] += p[2];
+	}
+}
+
+// Les versions vectorielles font les mêmes opérations flottantes dans le même ordre (somme des
+// voies comprise) : le rendu ne dépend pas de --cpu
+static float scalar_segment_error(const float pixels[3][8], const float weight[8], MetricColor a, MetricColor b)
+{
+	float d0 = (float)(b.c[0] - a.c[0]), d1 = (float)(b.c[1] - a.c[1]), d2 = (float)(b.c[2] - a.c[2]);
+	float length = d0 * d0 + d1 * d1 + d2 * d2;
+	float inverse = length > 0 ? 1.0f / length : 0;
+	float error = 0;
+	for (int k = 0; k < 8; k++) {
+		float w0 = pixels[0][k] - a.c[0], w1 = pixels[1][k] - a.c[1], w2 = pixels[2][k] - a.c[2];
+		float dot = w0 * d0 + w1 * d1 + w2 * d2;
+		float t = dot * inverse;
+		t = t < 0 ? 0 : t;
+		t = t > 1 ? 1 : t;
+		error += weight[k] * (w0 * w0 + w1 * w1 + w2 * w2 - t * (2 * dot - t * length));
+	}
+	return error;
+}
+
+static int scalar_threshold_mask(const float pixels[3][8], const float thresholds[8], MetricColor a, MetricColor b)
+{
+	float d0 = (float)(b.c[0] - a.c[0]), d1 = (float)(b.c[1] - a.c[1]), d2 = (float)(b.c[2] - a.c[2]);
+	float length = d0 * d0 + d1 * d1 + d2 * d2;
+	int mask = 0;
+	for (int k = 0; k < 8; k++) {
+		float dot = (pixels[0][k] - a.c[0]) * d0 + (pixels[1][k] - a.c[1]) * d1 + (pixels[2][k] - a.c[2]) * d2;
+		if (dot > thresholds[k] * length) mask |= 1 << k;
+	}
+	return mask;
+}
+
+CpuKernels cpu_kernels = {scalar_block_distances, scalar_pair_search,		scalar_rgb_to_rgba,
+						  scalar_rgba_to_rgb,	  scalar_expand_indices,	scalar_thomson_histogram,
+						  scalar_segment_error,	  scalar_threshold_mask};
+
+// Niveau de chaque noyau de cpu_kernels, pour --cpu-info
+#define KERNEL_COUNT 8
+static const char *kernel_names[KERNEL_COUNT] = {"distances",  "couples",	 "rgb->rgba", "rgba->rgb",
+												 "index->rgb", "histogramme", "segment",	  "seuillage"};
+static int kernel_levels[KERNEL_COUNT];
+static int selected_level = CPU_SCALAR;
+
+// --- Détection ---
+
+typedef struct {
+	int sse42, avx, avx2, fma, avx512f, avx512bw, os_avx, os_avx512;
+} CpuFeatures;
+
+static CpuFeatures features;
+static int detected_level = -1;
+
+#ifdef CPU_X86
+static void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4])
+{
+#ifdef _MSC_VER
+	int out[4];
+	__cpuidex(out, (int)leaf, (int)subleaf);
+	for (int i = 0; i < 4; i++) regs[i] = (unsigned)out[i];
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// Registres sauvegardés par le système (XCR0) : AVX n'est utilisable que si ymm l'est
+static uint64_t xgetbv0(void)
+{
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#else
+	unsigned lo, hi;
+	__asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return ((uint64_t)hi << 32) | lo;
+#endif
+}
+#endif
+
+int cpu_detect(void)
+{
+	if (detected_level >= 0) return detected_level;
+	memset(&features, 0, sizeof(features));
+	detected_level = CPU_SCALAR;
+#ifdef CPU_X86
+	unsigned regs[4];
+	cpuid(0, 0, regs);
+	unsigned max_leaf = regs[0];
+	if (max_leaf < 1) return detected_level;
+	cpuid(1, 0, regs);
+	features.sse42 = (regs[2] >> 20) & 1;
+	features.fma = (regs[2] >> 12) & 1;
+	int osxsave = (regs[2] >> 27) & 1;
+	features.avx = (regs[2] >> 28) & 1;
+	if (osxsave) {
+		uint64_t xcr0 = xgetbv0();
+		features.os_avx = (xcr0 & 0x6) == 0x6;
+		features.os_avx512 = (xcr0 & 0xE6) == 0xE6;
+	}
+	if (max_leaf >= 7) {
+		cpuid(7, 0, regs);
+		features.avx2 = (regs[1] >> 5) & 1;
+		features.avx512f = (regs[1] >> 16) & 1;
+		features.avx512bw = (regs[1] >> 30) & 1;
+	}
+	if (features.sse42) detected_level = CPU_SSE42;
+	if (detected_level == CPU_SSE42 && features.avx && features.avx2 && features.os_avx) detected_level = CPU_AVX2;
+	if (detected_level == CPU_AVX2 && features.avx512f && features.avx512bw && features.os_avx512)
+		detected_level = CPU_AVX512;
+#endif
+	return detected_level;
+}
+
+int cpu_select(int level)
+{
+	int detected = cpu_detect();
+	if (level == CPU_AUTO || level > detected) level = detected;
+	selected_level = level;
+	cpu_kernels = (CpuKernels){scalar_block_distances, scalar_pair_search,	 scalar_rgb_to_rgba,
+							   scalar_rgba_to_rgb,	   scalar_expand_indices, scalar_thomson_histogram,
+							   scalar_segment_error,   scalar_threshold_mask};
+	memset(kernel_levels, 0, sizeof(kernel_levels));
+#ifdef CPU_X86_KERNELS
+	// Conversions limitées par la mémoire et blocs de 8 flottants : AVX2 suffit, l'expansion reste en
+	// 128 bits à tous les niveaux
+	if (level >= CPU_SSE42) {
+		cpu_kernels.block_distances = sse42_block_distances;
+		cpu_kernels.pair_search = sse42_pair_search;
+		cpu_kernels.rgb_to_rgba = sse42_rgb_to_rgba;
+		cpu_kernels.rgba_to_rgb = sse42_rgba_to_rgb;
+		cpu_kernels.expand_indices = sse42_expand_indices;
+		cpu_kernels.segment_error = sse42_segment_error;
+		cpu_kernels.threshold_mask = sse42_threshold_mask;
+		for (int i = 0; i < 5; i++) kernel_levels[i] = CPU_SSE42;
+		kernel_levels[6] = kernel_levels[7] = CPU_SSE42;
+	}
+	if (level >= CPU_AVX2) {
+		cpu_kernels.block_distances = avx2_block_distances;
+		cpu_kernels.pair_search = avx2_pair_search;
+		cpu_kernels.rgb_to_rgba = avx2_rgb_to_rgba;
+		cpu_kernels.rgba_to_rgb = avx2_rgba_to_rgb;
+		cpu_kernels.segment_error = avx2_segment_error;
+		cpu_kernels.threshold_mask = avx2_threshold_mask;
+		for (int i = 0; i < 4; i++) kernel_levels[i] = CPU_AVX2;
+		kernel_levels[6] = kernel_levels[7] = CPU_AVX2;
+	}
+	if (level >= CPU_AVX512) {
+		cpu_kernels.block_distances = avx512_block_distances;
+		cpu_kernels.pair_search = avx512_pair_search;
+		kernel_levels[0] = kernel_levels[1] = CPU_AVX512;
+	}
+#endif
+	return level;
+}
+
+int cpu_level_parse(const char *name)
+{
+	if (strcmp(name, "auto") == 0) return CPU_AUTO;
+	for (int level = 0; level < CPU_LEVEL_COUNT; level++)
+		if (strcmp(name, level_names[level]) == 0) return level;
+	return -2;
+}
+
+const char *cpu_level_name(int level)
+{
+	return level >= 0 && level < CPU_LEVEL_COUNT ? level_names[level] : "auto";
+}
+
+void cpu_print_info(FILE *out)
+{
+	int detected = cpu_detect();
+	fprintf(out, "Processeur : sse4.2 %s, avx %s, avx2 %s, fma %s, avx512f %s, avx512bw %s\n",
+			features.sse42 ? "oui" : "non", features.avx && features.os_avx ? "oui" : "non",
+			features.avx2 ? "oui" : "non", features.fma ? "oui" : "non",
+			features.avx512f && features.os_avx512 ? "oui" : "non", features.avx512bw ? "oui" : "non");
+	fprintf(out, "Niveau détecté : %s, retenu : %s\n", level_names[detected], level_names[selected_level]);
+	for (int i = 0; i < KERNEL_COUNT; i++) fprintf(out, "  %-12s %s\n", kernel_names[i], level_names[kernel_levels[i]]);
+}
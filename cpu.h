@@ -0,0 +1,55 @@
+#ifndef CPU_H
+#define CPU_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "thomson.h"
+#include "metric.h"
+
+// Niveaux de jeu d'instructions, du moins au plus capable (--cpu)
+#define CPU_AUTO -1
+#define CPU_SCALAR 0
+#define CPU_SSE42 1
+#define CPU_AVX2 2
+#define CPU_AVX512 3 // AVX-512 F et BW
+#define CPU_LEVEL_COUNT 4
+
+// Palette en colonnes : composante c de la couleur i en pal[c][i], pour les noyaux vectoriels
+typedef struct {
+	int32_t c[3][16];
+} CpuPalette;
+
+// Noyaux chauds, choisis une fois par cpu_select selon le niveau du processeur. Avant cet appel,
+// la table contient les versions scalaires.
+typedef struct {
+	// dist[k][i] : distance du pixel k à la couleur i, pour les block_size pixels du bloc
+	void (*block_distances)(const MetricColor *block, int block_size, const CpuPalette *pal, int32_t dist[8][16]);
+	// Recherche exhaustive du couple de couleurs sur ces distances (mêmes ex aequo que le parcours i <= j)
+	void (*pair_search)(int32_t dist[8][16], int block_size, int *best_idx1, int *best_idx2);
+	void (*rgb_to_rgba)(const uint8_t *rgb, uint8_t *rgba, int pixels);
+	void (*rgba_to_rgb)(const uint8_t *rgba, uint8_t *rgb, int pixels);
+	// Index de palette -> RGB
+	void (*expand_indices)(const DitheredPixel *indices, int pixels, const Color palette[16], uint8_t *rgb);
+	// Histogramme des cases Thomson 12 bits : compte et sommes r, g, b (4 entrées par case)
+	void (*thomson_histogram)(const uint8_t *rgb, int pixels, uint64_t *histogram);
+	// Blocs de ordered.c, 8 pixels en plans de composantes. Erreur de rendu par les mélanges de a et b :
+	// distances des pixels au segment [a, b] pondérées par weight, sommées dans l'ordre des pixels
+	float (*segment_error)(const float pixels[3][8], const float weight[8], MetricColor a, MetricColor b);
+	// Bit k : la position du pixel k entre a et b dépasse thresholds[k] (le pixel prend b)
+	int (*threshold_mask)(const float pixels[3][8], const float thresholds[8], MetricColor a, MetricColor b);
+} CpuKernels;
+
+extern CpuKernels cpu_kernels;
+
+// Plus haut niveau pris en charge par le processeur et le système (CPUID et XGETBV, une fois)
+int cpu_detect(void);
+// Remplit cpu_kernels pour level (CPU_AUTO : niveau détecté, sinon plafonné au niveau détecté) ;
+// renvoie le niveau retenu. À appeler au démarrage, avant les threads.
+int cpu_select(int level);
+// Niveau d'après son nom (scalar, sse4.2, avx2, avx512), -2 si inconnu
+int cpu_level_parse(const char *name);
+const char *cpu_level_name(int level);
+// --cpu-info : fonctionnalités détectées, niveau retenu et version de chaque noyau
+void cpu_print_info(FILE *out);
+
+#endif // !CPU_H
@@ -0,0 +1,356 @@
+// Noyaux vectoriels x86 choisis par cpu_select : chaque fonction est compilée pour son jeu
+// d'instructions (attribut target) et n'est appelée que si le processeur le prend en charge
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "cpu.h"
+
+#define SSE42 __attribute__((target("sse4.2")))
+#define AVX2 __attribute__((target("avx2")))
+#define AVX512 __attribute__((target("avx512f,avx512bw")))
+
+// Couple final de la recherche vectorielle : chaque colonne j garde la plus petite erreur et le
+// premier i qui l'atteint ; l'ordre (erreur, i, j) redonne le couple du parcours scalaire
+static void pick_pair(const int32_t error[16], const int32_t first[16], int *best_idx1, int *best_idx2)
+{
+	int best = 0;
+	for (int j = 1; j < 16; j++)
+		if (error[j] < error[best] || (error[j] == error[best] && first[j] < first[best])) best = j;
+	*best_idx1 = first[best];
+	*best_idx2 = best;
+}
+
+// --- SSE4.2 (instructions SSE4.1) : 4 colonnes par registre ---
+
+SSE42 void sse42_block_distances(const MetricColor *block, int block_size, const CpuPalette *pal, int32_t dist[8][16])
+{
+	for (int k = 0; k < block_size; ++k) {
+		__m128i p0 = _mm_set1_epi32(block[k].c[0]), p1 = _mm_set1_epi32(block[k].c[1]), p2 = _mm_set1_epi32(block[k].c[2]);
+		for (int q = 0; q < 16; q += 4) {
+			__m128i d0 = _mm_sub_epi32(p0, _mm_loadu_si128((const __m128i *)&pal->c[0][q]));
+			__m128i d1 = _mm_sub_epi32(p1, _mm_loadu_si128((const __m128i *)&pal->c[1][q]));
+			__m128i d2 = _mm_sub_epi32(p2, _mm_loadu_si128((const __m128i *)&pal->c[2][q]));
+			__m128i sum = _mm_add_epi32(_mm_mullo_epi32(d0, d0), _mm_mullo_epi32(d1, d1));
+			_mm_storeu_si128((__m128i *)&dist[k][q], _mm_add_epi32(sum, _mm_mullo_epi32(d2, d2)));
+		}
+	}
+}
+
+SSE42 void sse42_pair_search(int32_t dist[8][16], int block_size, int *best_idx1, int *best_idx2)
+{
+	__m128i best[4], first[4], lane[4];
+	for (int q = 0; q < 4; q++) {
+		best[q] = _mm_set1_epi32(INT32_MAX);
+		first[q] = _mm_setzero_si128();
+		lane[q] = _mm_setr_epi32(q * 4, q * 4 + 1, q * 4 + 2, q * 4 + 3);
+	}
+	for (int i = 0; i < 16; ++i) {
+		__m128i acc[4] = {_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+		for (int k = 0; k < block_size; ++k) {
+			__m128i di = _mm_set1_epi32(dist[k][i]);
+			for (int q = 0; q < 4; q++)
+				acc[q] = _mm_add_epi32(acc[q], _mm_min_epi32(di, _mm_loadu_si128((const __m128i *)&dist[k][q * 4])));
+		}
+		__m128i vi = _mm_set1_epi32(i);
+		for (int q = 0; q < 4; q++) {
+			// j < i : couple déjà évalué sous la forme (j, i)
+			acc[q] = _mm_blendv_epi8(acc[q], _mm_set1_epi32(INT32_MAX), _mm_cmpgt_epi32(vi, lane[q]));
+			__m128i better = _mm_cmpgt_epi32(best[q], acc[q]);
+			best[q] = _mm_min_epi32(best[q], acc[q]);
+			first[q] = _mm_blendv_epi8(first[q], vi, better);
+		}
+	}
+	int32_t error[16], index[16];
+	for (int q = 0; q < 4; q++) {
+		_mm_storeu_si128((__m128i *)&error[q * 4], best[q]);
+		_mm_storeu_si128((__m128i *)&index[q * 4], first[q]);
+	}
+	pick_pair(error, index, best_idx1, best_idx2);
+}
+
+// --- AVX2 : 8 colonnes par registre ---
+
+AVX2 void avx2_block_distances(const MetricColor *block, int block_size, const CpuPalette *pal, int32_t dist[8][16])
+{
+	__m256i c[3][2];
+	for (int a = 0; a < 3; a++) {
+		c[a][0] = _mm256_loadu_si256((const __m256i *)&pal->c[a][0]);
+		c[a][1] = _mm256_loadu_si256((const __m256i *)&pal->c[a][8]);
+	}
+	for (int k = 0; k < block_size; ++k) {
+		__m256i p0 = _mm256_set1_epi32(block[k].c[0]), p1 = _mm256_set1_epi32(block[k].c[1]),
+				p2 = _mm256_set1_epi32(block[k].c[2]);
+		for (int h = 0; h < 2; h++) {
+			__m256i d0 = _mm256_sub_epi32(p0, c[0][h]), d1 = _mm256_sub_epi32(p1, c[1][h]),
+					d2 = _mm256_sub_epi32(p2, c[2][h]);
+			__m256i sum = _mm256_add_epi32(_mm256_mullo_epi32(d0, d0), _mm256_mullo_epi32(d1, d1));
+			_mm256_storeu_si256((__m256i *)&dist[k][h * 8], _mm256_add_epi32(sum, _mm256_mullo_epi32(d2, d2)));
+		}
+	}
+}
+
+AVX2 void avx2_pair_search(int32_t dist[8][16], int block_size, int *best_idx1, int *best_idx2)
+{
+	__m256i rows[8][2];
+	for (int k = 0; k < block_size; ++k) {
+		rows[k][0] = _mm256_loadu_si256((const __m256i *)&dist[k][0]);
+		rows[k][1] = _mm256_loadu_si256((const __m256i *)&dist[k][8]);
+	}
+	const __m256i lane0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256i lane1 = _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15);
+	const __m256i max = _mm256_set1_epi32(INT32_MAX);
+	__m256i best0 = max, best1 = max, first0 = _mm256_setzero_si256(), first1 = _mm256_setzero_si256();
+	for (int i = 0; i < 16; ++i) {
+		__m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+		for (int k = 0; k < block_size; ++k) {
+			__m256i di = _mm256_set1_epi32(dist[k][i]);
+			acc0 = _mm256_add_epi32(acc0, _mm256_min_epi32(di, rows[k][0]));
+			acc1 = _mm256_add_epi32(acc1, _mm256_min_epi32(di, rows[k][1]));
+		}
+		__m256i vi = _mm256_set1_epi32(i);
+		acc0 = _mm256_blendv_epi8(acc0, max, _mm256_cmpgt_epi32(vi, lane0));
+		acc1 = _mm256_blendv_epi8(acc1, max, _mm256_cmpgt_epi32(vi, lane1));
+		__m256i better0 = _mm256_cmpgt_epi32(best0, acc0), better1 = _mm256_cmpgt_epi32(best1, acc1);
+		best0 = _mm256_min_epi32(best0, acc0);
+		best1 = _mm256_min_epi32(best1, acc1);
+		first0 = _mm256_blendv_epi8(first0, vi, better0);
+		first1 = _mm256_blendv_epi8(first1, vi, better1);
+	}
+	int32_t error[16], index[16];
+	_mm256_storeu_si256((__m256i *)&error[0], best0);
+	_mm256_storeu_si256((__m256i *)&error[8], best1);
+	_mm256_storeu_si256((__m256i *)&index[0], first0);
+	_mm256_storeu_si256((__m256i *)&index[8], first1);
+	pick_pair(error, index, best_idx1, best_idx2);
+}
+
+// --- AVX-512 : une ligne de 16 distances par registre ---
+
+AVX512 void avx512_block_distances(const MetricColor *block, int block_size, const CpuPalette *pal,
+								   int32_t dist[8][16])
+{
+	__m512i c0 = _mm512_loadu_si512(pal->c[0]), c1 = _mm512_loadu_si512(pal->c[1]), c2 = _mm512_loadu_si512(pal->c[2]);
+	for (int k = 0; k < block_size; ++k) {
+		__m512i d0 = _mm512_sub_epi32(_mm512_set1_epi32(block[k].c[0]), c0);
+		__m512i d1 = _mm512_sub_epi32(_mm512_set1_epi32(block[k].c[1]), c1);
+		__m512i d2 = _mm512_sub_epi32(_mm512_set1_epi32(block[k].c[2]), c2);
+		__m512i sum = _mm512_add_epi32(_mm512_mullo_epi32(d0, d0), _mm512_mullo_epi32(d1, d1));
+		_mm512_storeu_si512(dist[k], _mm512_add_epi32(sum, _mm512_mullo_epi32(d2, d2)));
+	}
+}
+
+AVX512 void avx512_pair_search(int32_t dist[8][16], int block_size, int *best_idx1, int *best_idx2)
+{
+	__m512i rows[8];
+	for (int k = 0; k < block_size; ++k) rows[k] = _mm512_loadu_si512(dist[k]);
+	const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	__m512i best = _mm512_set1_epi32(INT32_MAX), first = _mm512_setzero_si512();
+	for (int i = 0; i < 16; ++i) {
+		__m512i acc = _mm512_setzero_si512();
+		for (int k = 0; k < block_size; ++k)
+			acc = _mm512_add_epi32(acc, _mm512_min_epi32(_mm512_set1_epi32(dist[k][i]), rows[k]));
+		__m512i vi = _mm512_set1_epi32(i);
+		// Colonnes j >= i seulement, et plus petites strictement : le premier i l'emporte
+		__mmask16 better = _mm512_mask_cmpgt_epi32_mask(_mm512_cmpge_epi32_mask(lane, vi), best, acc);
+		best = _mm512_mask_mov_epi32(best, better, acc);
+		first = _mm512_mask_mov_epi32(first, better, vi);
+	}
+	int32_t error[16], index[16];
+	_mm512_storeu_si512(error, best);
+	_mm512_storeu_si512(index, first);
+	pick_pair(error, index, best_idx1, best_idx2);
+}
+
+// --- Conversions RGB <-> RGBA et expansion index -> RGB ---
+
+// Masques pshufb : 4 pixels RGB (12 octets) <-> 4 pixels RGBA (16 octets), 0x80 met l'octet à zéro
+#define RGB_TO_RGBA_MASK 0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128
+#define RGBA_TO_RGB_MASK 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -128, -128, -128, -128
+#define ALPHA_MASK 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1
+
+// Les boucles vectorielles lisent ou écrivent 16 octets par groupe de 4 pixels (12 utiles côté RGB) :
+// elles s'arrêtent tant qu'il reste de quoi ne pas déborder, la fin passe en scalaire
+static void rgb_to_rgba_tail(const uint8_t *rgb, uint8_t *rgba, int from, int pixels)
+{
+	for (int i = from; i < pixels; i++) {
+		rgba[i * 4] = rgb[i * 3];
+		rgba[i * 4 + 1] = rgb[i * 3 + 1];
+		rgba[i * 4 + 2] = rgb[i * 3 + 2];
+		rgba[i * 4 + 3] = 255;
+	}
+}
+
+static void rgba_to_rgb_tail(const uint8_t *rgba, uint8_t *rgb, int from, int pixels)
+{
+	for (int i = from; i < pixels; i++) {
+		rgb[i * 3] = rgba[i * 4];
+		rgb[i * 3 + 1] = rgba[i * 4 + 1];
+		rgb[i * 3 + 2] = rgba[i * 4 + 2];
+	}
+}
+
+SSE42 void sse42_rgb_to_rgba(const uint8_t *rgb, uint8_t *rgba, int pixels)
+{
+	const __m128i mask = _mm_setr_epi8(RGB_TO_RGBA_MASK), alpha = _mm_setr_epi8(ALPHA_MASK);
+	int i = 0;
+	for (; i + 6 <= pixels; i += 4) { // 16 octets lus à partir de rgb + 3 i
+		__m128i in = _mm_loadu_si128((const __m128i *)(rgb + i * 3));
+		_mm_storeu_si128((__m128i *)(rgba + i * 4), _mm_or_si128(_mm_shuffle_epi8(in, mask), alpha));
+	}
+	rgb_to_rgba_tail(rgb, rgba, i, pixels);
+}
+
+SSE42 void sse42_rgba_to_rgb(const uint8_t *rgba, uint8_t *rgb, int pixels)
+{
+	const __m128i mask = _mm_setr_epi8(RGBA_TO_RGB_MASK);
+	int i = 0;
+	for (; i + 6 <= pixels; i += 4) { // 16 octets écrits à partir de rgb + 3 i
+		__m128i in = _mm_loadu_si128((const __m128i *)(rgba + i * 4));
+		_mm_storeu_si128((__m128i *)(rgb + i * 3), _mm_shuffle_epi8(in, mask));
+	}
+	rgba_to_rgb_tail(rgba, rgb, i, pixels);
+}
+
+// pshufb travaille par moitié de 128 bits : chaque moitié traite 4 pixels
+AVX2 void avx2_rgb_to_rgba(const uint8_t *rgb, uint8_t *rgba, int pixels)
+{
+	const __m256i mask = _mm256_setr_epi8(RGB_TO_RGBA_MASK, RGB_TO_RGBA_MASK);
+	const __m256i alpha = _mm256_setr_epi8(ALPHA_MASK, ALPHA_MASK);
+	int i = 0;
+	for (; i + 10 <= pixels; i += 8) { // 16 octets lus à partir de rgb + 3 i + 12
+		__m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(rgb + i * 3))),
+											 _mm_loadu_si128((const __m128i *)(rgb + i * 3 + 12)), 1);
+		_mm256_storeu_si256((__m256i *)(rgba + i * 4), _mm256_or_si256(_mm256_shuffle_epi8(in, mask), alpha));
+	}
+	rgb_to_rgba_tail(rgb, rgba, i, pixels);
+}
+
+AVX2 void avx2_rgba_to_rgb(const uint8_t *rgba, uint8_t *rgb, int pixels)
+{
+	const __m256i mask = _mm256_setr_epi8(RGBA_TO_RGB_MASK, RGBA_TO_RGB_MASK);
+	int i = 0;
+	for (; i + 10 <= pixels; i += 8) { // 16 octets écrits à partir de rgb + 3 i + 12
+		__m256i out = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(rgba + i * 4)), mask);
+		_mm_storeu_si128((__m128i *)(rgb + i * 3), _mm256_castsi256_si128(out));
+		_mm_storeu_si128((__m128i *)(rgb + i * 3 + 12), _mm256_extracti128_si256(out, 1));
+	}
+	rgba_to_rgb_tail(rgba, rgb, i, pixels);
+}
+
+// 16 index d'un octet, une table pshufb de 16 entrées par composante, puis entrelacement des trois
+// plans en 48 octets RGB : trois pshufb par registre de sortie
+SSE42 void sse42_expand_indices(const DitheredPixel *indices, int pixels, const Color palette[16], uint8_t *rgb)
+{
+	uint8_t planes[3][16], masks[3][3][16];
+	for (int i = 0; i < 16; i++) {
+		planes[0][i] = palette[i].r;
+		planes[1][i] = palette[i].g;
+		planes[2][i] = palette[i].b;
+	}
+	for (int o = 0; o < 48; o++)
+		for (int c = 0; c < 3; c++) masks[o / 16][c][o % 16] = o % 3 == c ? (uint8_t)(o / 3) : 0x80;
+	__m128i table[3], mask[3][3];
+	for (int c = 0; c < 3; c++) {
+		table[c] = _mm_loadu_si128((const __m128i *)planes[c]);
+		for (int v = 0; v < 3; v++) mask[v][c] = _mm_loadu_si128((const __m128i *)masks[v][c]);
+	}
+	int i = 0;
+	for (; i + 16 <= pixels; i += 16) {
+		__m128i idx = _mm_loadu_si128((const __m128i *)&indices[i]);
+		__m128i plane[3];
+		for (int c = 0; c < 3; c++) plane[c] = _mm_shuffle_epi8(table[c], idx);
+		for (int v = 0; v < 3; v++) {
+			__m128i out = _mm_or_si128(_mm_shuffle_epi8(plane[0], mask[v][0]), _mm_shuffle_epi8(plane[1], mask[v][1]));
+			_mm_storeu_si128((__m128i *)(rgb + i * 3 + v * 16), _mm_or_si128(out, _mm_shuffle_epi8(plane[2], mask[v][2])));
+		}
+	}
+	for (; i < pixels; i++) {
+		Color c = palette[indices[i].palette_idx];
+		rgb[i * 3] = c.r;
+		rgb[i * 3 + 1] = c.g;
+		rgb[i * 3 + 2] = c.b;
+	}
+}
+
+// --- Blocs de ordered.c : 8 flottants par plan, deux registres SSE ou un registre AVX2 ---
+// Mêmes opérations dans le même ordre que les versions scalaires, voies sommées dans l'ordre des pixels
+
+// Erreur de la voie : weight * (|w|² - t (2 dot - t length)), t = dot / length ramené à [0, 1]
+#define SEGMENT_LANES(V, add, sub, mul, min, max, set1, zero)                                                          \
+	V w0 = sub(p0, a0), w1 = sub(p1, a1), w2 = sub(p2, a2);                                                         \
+	V dot = add(add(mul(w0, vd0), mul(w1, vd1)), mul(w2, vd2));                                                    \
+	V t = min(max(mul(dot, vinverse), zero), set1(1.0f));                                                         \
+	V norm = add(add(mul(w0, w0), mul(w1, w1)), mul(w2, w2));                                                      \
+	V lanes = mul(wt, sub(norm, mul(t, sub(add(dot, dot), mul(t, vlength)))));
+
+SSE42 float sse42_segment_error(const float pixels[3][8], const float weight[8], MetricColor a, MetricColor b)
+{
+	float d0 = (float)(b.c[0] - a.c[0]), d1 = (float)(b.c[1] - a.c[1]), d2 = (float)(b.c[2] - a.c[2]);
+	float length = d0 * d0 + d1 * d1 + d2 * d2;
+	float inverse = length > 0 ? 1.0f / length : 0;
+	__m128 vd0 = _mm_set1_ps(d0), vd1 = _mm_set1_ps(d1), vd2 = _mm_set1_ps(d2);
+	__m128 vlength = _mm_set1_ps(length), vinverse = _mm_set1_ps(inverse);
+	__m128 a0 = _mm_set1_ps(a.c[0]), a1 = _mm_set1_ps(a.c[1]), a2 = _mm_set1_ps(a.c[2]);
+	float error[8];
+	for (int h = 0; h < 8; h += 4) {
+		__m128 p0 = _mm_loadu_ps(&pixels[0][h]), p1 = _mm_loadu_ps(&pixels[1][h]), p2 = _mm_loadu_ps(&pixels[2][h]);
+		__m128 wt = _mm_loadu_ps(&weight[h]);
+		SEGMENT_LANES(__m128, _mm_add_ps, _mm_sub_ps, _mm_mul_ps, _mm_min_ps, _mm_max_ps, _mm_set1_ps,
+					  _mm_setzero_ps())
+		_mm_storeu_ps(&error[h], lanes);
+	}
+	float sum = 0;
+	for (int k = 0; k < 8; k++) sum += error[k];
+	return sum;
+}
+
+SSE42 int sse42_threshold_mask(const float pixels[3][8], const float thresholds[8], MetricColor a, MetricColor b)
+{
+	float d0 = (float)(b.c[0] - a.c[0]), d1 = (float)(b.c[1] - a.c[1]), d2 = (float)(b.c[2] - a.c[2]);
+	__m128 vd0 = _mm_set1_ps(d0), vd1 = _mm_set1_ps(d1), vd2 = _mm_set1_ps(d2);
+	__m128 vlength = _mm_set1_ps(d0 * d0 + d1 * d1 + d2 * d2);
+	__m128 a0 = _mm_set1_ps(a.c[0]), a1 = _mm_set1_ps(a.c[1]), a2 = _mm_set1_ps(a.c[2]);
+	int mask = 0;
+	for (int h = 0; h < 8; h += 4) {
+		__m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&pixels[0][h]), a0), vd0),
+										   _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&pixels[1][h]), a1), vd1)),
+								_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&pixels[2][h]), a2), vd2));
+		mask |= _mm_movemask_ps(_mm_cmpgt_ps(dot, _mm_mul_ps(_mm_loadu_ps(&thresholds[h]), vlength))) << h;
+	}
+	return mask;
+}
+
+AVX2 float avx2_segment_error(const float pixels[3][8], const float weight[8], MetricColor a, MetricColor b)
+{
+	float d0 = (float)(b.c[0] - a.c[0]), d1 = (float)(b.c[1] - a.c[1]), d2 = (float)(b.c[2] - a.c[2]);
+	float length = d0 * d0 + d1 * d1 + d2 * d2;
+	float inverse = length > 0 ? 1.0f / length : 0;
+	__m256 vd0 = _mm256_set1_ps(d0), vd1 = _mm256_set1_ps(d1), vd2 = _mm256_set1_ps(d2);
+	__m256 vlength = _mm256_set1_ps(length), vinverse = _mm256_set1_ps(inverse);
+	__m256 a0 = _mm256_set1_ps(a.c[0]), a1 = _mm256_set1_ps(a.c[1]), a2 = _mm256_set1_ps(a.c[2]);
+	__m256 p0 = _mm256_loadu_ps(pixels[0]), p1 = _mm256_loadu_ps(pixels[1]), p2 = _mm256_loadu_ps(pixels[2]);
+	__m256 wt = _mm256_loadu_ps(weight);
+	SEGMENT_LANES(__m256, _mm256_add_ps, _mm256_sub_ps, _mm256_mul_ps, _mm256_min_ps, _mm256_max_ps, _mm256_set1_ps,
+				  _mm256_setzero_ps())
+	float error[8];
+	_mm256_storeu_ps(error, lanes);
+	float sum = 0;
+	for (int k = 0; k < 8; k++) sum += error[k];
+	return sum;
+}
+
+AVX2 int avx2_threshold_mask(const float pixels[3][8], const float thresholds[8], MetricColor a, MetricColor b)
+{
+	float d0 = (float)(b.c[0] - a.c[0]), d1 = (float)(b.c[1] - a.c[1]), d2 = (float)(b.c[2] - a.c[2]);
+	__m256 vlength = _mm256_set1_ps(d0 * d0 + d1 * d1 + d2 * d2);
+	__m256 dot = _mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(pixels[0]), _mm256_set1_ps(a.c[0])), _mm256_set1_ps(d0)),
+					  _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(pixels[1]), _mm256_set1_ps(a.c[1])), _mm256_set1_ps(d1))),
+		_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(pixels[2]), _mm256_set1_ps(a.c[2])), _mm256_set1_ps(d2)));
+	return _mm256_movemask_ps(_mm256_cmp_ps(dot, _mm256_mul_ps(_mm256_loadu_ps(thresholds), vlength), _CMP_GT_OQ));
+}
+
+#else
+typedef int cpu_x86_unused; // unité de traduction non vide hors x86
+#endif
@@ -1,6 +1,9 @@
 #include "matrix.h"
 #include "dither.h"
 #include "thomson.h"
+#include "metric.h"
+#include "cpu.h"
+#include "ordered.h"
 #include <math.h>
 #include <string.h>
 #include <stdbool.h>
@@ -39,6 +42,8 @@ int find_closest_thomson_idx(unsigned char r, unsigned char g, unsigned char b,
 {
 	double min_dist_sq = -1.0;
 	int closest_idx = -1;
+	Color query = {r, g, b, 0};
+	MetricColor target = metric_color(query);
 
 	for (int i = 0; i < NUM_THOMSON_COLORS; i++) {
 		// Optionnel: Ignorer les couleurs Thomson déjà "utilisées" par d'autres centroïdes pour l'unicité
@@ -47,7 +52,9 @@ int find_closest_thomson_idx(unsigned char r, unsigned char g, unsigned char b,
 			continue;
 		}
 
-		double dist_sq = distance_squared(r, g, b, thomson_pal[i].r, thomson_pal[i].g, thomson_pal[i].b);
+		double dist_sq = color_metric == METRIC_OKLAB
+							 ? metric_distance_sq(target, metric_palette_color(thomson_pal[i]))
+							 : distance_squared(r, g, b, thomson_pal[i].r, thomson_pal[i].g, thomson_pal[i].b);
 		if (closest_idx == -1 || dist_sq < min_dist_sq) {
 			min_dist_sq = dist_sq;
 			closest_idx = i;
@@ -407,12 +414,642 @@ void block_dithering_thomson_smart_propagation(const unsigned char *original_ima
 		exit(EXIT_FAILURE);
 	}
 
-	// Initialise l'image flottante avec les données de l'image originale.
-	for (int i = 0; i < width * height * 3; ++i) {
-		image_float[i] = (double)original_image[i];
+	block_dithering_thomson_smart_propagation_buffer(original_image, dithered_image, width, height, original_channels,
+													 pal, matrix, image_float);
+	free(image_float);
+}
+
+// Table de mémoïsation à correspondance directe : un couple par clé de bloc
+#define MEMO_BITS 12
+#define MEMO_SIZE (1 << MEMO_BITS)
+#define MEMO_KEY_SIZE 24 // 8 pixels RGB
+
+typedef struct {
+	uint8_t key[MEMO_KEY_SIZE];
+	int8_t idx1, idx2; // -1 : case libre
+} MemoEntry;
+
+struct DitherMemo {
+	MemoEntry entries[MEMO_SIZE];
+};
+
+DitherMemo *dither_memo_alloc(void)
+{
+	return malloc(sizeof(DitherMemo));
+}
+
+void dither_memo_free(DitherMemo *memo)
+{
+	free(memo);
+}
+
+// Clé d'un bloc complet : couleurs telles quelles (exacte) ou réduites en 5-6-5 bits (rapide)
+static void memo_key(const Color block[8], int memo, uint8_t key[MEMO_KEY_SIZE])
+{
+	memset(key, 0, MEMO_KEY_SIZE);
+	for (int k = 0; k < 8; k++) {
+		if (memo == DITHER_MEMO_EXACT) {
+			key[k * 3] = block[k].r;
+			key[k * 3 + 1] = block[k].g;
+			key[k * 3 + 2] = block[k].b;
+		} else {
+			uint16_t rgb565 = (uint16_t)((block[k].r >> 3) << 11 | (block[k].g >> 2) << 5 | block[k].b >> 3);
+			key[k * 2] = rgb565 >> 8;
+			key[k * 2 + 1] = rgb565 & 0xFF;
+		}
+	}
+}
+
+static uint32_t memo_slot(const uint8_t key[MEMO_KEY_SIZE])
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (int i = 0; i < MEMO_KEY_SIZE; i++) {
+		hash ^= key[i];
+		hash *= 1099511628211ull;
+	}
+	return (uint32_t)(hash >> (64 - MEMO_BITS));
+}
+
+// Distances des pixels d'un bloc aux 16 couleurs de la palette : calculées une fois par bloc et
+// partagées par le test du bloc uniforme, la recherche du couple et la quantification de l'étape C
+typedef int32_t BlockDistances[8][16];
+
+// Cache de distances (--distance-cache) : pour une palette et une métrique, les 16 distances du centre
+// de chaque case 15 bits (5 bits par composante), divisées par 4 pour tenir sur 16 bits, et ses deux
+// couleurs les plus proches. Les lignes sont calculées à leur première visite ; celles de la palette mo5, la plus utilisée,
+// le sont une fois pour tout le processus (dither_distance_cache_init).
+#define DCACHE_BITS 15
+#define DCACHE_SIZE (1 << DCACHE_BITS)
+#define DCACHE_NOT_BUILT 0xFF
+
+typedef struct {
+	Color palette[16];
+	MetricColor palette_metric[16];
+	int metric;
+	uint16_t (*rows)[16];
+	uint8_t (*nearest)[2]; // plus proche et seconde, DCACHE_NOT_BUILT : ligne pas encore calculée
+} DistanceCache;
+
+static DistanceCache mo5_distance_cache;
+
+static inline uint32_t dcache_key(Color c)
+{
+	return (uint32_t)(c.r >> 3) << 10 | (uint32_t)(c.g >> 3) << 5 | (uint32_t)(c.b >> 3);
+}
+
+static void dcache_build_row(DistanceCache *cache, uint32_t key)
+{
+	Color center = {(uint8_t)(((key >> 10) << 3) + 4), (uint8_t)((((key >> 5) & 31) << 3) + 4),
+					(uint8_t)(((key & 31) << 3) + 4), 0};
+	MetricColor m = metric_color(center);
+	uint16_t *row = cache->rows[key];
+	int first = -1, second = -1;
+	for (int i = 0; i < 16; ++i) {
+		row[i] = (uint16_t)(metric_distance_sq(m, cache->palette_metric[i]) >> 2);
+		if (first < 0 || row[i] < row[first]) {
+			second = first;
+			first = i;
+		} else if (second < 0 || row[i] < row[second]) {
+			second = i;
+		}
+	}
+	cache->nearest[key][0] = (uint8_t)first;
+	cache->nearest[key][1] = (uint8_t)second;
+}
+
+static inline uint32_t dcache_lookup(DistanceCache *cache, Color c)
+{
+	uint32_t key = dcache_key(c);
+	if (cache->nearest[key][0] == DCACHE_NOT_BUILT) dcache_build_row(cache, key);
+	return key;
+}
+
+static int dcache_alloc(DistanceCache *cache, const Color pal[16])
+{
+	memcpy(cache->palette, pal, sizeof(cache->palette));
+	for (int i = 0; i < 16; ++i) cache->palette_metric[i] = metric_palette_color(pal[i]);
+	cache->metric = color_metric;
+	cache->rows = malloc(DCACHE_SIZE * sizeof(*cache->rows));
+	cache->nearest = malloc(DCACHE_SIZE * sizeof(*cache->nearest));
+	if (!cache->rows || !cache->nearest) {
+		free(cache->rows);
+		free(cache->nearest);
+		cache->rows = NULL;
+		cache->nearest = NULL;
+		return -1;
+	}
+	memset(cache->nearest, DCACHE_NOT_BUILT, DCACHE_SIZE * sizeof(*cache->nearest));
+	return 0;
+}
+
+static void dcache_free(DistanceCache *cache)
+{
+	free(cache->rows);
+	free(cache->nearest);
+}
+
+static int same_palette(const Color a[16], const Color b[16])
+{
+	for (int i = 0; i < 16; ++i)
+		if (a[i].r != b[i].r || a[i].g != b[i].g || a[i].b != b[i].b) return 0;
+	return 1;
+}
+
+void dither_distance_cache_init(void)
+{
+	if (mo5_distance_cache.rows) return;
+	Color palette[16];
+	for (int i = 0; i < 16; ++i) snap_to_thomson(mo5_palette[i], &palette[i]);
+	if (dcache_alloc(&mo5_distance_cache, palette) != 0) return;
+	for (uint32_t key = 0; key < DCACHE_SIZE; ++key) dcache_build_row(&mo5_distance_cache, key);
+}
+
+// Palette de l'appel projetée dans l'espace de la métrique, en lignes et en colonnes (noyaux vectoriels)
+typedef struct {
+	MetricColor metric[16];
+	CpuPalette columns;
+} BlockPalette;
+
+static void block_distances(const Color *block, int block_size, const BlockPalette *pal, DistanceCache *cache,
+							BlockDistances dist)
+{
+	if (cache) {
+		for (int k = 0; k < block_size; ++k) {
+			const uint16_t *row = cache->rows[dcache_lookup(cache, block[k])];
+			for (int i = 0; i < 16; ++i) dist[k][i] = row[i];
+		}
+		return;
+	}
+	MetricColor metric_block[8] = {{{0}}};
+	for (int k = 0; k < block_size; ++k) metric_block[k] = metric_color(block[k]);
+	cpu_kernels.block_distances(metric_block, block_size, &pal->columns, dist);
+}
+
+// Même résultat que la recherche exhaustive (couple et ex aequo) par séparation et évaluation : le
+// couple des deux couleurs les plus souvent les plus proches sert de première borne, puis les couples
+// sont parcourus dans l'ordre en abandonnant l'accumulation dès qu'elle dépasse la meilleure erreur.
+// La somme des distances de chaque pixel à sa couleur la plus proche minore toutes les erreurs : une
+// fois atteinte, les couples suivants ne peuvent plus gagner.
+static void search_block_pair_bound(BlockDistances dist, int block_size, DitherStats *stats, int *best_idx1,
+									int *best_idx2)
+{
+	int32_t lower_bound = 0;
+	int nearest_count[16] = {0};
+	for (int k = 0; k < block_size; ++k) {
+		int nearest = 0;
+		for (int i = 1; i < 16; ++i)
+			if (dist[k][i] < dist[k][nearest]) nearest = i;
+		lower_bound += dist[k][nearest];
+		nearest_count[nearest]++;
+	}
+
+	// Première borne : les deux couleurs les plus souvent les plus proches
+	int first = 0, second = -1;
+	for (int i = 1; i < 16; ++i)
+		if (nearest_count[i] > nearest_count[first]) first = i;
+	for (int i = 0; i < 16; ++i)
+		if (i != first && nearest_count[i] > 0 && (second < 0 || nearest_count[i] > nearest_count[second])) second = i;
+	if (second < 0) second = first;
+	int bi = first < second ? first : second, bj = first < second ? second : first;
+	int32_t best_error = 0;
+	for (int k = 0; k < block_size; ++k) best_error += MIN(dist[k][bi], dist[k][bj]);
+
+	uint64_t scored = 0, pruned = 0;
+	for (int i = 0; i < 16; ++i) {
+		for (int j = i; j < 16; ++j) {
+			// Borne atteinte par un couple antérieur : les suivants perdraient au mieux l'ex aequo
+			if (best_error == lower_bound && (bi < i || (bi == i && bj < j))) {
+				pruned += 136 - (i * (33 - i) / 2 + (j - i));
+				goto done;
+			}
+			int32_t error = 0;
+			int k = 0;
+			for (; k < block_size && error <= best_error; ++k) error += MIN(dist[k][i], dist[k][j]);
+			if (error > best_error) {
+				if (k < block_size)
+					pruned++;
+				else
+					scored++;
+				continue;
+			}
+			scored++;
+			// error <= best_error : meilleur, ou ex aequo départagé par l'ordre de parcours
+			if (error < best_error || i < bi || (i == bi && j < bj)) {
+				best_error = error;
+				bi = i;
+				bj = j;
+			}
+		}
+	}
+done:
+	*best_idx1 = bi;
+	*best_idx2 = bj;
+	if (stats) {
+		stats->pairs_scored += scored;
+		stats->pairs_pruned += pruned;
+	}
+}
+
+// Recherche approchée (--fast) : seuls les couples formés dans l'union des k couleurs les plus proches
+// de chaque pixel sont évalués, quelques couples au lieu de 136
+static void search_block_pair_top_k(BlockDistances dist, int block_size, int k_nearest, DitherStats *stats,
+									int *best_idx1, int *best_idx2)
+{
+	uint16_t candidates = 0;
+	for (int k = 0; k < block_size; ++k) {
+		// k_nearest sélections du minimum restant (k_nearest <= 4)
+		uint16_t taken = 0;
+		for (int n = 0; n < k_nearest; ++n) {
+			int nearest = -1;
+			for (int i = 0; i < 16; ++i)
+				if (!(taken & (1 << i)) && (nearest < 0 || dist[k][i] < dist[k][nearest])) nearest = i;
+			taken |= 1 << nearest;
+		}
+		candidates |= taken;
+	}
+
+	int32_t best_error = INT32_MAX;
+	int bi = -1, bj = -1;
+	uint64_t scored = 0;
+	for (int i = 0; i < 16; ++i) {
+		if (!(candidates & (1 << i))) continue;
+		for (int j = i; j < 16; ++j) {
+			if (!(candidates & (1 << j))) continue;
+			int32_t error = 0;
+			for (int k = 0; k < block_size && error < best_error; ++k) error += MIN(dist[k][i], dist[k][j]);
+			scored++;
+			if (error < best_error) {
+				best_error = error;
+				bi = i;
+				bj = j;
+			}
+		}
+	}
+	*best_idx1 = bi;
+	*best_idx2 = bj;
+	if (stats) {
+		stats->pairs_scored += scored;
+		stats->pairs_pruned += 136 - scored;
+	}
+}
+
+#define PCA_SIDE_CANDIDATES 4 // couleurs retenues de chaque côté de la moyenne du bloc sur son axe
+
+// Recherche par axe principal (--pairs pca) : les 8 couleurs effectives s'étalent surtout le long de
+// l'axe propre dominant de leur covariance. Les 16 couleurs de la palette sont projetées sur cet axe et
+// seuls les couples qui encadrent le bloc sont évalués : une couleur projetée sous la moyenne du bloc,
+// l'autre au-dessus, plus les couples d'une seule couleur. Pour borner le nombre de couples, chaque
+// côté ne garde que ses PCA_SIDE_CANDIDATES couleurs les plus proches du centre des pixels de ce côté :
+// 24 couples au plus au lieu de 136.
+static void search_block_pair_pca(const Color *block, BlockDistances block_dist, int block_size,
+								  const MetricColor pal[16], DitherStats *stats, int *best_idx1, int *best_idx2)
+{
+	// Pixels centrés par plans de 8 voies, les pixels absents à zéro : ils ne pèsent pas sur la covariance
+	float px[3][8] = {{0}}, mean[3] = {0, 0, 0};
+	for (int k = 0; k < block_size; ++k) {
+		MetricColor m = metric_color(block[k]);
+		for (int c = 0; c < 3; ++c) {
+			px[c][k] = m.c[c];
+			mean[c] += m.c[c];
+		}
+	}
+	for (int c = 0; c < 3; ++c) {
+		mean[c] /= block_size;
+		for (int k = 0; k < block_size; ++k) px[c][k] -= mean[c];
+	}
+	// Covariance 3x3 symétrique : 6 produits scalaires sur 8 voies. Produits voie par voie puis sommes
+	// en arbre d'ordre fixé, sans réassociation à faire : GCC vectorise la boucle des produits à -O3
+	// (build Release par défaut), sans -ffast-math
+	static const int cov_a[6] = {0, 0, 0, 1, 1, 2}, cov_b[6] = {0, 1, 2, 1, 2, 2};
+	float prod[6][8], cov[3][3];
+	for (int k = 0; k < 8; ++k) {
+		prod[0][k] = px[0][k] * px[0][k];
+		prod[1][k] = px[0][k] * px[1][k];
+		prod[2][k] = px[0][k] * px[2][k];
+		prod[3][k] = px[1][k] * px[1][k];
+		prod[4][k] = px[1][k] * px[2][k];
+		prod[5][k] = px[2][k] * px[2][k];
+	}
+	for (int n = 0; n < 6; ++n) {
+		const float *p = prod[n];
+		float sum = ((p[0] + p[4]) + (p[2] + p[6])) + ((p[1] + p[5]) + (p[3] + p[7]));
+		cov[cov_a[n]][cov_b[n]] = cov[cov_b[n]][cov_a[n]] = sum;
+	}
+	// Itération de la puissance depuis la diagonale de gris
+	float axis[3] = {0.57735f, 0.57735f, 0.57735f};
+	float norm = 0;
+	for (int step = 0; step < 8; ++step) {
+		float next[3];
+		for (int a = 0; a < 3; ++a) next[a] = cov[a][0] * axis[0] + cov[a][1] * axis[1] + cov[a][2] * axis[2];
+		norm = sqrtf(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+		if (norm < 1e-3f) break;
+		for (int a = 0; a < 3; ++a) axis[a] = next[a] / norm;
+	}
+
+	if (norm < 1e-3f) {
+		// Bloc sans étendue : les couleurs les plus proches suffisent
+		search_block_pair_top_k(block_dist, block_size, DITHER_TOP_K_MIN, stats, best_idx1, best_idx2);
+		return;
+	}
+
+	// Étendue des pixels sur l'axe et centre des pixels de chaque côté de la moyenne ; un côté vide
+	// prend la moyenne
+	float center[2][3] = {{0, 0, 0}, {0, 0, 0}}, low_t = 0, high_t = 0;
+	int side_size[2] = {0, 0};
+	for (int k = 0; k < block_size; ++k) {
+		float t = px[0][k] * axis[0] + px[1][k] * axis[1] + px[2][k] * axis[2];
+		low_t = MIN(low_t, t);
+		high_t = MAX(high_t, t);
+		int side = t > 0;
+		for (int c = 0; c < 3; ++c) center[side][c] += px[c][k];
+		side_size[side]++;
+	}
+	for (int side = 0; side < 2; ++side)
+		for (int c = 0; c < 3; ++c) center[side][c] = mean[c] + (side_size[side] ? center[side][c] / side_size[side] : 0);
+
+	// Projection des 16 couleurs sur l'axe. Un couple encadre le bloc quand sa couleur basse se projette
+	// sous le pixel le plus haut et sa couleur haute au-dessus du pixel le plus bas : chaque côté ne garde
+	// que ses couleurs admises, les PCA_SIDE_CANDIDATES plus proches du centre de ce côté
+	float pal_t[16];
+	for (int i = 0; i < 16; ++i)
+		pal_t[i] = (pal[i].c[0] - mean[0]) * axis[0] + (pal[i].c[1] - mean[1]) * axis[1] +
+				   (pal[i].c[2] - mean[2]) * axis[2];
+	int side_candidates[2][PCA_SIDE_CANDIDATES], side_count[2] = {0, 0};
+	for (int side = 0; side < 2; ++side) {
+		float side_dist[PCA_SIDE_CANDIDATES];
+		for (int i = 0; i < 16; ++i) {
+			if (side ? pal_t[i] < low_t : pal_t[i] > high_t) continue;
+			float dr = pal[i].c[0] - center[side][0], dg = pal[i].c[1] - center[side][1], db = pal[i].c[2] - center[side][2];
+			float dist = dr * dr + dg * dg + db * db;
+			int pos = side_count[side] < PCA_SIDE_CANDIDATES ? side_count[side]++ : PCA_SIDE_CANDIDATES;
+			for (; pos > 0 && side_dist[pos - 1] > dist; pos--) {
+				if (pos < PCA_SIDE_CANDIDATES) {
+					side_candidates[side][pos] = side_candidates[side][pos - 1];
+					side_dist[pos] = side_dist[pos - 1];
+				}
+			}
+			if (pos < PCA_SIDE_CANDIDATES) {
+				side_candidates[side][pos] = i;
+				side_dist[pos] = dist;
+			}
+		}
+	}
+	if (!side_count[0] || !side_count[1]) {
+		// Bloc hors de la palette le long de l'axe, aucun couple ne l'encadre
+		search_block_pair_top_k(block_dist, block_size, DITHER_TOP_K_MIN, stats, best_idx1, best_idx2);
+		return;
+	}
+	int low_count = side_count[0];
+	uint16_t low_mask = 0;
+
+	int candidates[2 * PCA_SIDE_CANDIDATES], count = 0;
+	for (int side = 0; side < 2; ++side)
+		for (int n = 0; n < side_count[side]; ++n) candidates[count++] = side_candidates[side][n];
+	for (int n = 0; n < low_count; ++n) low_mask |= 1 << candidates[n];
+	int32_t dist[8][2 * PCA_SIDE_CANDIDATES];
+	for (int k = 0; k < block_size; ++k)
+		for (int n = 0; n < count; ++n) dist[k][n] = block_dist[k][candidates[n]];
+
+	// Couples (bas, haut) et couples d'une seule couleur, une couleur admise des deux côtés n'étant prise
+	// qu'une fois ; ex aequo : ordre des index de palette
+	int32_t best_error = INT32_MAX;
+	int bi = -1, bj = -1;
+	uint64_t scored = 0;
+	for (int a = 0; a < count; ++a) {
+		for (int b = a; b < count; ++b) {
+			if (b == a ? a >= low_count && low_mask & 1 << candidates[a]
+					   : a >= low_count || b < low_count || candidates[a] == candidates[b])
+				continue;
+			int i = MIN(candidates[a], candidates[b]), j = MAX(candidates[a], candidates[b]);
+			int32_t error = 0;
+			for (int k = 0; k < block_size && error <= best_error; ++k) error += MIN(dist[k][a], dist[k][b]);
+			scored++;
+			if (error < best_error || (error == best_error && (i < bi || (i == bi && j < bj)))) {
+				best_error = error;
+				bi = i;
+				bj = j;
+			}
+		}
+	}
+	*best_idx1 = bi;
+	*best_idx2 = bj;
+	if (stats) {
+		stats->pairs_scored += scored;
+		stats->pairs_pruned += 136 - scored;
+	}
+}
+
+// Bloc uniforme : chaque pixel a pour plus proche la même couleur n, strictement plus proche que
+// toutes les autres. Tout couple contenant n atteint alors le minimum (somme des distances à n) et
+// la recherche complète retient le premier dans l'ordre, (0, n). Renvoie n, -1 si le bloc ne l'est pas.
+static int flat_block_nearest(BlockDistances dist, int block_size)
+{
+	int nearest = -1;
+	for (int k = 0; k < block_size; ++k) {
+		int best = 0, tie = 0;
+		for (int i = 1; i < 16; ++i) {
+			if (dist[k][i] < dist[k][best]) {
+				best = i;
+				tie = 0;
+			} else if (dist[k][i] == dist[k][best]) {
+				tie = 1;
+			}
+		}
+		if (tie || (nearest >= 0 && best != nearest)) return -1;
+		nearest = best;
+	}
+	return nearest;
+}
+
+// Même test par le cache, sans parcourir les lignes : plus proche commune et strictement devant la seconde
+static int flat_block_nearest_cached(const DistanceCache *cache, const Color *block, int block_size)
+{
+	int nearest = -1;
+	for (int k = 0; k < block_size; ++k) {
+		uint32_t key = dcache_key(block[k]);
+		int best = cache->nearest[key][0];
+		if ((nearest >= 0 && best != nearest) || cache->rows[key][best] == cache->rows[key][cache->nearest[key][1]])
+			return -1;
+		nearest = best;
+	}
+	return nearest;
+}
+
+// Choix du couple d'un bloc : bloc uniforme en temps constant, sinon recherche selon options->pairs.
+// dist reçoit les distances du bloc, reprises par l'étape C.
+static void choose_block_pair(const Color *block, int block_size, const BlockPalette *pal, DistanceCache *cache,
+							  const DitherOptions *options, DitherStats *stats, BlockDistances dist, int *best_idx1,
+							  int *best_idx2)
+{
+	block_distances(block, block_size, pal, cache, dist);
+	int nearest = cache ? flat_block_nearest_cached(cache, block, block_size) : flat_block_nearest(dist, block_size);
+	if (nearest >= 0) {
+		*best_idx1 = 0;
+		*best_idx2 = nearest;
+		if (stats) stats->flat_blocks++;
+		return;
+	}
+	if (options->pairs == DITHER_PAIRS_BOUND)
+		search_block_pair_bound(dist, block_size, stats, best_idx1, best_idx2);
+	else if (options->pairs == DITHER_PAIRS_TOP_K)
+		search_block_pair_top_k(dist, block_size, options->top_k, stats, best_idx1, best_idx2);
+	else if (options->pairs == DITHER_PAIRS_PCA)
+		search_block_pair_pca(block, dist, block_size, pal->metric, stats, best_idx1, best_idx2);
+	else
+		cpu_kernels.pair_search(dist, block_size, best_idx1, best_idx2);
+}
+
+// Diffusion en lumière linéaire (--linear) : le tampon d'erreur contient des entiers, 0 à LINEAR_ONE
+// pour la lumière linéaire 0 à 1. Le passage sRGB <-> linéaire se fait par tables, les poids de la
+// matrice sont en virgule fixe (LINEAR_WEIGHT_SHIFT bits).
+#define LINEAR_ONE 65535
+#define LINEAR_WEIGHT_SHIFT 12
+#define LINEAR_MATRIX_MAX 16 // coefficients de la plus grande matrice de matrix.h : 12
+
+static int32_t linear_decode[256];				 // sRGB -> linéaire
+static uint8_t linear_encode[LINEAR_ONE + 1];	 // linéaire -> sRGB arrondi
+static int32_t linear_ostro_weights[256][3];	 // Ostromoukhov : droite, bas gauche, bas
+static int linear_ready;
+
+void dither_linear_init(void)
+{
+	if (linear_ready) return;
+	for (int i = 0; i < 256; i++) {
+		double v = i / 255.0;
+		linear_decode[i] = (int32_t)lrint(LINEAR_ONE * (v <= 0.04045 ? v / 12.92 : pow((v + 0.055) / 1.055, 2.4)));
+	}
+	for (int i = 0; i <= LINEAR_ONE; i++) {
+		double v = (double)i / LINEAR_ONE;
+		linear_encode[i] = (uint8_t)lrint(255 * (v <= 0.0031308 ? v * 12.92 : 1.055 * pow(v, 1 / 2.4) - 0.055));
+	}
+	for (int i = 0; i < 256; i++) {
+		OSTRO_COEFS oc = OSTRO_COEFS_ARRAY[i];
+		linear_ostro_weights[i][0] = (oc.i_r << LINEAR_WEIGHT_SHIFT) / oc.i_sum;
+		linear_ostro_weights[i][1] = (oc.i_dl << LINEAR_WEIGHT_SHIFT) / oc.i_sum;
+		linear_ostro_weights[i][2] = (oc.i_d << LINEAR_WEIGHT_SHIFT) / oc.i_sum;
+	}
+	linear_ready = 1;
+}
+
+static inline int32_t linear_clamp(int32_t value)
+{
+	return value < 0 ? 0 : value > LINEAR_ONE ? LINEAR_ONE : value;
+}
+
+static inline Color linear_effective_color(const int32_t *image_linear, int idx)
+{
+	Color c = {linear_encode[linear_clamp(image_linear[idx])], linear_encode[linear_clamp(image_linear[idx + 1])],
+			   linear_encode[linear_clamp(image_linear[idx + 2])], 0};
+	return c;
+}
+
+static inline void linear_add(int32_t *image_linear, int idx, const int32_t error[3], int32_t weight)
+{
+	const int32_t round = 1 << (LINEAR_WEIGHT_SHIFT - 1);
+	image_linear[idx] += (error[0] * weight + round) >> LINEAR_WEIGHT_SHIFT;
+	image_linear[idx + 1] += (error[1] * weight + round) >> LINEAR_WEIGHT_SHIFT;
+	image_linear[idx + 2] += (error[2] * weight + round) >> LINEAR_WEIGHT_SHIFT;
+}
+
+// Erreur du pixel (x, y) rendu par quantized, en lumière linéaire, diffusée par la matrice (poids
+// weights) ou par Ostromoukhov (matrix NULL). Renvoie 0 si l'erreur est nulle.
+static int diffuse_linear(int32_t *image_linear, int width, int height, int x, int y, const float *matrix,
+						  const int32_t *weights, Color old, Color quantized)
+{
+	int idx = (y * width + x) * 3;
+	int32_t error[3] = {linear_clamp(image_linear[idx]) - linear_decode[quantized.r],
+						linear_clamp(image_linear[idx + 1]) - linear_decode[quantized.g],
+						linear_clamp(image_linear[idx + 2]) - linear_decode[quantized.b]};
+	if (error[0] == 0 && error[1] == 0 && error[2] == 0) return 0;
+
+	if (matrix) {
+		int matrix_size = MIN((int)matrix[0], LINEAR_MATRIX_MAX);
+		for (int i = 0; i < matrix_size; i++) {
+			int xm = matrix[i * 3 + 1];
+			int ym = matrix[i * 3 + 2];
+			if ((x + xm < width) && (x + xm >= 0) && (y + ym < height))
+				linear_add(image_linear, ((y + ym) * width + (x + xm)) * 3, error, weights[i]);
+		}
+	} else {
+		int intensity = (int)round(0.2126 * old.r + 0.7152 * old.g + 0.0722 * old.b);
+		const int32_t *w = linear_ostro_weights[intensity];
+		if (x + 1 < width) linear_add(image_linear, idx + 3, error, w[0]);
+		if (x - 1 >= 0 && y + 1 < height) linear_add(image_linear, ((y + 1) * width + (x - 1)) * 3, error, w[1]);
+		if (y + 1 < height) linear_add(image_linear, ((y + 1) * width + x) * 3, error, w[2]);
+	}
+	return 1;
+}
+
+void block_dithering_thomson_smart_propagation_buffer(const unsigned char *original_image,
+													  DitheredPixel *dithered_image, int width, int height,
+													  int original_channels, const Color pal[16], float *matrix,
+													  double *image_float)
+{
+	block_dithering_thomson_smart_propagation_options(original_image, dithered_image, width, height,
+													  original_channels, pal, matrix, image_float, NULL);
+}
+
+void block_dithering_thomson_smart_propagation_options(const unsigned char *original_image,
+													   DitheredPixel *dithered_image, int width, int height,
+													   int original_channels, const Color pal[16], float *matrix,
+													   double *image_float, const DitherOptions *options)
+{
+	static const DitherOptions default_options = DITHER_OPTIONS_DEFAULT;
+	if (!options) options = &default_options;
+	DitherStats *stats = options->stats;
+	// -d 11 à 13 : tramage ordonné ou diffusion par points, parallèles (ordered.c)
+	if (options->ordered) {
+		ordered_dither(original_image, dithered_image, width, height, pal, options->ordered, options->threads, stats);
+		return;
+	}
+
+	// Palette projetée une fois dans l'espace de la métrique
+	BlockPalette block_palette;
+	for (int i = 0; i < 16; ++i) {
+		block_palette.metric[i] = metric_palette_color(pal[i]);
+		for (int c = 0; c < 3; ++c) block_palette.columns.c[c][i] = block_palette.metric[i].c[c];
+	}
+
+	// Cache de distances : celui de mo5, précalculé, ou un cache rempli au fil de cet appel
+	DistanceCache local_cache = {0}, *cache = NULL;
+	if (options->distance_cache) {
+		if (mo5_distance_cache.rows && mo5_distance_cache.metric == color_metric &&
+			same_palette(mo5_distance_cache.palette, pal))
+			cache = &mo5_distance_cache;
+		else if (dcache_alloc(&local_cache, pal) == 0)
+			cache = &local_cache;
+	}
+
+	// Table vidée à chaque appel : le couple mémorisé n'a de sens que pour cette palette. Celle des
+	// options sert d'un appel à l'autre, à défaut l'appel alloue la sienne
+	MemoEntry *memo = NULL;
+	DitherMemo *owned_memo = NULL;
+	if (options->memo != DITHER_MEMO_OFF) {
+		DitherMemo *table = options->memo_table ? options->memo_table : (owned_memo = dither_memo_alloc());
+		if (table) {
+			memo = table->entries;
+			for (int i = 0; i < MEMO_SIZE; i++) memo[i].idx1 = -1;
+		}
+	}
+
+	// --linear : même tampon, relu en entiers linéaires (4 octets par composante au lieu de 8)
+	int linear = options->linear_light;
+	int32_t *image_linear = (int32_t *)image_float;
+	int32_t linear_weights[LINEAR_MATRIX_MAX];
+	if (linear) {
+		dither_linear_init(); // sans effet si déjà fait au démarrage, avant les threads
+		for (int i = 0; matrix && i < MIN((int)matrix[0], LINEAR_MATRIX_MAX); i++)
+			linear_weights[i] = (int32_t)lrintf(matrix[i * 3 + 3] * (1 << LINEAR_WEIGHT_SHIFT));
+		for (int i = 0; i < width * height * 3; ++i) image_linear[i] = linear_decode[original_image[i]];
+	} else {
+		// Initialise l'image flottante avec les données de l'image originale.
+		for (int i = 0; i < width * height * 3; ++i) {
+			image_float[i] = (double)original_image[i];
+		}
 	}
 
 	for (int y = 0; y < height; ++y) {
+		int row_has_error = 0;
 		for (int x_block_start = 0; x_block_start < width; x_block_start += 8) {
 
 			// A. Préparer les "couleurs effectives" du bloc (original + erreur propagée)
@@ -424,9 +1061,13 @@ void block_dithering_thomson_smart_propagation(const unsigned char *original_ima
 				if (current_x >= width) break;
 
 				int float_idx = (y * width + current_x) * 3;
-				block_effective_colors[dx].r = (unsigned char)clamp_color_component(image_float[float_idx]);
-				block_effective_colors[dx].g = (unsigned char)clamp_color_component(image_float[float_idx + 1]);
-				block_effective_colors[dx].b = (unsigned char)clamp_color_component(image_float[float_idx + 2]);
+				if (linear) {
+					block_effective_colors[dx] = linear_effective_color(image_linear, float_idx);
+				} else {
+					block_effective_colors[dx].r = (unsigned char)clamp_color_component(image_float[float_idx]);
+					block_effective_colors[dx].g = (unsigned char)clamp_color_component(image_float[float_idx + 1]);
+					block_effective_colors[dx].b = (unsigned char)clamp_color_component(image_float[float_idx + 2]);
+				}
 				current_block_size++;
 			}
 
@@ -435,26 +1076,32 @@ void block_dithering_thomson_smart_propagation(const unsigned char *original_ima
 			// B. Trouver les 2 meilleures couleurs de palette pour ce bloc, basées sur les couleurs effectives
 			// Cette étape est cruciale : elle utilise les couleurs "pré-ditherées" (avec erreur accumulée)
 			// pour faire un meilleur choix de palette.
-			double min_total_error_sq = -1.0;
 			int best_color_idx1 = -1;
 			int best_color_idx2 = -1;
-
-			for (int i = 0; i < 16; ++i) {
-				for (int j = i; j < 16; ++j) { // j=i pour permettre le cas où une seule couleur est optimale
-					double current_pair_total_error_sq = 0.0;
-					for (int k = 0; k < current_block_size; ++k) {
-						Color effective_px_color = block_effective_colors[k];
-						double error1_sq = color_distance_sq(effective_px_color, pal[i]);
-						double error2_sq = color_distance_sq(effective_px_color, pal[j]);
-						current_pair_total_error_sq += fmin(error1_sq, error2_sq);
-					}
-
-					if (min_total_error_sq < 0 || current_pair_total_error_sq < min_total_error_sq) {
-						min_total_error_sq = current_pair_total_error_sq;
-						best_color_idx1 = i;
-						best_color_idx2 = j;
-					}
+			BlockDistances block_dist;
+			int have_dist = 1; // faux quand le couple vient de la mémoïsation
+			if (stats) stats->blocks++;
+
+			if (memo && current_block_size == 8) {
+				uint8_t key[MEMO_KEY_SIZE];
+				memo_key(block_effective_colors, options->memo, key);
+				MemoEntry *entry = &memo[memo_slot(key)];
+				if (stats) stats->memo_lookups++;
+				if (entry->idx1 >= 0 && memcmp(entry->key, key, MEMO_KEY_SIZE) == 0) {
+					best_color_idx1 = entry->idx1;
+					best_color_idx2 = entry->idx2;
+					have_dist = 0;
+					if (stats) stats->memo_hits++;
+				} else {
+					choose_block_pair(block_effective_colors, current_block_size, &block_palette, cache, options, stats, block_dist,
+									  &best_color_idx1, &best_color_idx2);
+					memcpy(entry->key, key, MEMO_KEY_SIZE);
+					entry->idx1 = (int8_t)best_color_idx1;
+					entry->idx2 = (int8_t)best_color_idx2;
 				}
+			} else {
+				choose_block_pair(block_effective_colors, current_block_size, &block_palette, cache, options, stats, block_dist,
+								  &best_color_idx1, &best_color_idx2);
 			}
 
 			// Fallback (ne devrait pas être nécessaire si la palette n'est pas vide)
@@ -471,14 +1118,33 @@ void block_dithering_thomson_smart_propagation(const unsigned char *original_ima
 				int float_idx = (y * width + current_x) * 3;
 
 				// Couleur actuelle du pixel flottant (incluant l'erreur propagée)
-				Color old_color_effective = {(unsigned char)clamp_color_component(image_float[float_idx]),
-											 (unsigned char)clamp_color_component(image_float[float_idx + 1]),
-											 (unsigned char)clamp_color_component(image_float[float_idx + 2])};
+				Color old_color_effective;
+				if (linear) {
+					old_color_effective = linear_effective_color(image_linear, float_idx);
+				} else {
+					old_color_effective.r = (unsigned char)clamp_color_component(image_float[float_idx]);
+					old_color_effective.g = (unsigned char)clamp_color_component(image_float[float_idx + 1]);
+					old_color_effective.b = (unsigned char)clamp_color_component(image_float[float_idx + 2]);
+				}
 
 				// Quantifier à la couleur de palette la plus proche PARMI LES DEUX CHOISIES POUR LE BLOC
+				// Pixel que la propagation interne au bloc n'a pas modifié : distances de l'étape B
 				int final_pixel_palette_idx;
-				double dist1_sq = color_distance_sq(old_color_effective, pal[best_color_idx1]);
-				double dist2_sq = color_distance_sq(old_color_effective, pal[best_color_idx2]);
+				int32_t dist1_sq, dist2_sq;
+				if (have_dist && old_color_effective.r == block_effective_colors[dx].r &&
+					old_color_effective.g == block_effective_colors[dx].g &&
+					old_color_effective.b == block_effective_colors[dx].b) {
+					dist1_sq = block_dist[dx][best_color_idx1];
+					dist2_sq = block_dist[dx][best_color_idx2];
+				} else if (cache) {
+					const uint16_t *row = cache->rows[dcache_lookup(cache, old_color_effective)];
+					dist1_sq = row[best_color_idx1];
+					dist2_sq = row[best_color_idx2];
+				} else {
+					MetricColor m = metric_color(old_color_effective);
+					dist1_sq = metric_distance_sq(m, block_palette.metric[best_color_idx1]);
+					dist2_sq = metric_distance_sq(m, block_palette.metric[best_color_idx2]);
+				}
 
 				if (dist1_sq < dist2_sq) {
 					final_pixel_palette_idx = best_color_idx1;
@@ -490,11 +1156,27 @@ void block_dithering_thomson_smart_propagation(const unsigned char *original_ima
 				dithered_image[y * width + current_x].palette_idx = final_pixel_palette_idx;
 				Color new_color_quantized = pal[final_pixel_palette_idx];
 
+				if (linear) {
+					if (diffuse_linear(image_linear, width, height, current_x, y, matrix, linear_weights,
+									   old_color_effective, new_color_quantized))
+						row_has_error = 1;
+					else if (stats)
+						stats->zero_error_pixels++;
+					continue;
+				}
+
 				// Calculer l'erreur de quantification
 				double error_r = (double)old_color_effective.r - new_color_quantized.r;
 				double error_g = (double)old_color_effective.g - new_color_quantized.g;
 				double error_b = (double)old_color_effective.b - new_color_quantized.b;
 
+				// Erreur nulle (aplat exactement rendu, bande noire du cadrage) : rien à propager
+				if (error_r == 0.0 && error_g == 0.0 && error_b == 0.0) {
+					if (stats) stats->zero_error_pixels++;
+					continue;
+				}
+				row_has_error = 1;
+
 				// Propager l'erreur aux voisins DANS L'IMAGE FLOTTANTE GLOBALE
 				// C'est ici que l'intelligence réside : l'erreur est propagée "normalement"
 				// mais c'est la phase de CHOIX DE PALETTE DU BLOC SUIVANT qui s'adapte.
@@ -581,55 +1263,28 @@ void block_dithering_thomson_smart_propagation(const unsigned char *original_ima
 				}
 			}
 		}
+		if (stats && !row_has_error) stats->zero_error_rows++;
 	}
-	free(image_float);
+	dither_memo_free(owned_memo);
+	if (cache == &local_cache) dcache_free(&local_cache);
 }
 
-float rgb_to_luminance(unsigned char r, unsigned char g, unsigned char b)
+void dither_stats_print(const DitherStats *stats)
 {
-	return (0.2126f * r) + (0.7152f * g) + (0.0722f * b);
+	printf("Dithering : %llu blocs", (unsigned long long)stats->blocks);
+	if (stats->memo_lookups)
+		printf(", mémoïsation %llu/%llu (%.1f %%)", (unsigned long long)stats->memo_hits,
+			   (unsigned long long)stats->memo_lookups, 100.0 * stats->memo_hits / stats->memo_lookups);
+	if (stats->pairs_scored || stats->pairs_pruned)
+		printf(", couples évalués %llu, élagués %llu", (unsigned long long)stats->pairs_scored,
+			   (unsigned long long)stats->pairs_pruned);
+	printf(", blocs uniformes %llu, pixels sans erreur %llu, lignes sans erreur %llu",
+		   (unsigned long long)stats->flat_blocks, (unsigned long long)stats->zero_error_pixels,
+		   (unsigned long long)stats->zero_error_rows);
+	printf("\n");
 }
 
-// --- Fonction de Vérification du Color Clash (essentielle) ---
-// Cette fonction reste la même et est cruciale pour valider que l'algorithme respecte la contrainte.
-bool verify_color_clash(const DitheredPixel *dithered_image, int width, int height)
+float rgb_to_luminance(unsigned char r, unsigned char g, unsigned char b)
 {
-	printf("\n--- Vérification finale du respect de la contrainte de 2 couleurs par bloc ---\n");
-	bool all_respected = true;
-	int errors_count = 0;
-
-	for (int y = 0; y < height; ++y) {
-		for (int x_block_start = 0; x_block_start < width; x_block_start += 8) {
-			int unique_colors_in_block[16] = {0};
-			int color_count = 0;
-
-			for (int dx = 0; dx < 8; ++dx) {
-				int current_x = x_block_start + dx;
-				if (current_x >= width) break;
-
-				int palette_idx = dithered_image[y * width + current_x].palette_idx;
-				if (unique_colors_in_block[palette_idx] == 0) {
-					unique_colors_in_block[palette_idx] = 1;
-					color_count++;
-				}
-			}
-
-			if (color_count > 2) {
-				all_respected = false;
-				errors_count++;
-				printf("ERREUR DÉTECTÉE: Bloc à (%d, %d) contient %d couleurs uniques.\n", x_block_start, y,
-					   color_count);
-			}
-		}
-	}
-
-	if (all_respected) {
-		printf("RÉUSSITE : Toutes les contraintes de 2 couleurs par bloc sont respectées.\n");
-	} else {
-		printf("ATTENTION : %d blocs ne respectent PAS la contrainte de 2 couleurs. "
-			   "Ceci est inattendu avec l'algorithme actuel et pourrait indiquer une erreur de logique.\n",
-			   errors_count);
-	}
-	printf("-----------------------------------------------------------------\n");
-	return all_respected;
+	return (0.2126f * r) + (0.7152f * g) + (0.0722f * b);
 }
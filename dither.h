@@ -29,6 +29,62 @@ static bool is_thomson_color_used_in_generated_palette[NUM_THOMSON_COLORS];
 
 
 
+// -d : matrices de diffusion d'erreur 0 à 9 (matrix.h), Ostromoukhov, puis les modes sans diffusion
+#define DITHER_OSTROMOUKHOV 10
+#define DITHER_BAYER 11		 // tramage ordonné, matrice de Bayer 8x8
+#define DITHER_BLUE_NOISE 12 // tramage ordonné, tuile de bruit bleu 32x32
+#define DITHER_KNUTH 13		 // diffusion par points de Knuth, matrice de classes 8x8 de blocs
+#define DITHER_MODE_MAX 13
+
+// Mémoïsation du couple de couleurs choisi par bloc (--memo) : les bandes noires du cadrage, les
+// aplats et les motifs répétés redonnent les mêmes 8 couleurs effectives
+#define DITHER_MEMO_OFF 0
+#define DITHER_MEMO_EXACT 1 // clé : les 8 couleurs effectives, rendu identique à la recherche complète
+#define DITHER_MEMO_FAST 2	// clé : 5-6-5 bits par pixel, les blocs presque identiques partagent leur couple
+
+// Recherche du couple de couleurs d'un bloc (--pairs)
+#define DITHER_PAIRS_EXHAUSTIVE 0 // les 136 couples
+#define DITHER_PAIRS_BOUND 1	  // séparation et évaluation, même résultat que l'exhaustive
+#define DITHER_PAIRS_TOP_K 2	  // --fast : couples pris parmi les top_k couleurs les plus proches de chaque pixel
+#define DITHER_PAIRS_PCA 3		  // couples encadrant le bloc sur l'axe principal de ses couleurs
+#define DITHER_TOP_K_MIN 2
+#define DITHER_TOP_K_MAX 4
+
+// Compteurs de profilage d'un ou plusieurs dithering
+typedef struct {
+	uint64_t blocks;
+	uint64_t memo_lookups, memo_hits;
+	uint64_t flat_blocks;		// une seule couleur la plus proche pour les 8 pixels : couple immédiat
+	uint64_t zero_error_pixels; // rendus exactement, sans erreur à propager
+	uint64_t zero_error_rows;
+	uint64_t pairs_scored, pairs_pruned; // --pairs bound : couples évalués jusqu'au bout ou abandonnés
+} DitherStats;
+
+// Table de mémoïsation de --memo, réutilisable d'un dithering à l'autre (un seul à la fois)
+typedef struct DitherMemo DitherMemo;
+
+// Réglages du dithering, NULL : valeurs par défaut (DITHER_OPTIONS_DEFAULT)
+typedef struct {
+	int memo;			// DITHER_MEMO_*
+	int pairs;			// DITHER_PAIRS_*
+	int top_k;			// DITHER_PAIRS_TOP_K : DITHER_TOP_K_MIN à DITHER_TOP_K_MAX
+	int distance_cache; // distances lues dans un cache par case 15 bits (approché : centre de la case)
+	int linear_light;	// erreur diffusée en lumière linéaire (entiers dans le tampon image_float)
+	int ordered;		// DITHER_BAYER, DITHER_BLUE_NOISE ou DITHER_KNUTH : moteur parallèle de ordered.c, 0 sinon
+	int threads;		// threads de ce moteur
+	DitherStats *stats; // compteurs cumulés, NULL si inutiles
+	DitherMemo *memo_table; // table de --memo vidée à chaque appel, NULL : allouée par l'appel
+} DitherOptions;
+
+#define DITHER_FAST_DEFAULT_K 3
+#define DITHER_OPTIONS_DEFAULT {DITHER_MEMO_EXACT, DITHER_PAIRS_EXHAUSTIVE, DITHER_FAST_DEFAULT_K, 0, 0, 0, 1, NULL, NULL}
+
+// Précalcule le cache de distances de la palette mo5, partagé ensuite par tous les dithering du
+// processus : à appeler une fois au démarrage, avant de lancer des threads
+void dither_distance_cache_init(void);
+// Tables sRGB <-> linéaire de --linear, même contrainte
+void dither_linear_init(void);
+
 double distance_squared(unsigned char r1, unsigned char g1, unsigned char b1, unsigned char r2, unsigned char g2,
 						unsigned char b2);
 int find_closest_thomson_idx(unsigned char r, unsigned char g, unsigned char b,
@@ -37,7 +93,20 @@ unsigned char clamp_color_component(double val);
 
 void block_dithering_thomson_smart_propagation(const unsigned char *original_image, DitheredPixel *dithered_image,
 											   int width, int height, int original_channels, const Color pal[16], float *matrix);
-bool verify_color_clash(const DitheredPixel *dithered_image, int width, int height);
+// Variante sans allocation : image_float doit contenir width * height * 3 doubles (tampon d'erreur)
+void block_dithering_thomson_smart_propagation_buffer(const unsigned char *original_image,
+													  DitheredPixel *dithered_image, int width, int height,
+													  int original_channels, const Color pal[16], float *matrix,
+													  double *image_float);
+// Variante réglable : options NULL équivaut à block_dithering_thomson_smart_propagation_buffer
+void block_dithering_thomson_smart_propagation_options(const unsigned char *original_image,
+													   DitheredPixel *dithered_image, int width, int height,
+													   int original_channels, const Color pal[16], float *matrix,
+													   double *image_float, const DitherOptions *options);
+DitherMemo *dither_memo_alloc(void); // NULL si la mémoire manque
+void dither_memo_free(DitherMemo *memo);
+void dither_stats_print(const DitherStats *stats);
+float rgb_to_luminance(unsigned char r, unsigned char g, unsigned char b);
 void generate_palette_wu_thomson_aware(uint8_t *framed_image, int width, int height,
 									   Color thomson_palette_source[NUM_THOMSON_COLORS],
 									   Color generated_palette[PALETTE_SIZE]);
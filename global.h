@@ -7,4 +7,7 @@
 #define NUM_THOMSON_COLORS 4096
 #define COLOR_COMP 3
 
+// Messages de progression (coupés en mode batch)
+extern int clash_verbose;
+
 #endif // !GLOBAL_H
@@ -1,5 +1,7 @@
 #include "global.h"
 #include "image.h"
+#include "platform.h"
+#include "cpu.h"
 #include <math.h>
 #include <stdio.h>
 #include <string.h>
@@ -11,6 +13,7 @@
 #define STB_IMAGE_RESIZE2_IMPLEMENTATION
 #include <stb_image_resize2.h>
 
+int clash_verbose = 1;
 
 static inline unsigned long get_color_hash_index(uint8_t r, uint8_t g, uint8_t b)
 {
@@ -55,6 +58,15 @@ long count_unique_colors_hashed(const unsigned char *image_data, int width, int
 	return unique_colors_count;
 }
 
+void resized_dimensions(const int ix, const int iy, int *ox, int *oy)
+{
+	float ratioX = ix / 320.0, ratioY = 0, ratio;
+	if (iy > 200) ratioY = iy / 200.0;
+	ratio = fmax(ratioX, ratioY);
+	*ox = ix / ratio;
+	*oy = iy / ratio;
+}
+
 uint8_t *resize_if_necessary(const uint8_t *inputImage, const int ix, const int iy, uint8_t *resizedImage, int *ox,
 							 int *oy)
 {
@@ -62,26 +74,26 @@ uint8_t *resize_if_necessary(const uint8_t *inputImage, const int ix, const int
 	int doResize = 0;
 
 	ratioX = ix / 320.0;
-	printf("ratio x -> %f\n", ratioX);
+	if (clash_verbose) printf("ratio x -> %f\n", ratioX);
 	doResize = 1;
 
 	if (iy > 200) {
 		ratioY = iy / 200.0;
-		printf("ratio y -> %f\n", ratioY);
+		if (clash_verbose) printf("ratio y -> %f\n", ratioY);
 		doResize = 1;
 	}
 
 	if (doResize) {
 		ratio = fmax(ratioX, ratioY);
-		printf("ratio -> %f\n", ratio);
+		if (clash_verbose) printf("ratio -> %f\n", ratio);
 
 		int xx, yy;
-		xx = ix / ratio;
-		yy = iy / ratio;
+		resized_dimensions(ix, iy, &xx, &yy);
 
-		printf("Nouvelles dimensions %d*%d\n", xx, yy);
+		if (clash_verbose) printf("Nouvelles dimensions %d*%d\n", xx, yy);
 
-		resizedImage = malloc(xx * yy * COLOR_COMP);
+		// Un tampon fourni par l'appelant doit contenir resized_dimensions() pixels
+		if (!resizedImage) resizedImage = malloc(xx * yy * COLOR_COMP);
 		stbir_resize_uint8_linear(inputImage, ix, iy, COLOR_COMP * ix, resizedImage, xx, yy, xx * COLOR_COMP,
 								  COLOR_COMP);
 		*ox = xx;
@@ -96,7 +108,7 @@ uint8_t *frame_into_canvas(const uint8_t *inputData, int ix, int iy, uint8_t *ou
 	int targetw = 320;
 	int targeth = 200;
 
-	outputData = malloc(targetw * targeth * COLOR_COMP);
+	if (!outputData) outputData = malloc(targetw * targeth * COLOR_COMP);
 	if (outputData) {
 		memset(outputData, 0, targetw * targeth * COLOR_COMP);
 		int k = 0, l = 0;
@@ -119,6 +131,13 @@ uint8_t *frame_into_canvas(const uint8_t *inputData, int ix, int iy, uint8_t *ou
 	return NULL;
 }
 
+void convert_rgb_to_rgba_buffer(const unsigned char *src_image_data, unsigned char *dest_image_data, int width,
+								int height)
+{
+	// Alpha opaque ; noyau choisi selon le processeur (cpu_select)
+	cpu_kernels.rgb_to_rgba(src_image_data, dest_image_data, width * height);
+}
+
 unsigned char *convert_rgb_to_rgba(const unsigned char *src_image_data, int width, int height)
 {
 	if (src_image_data == NULL || width <= 0 || height <= 0) {
@@ -126,7 +145,6 @@ unsigned char *convert_rgb_to_rgba(const unsigned char *src_image_data, int widt
 		return NULL;
 	}
 
-	const int src_components = 3;  // RVB
 	const int dest_components = 4; // RGBA
 	long total_pixels = (long)width * height;
 
@@ -138,22 +156,16 @@ unsigned char *convert_rgb_to_rgba(const unsigned char *src_image_data, int widt
 		return NULL;
 	}
 
-	for (long i = 0; i < total_pixels; ++i) {
-		long src_pixel_index = i * src_components;
-		long dest_pixel_index = i * dest_components;
-
-		// Vérification de débordement pour éviter l'accès hors limites
-		if ((dest_pixel_index + 3) < (long)dest_data_size && (src_pixel_index + 2) < (long)(total_pixels * src_components)) {
-			dest_image_data[dest_pixel_index + 0] = src_image_data[src_pixel_index + 0]; // R
-			dest_image_data[dest_pixel_index + 1] = src_image_data[src_pixel_index + 1]; // G
-			dest_image_data[dest_pixel_index + 2] = src_image_data[src_pixel_index + 2]; // B
-			dest_image_data[dest_pixel_index + 3] = 255; // Alpha (opaque)
-		}
-	}
-
+	convert_rgb_to_rgba_buffer(src_image_data, dest_image_data, width, height);
 	return dest_image_data;
 }
 
+void convert_rgba_to_rgb_buffer(const unsigned char *rgba, unsigned char *rgb, int width, int height)
+{
+    // Alpha ignoré
+    cpu_kernels.rgba_to_rgb(rgba, rgb, width * height);
+}
+
 unsigned char *convert_rgba_to_rgb(const unsigned char* rgba, int width, int height) {
     if (!rgba || width <= 0 || height <= 0) return NULL;
 
@@ -161,15 +173,36 @@ unsigned char *convert_rgba_to_rgb(const unsigned char* rgba, int width, int hei
     uint8_t* rgb = malloc(total_pixels * 3);
     if (!rgb) return NULL;
 
-    for (int i = 0; i < total_pixels; i++) {
-        rgb[i * 3 + 0] = rgba[i * 4 + 0]; // R
-        rgb[i * 3 + 1] = rgba[i * 4 + 1]; // G
-        rgb[i * 3 + 2] = rgba[i * 4 + 2]; // B
-        // Alpha (rgba[i * 4 + 3]) est ignoré
-    }
-
+    convert_rgba_to_rgb_buffer(rgba, rgb, width, height);
     return rgb;
 }
 
+uint8_t *read_file_bytes(const char *filename, size_t *size)
+{
+	FILE *f;
+	if (strcmp(filename, "-") == 0) {
+		platform_binary_stdin();
+		f = stdin;
+	} else {
+		f = fopen(filename, "rb");
+	}
+	if (!f) return NULL;
+
+	// Lecture par blocs : la taille d'un pipe n'est pas connue à l'avance
+	size_t capacity = 1 << 16, length = 0, lu;
+	uint8_t *data = malloc(capacity);
+	while (data && (lu = fread(data + length, 1, capacity - length, f)) > 0) {
+		length += lu;
+		if (length == capacity) {
+			capacity *= 2;
+			uint8_t *tmp = realloc(data, capacity);
+			if (!tmp) free(data);
+			data = tmp;
+		}
+	}
+	if (f != stdin) fclose(f);
 
+	*size = length;
+	return data;
+}
 
@@ -21,6 +21,11 @@ void push_back(IntVector *vec, uint8_t value)
 	vec->data[vec->size++] = value;
 }
 
+void clear_vector(IntVector *vec)
+{
+	vec->size = 0;
+}
+
 void free_vector(IntVector *vec)
 {
 	free(vec->data);
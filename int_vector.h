@@ -13,6 +13,7 @@ typedef struct {
 
 void init_vector(IntVector *vec);
 void push_back(IntVector *vec, uint8_t value);
+void clear_vector(IntVector *vec);
 void free_vector(IntVector *vec);
 
 #endif // ! INT_VECTOR
\ No newline at end of file
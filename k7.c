@@ -1,4 +1,5 @@
 #include "k7.h"
+#include "int_vector.h"
 #include <string.h>
 
 /*******************************************************************************
@@ -42,51 +43,66 @@ void ecrireBloc(FILE *k7, const char typeBloc, const char data[], int len)
 	fwrite(&chksum, 1, 1, k7);
 }
 
+void ajouterDonnees(FILE *k7, const char *filename, const uint8_t *contenu, size_t taille_contenu)
+{
+	char data[256];
+	memset(data, 0, sizeof(data));
+
+	int point = strcspn(filename, ".");
+	strncpy(data, filename, point);
+	for (int i = point; i < 8; i++) strcat(data, " ");
+	strcat(data, &filename[point + 1]);
+	// if (strncmp(&filename[point + 1], "BIN", 3) == 0) data[11] = 0x02;
+	if (strncmp(&filename[point + 1], "BIN", 3) == 0 || strncmp(&filename[point + 1], "MAP", 3) == 0)
+		data[11] = 0x02;
+	//- Bloc d'en-tete (type 00)
+	// 00 type de bloc = 00
+	// 01 longueur du bloc = &h10
+	// 02-09 nom du fichier
+	// 0A-0C extension (sans le point)
+	// 0D type de fichier 00=Basic 01=Data 02=Binaire
+	// 0E mode du fichier 00=Binaire FF=Texte
+	// 0F identique à l'octet precedent (a verifier)
+	// 10 checksum
+	ecrireBloc(k7, 0x00, data, 14);
+
+	size_t position = 0;
+	int taille = 254;
+	while (taille == 254) {
+		taille = taille_contenu - position > 254 ? 254 : (int)(taille_contenu - position);
+		if (taille > 0) memcpy(data, contenu + position, taille);
+		position += taille;
+		//- Blocs contenant le fichier (type 01)
+		// 00 type de bloc = 01
+		// 01 longueur du bloc = xx (attention, &h00 signifie 256)
+		// 02-yy contenu du fichier (yy = xx -1)
+		// xx checksum
+		ecrireBloc(k7, 0x01, data, taille);
+	}
+
+	memset(data, 0, sizeof(data));
+	//- Bloc de fin (type FF)
+	// 00 type de bloc = FF
+	// 01 longueur du bloc = 02
+	// 02 checksum = 00
+	ecrireBloc(k7, 0xff, data, 0);
+}
+
 void ajouterFichier(FILE *k7, char *filename)
 {
 	FILE *f = fopen(filename, "rb");
 	if (f == NULL) {
 		printf("impossible d'ouvrir %s\n", filename);
 	} else {
-		char data[256];
-		memset(data, 0, sizeof(data));
-
-		int point = strcspn(filename, ".");
-		strncpy(data, filename, point);
-		for (int i = point; i < 8; i++) strcat(data, " ");
-		strcat(data, &filename[point + 1]);
-		// if (strncmp(&filename[point + 1], "BIN", 3) == 0) data[11] = 0x02;
-		if (strncmp(&filename[point + 1], "BIN", 3) == 0 || strncmp(&filename[point + 1], "MAP", 3) == 0)
-			data[11] = 0x02;
-		//- Bloc d'en-tete (type 00)
-		// 00 type de bloc = 00
-		// 01 longueur du bloc = &h10
-		// 02-09 nom du fichier
-		// 0A-0C extension (sans le point)
-		// 0D type de fichier 00=Basic 01=Data 02=Binaire
-		// 0E mode du fichier 00=Binaire FF=Texte
-		// 0F identique à l'octet precedent (a verifier)
-		// 10 checksum
-		ecrireBloc(k7, 0x00, data, 14);
-
-		int taille = 254;
-		while (taille == 254) {
-			taille = fread(data, 1, 254, f);
-			//- Blocs contenant le fichier (type 01)
-			// 00 type de bloc = 01
-			// 01 longueur du bloc = xx (attention, &h00 signifie 256)
-			// 02-yy contenu du fichier (yy = xx -1)
-			// xx checksum
-			ecrireBloc(k7, 0x01, data, taille);
-		}
-
-		memset(data, 0, sizeof(data));
-		//- Bloc de fin (type FF)
-		// 00 type de bloc = FF
-		// 01 longueur du bloc = 02
-		// 02 checksum = 00
-		ecrireBloc(k7, 0xff, data, 0);
-
+		// Le nom inscrit sur la k7 est le nom du fichier disque
+		IntVector contenu;
+		uint8_t buffer[254];
+		size_t lu;
+		init_vector(&contenu);
+		while ((lu = fread(buffer, 1, sizeof(buffer), f)) > 0)
+			for (size_t i = 0; i < lu; i++) push_back(&contenu, buffer[i]);
+		ajouterDonnees(k7, filename, contenu.data, contenu.size);
+		free_vector(&contenu);
 		fclose(f);
 	}
 }
@@ -3,7 +3,9 @@
 
 #include <memory.h>
 #include <stdio.h>
+#include <stdint.h>
 
 void ajouterFichier(FILE *k7, char *filename);
+void ajouterDonnees(FILE *k7, const char *filename, const uint8_t *contenu, size_t taille_contenu);
 
 #endif
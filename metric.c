@@ -0,0 +1,86 @@
+#include <math.h>
+#include "metric.h"
+
+int color_metric = METRIC_RGB;
+uint8_t metric_level[256];
+MetricColor metric_table[METRIC_TABLE_SIZE];
+MetricColor metric_thomson[METRIC_THOMSON_COLORS];
+static int metric_ready;
+
+static Color thomson_color(int index)
+{
+	Color c;
+	c.r = red_255[index & 15].r;
+	c.g = green_255[(index >> 4) & 15].g;
+	c.b = blue_255[(index >> 8) & 15].b;
+	c.thomson_idx = (uint16_t)index;
+	return c;
+}
+
+static double srgb_to_linear(int value)
+{
+	double v = value / 255.0;
+	return v <= 0.04045 ? v / 12.92 : pow((v + 0.055) / 1.055, 2.4);
+}
+
+// OKLab exact, en double, de composantes linéaires
+static MetricColor oklab(double r, double g, double b)
+{
+	double l = cbrt(0.4122214708 * r + 0.5363325363 * g + 0.0514459929 * b);
+	double m = cbrt(0.2119034982 * r + 0.6806995451 * g + 0.1073969566 * b);
+	double s = cbrt(0.0883024619 * r + 0.2817188376 * g + 0.6299787005 * b);
+	MetricColor c;
+	c.c[0] = (int16_t)lrint(OKLAB_SCALE * (0.2104542553 * l + 0.7936177850 * m - 0.0040720468 * s));
+	c.c[1] = (int16_t)lrint(OKLAB_SCALE * (1.9779984951 * l - 2.4285922050 * m + 0.4505937099 * s));
+	c.c[2] = (int16_t)lrint(OKLAB_SCALE * (0.0259040371 * l + 0.7827717662 * m - 0.8086757660 * s));
+	return c;
+}
+
+void metric_select(int metric)
+{
+	color_metric = metric;
+	if (metric != METRIC_OKLAB || metric_ready) return;
+	// Niveaux : racine cubique de la lumière linéaire découpée en parts égales, comme le fait OKLab ;
+	// chaque niveau est représenté par la valeur médiane de ses composantes
+	const int levels = 1 << METRIC_LEVEL_BITS;
+	int first[1 << METRIC_LEVEL_BITS], last[1 << METRIC_LEVEL_BITS];
+	for (int k = 0; k < levels; k++) first[k] = last[k] = -1;
+	for (int v = 0; v < 256; v++) {
+		int k = (int)(levels * cbrt(srgb_to_linear(v)));
+		k = k < levels ? k : levels - 1;
+		metric_level[v] = (uint8_t)k;
+		if (first[k] < 0) first[k] = v;
+		last[k] = v;
+	}
+	double linear[1 << METRIC_LEVEL_BITS];
+	for (int k = 0; k < levels; k++) linear[k] = first[k] < 0 ? 0 : srgb_to_linear((first[k] + last[k] + 1) / 2);
+	for (int i = 0; i < METRIC_TABLE_SIZE; i++) {
+		int r = i >> (2 * METRIC_LEVEL_BITS), g = (i >> METRIC_LEVEL_BITS) & (levels - 1), b = i & (levels - 1);
+		metric_table[i] = oklab(linear[r], linear[g], linear[b]);
+	}
+	for (int i = 0; i < METRIC_THOMSON_COLORS; i++) {
+		Color c = thomson_color(i);
+		metric_thomson[i] = oklab(srgb_to_linear(c.r), srgb_to_linear(c.g), srgb_to_linear(c.b));
+	}
+	metric_ready = 1;
+}
+
+void metric_snap_to_thomson(Color c, Color *snapped)
+{
+	if (color_metric != METRIC_OKLAB) {
+		snap_to_thomson(c, snapped);
+		return;
+	}
+	// Le treillis n'est plus séparable : les 4096 points sont comparés
+	MetricColor target = metric_color(c);
+	int best = 0;
+	int32_t best_dist = metric_distance_sq(target, metric_thomson[0]);
+	for (int i = 1; i < METRIC_THOMSON_COLORS; i++) {
+		int32_t dist = metric_distance_sq(target, metric_thomson[i]);
+		if (dist < best_dist) {
+			best_dist = dist;
+			best = i;
+		}
+	}
+	*snapped = thomson_color(best);
+}
@@ -0,0 +1,67 @@
+#ifndef METRIC_H
+#define METRIC_H
+
+#include <stdint.h>
+#include "thomson.h"
+
+// Métrique des distances couleur (--metric) : les couleurs sont projetées dans un espace de
+// coordonnées entières où la distance est euclidienne, au même coût que la distance RGB
+#define METRIC_RGB 0   // r, g, b tels quels
+#define METRIC_OKLAB 1 // OKLab perceptuel : L, a, b multipliés par OKLAB_SCALE
+
+#define OKLAB_SCALE 256				 // L de 0 à 256 : distance maximale ~100000, comme en RGB
+#define METRIC_LEVEL_BITS 5			 // niveaux par composante de la table OKLab
+#define METRIC_TABLE_SIZE (1 << (3 * METRIC_LEVEL_BITS))
+#define METRIC_THOMSON_COLORS 4096	 // treillis Thomson, index 12 bits r + 16 g + 256 b
+
+typedef struct {
+	int16_t c[3];
+} MetricColor;
+
+// Métrique du processus, METRIC_RGB par défaut
+extern int color_metric;
+// Tables OKLab construites par metric_select : niveau de chaque composante (32 niveaux espacés
+// uniformément en racine cubique de la lumière linéaire, plus fins dans les sombres), couleur OKLab
+// de chaque triplet de niveaux, treillis Thomson
+extern uint8_t metric_level[256];
+extern MetricColor metric_table[METRIC_TABLE_SIZE];
+extern MetricColor metric_thomson[METRIC_THOMSON_COLORS];
+
+// Choisit la métrique et construit ses tables : à appeler au démarrage, avant les threads
+void metric_select(int metric);
+
+// Couleur quelconque : une lecture dans la table des niveaux, approchée à 5 unités près
+// (OKLAB_SCALE 256, moyenne 2) ; les couleurs du treillis restent exactes (metric_palette_color)
+static inline MetricColor metric_color(Color c)
+{
+	MetricColor m;
+	if (color_metric != METRIC_OKLAB) {
+		m.c[0] = c.r;
+		m.c[1] = c.g;
+		m.c[2] = c.b;
+		return m;
+	}
+	return metric_table[metric_level[c.r] << (2 * METRIC_LEVEL_BITS) | metric_level[c.g] << METRIC_LEVEL_BITS |
+						metric_level[c.b]];
+}
+
+// Couleur de palette : lue dans la table du treillis quand elle en est un point (thomson_idx renseigné)
+static inline MetricColor metric_palette_color(Color c)
+{
+	int r = c.thomson_idx & 15, g = (c.thomson_idx >> 4) & 15, b = (c.thomson_idx >> 8) & 15;
+	if (color_metric == METRIC_OKLAB && c.thomson_idx < METRIC_THOMSON_COLORS && red_255[r].r == c.r &&
+		green_255[g].g == c.g && blue_255[b].b == c.b)
+		return metric_thomson[c.thomson_idx];
+	return metric_color(c);
+}
+
+static inline int32_t metric_distance_sq(MetricColor a, MetricColor b)
+{
+	int d0 = a.c[0] - b.c[0], d1 = a.c[1] - b.c[1], d2 = a.c[2] - b.c[2];
+	return d0 * d0 + d1 * d1 + d2 * d2;
+}
+
+// Point du treillis Thomson le plus proche de c au sens de la métrique (thomson_idx renseigné)
+void metric_snap_to_thomson(Color c, Color *snapped);
+
+#endif // !METRIC_H
@@ -0,0 +1,554 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cpu.h"
+#include "global.h"
+#include "metric.h"
+#include "platform.h"
+#include "ordered.h"
+
+#define BLOCK_SIZE 8
+#define MAX_TASKS 64
+#define BLUE_NOISE_CELLS (ORDERED_BLUE_NOISE_SIZE * ORDERED_BLUE_NOISE_SIZE)
+#define BLUE_NOISE_SIGMA 1.5f	  // écart type de la gaussienne d'énergie, en pixels
+#define BLUE_NOISE_SEED_DENSITY 10 // un pixel sur 10 allumé dans le motif initial
+
+static uint16_t blue_noise_rank[BLUE_NOISE_CELLS];
+static int blue_noise_ready;
+
+// --- Tuile de bruit bleu : void-and-cluster d'Ulichney ---
+
+// Énergie de chaque case : somme des gaussiennes (sur le tore) centrées sur les pixels allumés
+static void energy_update(float *energy, const float *gaussian, int cell, float sign)
+{
+	const int size = ORDERED_BLUE_NOISE_SIZE;
+	int cx = cell % size, cy = cell / size;
+	for (int y = 0; y < size; y++)
+		for (int x = 0; x < size; x++)
+			energy[y * size + x] += sign * gaussian[((y - cy) & (size - 1)) * size + ((x - cx) & (size - 1))];
+}
+
+// lit = 1 : le pixel allumé de plus forte énergie (amas le plus serré) ;
+// lit = 0 : le pixel éteint de plus faible énergie (plus grand vide)
+static int extreme_cell(const float *energy, const uint8_t *pattern, int lit)
+{
+	int best = -1;
+	for (int i = 0; i < BLUE_NOISE_CELLS; i++) {
+		if (pattern[i] != lit) continue;
+		if (best < 0 || (lit ? energy[i] > energy[best] : energy[i] < energy[best])) best = i;
+	}
+	return best;
+}
+
+static void toggle_cell(uint8_t *pattern, float *energy, const float *gaussian, int cell)
+{
+	pattern[cell] = !pattern[cell];
+	energy_update(energy, gaussian, cell, pattern[cell] ? 1.0f : -1.0f);
+}
+
+void ordered_blue_noise_init(void)
+{
+	if (blue_noise_ready) return;
+	const int size = ORDERED_BLUE_NOISE_SIZE;
+	static float gaussian[BLUE_NOISE_CELLS], energy[BLUE_NOISE_CELLS], work_energy[BLUE_NOISE_CELLS];
+	static uint8_t pattern[BLUE_NOISE_CELLS], work[BLUE_NOISE_CELLS];
+	for (int dy = 0; dy < size; dy++) {
+		for (int dx = 0; dx < size; dx++) {
+			int ex = dx < size - dx ? dx : size - dx, ey = dy < size - dy ? dy : size - dy;
+			gaussian[dy * size + dx] = expf(-(float)(ex * ex + ey * ey) / (2 * BLUE_NOISE_SIGMA * BLUE_NOISE_SIGMA));
+		}
+	}
+
+	// Motif initial pseudo-aléatoire, graine fixe : la même tuile à chaque exécution
+	memset(pattern, 0, sizeof(pattern));
+	memset(energy, 0, sizeof(energy));
+	uint32_t seed = 1;
+	int ones = 0;
+	while (ones < BLUE_NOISE_CELLS / BLUE_NOISE_SEED_DENSITY) {
+		seed = seed * 1664525u + 1013904223u;
+		int cell = (seed >> 16) & (BLUE_NOISE_CELLS - 1);
+		if (pattern[cell]) continue;
+		toggle_cell(pattern, energy, gaussian, cell);
+		ones++;
+	}
+	// Motif prototype : l'amas le plus serré passe dans le plus grand vide, jusqu'à ce qu'il y revienne
+	for (int i = 0; i < BLUE_NOISE_CELLS; i++) {
+		int cluster = extreme_cell(energy, pattern, 1);
+		toggle_cell(pattern, energy, gaussian, cluster);
+		int hole = extreme_cell(energy, pattern, 0);
+		toggle_cell(pattern, energy, gaussian, hole);
+		if (hole == cluster) break;
+	}
+
+	// Pixels du prototype : les amas retirés un à un prennent les rangs décroissants
+	memcpy(work, pattern, sizeof(work));
+	memcpy(work_energy, energy, sizeof(work_energy));
+	for (int rank = ones - 1; rank >= 0; rank--) {
+		int cluster = extreme_cell(work_energy, work, 1);
+		toggle_cell(work, work_energy, gaussian, cluster);
+		blue_noise_rank[cluster] = (uint16_t)rank;
+	}
+	// Les autres : les vides comblés un à un prennent les rangs croissants. Au-delà de la moitié, l'amas
+	// d'éteints le plus serré est aussi le plus grand vide, la somme des deux énergies étant constante.
+	for (int rank = ones; rank < BLUE_NOISE_CELLS; rank++) {
+		int hole = extreme_cell(energy, pattern, 0);
+		toggle_cell(pattern, energy, gaussian, hole);
+		blue_noise_rank[hole] = (uint16_t)rank;
+	}
+	blue_noise_ready = 1;
+}
+
+// --- Tramage ordonné par bloc ---
+
+// Lot de lignes traité par un thread
+typedef struct {
+	const unsigned char *image;
+	DitheredPixel *dithered;
+	int width, first_row, last_row;
+	const MetricColor *palette; // palette dans l'espace de la métrique
+	const float *thresholds; // tuile de seuils dans ]0, 1[, côté 1 << tile_shift
+	int tile_shift;
+	DitherStats stats;
+} OrderedTask;
+
+// Les deux couleurs de la palette les plus proches de target
+static void nearest_colors(const MetricColor palette[PALETTE_SIZE], MetricColor target, int *first, int *second)
+{
+	int32_t d[PALETTE_SIZE];
+	for (int i = 0; i < PALETTE_SIZE; i++) d[i] = metric_distance_sq(target, palette[i]);
+	int best = 0, next = 1;
+	if (d[1] < d[0]) {
+		best = 1;
+		next = 0;
+	}
+	for (int i = 2; i < PALETTE_SIZE; i++) {
+		if (d[i] < d[best]) {
+			next = best;
+			best = i;
+		} else if (d[i] < d[next]) {
+			next = i;
+		}
+	}
+	*first = best;
+	*second = next;
+}
+
+// Bloc dans l'espace de la métrique, en couleurs et par plans de composantes ; les pixels absents
+// (bord droit) copient le premier, avec un poids nul
+static void block_planes(const Color *colors, int block_size, MetricColor block[BLOCK_SIZE],
+						 float pixels[3][BLOCK_SIZE], float weight[BLOCK_SIZE])
+{
+	for (int k = 0; k < BLOCK_SIZE; k++) {
+		block[k] = metric_color(colors[k < block_size ? k : 0]);
+		weight[k] = k < block_size ? 1.0f : 0.0f;
+		for (int c = 0; c < 3; c++) pixels[c][k] = block[k].c[c];
+	}
+}
+
+// Couple dont les mélanges rendent le mieux le bloc, une seule couleur comprise
+static void choose_pair(const MetricColor palette[PALETTE_SIZE], const MetricColor *block, int block_size,
+						const float pixels[3][BLOCK_SIZE], const float weight[BLOCK_SIZE], int *pair_a, int *pair_b)
+{
+	// Candidates : les deux couleurs les plus proches de la moyenne et les plus proches des deux
+	// extrémités du bloc (pixel le plus loin de la moyenne, puis le plus loin de celui-ci)
+	int32_t mean[3] = {0, 0, 0};
+	for (int k = 0; k < block_size; k++)
+		for (int c = 0; c < 3; c++) mean[c] += block[k].c[c];
+	MetricColor average;
+	for (int c = 0; c < 3; c++) average.c[c] = (int16_t)(mean[c] / block_size);
+	int far = 0, opposite = 0;
+	for (int k = 1; k < block_size; k++)
+		if (metric_distance_sq(block[k], average) > metric_distance_sq(block[far], average)) far = k;
+	for (int k = 1; k < block_size; k++)
+		if (metric_distance_sq(block[k], block[far]) > metric_distance_sq(block[opposite], block[far])) opposite = k;
+	int first, second;
+	nearest_colors(palette, average, &first, &second);
+	uint16_t candidates = 1 << first | 1 << second;
+	if (metric_distance_sq(block[far], block[opposite]) > 0) {
+		int unused;
+		nearest_colors(palette, block[far], &first, &unused);
+		nearest_colors(palette, block[opposite], &second, &unused);
+		candidates |= 1 << first | 1 << second;
+	}
+
+	int list[PALETTE_SIZE], count = 0;
+	for (int i = 0; i < PALETTE_SIZE; i++)
+		if (candidates & 1 << i) list[count++] = i;
+	float best_error = INFINITY;
+	for (int u = 0; u < count; u++) {
+		for (int v = u; v < count; v++) {
+			float error = cpu_kernels.segment_error(pixels, weight, palette[list[u]], palette[list[v]]);
+			if (error < best_error) {
+				best_error = error;
+				*pair_a = list[u];
+				*pair_b = list[v];
+			}
+		}
+	}
+}
+
+// Bloc de block_size pixels en (x0, y) ; reuse : le bloc précédent de la ligne a les mêmes pixels,
+// son couple (*pair_a, *pair_b) est repris
+static void ordered_block(OrderedTask *task, int y, int x0, int block_size, int reuse, int *pair_a, int *pair_b)
+{
+	Color colors[BLOCK_SIZE];
+	for (int k = 0; k < block_size; k++) {
+		const unsigned char *p = task->image + ((size_t)y * task->width + x0 + k) * COLOR_COMP;
+		colors[k] = (Color){p[0], p[1], p[2], 0};
+	}
+	MetricColor block[BLOCK_SIZE];
+	float pixels[3][BLOCK_SIZE], weight[BLOCK_SIZE];
+	block_planes(colors, block_size, block, pixels, weight);
+	if (!reuse) choose_pair(task->palette, block, block_size, pixels, weight, pair_a, pair_b);
+
+	// Seuillage : position du pixel entre a et b comparée au seuil de la tuile. x0 est multiple de 8 et
+	// les tuiles ont 8 ou 32 colonnes : les 8 seuils du bloc se suivent dans la ligne de la tuile
+	int mask = (1 << task->tile_shift) - 1;
+	const float *thresholds = task->thresholds + ((y & mask) << task->tile_shift) + (x0 & mask);
+	int bits = cpu_kernels.threshold_mask(pixels, thresholds, task->palette[*pair_a], task->palette[*pair_b]);
+	DitheredPixel *out = task->dithered + (size_t)y * task->width + x0;
+	for (int k = 0; k < block_size; k++) out[k].palette_idx = (uint8_t)(bits >> k & 1 ? *pair_b : *pair_a);
+
+	task->stats.blocks++;
+	if (*pair_a == *pair_b) task->stats.flat_blocks++;
+}
+
+static void *ordered_rows(void *arg)
+{
+	OrderedTask *task = arg;
+	const size_t row_bytes = (size_t)task->width * COLOR_COMP, block_bytes = BLOCK_SIZE * COLOR_COMP;
+	for (int y = task->first_row; y < task->last_row; y++) {
+		const unsigned char *row = task->image + y * row_bytes;
+		int pair_a = 0, pair_b = 0;
+		for (int x = 0; x < task->width; x += BLOCK_SIZE) {
+			int block_size = task->width - x < BLOCK_SIZE ? task->width - x : BLOCK_SIZE;
+			int reuse = x > 0 && block_size == BLOCK_SIZE &&
+						memcmp(row + x * COLOR_COMP, row + x * COLOR_COMP - block_bytes, block_bytes) == 0;
+			task->stats.memo_lookups += x > 0;
+			task->stats.memo_hits += reuse;
+			ordered_block(task, y, x, block_size, reuse, &pair_a, &pair_b);
+		}
+	}
+	return NULL;
+}
+
+// --- Diffusion par points de Knuth (-d 13) ---
+
+#define DOT_TILE 8							   // matrice de classes 8x8, une case par bloc
+#define DOT_TILE_WIDTH (DOT_TILE * BLOCK_SIZE) // la tuile couvre 64x8 pixels
+#define DOT_NEIGHBORS 8
+
+// Matrice de classes de Knuth (« Digital halftones by dot diffusion », 1987) : deux barons seulement
+// (62 et 63, sans voisin de classe supérieure), et deux classes consécutives ne se touchent pas
+static const uint8_t knuth_classes[DOT_TILE][DOT_TILE] = {
+	{34, 48, 40, 32, 29, 15, 23, 31}, {42, 58, 56, 53, 21, 5, 7, 10}, {50, 62, 61, 45, 13, 1, 2, 18},
+	{38, 46, 54, 37, 25, 17, 9, 26},  {28, 14, 22, 30, 35, 49, 41, 33}, {20, 4, 6, 11, 43, 59, 57, 52},
+	{12, 0, 3, 19, 51, 63, 60, 44},	  {24, 16, 8, 27, 39, 47, 55, 36}};
+
+// Voisins d'un pixel ; poids 2 pour les côtés, 1 pour les diagonales
+static const int dot_dx[DOT_NEIGHBORS] = {-1, 0, 1, -1, 1, -1, 0, 1};
+static const int dot_dy[DOT_NEIGHBORS] = {-1, -1, -1, 0, 0, 1, 1, 1};
+static const float dot_weight[DOT_NEIGHBORS] = {1, 2, 1, 2, 2, 1, 2, 1};
+#define DOT_LEFT 3 // voisin de gauche, dans le même bloc sauf pour le premier pixel
+
+// Barrière entre deux classes : tous les blocs d'une classe sont traités avant la suivante
+typedef struct {
+	platform_mutex lock;
+	platform_cond cond;
+	int count, waiting, generation;
+} PhaseBarrier;
+
+static void phase_barrier_wait(PhaseBarrier *barrier)
+{
+	platform_mutex_lock(&barrier->lock);
+	int generation = barrier->generation;
+	if (++barrier->waiting >= barrier->count) {
+		barrier->waiting = 0;
+		barrier->generation++;
+		platform_cond_broadcast(&barrier->cond);
+	} else {
+		while (generation == barrier->generation) platform_cond_wait(&barrier->cond, &barrier->lock);
+	}
+	platform_mutex_unlock(&barrier->lock);
+}
+
+// Moins de participants que prévu (thread non créé) : ceux qui attendent déjà peuvent être libérés
+static void phase_barrier_resize(PhaseBarrier *barrier, int count)
+{
+	platform_mutex_lock(&barrier->lock);
+	barrier->count = count;
+	if (barrier->waiting >= count) {
+		barrier->waiting = 0;
+		barrier->generation++;
+		platform_cond_broadcast(&barrier->cond);
+	}
+	platform_mutex_unlock(&barrier->lock);
+}
+
+// Bande de lignes traitée par un thread, classe après classe
+typedef struct {
+	const unsigned char *image;
+	DitheredPixel *dithered;
+	float *error; // erreur de quantification de chaque pixel traité, RGB
+	int width, height, first_row, last_row;
+	int extra_row; // lignes extra_row à height en plus : bandes des threads non créés
+	const Color *pal;
+	const MetricColor *palette;
+	const float *shares; // part de l'erreur de chaque voisin reçue par le pixel, par position dans la tuile
+	PhaseBarrier *barrier;
+	DitherStats stats;
+} DotTask;
+
+// Ordre de traitement d'un pixel de la tuile : classe de son bloc, puis position dans le bloc
+static int dot_order(int x, int y)
+{
+	x &= DOT_TILE_WIDTH - 1;
+	return knuth_classes[y & (DOT_TILE - 1)][x / BLOCK_SIZE] * BLOCK_SIZE + x % BLOCK_SIZE;
+}
+
+// shares[(y * DOT_TILE_WIDTH + x) * DOT_NEIGHBORS + d] : part de l'erreur du voisin d, traité avant,
+// reçue par le pixel (x, y) de la tuile. Un pixel répartit son erreur entre ses voisins traités après lui
+// (poids normalisés) ; un baron n'en a pas et la perd.
+static void dot_shares(float *shares)
+{
+	for (int y = 0; y < DOT_TILE; y++) {
+		for (int x = 0; x < DOT_TILE_WIDTH; x++) {
+			for (int d = 0; d < DOT_NEIGHBORS; d++) {
+				int qx = x + dot_dx[d], qy = y + dot_dy[d];
+				float *share = &shares[(y * DOT_TILE_WIDTH + x) * DOT_NEIGHBORS + d];
+				*share = 0;
+				if (dot_order(qx, qy) > dot_order(x, y)) continue;
+				float total = 0;
+				for (int e = 0; e < DOT_NEIGHBORS; e++)
+					if (dot_order(qx + dot_dx[e], qy + dot_dy[e]) > dot_order(qx, qy)) total += dot_weight[e];
+				*share = dot_weight[d] / total; // total >= poids du pixel (x, y)
+			}
+		}
+	}
+}
+
+// Erreur reçue par le pixel (x, y) de son voisin d, s'il existe
+static void dot_receive(const DotTask *task, int x, int y, int d, float share, float value[3])
+{
+	int qx = x + dot_dx[d], qy = y + dot_dy[d];
+	if (share == 0 || qx < 0 || qx >= task->width || qy < 0 || qy >= task->height) return;
+	const float *error = task->error + ((size_t)qy * task->width + qx) * 3;
+	for (int c = 0; c < 3; c++) value[c] += share * error[c];
+}
+
+static Color dot_clamp(const float value[3])
+{
+	Color c;
+	c.r = (unsigned char)clamp_color_component(value[0]);
+	c.g = (unsigned char)clamp_color_component(value[1]);
+	c.b = (unsigned char)clamp_color_component(value[2]);
+	c.thomson_idx = 0;
+	return c;
+}
+
+// Bloc de 8 pixels en (x0, y) : le couple est choisi sur les pixels corrigés de l'erreur des blocs des
+// classes inférieures, puis les pixels sont quantifiés de gauche à droite, chacun recevant aussi la part
+// de l'erreur de son voisin de gauche dans le bloc
+static void dot_block(DotTask *task, int y, int x0)
+{
+	int block_size = task->width - x0 < BLOCK_SIZE ? task->width - x0 : BLOCK_SIZE;
+	const float *shares = task->shares + ((y & (DOT_TILE - 1)) * DOT_TILE_WIDTH + (x0 & (DOT_TILE_WIDTH - 1))) *
+											 DOT_NEIGHBORS;
+	float value[BLOCK_SIZE][3];
+	Color colors[BLOCK_SIZE] = {{0}};
+	for (int k = 0; k < block_size; k++) {
+		const unsigned char *p = task->image + ((size_t)y * task->width + x0 + k) * COLOR_COMP;
+		for (int c = 0; c < 3; c++) value[k][c] = p[c];
+		for (int d = 0; d < DOT_NEIGHBORS; d++)
+			if (d != DOT_LEFT || k == 0) dot_receive(task, x0 + k, y, d, shares[k * DOT_NEIGHBORS + d], value[k]);
+		colors[k] = dot_clamp(value[k]);
+	}
+	MetricColor block[BLOCK_SIZE];
+	float pixels[3][BLOCK_SIZE], weight[BLOCK_SIZE];
+	block_planes(colors, block_size, block, pixels, weight);
+	int pair_a, pair_b;
+	choose_pair(task->palette, block, block_size, pixels, weight, &pair_a, &pair_b);
+
+	DitheredPixel *out = task->dithered + (size_t)y * task->width + x0;
+	float *error = task->error + ((size_t)y * task->width + x0) * 3;
+	for (int k = 0; k < block_size; k++) {
+		MetricColor m = block[k];
+		if (k > 0) {
+			for (int c = 0; c < 3; c++) value[k][c] += shares[k * DOT_NEIGHBORS + DOT_LEFT] * error[(k - 1) * 3 + c];
+			Color corrected = dot_clamp(value[k]);
+			if (corrected.r != colors[k].r || corrected.g != colors[k].g || corrected.b != colors[k].b) {
+				colors[k] = corrected;
+				m = metric_color(corrected);
+			}
+		}
+		int32_t to_a = metric_distance_sq(m, task->palette[pair_a]), to_b = metric_distance_sq(m, task->palette[pair_b]);
+		int idx = to_b < to_a ? pair_b : pair_a;
+		out[k].palette_idx = (uint8_t)idx;
+		Color q = task->pal[idx];
+		error[k * 3] = (float)(colors[k].r - q.r);
+		error[k * 3 + 1] = (float)(colors[k].g - q.g);
+		error[k * 3 + 2] = (float)(colors[k].b - q.b);
+	}
+
+	task->stats.blocks++;
+	if (pair_a == pair_b) task->stats.flat_blocks++;
+}
+
+static void dot_class_rows(DotTask *task, int first_row, int last_row, int class_x, int class_y)
+{
+	int y = first_row + ((class_y - first_row) & (DOT_TILE - 1));
+	for (; y < last_row; y += DOT_TILE)
+		for (int x = class_x * BLOCK_SIZE; x < task->width; x += DOT_TILE_WIDTH) dot_block(task, y, x);
+}
+
+static void *dot_rows(void *arg)
+{
+	DotTask *task = arg;
+	int class_x[DOT_TILE * DOT_TILE], class_y[DOT_TILE * DOT_TILE];
+	for (int y = 0; y < DOT_TILE; y++) {
+		for (int x = 0; x < DOT_TILE; x++) {
+			class_x[knuth_classes[y][x]] = x;
+			class_y[knuth_classes[y][x]] = y;
+		}
+	}
+	for (int k = 0; k < DOT_TILE * DOT_TILE; k++) {
+		dot_class_rows(task, task->first_row, task->last_row, class_x[k], class_y[k]);
+		dot_class_rows(task, task->extra_row, task->height, class_x[k], class_y[k]);
+		phase_barrier_wait(task->barrier);
+	}
+	return NULL;
+}
+
+// Diffusion par points : les blocs d'une même classe ne se touchent pas et ne reçoivent que l'erreur des
+// classes déjà traitées, chaque classe est donc répartie entre les threads (64 étapes par image)
+static void dot_diffusion(const unsigned char *image, DitheredPixel *dithered, int width, int height,
+						  const Color pal[16], const MetricColor palette[PALETTE_SIZE], int threads, DitherStats *stats)
+{
+	float *error = malloc((size_t)width * height * 3 * sizeof(float));
+	float *shares = malloc(DOT_TILE * DOT_TILE_WIDTH * DOT_NEIGHBORS * sizeof(float));
+	if (!error || !shares) {
+		printf("Erreur: Impossible d'allouer la mémoire de la diffusion par points.\n");
+		exit(EXIT_FAILURE);
+	}
+	dot_shares(shares);
+
+	int task_count = threads < 1 ? 1 : threads > MAX_TASKS ? MAX_TASKS : threads;
+	if (task_count > height) task_count = height > 0 ? height : 1;
+	PhaseBarrier barrier;
+	platform_mutex_init(&barrier.lock);
+	platform_cond_init(&barrier.cond);
+	barrier.count = task_count;
+	barrier.waiting = barrier.generation = 0;
+	DotTask tasks[MAX_TASKS];
+	platform_thread handles[MAX_TASKS];
+	for (int t = 0; t < task_count; t++) {
+		DotTask *task = &tasks[t];
+		memset(task, 0, sizeof(*task));
+		task->image = image;
+		task->dithered = dithered;
+		task->error = error;
+		task->width = width;
+		task->height = height;
+		task->first_row = (int)((int64_t)height * t / task_count);
+		task->last_row = (int)((int64_t)height * (t + 1) / task_count);
+		task->extra_row = height;
+		task->pal = pal;
+		task->palette = palette;
+		task->shares = shares;
+		task->barrier = &barrier;
+	}
+
+	// Le premier lot reste sur le thread appelant, qui reprend les bandes des threads non créés
+	int running = 0;
+	for (int t = 1; t < task_count; t++) {
+		if (platform_thread_create(&handles[running], dot_rows, &tasks[t]) != 0) {
+			tasks[0].extra_row = tasks[t].first_row;
+			phase_barrier_resize(&barrier, t);
+			break;
+		}
+		running++;
+	}
+	dot_rows(&tasks[0]);
+	for (int t = 0; t < running; t++) platform_thread_join(handles[t]);
+	platform_cond_destroy(&barrier.cond);
+	platform_mutex_destroy(&barrier.lock);
+	free(shares);
+	free(error);
+
+	if (stats) {
+		for (int t = 0; t <= running; t++) {
+			stats->blocks += tasks[t].stats.blocks;
+			stats->flat_blocks += tasks[t].stats.flat_blocks;
+		}
+	}
+}
+
+void ordered_dither(const unsigned char *image, DitheredPixel *dithered, int width, int height, const Color pal[16],
+					int mode, int threads, DitherStats *stats)
+{
+	MetricColor palette[PALETTE_SIZE];
+	for (int i = 0; i < PALETTE_SIZE; i++) palette[i] = metric_palette_color(pal[i]);
+	if (mode == DITHER_KNUTH) {
+		dot_diffusion(image, dithered, width, height, pal, palette, threads, stats);
+		return;
+	}
+
+	// Seuils (rang + 1/2) / nombre de cases
+	float thresholds[BLUE_NOISE_CELLS];
+	int shift;
+	if (mode == DITHER_BLUE_NOISE) {
+		ordered_blue_noise_init(); // sans effet si déjà fait au démarrage, avant les threads
+		shift = 5; // ORDERED_BLUE_NOISE_SIZE = 1 << 5
+		for (int i = 0; i < BLUE_NOISE_CELLS; i++) thresholds[i] = (blue_noise_rank[i] + 0.5f) / BLUE_NOISE_CELLS;
+	} else {
+		// Bayer : entrelacement inversé des bits de x ^ y et de y
+		shift = 3;
+		for (int y = 0; y < ORDERED_BAYER_SIZE; y++) {
+			for (int x = 0; x < ORDERED_BAYER_SIZE; x++) {
+				int rank = 0;
+				for (int bit = 0; bit < shift; bit++)
+					rank |= (((x ^ y) >> bit & 1) << (2 * (shift - bit) - 1)) | ((y >> bit & 1) << (2 * (shift - bit) - 2));
+				thresholds[y * ORDERED_BAYER_SIZE + x] = (rank + 0.5f) / (ORDERED_BAYER_SIZE * ORDERED_BAYER_SIZE);
+			}
+		}
+	}
+
+	int task_count = threads < 1 ? 1 : threads > MAX_TASKS ? MAX_TASKS : threads;
+	if (task_count > height) task_count = height > 0 ? height : 1;
+	OrderedTask tasks[MAX_TASKS];
+	platform_thread handles[MAX_TASKS];
+	for (int t = 0; t < task_count; t++) {
+		OrderedTask *task = &tasks[t];
+		memset(task, 0, sizeof(*task));
+		task->image = image;
+		task->dithered = dithered;
+		task->width = width;
+		task->first_row = (int)((int64_t)height * t / task_count);
+		task->last_row = (int)((int64_t)height * (t + 1) / task_count);
+		task->palette = palette;
+		task->thresholds = thresholds;
+		task->tile_shift = shift;
+	}
+
+	// Le premier lot reste sur le thread appelant
+	int running = 0;
+	for (int t = 1; t < task_count; t++) {
+		if (platform_thread_create(&handles[running], ordered_rows, &tasks[t]) != 0) {
+			for (int u = t; u < task_count; u++) ordered_rows(&tasks[u]);
+			break;
+		}
+		running++;
+	}
+	ordered_rows(&tasks[0]);
+	for (int t = 0; t < running; t++) platform_thread_join(handles[t]);
+
+	if (stats) {
+		for (int t = 0; t < task_count; t++) {
+			stats->blocks += tasks[t].stats.blocks;
+			stats->flat_blocks += tasks[t].stats.flat_blocks;
+			stats->memo_lookups += tasks[t].stats.memo_lookups;
+			stats->memo_hits += tasks[t].stats.memo_hits;
+		}
+	}
+}
@@ -0,0 +1,25 @@
+#ifndef ORDERED_H
+#define ORDERED_H
+
+#include <stdint.h>
+#include "thomson.h"
+#include "dither.h"
+
+#define ORDERED_BAYER_SIZE 8	   // matrice de Bayer 8x8 : 64 seuils
+#define ORDERED_BLUE_NOISE_SIZE 32 // tuile de bruit bleu 32x32 : 1024 seuils (puissance de 2)
+
+// Tuile de bruit bleu (void-and-cluster, déterministe) de -d 12 : à générer une fois au démarrage,
+// avant de lancer des threads
+void ordered_blue_noise_init(void);
+
+// Tramage ordonné (-d 11 et 12) : chaque bloc de 8 pixels choisit son couple sur ses seules couleurs,
+// puis chaque pixel est seuillé par la tuile selon sa position entre les deux couleurs. Aucune
+// dépendance entre blocs : les lignes sont réparties sur threads threads.
+// Diffusion par points (-d 13) : les blocs sont traités par classe de la matrice de Knuth, chacun
+// choisissant son couple sur ses pixels corrigés de l'erreur des classes déjà traitées, puis diffusant
+// la sienne vers les voisins de classe supérieure ; chaque classe est répartie sur threads threads.
+// mode : DITHER_BAYER, DITHER_BLUE_NOISE ou DITHER_KNUTH ; stats peut être NULL.
+void ordered_dither(const unsigned char *image, DitheredPixel *dithered, int width, int height, const Color pal[16],
+					int mode, int threads, DitherStats *stats);
+
+#endif // !ORDERED_H
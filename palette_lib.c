@@ -0,0 +1,611 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "global.h"
+#include "thomson.h"
+#include "palettes.h"
+#include "palette_lib.h"
+#include "platform.h"
+
+// À incrémenter quand le format du fichier ou l'arrondi au treillis Thomson change
+#define PALETTE_LIB_VERSION 3
+#define PALETTE_LIB_MAGIC "CLPL"
+// Sous-arbres parcourus sans élagage par point de vue
+#define VP_LEAF_SIZE 16
+
+// Fichier : en-tête, count enregistrements PaletteRecord, slot_count emplacements uint32_t,
+// node_count noeuds VpNode (un par palette canonique)
+typedef struct {
+	char magic[4];
+	uint32_t version;
+	uint32_t record_size; // sizeof(PaletteRecord)
+	uint32_t count;
+	uint32_t unique_count;
+	uint32_t slot_count;
+	uint32_t node_count;
+	uint32_t reserved;
+	int64_t source_size;  // taille et date du CSV d'origine, -1 s'il est inconnu
+	int64_t source_mtime; // en nanosecondes : une réécriture dans la même seconde se voit
+	uint64_t content_hash;
+} PaletteLibHeader;
+
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t size)
+{
+	const uint8_t *bytes = data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+static size_t library_size(uint32_t count, uint32_t slot_count, uint32_t node_count)
+{
+	return sizeof(PaletteLibHeader) + (size_t)count * sizeof(PaletteRecord) + (size_t)slot_count * sizeof(uint32_t) +
+		   (size_t)node_count * sizeof(VpNode);
+}
+
+// Renseigne lib depuis une image du fichier (projetée ou en mémoire), -1 si elle est invalide
+static int attach(PaletteLibrary *lib, const void *data, size_t size)
+{
+	const PaletteLibHeader *header = data;
+	if (size < sizeof(PaletteLibHeader) || memcmp(header->magic, PALETTE_LIB_MAGIC, 4) != 0 ||
+		header->version != PALETTE_LIB_VERSION || header->record_size != sizeof(PaletteRecord) ||
+		header->count == 0 || header->count > INT32_MAX || header->slot_count == 0 ||
+		(header->slot_count & (header->slot_count - 1)) != 0 || header->node_count > header->count ||
+		size != library_size(header->count, header->slot_count, header->node_count))
+		return -1;
+	// Un fichier tronqué ou altéré ne doit pas faire lire hors des tables : unique_count, qui dimensionne
+	// les tables indexées par palette canonique, doit aussi être exact
+	const PaletteRecord *records = (const PaletteRecord *)(header + 1);
+	uint32_t unique = 0;
+	for (uint32_t p = 0; p < header->count; p++) {
+		uint32_t canonical = records[p].canonical;
+		if (!memchr(records[p].name, '\0', PALETTE_LIB_NAME_SIZE) || canonical > p ||
+			records[canonical].canonical != canonical)
+			return -1;
+		unique += canonical == p;
+		for (int i = 0; i < PALETTE_SIZE; i++)
+			if (records[p].thomson_idx[i] >= NUM_THOMSON_COLORS) return -1;
+	}
+	if (unique != header->unique_count || (header->node_count != 0 && header->node_count != unique)) return -1;
+	const VpNode *nodes = (const VpNode *)((const uint32_t *)(records + header->count) + header->slot_count);
+	for (uint32_t i = 0; i < header->node_count; i++)
+		if (nodes[i].palette >= header->count || nodes[i].inside_count >= header->node_count - i) return -1;
+	lib->records = records;
+	lib->count = (int)header->count;
+	lib->unique_count = (int)header->unique_count;
+	lib->slots = (const uint32_t *)(lib->records + lib->count);
+	lib->slot_count = header->slot_count;
+	lib->content_hash = header->content_hash;
+	lib->nodes = header->node_count ? nodes : NULL;
+	lib->node_count = (int)header->node_count;
+	return 0;
+}
+
+typedef struct {
+	int index;
+	int key[COLORS_PER_PALETTE];
+} CanonicalEntry;
+
+static int compare_canonical(const void *a, const void *b)
+{
+	const CanonicalEntry *x = a, *y = b;
+	int order = memcmp(x->key, y->key, sizeof(x->key));
+	return order ? order : x->index - y->index;
+}
+
+// Alias par tri des clés canoniques : chaque groupe de clés égales pointe vers son plus petit index
+static int assign_canonical(PaletteRecord *records, int count)
+{
+	CanonicalEntry *entries = malloc(count * sizeof(CanonicalEntry));
+	if (!entries) return -1;
+	for (int p = 0; p < count; p++) {
+		Color snapped[COLORS_PER_PALETTE];
+		for (int i = 0; i < COLORS_PER_PALETTE; i++) snapped[i].thomson_idx = records[p].thomson_idx[i];
+		entries[p].index = p;
+		palette_canonical_key(snapped, entries[p].key);
+	}
+	qsort(entries, count, sizeof(CanonicalEntry), compare_canonical);
+	int unique = 0, first = 0;
+	for (int i = 0; i < count; i++) {
+		if (i == 0 || memcmp(entries[i].key, entries[i - 1].key, sizeof(entries[i].key)) != 0) {
+			first = entries[i].index;
+			unique++;
+		}
+		records[entries[i].index].canonical = (uint32_t)first;
+	}
+	free(entries);
+	return unique;
+}
+
+static uint32_t probe(const uint32_t *slots, uint32_t slot_count, const PaletteRecord *records, const char *name)
+{
+	uint32_t slot = palette_name_hash(name, 0) & (slot_count - 1);
+	while (slots[slot] && strcmp(records[slots[slot] - 1].name, name) != 0) slot = (slot + 1) & (slot_count - 1);
+	return slot;
+}
+
+// Adressage ouvert, remplissage <= 50 % ; les noms vides ou en double ne sont pas indexés
+static void build_slots(const PaletteRecord *records, int count, uint32_t *slots, uint32_t slot_count)
+{
+	memset(slots, 0, slot_count * sizeof(uint32_t));
+	for (int p = 0; p < count; p++) {
+		if (records[p].name[0] == '\0') continue;
+		uint32_t slot = probe(slots, slot_count, records, records[p].name);
+		if (!slots[slot]) slots[slot] = (uint32_t)p + 1;
+	}
+}
+
+// Affectation de coût minimal (méthode hongroise par potentiels), matrice PALETTE_SIZE x PALETTE_SIZE
+static double assignment_cost(double cost[PALETTE_SIZE][PALETTE_SIZE])
+{
+	const int n = PALETTE_SIZE;
+	double u[PALETTE_SIZE + 1] = {0}, v[PALETTE_SIZE + 1] = {0};
+	int match[PALETTE_SIZE + 1] = {0}, way[PALETTE_SIZE + 1] = {0}; // match[j] : ligne affectée à la colonne j
+	for (int i = 1; i <= n; i++) {
+		double min_slack[PALETTE_SIZE + 1];
+		int used[PALETTE_SIZE + 1] = {0};
+		for (int j = 0; j <= n; j++) min_slack[j] = DBL_MAX;
+		match[0] = i;
+		int j0 = 0;
+		do {
+			used[j0] = 1;
+			int i0 = match[j0], j1 = 0;
+			double delta = DBL_MAX;
+			for (int j = 1; j <= n; j++) {
+				if (used[j]) continue;
+				double slack = cost[i0 - 1][j - 1] - u[i0] - v[j];
+				if (slack < min_slack[j]) {
+					min_slack[j] = slack;
+					way[j] = j0;
+				}
+				if (min_slack[j] < delta) {
+					delta = min_slack[j];
+					j1 = j;
+				}
+			}
+			for (int j = 0; j <= n; j++) {
+				if (used[j]) {
+					u[match[j]] += delta;
+					v[j] -= delta;
+				} else {
+					min_slack[j] -= delta;
+				}
+			}
+			j0 = j1;
+		} while (match[j0] != 0);
+		do {
+			int j1 = way[j0];
+			match[j0] = match[j1];
+			j0 = j1;
+		} while (j0);
+	}
+	double total = 0;
+	for (int j = 1; j <= n; j++) total += cost[match[j] - 1][j - 1];
+	return total;
+}
+
+float palette_distance(const Color a[PALETTE_SIZE], const Color b[PALETTE_SIZE])
+{
+	double cost[PALETTE_SIZE][PALETTE_SIZE];
+	for (int i = 0; i < PALETTE_SIZE; i++) {
+		for (int j = 0; j < PALETTE_SIZE; j++) {
+			double dr = (double)a[i].r - b[j].r, dg = (double)a[i].g - b[j].g, db = (double)a[i].b - b[j].b;
+			cost[i][j] = sqrt(dr * dr + dg * dg + db * db);
+		}
+	}
+	return (float)(assignment_cost(cost) / PALETTE_SIZE);
+}
+
+static int compare_matches(const void *a, const void *b)
+{
+	const PaletteMatch *x = a, *y = b;
+	if (x->distance != y->distance) return x->distance < y->distance ? -1 : 1;
+	return x->index - y->index;
+}
+
+// Noeud pour items[0..count) : le point de vue est le plus éloigné du point de vue parent (dernier
+// élément, les items arrivant triés par distance), les autres sont séparés à la médiane
+static void build_vp_node(const PaletteLibrary *lib, PaletteMatch *items, int count, VpNode *nodes)
+{
+	PaletteMatch swap = items[0];
+	items[0] = items[count - 1];
+	items[count - 1] = swap;
+	nodes[0].palette = (uint32_t)items[0].index;
+	nodes[0].radius = 0;
+	nodes[0].inside_count = 0;
+	if (count == 1) return;
+
+	Color vantage[PALETTE_SIZE], colors[PALETTE_SIZE];
+	palette_lib_colors(lib, items[0].index, vantage);
+	for (int i = 1; i < count; i++) {
+		palette_lib_colors(lib, items[i].index, colors);
+		items[i].distance = palette_distance(vantage, colors);
+	}
+	qsort(items + 1, count - 1, sizeof(PaletteMatch), compare_matches);
+	int inside = (count - 1) / 2;
+	nodes[0].radius = items[inside > 0 ? inside : 1].distance;
+	nodes[0].inside_count = (uint32_t)inside;
+	if (inside > 0) build_vp_node(lib, items + 1, inside, nodes + 1);
+	build_vp_node(lib, items + 1 + inside, count - 1 - inside, nodes + 1 + inside);
+}
+
+// Arbre des palettes canoniques de lib dans nodes (lib->unique_count noeuds)
+static int build_vp_tree(const PaletteLibrary *lib, VpNode *nodes)
+{
+	PaletteMatch *items = malloc(lib->unique_count * sizeof(PaletteMatch));
+	if (!items) return -1;
+	int count = 0;
+	for (int p = 0; p < lib->count; p++)
+		if (palette_lib_canonical(lib, p) == p) items[count++] = (PaletteMatch){p, 0};
+	build_vp_node(lib, items, count, nodes);
+	free(items);
+	return 0;
+}
+
+// Lit le CSV dans un tableau d'enregistrements alloué, renvoie leur nombre ou -1
+static int read_csv(const char *path, PaletteRecord **out)
+{
+	FILE *f = fopen(path, "r");
+	if (!f) {
+		printf("Erreur: Impossible d'ouvrir la bibliothèque de palettes '%s'.\n", path);
+		return -1;
+	}
+	PaletteRecord *records = NULL;
+	int count = 0, capacity = 0, line_number = 0;
+	char line[1024];
+	while (fgets(line, sizeof(line), f)) {
+		line_number++;
+		if (line[strspn(line, "\r\n")] == '\0') continue;
+		if (count == capacity) {
+			capacity = capacity ? capacity * 2 : 512;
+			PaletteRecord *grown = realloc(records, capacity * sizeof(PaletteRecord));
+			if (!grown) {
+				printf("Erreur: Impossible d'allouer la mémoire pour la bibliothèque de palettes.\n");
+				free(records);
+				fclose(f);
+				return -1;
+			}
+			records = grown;
+		}
+		PaletteRecord *record = &records[count];
+		memset(record, 0, sizeof(*record));
+		Color colors[COLORS_PER_PALETTE];
+		int status = palette_parse_csv_line(line, record->name, sizeof(record->name), colors);
+		if (status != 0) {
+			// Une ligne invalide n'empêche pas de charger les autres
+			if (status < 0)
+				printf("Attention: %s:%d : nom absent ou trop long, ligne ignorée.\n", path, line_number);
+			else
+				printf("Attention: %s:%d : couleur %d invalide, ligne ignorée.\n", path, line_number, status);
+			continue;
+		}
+		for (int i = 0; i < COLORS_PER_PALETTE; i++) {
+			Color snapped;
+			snap_to_thomson(colors[i], &snapped);
+			record->thomson_idx[i] = snapped.thomson_idx;
+		}
+		count++;
+	}
+	fclose(f);
+	if (count == 0) {
+		printf("Erreur: Aucune palette dans '%s'.\n", path);
+		free(records);
+		return -1;
+	}
+	*out = records;
+	return count;
+}
+
+// Construit l'image du fichier binaire en mémoire ; source_size et source_mtime identifient le CSV
+static void *build_library(const PaletteRecord *records, int count, int64_t source_size, int64_t source_mtime,
+						   size_t *size)
+{
+	PaletteRecord *copy = malloc(count * sizeof(PaletteRecord));
+	if (!copy) return NULL;
+	memcpy(copy, records, count * sizeof(PaletteRecord));
+	int unique = assign_canonical(copy, count);
+	if (unique < 0) {
+		free(copy);
+		return NULL;
+	}
+	uint32_t slot_count = 1;
+	while (slot_count < (uint32_t)count * 2) slot_count <<= 1;
+	*size = library_size(count, slot_count, unique);
+	PaletteLibHeader *header = malloc(*size);
+	if (!header) {
+		free(copy);
+		return NULL;
+	}
+	memset(header, 0, sizeof(*header));
+	PaletteRecord *stored = (PaletteRecord *)(header + 1);
+	memcpy(stored, copy, count * sizeof(PaletteRecord));
+	free(copy);
+	uint32_t *slots = (uint32_t *)(stored + count);
+	build_slots(stored, count, slots, slot_count);
+
+	// Le VP-tree est construit une fois ici puis relu avec le reste du fichier
+	PaletteLibrary view;
+	memset(&view, 0, sizeof(view));
+	view.records = stored;
+	view.count = count;
+	view.unique_count = unique;
+	if (build_vp_tree(&view, (VpNode *)(slots + slot_count)) != 0) {
+		free(header);
+		return NULL;
+	}
+
+	memcpy(header->magic, PALETTE_LIB_MAGIC, 4);
+	header->version = PALETTE_LIB_VERSION;
+	header->record_size = sizeof(PaletteRecord);
+	header->count = (uint32_t)count;
+	header->unique_count = (uint32_t)unique;
+	header->slot_count = slot_count;
+	header->node_count = (uint32_t)unique;
+	header->source_size = source_size;
+	header->source_mtime = source_mtime;
+	header->content_hash = hash_bytes(0xcbf29ce484222325ULL, stored, count * sizeof(PaletteRecord));
+	return header;
+}
+
+// Écriture dans un fichier temporaire puis renommage, comme les entrées du cache
+static int write_library(const char *path, const void *data, size_t size)
+{
+	char temp[4160];
+	snprintf(temp, sizeof(temp), "%s.%d.tmp", path, platform_process_id());
+	FILE *f = fopen(temp, "wb");
+	if (!f) return -1;
+	int ok = fwrite(data, 1, size, f) == size;
+	ok = fclose(f) == 0 && ok;
+	if (ok && rename(temp, path) != 0) {
+		// Sous Windows rename ne remplace pas un fichier existant
+		remove(path);
+		ok = rename(temp, path) == 0;
+	}
+	if (!ok) remove(temp);
+	return ok ? 0 : -1;
+}
+
+static int map_library(PaletteLibrary *lib, const char *path)
+{
+	size_t size;
+	const void *data = platform_map_file(path, &size);
+	if (!data) return -1;
+	if (attach(lib, data, size) != 0) {
+		platform_unmap_file(data, size);
+		return -1;
+	}
+	lib->mapping = data;
+	lib->mapping_size = size;
+	return 0;
+}
+
+int palette_lib_builtin(PaletteLibrary *lib)
+{
+	memset(lib, 0, sizeof(*lib));
+	PaletteRecord *records = malloc(NUM_PALETTES * sizeof(PaletteRecord));
+	if (!records) return -1;
+	memset(records, 0, NUM_PALETTES * sizeof(PaletteRecord));
+	for (int p = 0; p < NUM_PALETTES; p++) {
+		strcpy(records[p].name, palette_table[p].name);
+		records[p].canonical = (uint32_t)palette_canonical[p];
+		for (int i = 0; i < COLORS_PER_PALETTE; i++) records[p].thomson_idx[i] = palette_thomson[p][i].thomson_idx;
+	}
+	// Les noms passent par le hachage parfait de palettes.c, content_hash nul : clés du cache inchangées
+	lib->records = records;
+	lib->count = NUM_PALETTES;
+	lib->unique_count = palette_unique_count;
+	lib->owned = records;
+	return 0;
+}
+
+int palette_lib_open(PaletteLibrary *lib, const char *path)
+{
+	memset(lib, 0, sizeof(*lib));
+
+	// Binaire donné directement
+	FILE *f = fopen(path, "rb");
+	if (!f) {
+		printf("Erreur: Impossible d'ouvrir la bibliothèque de palettes '%s'.\n", path);
+		return -1;
+	}
+	char magic[4];
+	int is_binary = fread(magic, 1, 4, f) == 4 && memcmp(magic, PALETTE_LIB_MAGIC, 4) == 0;
+	fclose(f);
+	if (is_binary) {
+		if (map_library(lib, path) == 0) return 0;
+		printf("Erreur: Bibliothèque de palettes '%s' invalide ou d'une autre version.\n", path);
+		return -1;
+	}
+
+	// CSV : le binaire voisin sert tant qu'il correspond à la taille et à la date du CSV
+	char bin_path[4096];
+	snprintf(bin_path, sizeof(bin_path), "%s.bin", path);
+	int64_t source_size = platform_file_size(path), source_mtime = platform_file_mtime_ns(path);
+	if (map_library(lib, bin_path) == 0) {
+		const PaletteLibHeader *header = lib->mapping;
+		if (header->source_size == source_size && header->source_mtime == source_mtime) {
+			if (clash_verbose) printf("Bibliothèque de palettes projetée depuis %s\n", bin_path);
+			return 0;
+		}
+		palette_lib_close(lib);
+	}
+
+	PaletteRecord *records;
+	int count = read_csv(path, &records);
+	if (count < 0) return -1;
+	size_t size;
+	void *data = build_library(records, count, source_size, source_mtime, &size);
+	free(records);
+	if (!data) {
+		printf("Erreur: Impossible d'allouer la mémoire pour la bibliothèque de palettes.\n");
+		return -1;
+	}
+	attach(lib, data, size);
+	lib->owned = data;
+	if (write_library(bin_path, data, size) != 0)
+		printf("Attention: Impossible d'écrire %s, la bibliothèque sera relue depuis le CSV.\n", bin_path);
+	else if (clash_verbose)
+		printf("Bibliothèque de palettes %s écrite : %d palettes, %d ensembles Thomson\n", bin_path, lib->count,
+			   lib->unique_count);
+	return 0;
+}
+
+void palette_lib_close(PaletteLibrary *lib)
+{
+	if (lib->mapping) platform_unmap_file(lib->mapping, lib->mapping_size);
+	free(lib->owned);
+	free(lib->owned_nodes);
+	memset(lib, 0, sizeof(*lib));
+}
+
+int palette_lib_lookup(const PaletteLibrary *lib, const char *name)
+{
+	if (!lib->slots) return palette_lookup(name);
+	uint32_t slot = probe(lib->slots, lib->slot_count, lib->records, name);
+	return (int)lib->slots[slot] - 1;
+}
+
+void palette_lib_colors(const PaletteLibrary *lib, int index, Color colors[PALETTE_SIZE])
+{
+	const uint16_t *idx = lib->records[index].thomson_idx;
+	for (int i = 0; i < PALETTE_SIZE; i++) {
+		colors[i].r = red_255[idx[i] & 15].r;
+		colors[i].g = green_255[(idx[i] >> 4) & 15].g;
+		colors[i].b = blue_255[idx[i] >> 8].b;
+		colors[i].thomson_idx = idx[i];
+	}
+}
+
+int palette_lib_index(PaletteLibrary *lib)
+{
+	if (lib->nodes) return 0;
+	VpNode *nodes = malloc(lib->unique_count * sizeof(VpNode));
+	if (!nodes || build_vp_tree(lib, nodes) != 0) {
+		printf("Erreur: Impossible d'allouer la mémoire pour l'index des palettes.\n");
+		free(nodes);
+		return -1;
+	}
+	lib->nodes = nodes;
+	lib->node_count = lib->unique_count;
+	lib->owned_nodes = nodes;
+	return 0;
+}
+
+typedef struct {
+	const PaletteLibrary *lib;
+	const Color *query;
+	uint8_t sorted[3][PALETTE_SIZE]; // canaux de la requête triés, pour le minorant
+	PaletteMatch *matches;			 // les found plus proches, par distance croissante
+	int k, found;
+} NearestSearch;
+
+// Valeurs de chaque canal triées : en une dimension, le transport optimal apparie les rangs
+static void sort_channels(const Color colors[PALETTE_SIZE], uint8_t sorted[3][PALETTE_SIZE])
+{
+	for (int i = 0; i < PALETTE_SIZE; i++) {
+		uint8_t value[3] = {colors[i].r, colors[i].g, colors[i].b};
+		for (int c = 0; c < 3; c++) {
+			int j = i;
+			for (; j > 0 && sorted[c][j - 1] > value[c]; j--) sorted[c][j] = sorted[c][j - 1];
+			sorted[c][j] = value[c];
+		}
+	}
+}
+
+// Minorant de palette_distance sans appariement : la norme euclidienne vaut au moins la norme L1
+// divisée par racine de 3 et au moins chaque écart de canal, et le transport L1 coûte au moins la
+// somme des transports canal par canal
+static float distance_lower_bound(const uint8_t a[3][PALETTE_SIZE], const Color colors[PALETTE_SIZE])
+{
+	uint8_t b[3][PALETTE_SIZE];
+	sort_channels(colors, b);
+	int sum = 0, largest = 0;
+	for (int c = 0; c < 3; c++) {
+		int channel = 0;
+		for (int i = 0; i < PALETTE_SIZE; i++) channel += abs(a[c][i] - b[c][i]);
+		sum += channel;
+		if (channel > largest) largest = channel;
+	}
+	float l1 = sum / 1.7320508f;
+	return (l1 > largest ? l1 : largest) / PALETTE_SIZE;
+}
+
+// Garde la palette index si elle est parmi les k plus proches
+static void add_match(NearestSearch *search, int index, float distance)
+{
+	if (search->found == search->k && distance >= search->matches[search->k - 1].distance) return;
+	int i = search->found < search->k ? search->found++ : search->k - 1;
+	for (; i > 0 && search->matches[i - 1].distance > distance; i--) search->matches[i] = search->matches[i - 1];
+	search->matches[i] = (PaletteMatch){index, distance};
+}
+
+// Rayon de recherche : distance du k-ième plus proche trouvé
+static float search_radius(const NearestSearch *search)
+{
+	return search->found < search->k ? FLT_MAX : search->matches[search->k - 1].distance;
+}
+
+static void search_vp_node(NearestSearch *search, const VpNode *nodes, int count)
+{
+	if (count <= VP_LEAF_SIZE) {
+		// Petit sous-arbre, contigu en préordre : le minorant élimine mieux que les points de vue
+		for (int i = 0; i < count; i++) {
+			Color colors[PALETTE_SIZE];
+			palette_lib_colors(search->lib, (int)nodes[i].palette, colors);
+			if (distance_lower_bound(search->sorted, colors) < search_radius(search))
+				add_match(search, (int)nodes[i].palette, palette_distance(search->query, colors));
+		}
+		return;
+	}
+	const VpNode *inside = nodes + 1, *outside = nodes + 1 + nodes[0].inside_count;
+	int inside_count = (int)nodes[0].inside_count, outside_count = count - 1 - inside_count;
+	float radius = nodes[0].radius;
+
+	Color colors[PALETTE_SIZE];
+	palette_lib_colors(search->lib, (int)nodes[0].palette, colors);
+	float lower = distance_lower_bound(search->sorted, colors);
+	if (lower - search_radius(search) > radius) {
+		// Requête loin hors de la boule : ni le point de vue ni l'intérieur ne peuvent être retenus
+		search_vp_node(search, outside, outside_count);
+		return;
+	}
+	float distance = palette_distance(search->query, colors);
+	add_match(search, (int)nodes[0].palette, distance);
+	// Côté de la requête d'abord : le rayon de recherche s'y resserre plus vite
+	if (distance <= radius) {
+		if (distance - search_radius(search) <= radius) search_vp_node(search, inside, inside_count);
+		if (distance + search_radius(search) >= radius) search_vp_node(search, outside, outside_count);
+	} else {
+		if (distance + search_radius(search) >= radius) search_vp_node(search, outside, outside_count);
+		if (distance - search_radius(search) <= radius) search_vp_node(search, inside, inside_count);
+	}
+}
+
+int palette_lib_nearest(const PaletteLibrary *lib, const Color query[PALETTE_SIZE], int k, PaletteMatch *matches)
+{
+	if (k <= 0) return 0;
+	NearestSearch search;
+	search.lib = lib;
+	search.query = query;
+	search.matches = matches;
+	search.k = k;
+	search.found = 0;
+	sort_channels(query, search.sorted);
+	if (lib->nodes) {
+		search_vp_node(&search, lib->nodes, lib->node_count);
+	} else {
+		for (int p = 0; p < lib->count; p++) {
+			if (palette_lib_canonical(lib, p) != p) continue;
+			Color colors[PALETTE_SIZE];
+			palette_lib_colors(lib, p, colors);
+			if (distance_lower_bound(search.sorted, colors) < search_radius(&search))
+				add_match(&search, p, palette_distance(query, colors));
+		}
+	}
+	return search.found;
+}
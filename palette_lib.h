@@ -0,0 +1,80 @@
+#ifndef PALETTE_LIB_H
+#define PALETTE_LIB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "thomson.h"
+
+#define PALETTE_LIB_NAME_SIZE 60
+
+// Enregistrement de taille fixe du fichier binaire (96 octets) : nom et couleurs déjà ramenées
+// au treillis Thomson (index 12 bits r + 16 g + 256 b)
+typedef struct {
+	char name[PALETTE_LIB_NAME_SIZE];
+	uint32_t canonical; // premier enregistrement ayant le même ensemble de couleurs Thomson
+	uint16_t thomson_idx[PALETTE_SIZE];
+} PaletteRecord;
+
+// Noeud de l'arbre de points de vue (VP-tree) sur les palettes canoniques, rangé en préordre :
+// le sous-arbre intérieur suit le noeud, le sous-arbre extérieur suit l'intérieur
+typedef struct {
+	uint32_t palette;	   // point de vue : index de la palette
+	float radius;		   // intérieur : distance <= radius, extérieur : distance >= radius
+	uint32_t inside_count; // noeuds du sous-arbre intérieur
+} VpNode;
+
+typedef struct {
+	int index;
+	float distance;
+} PaletteMatch;
+
+// Bibliothèque de palettes : celles compilées dans palettes.c ou celles d'un CSV au format
+// palettes_hex.csv (--palette-lib), mis en cache dans <csv>.bin et projeté en mémoire
+typedef struct {
+	const PaletteRecord *records;
+	int count;
+	int unique_count;		  // ensembles de couleurs Thomson distincts
+	const uint32_t *slots;	  // table des noms : index + 1, 0 = libre (NULL : palette_lookup)
+	uint32_t slot_count;	  // puissance de 2
+	uint64_t content_hash;	  // distingue les bibliothèques dans les clés du cache
+	const VpNode *nodes;	  // index des plus proches voisins, NULL tant qu'il n'est pas construit
+	int node_count;
+	const void *mapping;	  // fichier projeté, NULL sinon
+	size_t mapping_size;
+	void *owned;			  // données construites en mémoire, NULL sinon
+	void *owned_nodes;		  // index construit par palette_lib_index
+} PaletteLibrary;
+
+// Palettes compilées (palettes.c)
+int palette_lib_builtin(PaletteLibrary *lib);
+// path : CSV (le binaire <path>.bin, index compris, est reconstruit s'il manque ou ne correspond
+// plus au CSV) ou binaire déjà construit
+int palette_lib_open(PaletteLibrary *lib, const char *path);
+void palette_lib_close(PaletteLibrary *lib);
+
+// Index d'une palette par son nom, -1 si inconnue (première occurrence pour un nom en double)
+int palette_lib_lookup(const PaletteLibrary *lib, const char *name);
+// Couleurs Thomson de la palette index, thomson_idx renseigné
+void palette_lib_colors(const PaletteLibrary *lib, int index, Color colors[PALETTE_SIZE]);
+
+// Distance du transport optimal (Earth mover) entre deux ensembles de 16 couleurs : coût moyen
+// de l'appariement un à un des couleurs qui minimise la somme des distances RGB. C'est une
+// métrique, ce qui permet l'élagage du VP-tree par inégalité triangulaire.
+float palette_distance(const Color a[PALETTE_SIZE], const Color b[PALETTE_SIZE]);
+// Construit l'index des palettes compilées (celui d'une bibliothèque CSV est dans son binaire)
+int palette_lib_index(PaletteLibrary *lib);
+// Les k palettes canoniques les plus proches de query, par distance croissante ; renvoie leur
+// nombre. Sans index, toutes les palettes sont comparées.
+int palette_lib_nearest(const PaletteLibrary *lib, const Color query[PALETTE_SIZE], int k, PaletteMatch *matches);
+
+static inline const char *palette_lib_name(const PaletteLibrary *lib, int index)
+{
+	return lib->records[index].name;
+}
+
+static inline int palette_lib_canonical(const PaletteLibrary *lib, int index)
+{
+	return (int)lib->records[index].canonical;
+}
+
+#endif // !PALETTE_LIB_H
@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "global.h"
+#include "thomson.h"
+#include "platform.h"
+#include "palette_opt.h"
+
+#define BLOCK_SIZE 8
+#define BLOCK_COUNT (WIDTH * HEIGHT / BLOCK_SIZE)
+#define MAX_TASKS 64
+
+// Lot de blocs traité par un thread lors de l'affectation
+typedef struct {
+	const uint8_t *image;
+	const Color *palette;
+	const uint8_t *moved;	// couleurs déplacées depuis l'itération précédente : colonnes à recalculer
+	int32_t *distances;		// distance RGB au carré de chaque pixel à chaque couleur
+	uint8_t *membership;	// couleur affectée à chaque pixel
+	int first_block, last_block;
+	int64_t sums[PALETTE_SIZE][4]; // par couleur : nombre de pixels et somme RGB de ceux affectés
+	int64_t error;
+	int worst_pixel;		// pixel le plus mal rendu du lot, pour réensemencer une couleur inutilisée
+	int32_t worst_distance;
+} AssignTask;
+
+static void *assign_blocks(void *arg)
+{
+	AssignTask *task = arg;
+	memset(task->sums, 0, sizeof(task->sums));
+	task->error = 0;
+	task->worst_pixel = -1;
+	task->worst_distance = -1;
+
+	for (int block = task->first_block; block < task->last_block; block++) {
+		int first = block * BLOCK_SIZE;
+		int32_t *d = task->distances + (size_t)first * PALETTE_SIZE;
+
+		// Mise à jour incrémentale : seules les couleurs déplacées changent de distance
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			const uint8_t *p = task->image + (size_t)(first + i) * COLOR_COMP;
+			for (int k = 0; k < PALETTE_SIZE; k++) {
+				if (!task->moved[k]) continue;
+				int dr = p[0] - task->palette[k].r, dg = p[1] - task->palette[k].g, db = p[2] - task->palette[k].b;
+				d[i * PALETTE_SIZE + k] = dr * dr + dg * dg + db * db;
+			}
+		}
+
+		// Couple (a, b) minimisant l'erreur du bloc, chaque pixel prenant la plus proche des deux
+		int best_a = 0, best_b = 0;
+		int32_t best_error = INT32_MAX;
+		for (int a = 0; a < PALETTE_SIZE; a++) {
+			for (int b = a; b < PALETTE_SIZE; b++) {
+				int32_t e = 0;
+				for (int i = 0; i < BLOCK_SIZE && e < best_error; i++) {
+					int32_t da = d[i * PALETTE_SIZE + a], db = d[i * PALETTE_SIZE + b];
+					e += da < db ? da : db;
+				}
+				if (e < best_error) {
+					best_error = e;
+					best_a = a;
+					best_b = b;
+				}
+			}
+		}
+
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			int32_t da = d[i * PALETTE_SIZE + best_a], db = d[i * PALETTE_SIZE + best_b];
+			int k = da <= db ? best_a : best_b;
+			int32_t dk = da <= db ? da : db;
+			const uint8_t *p = task->image + (size_t)(first + i) * COLOR_COMP;
+			task->membership[first + i] = (uint8_t)k;
+			task->sums[k][0]++;
+			task->sums[k][1] += p[0];
+			task->sums[k][2] += p[1];
+			task->sums[k][3] += p[2];
+			if (dk > task->worst_distance) {
+				task->worst_distance = dk;
+				task->worst_pixel = first + i;
+			}
+		}
+		task->error += best_error;
+	}
+	return NULL;
+}
+
+int optimize_block_palette(const uint8_t *framed_image, Color palette[PALETTE_SIZE], int32_t *distances,
+						   uint8_t *membership, int threads)
+{
+	int task_count = threads < 1 ? 1 : threads > MAX_TASKS ? MAX_TASKS : threads;
+	AssignTask tasks[MAX_TASKS];
+	platform_thread handles[MAX_TASKS];
+	uint8_t moved[PALETTE_SIZE];
+	memset(moved, 1, sizeof(moved));
+
+	for (int t = 0; t < task_count; t++) {
+		tasks[t].image = framed_image;
+		tasks[t].palette = palette;
+		tasks[t].moved = moved;
+		tasks[t].distances = distances;
+		tasks[t].membership = membership;
+		tasks[t].first_block = (int)((int64_t)BLOCK_COUNT * t / task_count);
+		tasks[t].last_block = (int)((int64_t)BLOCK_COUNT * (t + 1) / task_count);
+	}
+
+	int iteration = 0;
+	while (iteration < PALETTE_OPT_MAX_ITERATIONS) {
+		iteration++;
+
+		// Affectation : les blocs sont indépendants, le premier lot reste sur le thread appelant
+		int running = 0;
+		for (int t = 1; t < task_count; t++) {
+			if (platform_thread_create(&handles[running], assign_blocks, &tasks[t]) != 0) {
+				for (int u = t; u < task_count; u++) assign_blocks(&tasks[u]);
+				break;
+			}
+			running++;
+		}
+		assign_blocks(&tasks[0]);
+		for (int t = 0; t < running; t++) platform_thread_join(handles[t]);
+
+		int64_t sums[PALETTE_SIZE][4] = {{0}};
+		int64_t error = 0;
+		int worst_pixel = -1;
+		int32_t worst_distance = -1;
+		for (int t = 0; t < task_count; t++) {
+			for (int k = 0; k < PALETTE_SIZE; k++)
+				for (int c = 0; c < 4; c++) sums[k][c] += tasks[t].sums[k][c];
+			error += tasks[t].error;
+			if (tasks[t].worst_distance > worst_distance) {
+				worst_distance = tasks[t].worst_distance;
+				worst_pixel = tasks[t].worst_pixel;
+			}
+		}
+		if (clash_verbose) printf("Optimisation palette : iteration %d, erreur %lld\n", iteration, (long long)error);
+
+		// Mise à jour : le point du treillis le plus proche de la moyenne minimise l'erreur quadratique
+		// des pixels affectés. Une couleur inutilisée repart du pixel le plus mal rendu.
+		int changed = 0, reseeded = 0;
+		for (int k = 0; k < PALETTE_SIZE; k++) {
+			Color target;
+			int64_t n = sums[k][0];
+			if (n > 0) {
+				target.r = (unsigned char)((sums[k][1] + n / 2) / n);
+				target.g = (unsigned char)((sums[k][2] + n / 2) / n);
+				target.b = (unsigned char)((sums[k][3] + n / 2) / n);
+			} else if (!reseeded && worst_pixel >= 0 && worst_distance > 0) {
+				const uint8_t *p = framed_image + (size_t)worst_pixel * COLOR_COMP;
+				target.r = p[0];
+				target.g = p[1];
+				target.b = p[2];
+				reseeded = 1;
+			} else {
+				moved[k] = 0;
+				continue;
+			}
+			Color snapped;
+			snap_to_thomson(target, &snapped);
+			moved[k] = snapped.thomson_idx != palette[k].thomson_idx;
+			if (moved[k]) {
+				palette[k] = snapped;
+				changed = 1;
+			}
+		}
+		if (!changed) break;
+	}
+	return iteration;
+}
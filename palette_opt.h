@@ -0,0 +1,19 @@
+#ifndef PALETTE_OPT_H
+#define PALETTE_OPT_H
+
+#include <stdint.h>
+#include "thomson.h"
+
+// -m 4 : nombre maximal d'itérations affectation / mise à jour
+#define PALETTE_OPT_MAX_ITERATIONS 12
+
+// Optimise palette (couleurs Thomson, thomson_idx renseigné) sous la contrainte de 2 couleurs par
+// bloc de 8 pixels : chaque itération choisit pour chaque bloc le couple de couleurs qui minimise son
+// erreur, affecte chaque pixel à la plus proche des deux, puis déplace chaque couleur sur le point du
+// treillis Thomson le plus proche de la moyenne de ses pixels. S'arrête quand la palette ne bouge
+// plus. distances : tampon WIDTH * HEIGHT * PALETTE_SIZE, membership : WIDTH * HEIGHT octets.
+// Les blocs sont répartis sur threads threads. Renvoie le nombre d'itérations effectuées.
+int optimize_block_palette(const uint8_t *framed_image, Color palette[PALETTE_SIZE], int32_t *distances,
+						   uint8_t *membership, int threads);
+
+#endif // !PALETTE_OPT_H
@@ -0,0 +1,298 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+#include "global.h"
+#include "thomson.h"
+#include "dither.h"
+#include "palette_select.h"
+
+// Case d'histogramme : nombre de pixels et somme de leurs couleurs. L'erreur quadratique
+// d'un groupe de pixels envers une couleur c vaut n * |moyenne - c|² + variance interne,
+// cette dernière ne dépendant pas de la palette.
+typedef struct {
+	float r, g, b; // moyenne des couleurs de la case
+	float count;
+} HistogramBin;
+
+typedef struct {
+	uint32_t count[NUM_THOMSON_COLORS];
+	uint64_t sum[NUM_THOMSON_COLORS][3];
+} Histogram;
+
+typedef struct {
+	int index;
+	double score;
+} PaletteScore;
+
+#define PAIRS (PALETTE_SIZE * (PALETTE_SIZE + 1) / 2) // couples de couleurs possibles d'un bloc
+
+// Poids de l'erreur au plus proche par pixel : elle départage surtout les palettes dont les
+// segments couvrent aussi bien les moyennes de blocs
+#define PIXEL_ERROR_WEIGHT 0.1
+
+// "mot" ou "mot:K"
+static int parse_selector(const char *name, const char *word, int default_k, int *k)
+{
+	size_t length = strlen(word);
+	if (strncmp(name, word, length) != 0) return 0;
+	if (name[length] == '\0') {
+		*k = default_k;
+		return 1;
+	}
+	if (name[length] != ':') return 0;
+	char *end;
+	long value = strtol(name + length + 1, &end, 10);
+	if (end == name + length + 1 || *end != '\0' || value < 1 || value > INT32_MAX) return -1;
+	*k = (int)value;
+	return 1;
+}
+
+int parse_auto_palette(const char *name, int *k)
+{
+	return parse_selector(name, "auto", AUTO_PALETTE_DEFAULT_K, k);
+}
+
+int parse_nearest_palette(const char *name, int *k)
+{
+	return parse_selector(name, "nearest", NEAREST_PALETTE_DEFAULT_K, k);
+}
+
+static void histogram_add(Histogram *histogram, float r, float g, float b, int n)
+{
+	Color c = {(unsigned char)(r + 0.5f), (unsigned char)(g + 0.5f), (unsigned char)(b + 0.5f), 0};
+	Color snapped;
+	snap_to_thomson(c, &snapped);
+	histogram->count[snapped.thomson_idx] += n;
+	histogram->sum[snapped.thomson_idx][0] += (uint64_t)(r * n + 0.5f);
+	histogram->sum[snapped.thomson_idx][1] += (uint64_t)(g * n + 0.5f);
+	histogram->sum[snapped.thomson_idx][2] += (uint64_t)(b * n + 0.5f);
+}
+
+// Cases non vides, renvoie leur nombre
+static int histogram_bins(const Histogram *histogram, HistogramBin *bins)
+{
+	int count = 0;
+	for (int i = 0; i < NUM_THOMSON_COLORS; i++) {
+		if (!histogram->count[i]) continue;
+		float n = (float)histogram->count[i];
+		bins[count].r = histogram->sum[i][0] / n;
+		bins[count].g = histogram->sum[i][1] / n;
+		bins[count].b = histogram->sum[i][2] / n;
+		bins[count].count = n;
+		count++;
+	}
+	return count;
+}
+
+// Erreur d'un bloc contraint à deux couleurs a et b : le tramage restitue au mieux un mélange
+// de a et b, la moyenne du bloc est donc comparée au segment [a, b] le plus proche
+static double segment_error(const HistogramBin *bins, int count, const Color palette[PALETTE_SIZE])
+{
+	float origin[PAIRS][3], direction[PAIRS][3], inverse_length[PAIRS];
+	int n = 0;
+	for (int a = 0; a < PALETTE_SIZE; a++) {
+		for (int b = a; b < PALETTE_SIZE; b++, n++) {
+			origin[n][0] = palette[a].r;
+			origin[n][1] = palette[a].g;
+			origin[n][2] = palette[a].b;
+			direction[n][0] = (float)palette[b].r - palette[a].r;
+			direction[n][1] = (float)palette[b].g - palette[a].g;
+			direction[n][2] = (float)palette[b].b - palette[a].b;
+			float length = direction[n][0] * direction[n][0] + direction[n][1] * direction[n][1] +
+						   direction[n][2] * direction[n][2];
+			inverse_length[n] = length > 0 ? 1.0f / length : 0;
+		}
+	}
+
+	double total = 0, weight = 0;
+	for (int i = 0; i < count; i++) {
+		float best = FLT_MAX;
+		for (int p = 0; p < PAIRS; p++) {
+			float vr = bins[i].r - origin[p][0];
+			float vg = bins[i].g - origin[p][1];
+			float vb = bins[i].b - origin[p][2];
+			float t = (vr * direction[p][0] + vg * direction[p][1] + vb * direction[p][2]) * inverse_length[p];
+			t = t < 0 ? 0 : t > 1 ? 1 : t;
+			vr -= t * direction[p][0];
+			vg -= t * direction[p][1];
+			vb -= t * direction[p][2];
+			float d = vr * vr + vg * vg + vb * vb;
+			if (d < best) best = d;
+		}
+		total += best * bins[i].count;
+		weight += bins[i].count;
+	}
+	return weight > 0 ? total / weight : 0;
+}
+
+// Erreur quadratique moyenne des cases envers leur couleur de palette la plus proche
+static double histogram_error(const HistogramBin *bins, int count, const Color palette[PALETTE_SIZE])
+{
+	double total = 0, weight = 0;
+	for (int i = 0; i < count; i++) {
+		float best = FLT_MAX;
+		for (int k = 0; k < PALETTE_SIZE; k++) {
+			float dr = bins[i].r - palette[k].r;
+			float dg = bins[i].g - palette[k].g;
+			float db = bins[i].b - palette[k].b;
+			float d = dr * dr + dg * dg + db * db;
+			if (d < best) best = d;
+		}
+		total += best * bins[i].count;
+		weight += bins[i].count;
+	}
+	return weight > 0 ? total / weight : 0;
+}
+
+// Écart perçu entre le rendu et la source : erreur filtrée par une moyenne 3x3, le tramage
+// n'étant jugé qu'une fois mélangé par l'oeil
+static double dithered_error(const uint8_t *framed_image, const DitheredPixel *dithered,
+							 const Color palette[PALETTE_SIZE], double *diff)
+{
+	for (int i = 0; i < WIDTH * HEIGHT; i++) {
+		Color c = palette[dithered[i].palette_idx];
+		diff[i * 3] = (double)c.r - framed_image[i * 3];
+		diff[i * 3 + 1] = (double)c.g - framed_image[i * 3 + 1];
+		diff[i * 3 + 2] = (double)c.b - framed_image[i * 3 + 2];
+	}
+	double total = 0;
+	for (int y = 0; y < HEIGHT; y++) {
+		for (int x = 0; x < WIDTH; x++) {
+			double sum[3] = {0, 0, 0};
+			int n = 0;
+			for (int dy = -1; dy <= 1; dy++) {
+				if (y + dy < 0 || y + dy >= HEIGHT) continue;
+				for (int dx = -1; dx <= 1; dx++) {
+					if (x + dx < 0 || x + dx >= WIDTH) continue;
+					const double *d = &diff[((y + dy) * WIDTH + x + dx) * 3];
+					sum[0] += d[0];
+					sum[1] += d[1];
+					sum[2] += d[2];
+					n++;
+				}
+			}
+			total += (sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]) / ((double)n * n);
+		}
+	}
+	return total / (WIDTH * HEIGHT);
+}
+
+static int compare_scores(const void *a, const void *b)
+{
+	const PaletteScore *x = a, *y = b;
+	if (x->score != y->score) return x->score < y->score ? -1 : 1;
+	return x->index - y->index;
+}
+
+// Trame les candidates et garde celle dont le rendu s'écarte le moins de la source
+static int dither_candidates(const PaletteLibrary *palettes, const uint8_t *framed_image, const char *mode,
+							 const PaletteScore *candidates, int k, float *matrix, const DitherOptions *options,
+							 Color palette[PALETTE_SIZE], DitheredPixel *dithered, DitheredPixel *candidate,
+							 double *error)
+{
+	int best = -1;
+	double best_error = DBL_MAX;
+	DitheredPixel *work = candidate, *kept = dithered; // kept reçoit le meilleur rendu par échange
+	for (int c = 0; c < k; c++) {
+		int p = candidates[c].index;
+		Color snapped[PALETTE_SIZE];
+		palette_lib_colors(palettes, p, snapped);
+		block_dithering_thomson_smart_propagation_options(framed_image, work, WIDTH, HEIGHT, COLOR_COMP, snapped,
+														  matrix, error, options);
+		double actual = dithered_error(framed_image, work, snapped, error);
+		if (clash_verbose)
+			printf("Palette %s %d/%d : %s (note %.1f, erreur %.1f)\n", mode, c + 1, k, palette_lib_name(palettes, p),
+				   candidates[c].score, actual);
+		if (actual < best_error) {
+			best_error = actual;
+			best = p;
+			memcpy(palette, snapped, PALETTE_SIZE * sizeof(Color));
+			DitheredPixel *swap = kept;
+			kept = work;
+			work = swap;
+		}
+	}
+	if (kept != dithered) memcpy(dithered, kept, WIDTH * HEIGHT * sizeof(DitheredPixel));
+	return best;
+}
+
+int select_auto_palette(const PaletteLibrary *palettes, const uint8_t *framed_image, int k, float *matrix,
+						const DitherOptions *options, Color palette[PALETTE_SIZE], DitheredPixel *dithered,
+						DitheredPixel *candidate, double *error)
+{
+	Histogram *histogram = calloc(2, sizeof(Histogram));
+	HistogramBin *bins = malloc(2 * NUM_THOMSON_COLORS * sizeof(HistogramBin));
+	PaletteScore *scores = malloc(palettes->unique_count * sizeof(PaletteScore));
+	if (!histogram || !bins || !scores) {
+		printf("Erreur: Impossible d'allouer la mémoire pour la sélection de palette.\n");
+		free(histogram);
+		free(bins);
+		free(scores);
+		exit(EXIT_FAILURE);
+	}
+
+	// Histogramme des pixels et histogramme des moyennes de blocs 8x1
+	for (int i = 0; i < WIDTH * HEIGHT; i++)
+		histogram_add(&histogram[0], framed_image[i * 3], framed_image[i * 3 + 1], framed_image[i * 3 + 2], 1);
+	for (int i = 0; i < WIDTH * HEIGHT; i += 8) {
+		float sum[3] = {0, 0, 0};
+		for (int j = i; j < i + 8; j++)
+			for (int c = 0; c < 3; c++) sum[c] += framed_image[j * 3 + c];
+		histogram_add(&histogram[1], sum[0] / 8, sum[1] / 8, sum[2] / 8, 8);
+	}
+	HistogramBin *pixel_bins = bins;
+	int pixel_count = histogram_bins(&histogram[0], pixel_bins);
+	HistogramBin *block_bins = bins + pixel_count;
+	int block_count = histogram_bins(&histogram[1], block_bins);
+
+	// Note en forme close : pénalité de la contrainte 2 couleurs par bloc + erreur au plus proche par pixel
+	// Un seul représentant par ensemble de couleurs Thomson : les alias auraient la même note et le même rendu
+	int count = 0;
+	for (int p = 0; p < palettes->count; p++) {
+		if (palette_lib_canonical(palettes, p) != p) continue;
+		Color snapped[PALETTE_SIZE];
+		palette_lib_colors(palettes, p, snapped);
+		scores[count].index = p;
+		scores[count].score = segment_error(block_bins, block_count, snapped) +
+							  PIXEL_ERROR_WEIGHT * histogram_error(pixel_bins, pixel_count, snapped);
+		count++;
+	}
+	qsort(scores, count, sizeof(PaletteScore), compare_scores);
+
+	// Tramage des K mieux notées : le rendu réel départage
+	int best = dither_candidates(palettes, framed_image, "auto", scores, k < count ? k : count, matrix, options,
+								 palette, dithered, candidate, error);
+
+	free(histogram);
+	free(bins);
+	free(scores);
+	return best;
+}
+
+int select_nearest_palette(const PaletteLibrary *palettes, const uint8_t *framed_image, const Color query[PALETTE_SIZE],
+						   int k, float *matrix, const DitherOptions *options, Color palette[PALETTE_SIZE],
+						   DitheredPixel *dithered, DitheredPixel *candidate, double *error)
+{
+	if (k > palettes->unique_count) k = palettes->unique_count;
+	PaletteMatch *matches = malloc(k * sizeof(PaletteMatch));
+	PaletteScore *scores = malloc(k * sizeof(PaletteScore));
+	if (!matches || !scores) {
+		printf("Erreur: Impossible d'allouer la mémoire pour la sélection de palette.\n");
+		free(matches);
+		free(scores);
+		exit(EXIT_FAILURE);
+	}
+	// Note : distance moyenne des couleurs appariées, en niveaux RGB
+	int count = palette_lib_nearest(palettes, query, k, matches);
+	for (int i = 0; i < count; i++) {
+		scores[i].index = matches[i].index;
+		scores[i].score = matches[i].distance;
+	}
+	int best = dither_candidates(palettes, framed_image, "nearest", scores, count, matrix, options, palette,
+								 dithered, candidate, error);
+	free(matches);
+	free(scores);
+	return best;
+}
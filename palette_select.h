@@ -0,0 +1,33 @@
+#ifndef PALETTE_SELECT_H
+#define PALETTE_SELECT_H
+
+#include <stdint.h>
+#include "thomson.h"
+#include "palette_lib.h"
+#include "dither.h"
+
+// -p auto[:K] : nombre de palettes tramées pour départager les mieux notées
+#define AUTO_PALETTE_DEFAULT_K 5
+// -p nearest[:K] : palettes de la bibliothèque les plus proches de la palette exoquant de l'image
+#define NEAREST_PALETTE_DEFAULT_K 3
+
+// 1 si name vaut "auto" ou "auto:K" (K dans *k), 0 sinon, -1 si K est invalide
+int parse_auto_palette(const char *name, int *k);
+// Idem pour "nearest" et "nearest:K"
+int parse_nearest_palette(const char *name, int *k);
+
+// Note toutes les palettes de la bibliothèque sur les histogrammes de l'image cadrée, tramée les K
+// meilleures et garde celle dont le rendu s'écarte le moins de la source. En sortie : palette ramenée
+// aux couleurs Thomson et dithered rempli avec elle. candidate et error sont des tampons
+// WIDTH * HEIGHT (error : 3 doubles par pixel). Renvoie l'index de la palette retenue.
+int select_auto_palette(const PaletteLibrary *palettes, const uint8_t *framed_image, int k, float *matrix,
+						const DitherOptions *options, Color palette[PALETTE_SIZE], DitheredPixel *dithered,
+						DitheredPixel *candidate, double *error);
+
+// Cherche dans l'index de la bibliothèque les K palettes les plus proches de query (distance du
+// transport optimal), les trame et garde la meilleure, comme select_auto_palette.
+int select_nearest_palette(const PaletteLibrary *palettes, const uint8_t *framed_image, const Color query[PALETTE_SIZE],
+						   int k, float *matrix, const DitherOptions *options, Color palette[PALETTE_SIZE],
+						   DitheredPixel *dithered, DitheredPixel *candidate, double *error);
+
+#endif // !PALETTE_SELECT_H
@@ -5,6 +5,8 @@
 #define PALETTES_H
 
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 #include "thomson.h"
 
 #define NUM_PALETTES 445
@@ -15,8017 +17,69 @@ typedef struct {
 	Color palette[COLORS_PER_PALETTE];
 } Palette;
 
-static const Palette palette_table[NUM_PALETTES] = {
-	/* 0 */
-	{"burntseason",
-	 {{0xE1, 0xB6, 0x70, 0},
-	  {0xB9, 0x69, 0x25, 0},
-	  {0x68, 0x39, 0x2E, 0},
-	  {0x20, 0x13, 0x00, 0},
-	  {0x40, 0x4E, 0x21, 0},
-	  {0x45, 0x94, 0x4F, 0},
-	  {0x77, 0xD3, 0xB2, 0},
-	  {0x96, 0xBF, 0xFF, 0},
-	  {0x03, 0x8A, 0xC2, 0},
-	  {0x01, 0x51, 0x5E, 0},
-	  {0x00, 0x14, 0x37, 0},
-	  {0x50, 0x3E, 0x66, 0},
-	  {0xA7, 0x62, 0xA9, 0},
-	  {0xEF, 0xA3, 0xC8, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 1 */
-	{"postofficeflourescent",
-	 {{0x14, 0x15, 0x20, 0},
-	  {0x3B, 0x3F, 0x4B, 0},
-	  {0x6F, 0x7E, 0x8F, 0},
-	  {0xA1, 0xAE, 0xBA, 0},
-	  {0xFE, 0xFF, 0xFB, 0},
-	  {0x02, 0x2E, 0x6B, 0},
-	  {0x33, 0x45, 0x5C, 0},
-	  {0x61, 0xAA, 0xD9, 0},
-	  {0x6F, 0x50, 0x35, 0},
-	  {0xBB, 0x9B, 0x7F, 0},
-	  {0xE3, 0xD3, 0xA9, 0},
-	  {0xF4, 0xF4, 0xCA, 0},
-	  {0xC7, 0xCD, 0xA5, 0},
-	  {0xA6, 0x43, 0x23, 0},
-	  {0xD3, 0x6A, 0x5D, 0},
-	  {0x53, 0x86, 0x70, 0}}},
-	/* 2 */
-	{"potshelf",
-	 {{0x1A, 0x15, 0x15, 0},
-	  {0x43, 0x32, 0x24, 0},
-	  {0x6F, 0x4E, 0x20, 0},
-	  {0xB9, 0x8F, 0x55, 0},
-	  {0xEA, 0xDE, 0xC3, 0},
-	  {0xF0, 0x94, 0x4A, 0},
-	  {0xC7, 0x69, 0x1E, 0},
-	  {0x75, 0x38, 0x1A, 0},
-	  {0x38, 0x18, 0x0F, 0},
-	  {0x19, 0x32, 0x23, 0},
-	  {0x3E, 0x78, 0x50, 0},
-	  {0x7A, 0x9E, 0x7D, 0},
-	  {0xB6, 0xE2, 0xA0, 0},
-	  {0x8B, 0xCF, 0xD0, 0},
-	  {0x36, 0x77, 0x87, 0},
-	  {0x2A, 0x54, 0x6F, 0}}},
-	/* 3 */
-	{"lostcenturypalette",
-	 {{0xD1, 0xB1, 0x87, 0},
-	  {0xC7, 0x7B, 0x58, 0},
-	  {0xAE, 0x5D, 0x40, 0},
-	  {0x79, 0x44, 0x4A, 0},
-	  {0x4B, 0x3D, 0x44, 0},
-	  {0xBA, 0x91, 0x58, 0},
-	  {0x92, 0x74, 0x41, 0},
-	  {0x4D, 0x45, 0x39, 0},
-	  {0x77, 0x74, 0x3B, 0},
-	  {0xB3, 0xA5, 0x55, 0},
-	  {0xD2, 0xC9, 0xA5, 0},
-	  {0x8C, 0xAB, 0xA1, 0},
-	  {0x4B, 0x72, 0x6E, 0},
-	  {0x57, 0x48, 0x52, 0},
-	  {0x84, 0x78, 0x75, 0},
-	  {0xAB, 0x9B, 0x8E, 0}}},
-	/* 4 */
-	{"sweetie16",
-	 {{0x1A, 0x1C, 0x2C, 0},
-	  {0x5D, 0x27, 0x5D, 0},
-	  {0xB1, 0x3E, 0x53, 0},
-	  {0xEF, 0x7D, 0x57, 0},
-	  {0xFF, 0xCD, 0x75, 0},
-	  {0xA7, 0xF0, 0x70, 0},
-	  {0x38, 0xB7, 0x64, 0},
-	  {0x25, 0x71, 0x79, 0},
-	  {0x29, 0x36, 0x6F, 0},
-	  {0x3B, 0x5D, 0xC9, 0},
-	  {0x41, 0xA6, 0xF6, 0},
-	  {0x73, 0xEF, 0xF7, 0},
-	  {0xF4, 0xF4, 0xF4, 0},
-	  {0x94, 0xB0, 0xC2, 0},
-	  {0x56, 0x6C, 0x86, 0},
-	  {0x33, 0x3C, 0x57, 0}}},
-	/* 5 */
-	{"steamlords",
-	 {{0x21, 0x3B, 0x25, 0},
-	  {0x3A, 0x60, 0x4A, 0},
-	  {0x4F, 0x77, 0x54, 0},
-	  {0xA1, 0x9F, 0x7C, 0},
-	  {0x77, 0x74, 0x4F, 0},
-	  {0x77, 0x5C, 0x4F, 0},
-	  {0x60, 0x3B, 0x3A, 0},
-	  {0x3B, 0x21, 0x37, 0},
-	  {0x17, 0x0E, 0x19, 0},
-	  {0x2F, 0x21, 0x3B, 0},
-	  {0x43, 0x3A, 0x60, 0},
-	  {0x4F, 0x52, 0x77, 0},
-	  {0x65, 0x73, 0x8C, 0},
-	  {0x7C, 0x94, 0xA1, 0},
-	  {0xA0, 0xB9, 0xBA, 0},
-	  {0xC0, 0xD1, 0xCC, 0}}},
-	/* 6 */
-	{"pico8",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x1D, 0x2B, 0x53, 0},
-	  {0x7E, 0x25, 0x53, 0},
-	  {0x00, 0x87, 0x51, 0},
-	  {0xAB, 0x52, 0x36, 0},
-	  {0x5F, 0x57, 0x4F, 0},
-	  {0xC2, 0xC3, 0xC7, 0},
-	  {0xFF, 0xF1, 0xE8, 0},
-	  {0xFF, 0x00, 0x4D, 0},
-	  {0xFF, 0xA3, 0x00, 0},
-	  {0xFF, 0xEC, 0x27, 0},
-	  {0x00, 0xE4, 0x36, 0},
-	  {0x29, 0xAD, 0xFF, 0},
-	  {0x83, 0x76, 0x9C, 0},
-	  {0xFF, 0x77, 0xA8, 0},
-	  {0xFF, 0xCC, 0xAA, 0}}},
-	/* 7 */
-	{"na16",
-	 {{0x8C, 0x8F, 0xAE, 0},
-	  {0x58, 0x45, 0x63, 0},
-	  {0x3E, 0x21, 0x37, 0},
-	  {0x9A, 0x63, 0x48, 0},
-	  {0xD7, 0x9B, 0x7D, 0},
-	  {0xF5, 0xED, 0xBA, 0},
-	  {0xC0, 0xC7, 0x41, 0},
-	  {0x64, 0x7D, 0x34, 0},
-	  {0xE4, 0x94, 0x3A, 0},
-	  {0x9D, 0x30, 0x3B, 0},
-	  {0xD2, 0x64, 0x71, 0},
-	  {0x70, 0x37, 0x7F, 0},
-	  {0x7E, 0xC4, 0xC1, 0},
-	  {0x34, 0x85, 0x9D, 0},
-	  {0x17, 0x43, 0x4B, 0},
-	  {0x1F, 0x0E, 0x1C, 0}}},
-	/* 8 */
-	{"vanillamilkpallete",
-	 {{0x28, 0x28, 0x2E, 0},
-	  {0x6C, 0x56, 0x71, 0},
-	  {0xD9, 0xC8, 0xBF, 0},
-	  {0xF9, 0x82, 0x84, 0},
-	  {0xB0, 0xA9, 0xE4, 0},
-	  {0xAC, 0xCC, 0xE4, 0},
-	  {0xB3, 0xE3, 0xDA, 0},
-	  {0xFE, 0xAA, 0xE4, 0},
-	  {0x87, 0xA8, 0x89, 0},
-	  {0xB0, 0xEB, 0x93, 0},
-	  {0xE9, 0xF5, 0x9D, 0},
-	  {0xFF, 0xE6, 0xC6, 0},
-	  {0xDE, 0xA3, 0x8B, 0},
-	  {0xFF, 0xC3, 0x84, 0},
-	  {0xFF, 0xF7, 0xA0, 0},
-	  {0xFF, 0xF7, 0xE4, 0}}},
-	/* 9 */
-	{"islandjoy16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x6D, 0xF7, 0xC1, 0},
-	  {0x11, 0xAD, 0xC1, 0},
-	  {0x60, 0x6C, 0x81, 0},
-	  {0x39, 0x34, 0x57, 0},
-	  {0x1E, 0x88, 0x75, 0},
-	  {0x5B, 0xB3, 0x61, 0},
-	  {0xA1, 0xE5, 0x5A, 0},
-	  {0xF7, 0xE4, 0x76, 0},
-	  {0xF9, 0x92, 0x52, 0},
-	  {0xCB, 0x4D, 0x68, 0},
-	  {0x6A, 0x37, 0x71, 0},
-	  {0xC9, 0x24, 0x64, 0},
-	  {0xF4, 0x8C, 0xB6, 0},
-	  {0xF7, 0xB6, 0x9E, 0},
-	  {0x9B, 0x9C, 0x82, 0}}},
-	/* 10 */
-	{"fading16palette",
-	 {{0xDD, 0xCF, 0x99, 0},
-	  {0xCC, 0xA8, 0x7B, 0},
-	  {0xB9, 0x7A, 0x60, 0},
-	  {0x9C, 0x52, 0x4E, 0},
-	  {0x77, 0x42, 0x51, 0},
-	  {0x4B, 0x3D, 0x44, 0},
-	  {0x4E, 0x54, 0x63, 0},
-	  {0x5B, 0x7D, 0x73, 0},
-	  {0x8E, 0x9F, 0x7D, 0},
-	  {0x64, 0x53, 0x55, 0},
-	  {0x8C, 0x7C, 0x79, 0},
-	  {0xA9, 0x9C, 0x8D, 0},
-	  {0x7D, 0x7B, 0x62, 0},
-	  {0xAA, 0xA2, 0x5D, 0},
-	  {0x84, 0x6D, 0x59, 0},
-	  {0xA8, 0x8A, 0x5E, 0}}},
-	/* 11 */
-	{"bubblegum16",
-	 {{0x16, 0x17, 0x1A, 0},
-	  {0x7F, 0x06, 0x22, 0},
-	  {0xD6, 0x24, 0x11, 0},
-	  {0xFF, 0x84, 0x26, 0},
-	  {0xFF, 0xD1, 0x00, 0},
-	  {0xFA, 0xFD, 0xFF, 0},
-	  {0xFF, 0x80, 0xA4, 0},
-	  {0xFF, 0x26, 0x74, 0},
-	  {0x94, 0x21, 0x6A, 0},
-	  {0x43, 0x00, 0x67, 0},
-	  {0x23, 0x49, 0x75, 0},
-	  {0x68, 0xAE, 0xD4, 0},
-	  {0xBF, 0xFF, 0x3C, 0},
-	  {0x10, 0xD2, 0x75, 0},
-	  {0x00, 0x78, 0x99, 0},
-	  {0x00, 0x28, 0x59, 0}}},
-	/* 12 */
-	{"cretaceous16",
-	 {{0x31, 0x34, 0x32, 0},
-	  {0x32, 0x3E, 0x42, 0},
-	  {0x45, 0x4B, 0x4B, 0},
-	  {0x3A, 0x5F, 0x3B, 0},
-	  {0x7C, 0x45, 0x45, 0},
-	  {0x67, 0x52, 0x39, 0},
-	  {0x62, 0x50, 0x55, 0},
-	  {0x51, 0x6B, 0x43, 0},
-	  {0x79, 0x6C, 0x64, 0},
-	  {0x71, 0x82, 0x45, 0},
-	  {0x9E, 0x80, 0x5C, 0},
-	  {0x99, 0x85, 0x79, 0},
-	  {0xAC, 0x90, 0x86, 0},
-	  {0xA6, 0xA2, 0x96, 0},
-	  {0xB4, 0xAB, 0x8F, 0},
-	  {0xBC, 0xB7, 0xA5, 0}}},
-	/* 13 */
-	{"edg16",
-	 {{0xE4, 0xA6, 0x72, 0},
-	  {0xB8, 0x6F, 0x50, 0},
-	  {0x74, 0x3F, 0x39, 0},
-	  {0x3F, 0x28, 0x32, 0},
-	  {0x9E, 0x28, 0x35, 0},
-	  {0xE5, 0x3B, 0x44, 0},
-	  {0xFB, 0x92, 0x2B, 0},
-	  {0xFF, 0xE7, 0x62, 0},
-	  {0x63, 0xC6, 0x4D, 0},
-	  {0x32, 0x73, 0x45, 0},
-	  {0x19, 0x3D, 0x3F, 0},
-	  {0x4F, 0x67, 0x81, 0},
-	  {0xAF, 0xBF, 0xD2, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x2C, 0xE8, 0xF4, 0},
-	  {0x04, 0x84, 0xD1, 0}}},
-	/* 14 */
-	{"galaxyflame",
-	 {{0x69, 0x9F, 0xAD, 0},
-	  {0x3A, 0x70, 0x8E, 0},
-	  {0x2B, 0x45, 0x4F, 0},
-	  {0x11, 0x12, 0x15, 0},
-	  {0x15, 0x1D, 0x1A, 0},
-	  {0x1D, 0x32, 0x30, 0},
-	  {0x31, 0x4E, 0x3F, 0},
-	  {0x4F, 0x5D, 0x42, 0},
-	  {0x9A, 0x9F, 0x87, 0},
-	  {0xED, 0xE6, 0xCB, 0},
-	  {0xF5, 0xD8, 0x93, 0},
-	  {0xE8, 0xB2, 0x6F, 0},
-	  {0xB6, 0x83, 0x4C, 0},
-	  {0x70, 0x4D, 0x2B, 0},
-	  {0x40, 0x23, 0x1E, 0},
-	  {0x15, 0x10, 0x15, 0}}},
-	/* 15 */
-	{"antiquity16",
-	 {{0x20, 0x20, 0x20, 0},
-	  {0x2D, 0x21, 0x1E, 0},
-	  {0x45, 0x29, 0x23, 0},
-	  {0x6D, 0x3D, 0x29, 0},
-	  {0xB1, 0x6B, 0x4A, 0},
-	  {0xE8, 0x9F, 0x6E, 0},
-	  {0xE8, 0xBE, 0x82, 0},
-	  {0x5D, 0x75, 0x57, 0},
-	  {0x8E, 0x92, 0x57, 0},
-	  {0x70, 0x7B, 0x88, 0},
-	  {0x8A, 0xA7, 0xAC, 0},
-	  {0xE5, 0x5D, 0x4D, 0},
-	  {0xF1, 0x86, 0x6C, 0},
-	  {0xD2, 0x67, 0x30, 0},
-	  {0xDE, 0x9A, 0x28, 0},
-	  {0xE8, 0xD8, 0xA5, 0}}},
-	/* 16 */
-	{"parchmentandink",
-	 {{0xF1, 0xE2, 0xBE, 0},
-	  {0xE6, 0xD1, 0xA1, 0},
-	  {0xF0, 0xD6, 0x96, 0},
-	  {0xCA, 0xAC, 0x77, 0},
-	  {0xA5, 0x8A, 0x62, 0},
-	  {0x88, 0x62, 0x43, 0},
-	  {0xC0, 0x97, 0x7A, 0},
-	  {0x94, 0x44, 0x31, 0},
-	  {0xD2, 0xBC, 0x76, 0},
-	  {0xAD, 0x9D, 0x62, 0},
-	  {0x88, 0x7C, 0x56, 0},
-	  {0x59, 0x4A, 0x45, 0},
-	  {0xA9, 0xA9, 0x94, 0},
-	  {0x87, 0x86, 0x7A, 0},
-	  {0x44, 0x51, 0x62, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 17 */
-	{"microsoftwindows",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x7E, 0x7E, 0x7E, 0},
-	  {0xBE, 0xBE, 0xBE, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x7E, 0x00, 0x00, 0},
-	  {0xFE, 0x00, 0x00, 0},
-	  {0x04, 0x7E, 0x00, 0},
-	  {0x06, 0xFF, 0x04, 0},
-	  {0x7E, 0x7E, 0x00, 0},
-	  {0xFF, 0xFF, 0x04, 0},
-	  {0x00, 0x00, 0x7E, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0x7E, 0x00, 0x7E, 0},
-	  {0xFE, 0x00, 0xFF, 0},
-	  {0x04, 0x7E, 0x7E, 0},
-	  {0x06, 0xFF, 0xFF, 0}}},
-	/* 18 */
-	{"c64",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x62, 0x62, 0x62, 0},
-	  {0x89, 0x89, 0x89, 0},
-	  {0xAD, 0xAD, 0xAD, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x9F, 0x4E, 0x44, 0},
-	  {0xCB, 0x7E, 0x75, 0},
-	  {0x6D, 0x54, 0x12, 0},
-	  {0xA1, 0x68, 0x3C, 0},
-	  {0xC9, 0xD4, 0x87, 0},
-	  {0x9A, 0xE2, 0x9B, 0},
-	  {0x5C, 0xAB, 0x5E, 0},
-	  {0x6A, 0xBF, 0xC6, 0},
-	  {0x88, 0x7E, 0xCB, 0},
-	  {0x50, 0x45, 0x9B, 0},
-	  {0xA0, 0x57, 0xA3, 0}}},
-	/* 19 */
-	{"summerspast16",
-	 {{0x32, 0x00, 0x11, 0},
-	  {0x5F, 0x3A, 0x60, 0},
-	  {0x87, 0x66, 0x72, 0},
-	  {0xB7, 0xA3, 0x9D, 0},
-	  {0xEC, 0xE8, 0xC2, 0},
-	  {0x6D, 0xB7, 0xC3, 0},
-	  {0x5E, 0x80, 0xB2, 0},
-	  {0x62, 0x70, 0x57, 0},
-	  {0x8D, 0xA2, 0x4E, 0},
-	  {0xD2, 0xCB, 0x3E, 0},
-	  {0xF7, 0xD5, 0x54, 0},
-	  {0xE8, 0xBF, 0x92, 0},
-	  {0xE7, 0x8C, 0x5B, 0},
-	  {0xC6, 0x6F, 0x5E, 0},
-	  {0xC3, 0x38, 0x46, 0},
-	  {0x93, 0x39, 0x42, 0}}},
-	/* 20 */
-	{"db16",
-	 {{0x14, 0x0C, 0x1C, 0},
-	  {0x44, 0x24, 0x34, 0},
-	  {0x30, 0x34, 0x6D, 0},
-	  {0x4E, 0x4A, 0x4E, 0},
-	  {0x85, 0x4C, 0x30, 0},
-	  {0x34, 0x65, 0x24, 0},
-	  {0xD0, 0x46, 0x48, 0},
-	  {0x75, 0x71, 0x61, 0},
-	  {0x59, 0x7D, 0xCE, 0},
-	  {0xD2, 0x7D, 0x2C, 0},
-	  {0x85, 0x95, 0xA1, 0},
-	  {0x6D, 0xAA, 0x2C, 0},
-	  {0xD2, 0xAA, 0x99, 0},
-	  {0x6D, 0xC2, 0xCA, 0},
-	  {0xDA, 0xD4, 0x5E, 0},
-	  {0xDE, 0xEE, 0xD6, 0}}},
-	/* 21 */
-	{"forest16",
-	 {{0x64, 0x98, 0x8E, 0},
-	  {0x3D, 0x70, 0x85, 0},
-	  {0x0F, 0x2C, 0x2E, 0},
-	  {0x34, 0x56, 0x44, 0},
-	  {0x6B, 0x7F, 0x5C, 0},
-	  {0xB0, 0xB1, 0x7C, 0},
-	  {0xE1, 0xC5, 0x84, 0},
-	  {0xC8, 0x96, 0x60, 0},
-	  {0xAD, 0x5F, 0x52, 0},
-	  {0x91, 0x36, 0x36, 0},
-	  {0x69, 0x2F, 0x11, 0},
-	  {0x89, 0x54, 0x2F, 0},
-	  {0x79, 0x6E, 0x63, 0},
-	  {0xA1, 0x7D, 0x5E, 0},
-	  {0xB4, 0xA1, 0x8F, 0},
-	  {0xEC, 0xDD, 0xBA, 0}}},
-	/* 22 */
-	{"ds16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x00, 0x14, 0x18, 0},
-	  {0x00, 0x20, 0x24, 0},
-	  {0x00, 0x2C, 0x38, 0},
-	  {0x14, 0x34, 0x44, 0},
-	  {0x44, 0x34, 0x44, 0},
-	  {0x58, 0x3C, 0x48, 0},
-	  {0x6C, 0x4C, 0x44, 0},
-	  {0x80, 0x60, 0x58, 0},
-	  {0x6C, 0x70, 0x6C, 0},
-	  {0x88, 0x80, 0x78, 0},
-	  {0xA4, 0x94, 0x84, 0},
-	  {0xC4, 0xAC, 0x9C, 0},
-	  {0xD8, 0xB0, 0xA8, 0},
-	  {0xEC, 0xD4, 0xD0, 0},
-	  {0xFC, 0xFC, 0xFC, 0}}},
-	/* 23 */
-	{"goline",
-	 {{0x43, 0x00, 0x67, 0},
-	  {0x94, 0x21, 0x6A, 0},
-	  {0xFF, 0x00, 0x4D, 0},
-	  {0xFF, 0x84, 0x26, 0},
-	  {0xFF, 0xDD, 0x34, 0},
-	  {0x50, 0xE1, 0x12, 0},
-	  {0x3F, 0xA6, 0x6F, 0},
-	  {0x36, 0x59, 0x87, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x00, 0x33, 0xFF, 0},
-	  {0x29, 0xAD, 0xFF, 0},
-	  {0x00, 0xFF, 0xCC, 0},
-	  {0xFF, 0xF1, 0xE8, 0},
-	  {0xC2, 0xC3, 0xC7, 0},
-	  {0xAB, 0x52, 0x36, 0},
-	  {0x5F, 0x57, 0x4F, 0}}},
-	/* 24 */
-	{"miyazaki16",
-	 {{0x23, 0x22, 0x28, 0},
-	  {0x28, 0x42, 0x61, 0},
-	  {0x5F, 0x58, 0x54, 0},
-	  {0x87, 0x85, 0x73, 0},
-	  {0xB8, 0xB0, 0x95, 0},
-	  {0xC3, 0xD5, 0xC7, 0},
-	  {0xEB, 0xEC, 0xDC, 0},
-	  {0x24, 0x85, 0xA6, 0},
-	  {0x54, 0xBA, 0xD2, 0},
-	  {0x75, 0x4D, 0x45, 0},
-	  {0xC6, 0x50, 0x46, 0},
-	  {0xE6, 0x92, 0x8A, 0},
-	  {0x1E, 0x74, 0x53, 0},
-	  {0x55, 0xA0, 0x58, 0},
-	  {0xA1, 0xBF, 0x41, 0},
-	  {0xE3, 0xC0, 0x54, 0}}},
-	/* 25 */
-	{"nannerjam",
-	 {{0x35, 0x2B, 0x40, 0},
-	  {0x65, 0x3D, 0x48, 0},
-	  {0x93, 0x3F, 0x45, 0},
-	  {0xB2, 0x5E, 0x46, 0},
-	  {0xCC, 0x92, 0x5E, 0},
-	  {0xDA, 0xCB, 0x80, 0},
-	  {0xF0, 0xE9, 0xC9, 0},
-	  {0x76, 0xC3, 0x79, 0},
-	  {0x50, 0x8D, 0x76, 0},
-	  {0x53, 0x5C, 0x89, 0},
-	  {0x7B, 0x99, 0xC8, 0},
-	  {0x99, 0xD4, 0xE6, 0},
-	  {0xBE, 0x79, 0x79, 0},
-	  {0xD8, 0xB1, 0xA1, 0},
-	  {0x7D, 0x6E, 0x6E, 0},
-	  {0xC2, 0xB5, 0xA9, 0}}},
-	/* 26 */
-	{"pastelhorizon",
-	 {{0x53, 0x43, 0x7F, 0},
-	  {0xA8, 0x9F, 0xCC, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xD9, 0xE8, 0},
-	  {0xFF, 0x9B, 0xB6, 0},
-	  {0x99, 0x68, 0xE2, 0},
-	  {0xBE, 0x9B, 0xFF, 0},
-	  {0x7F, 0xCE, 0xFF, 0},
-	  {0x6D, 0x81, 0xFF, 0},
-	  {0x2C, 0x6F, 0x99, 0},
-	  {0x00, 0xBC, 0xAA, 0},
-	  {0xC4, 0x8F, 0x9E, 0},
-	  {0x8E, 0x58, 0x6F, 0},
-	  {0xFF, 0x54, 0x70, 0},
-	  {0xFF, 0x9B, 0x71, 0},
-	  {0xFF, 0xD9, 0xAE, 0}}},
-	/* 27 */
-	{"woodspark",
-	 {{0xF5, 0xEE, 0xB0, 0},
-	  {0xFA, 0xBF, 0x61, 0},
-	  {0xE0, 0x8D, 0x51, 0},
-	  {0x8A, 0x58, 0x65, 0},
-	  {0x45, 0x2B, 0x3F, 0},
-	  {0x2C, 0x5E, 0x3B, 0},
-	  {0x60, 0x9C, 0x4F, 0},
-	  {0xC6, 0xCC, 0x54, 0},
-	  {0x78, 0xC2, 0xD6, 0},
-	  {0x54, 0x79, 0xB0, 0},
-	  {0x56, 0x54, 0x6E, 0},
-	  {0x83, 0x9F, 0xA6, 0},
-	  {0xE0, 0xD3, 0xC8, 0},
-	  {0xF0, 0x5B, 0x5B, 0},
-	  {0x8F, 0x32, 0x5F, 0},
-	  {0xEB, 0x6C, 0x98, 0}}},
-	/* 28 */
-	{"shidoneon",
-	 {{0x00, 0x03, 0x3C, 0},
-	  {0x00, 0x52, 0x60, 0},
-	  {0x00, 0x9D, 0x4A, 0},
-	  {0x0A, 0xFF, 0x52, 0},
-	  {0x00, 0x38, 0x84, 0},
-	  {0x00, 0x8A, 0xC5, 0},
-	  {0x00, 0xF7, 0xFF, 0},
-	  {0xFF, 0x5C, 0xFF, 0},
-	  {0xAC, 0x29, 0xCE, 0},
-	  {0x60, 0x00, 0x88, 0},
-	  {0xB1, 0x05, 0x85, 0},
-	  {0xFF, 0x00, 0x4E, 0},
-	  {0x2A, 0x2E, 0x79, 0},
-	  {0x4E, 0x6E, 0xA8, 0},
-	  {0xAD, 0xD4, 0xFA, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 29 */
-	{"cardboardpaint",
-	 {{0xD2, 0xB2, 0xA0, 0},
-	  {0xB1, 0x89, 0x79, 0},
-	  {0x6F, 0x54, 0x4C, 0},
-	  {0x3E, 0x2A, 0x2E, 0},
-	  {0x8F, 0x36, 0x41, 0},
-	  {0xB9, 0x68, 0x4F, 0},
-	  {0xD2, 0xA8, 0x65, 0},
-	  {0x75, 0xA1, 0x65, 0},
-	  {0x45, 0x7C, 0x60, 0},
-	  {0x32, 0x55, 0x4F, 0},
-	  {0x51, 0x81, 0x83, 0},
-	  {0x85, 0xA7, 0xB6, 0},
-	  {0x57, 0x57, 0x77, 0},
-	  {0x4D, 0x39, 0x56, 0},
-	  {0x85, 0x48, 0x65, 0},
-	  {0xBE, 0x7A, 0x80, 0}}},
-	/* 30 */
-	{"16bital",
-	 {{0x21, 0x2B, 0x5E, 0},
-	  {0x63, 0x6F, 0xB2, 0},
-	  {0xAD, 0xC4, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xCC, 0xD7, 0},
-	  {0xFF, 0x7F, 0xBD, 0},
-	  {0x87, 0x24, 0x50, 0},
-	  {0xE5, 0x2D, 0x40, 0},
-	  {0xEF, 0x60, 0x4A, 0},
-	  {0xFF, 0xD8, 0x77, 0},
-	  {0x00, 0xCC, 0x8B, 0},
-	  {0x00, 0x5A, 0x75, 0},
-	  {0x51, 0x3A, 0xE8, 0},
-	  {0x19, 0xBA, 0xFF, 0},
-	  {0x77, 0x31, 0xA5, 0},
-	  {0xB9, 0x7C, 0xFF, 0}}},
-	/* 31 */
-	{"cga",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x55, 0x55, 0x55, 0},
-	  {0xAA, 0xAA, 0xAA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x00, 0x00, 0xAA, 0},
-	  {0x55, 0x55, 0xFF, 0},
-	  {0x00, 0xAA, 0x00, 0},
-	  {0x55, 0xFF, 0x55, 0},
-	  {0x00, 0xAA, 0xAA, 0},
-	  {0x55, 0xFF, 0xFF, 0},
-	  {0xAA, 0x00, 0x00, 0},
-	  {0xFF, 0x55, 0x55, 0},
-	  {0xAA, 0x00, 0xAA, 0},
-	  {0xFF, 0x55, 0xFF, 0},
-	  {0xAA, 0x55, 0x00, 0},
-	  {0xFF, 0xFF, 0x55, 0}}},
-	/* 32 */
-	{"nanner16",
-	 {{0x7A, 0xCC, 0xCC, 0},
-	  {0x62, 0x7D, 0xB3, 0},
-	  {0x55, 0x40, 0x80, 0},
-	  {0x59, 0x28, 0x58, 0},
-	  {0x80, 0x40, 0x55, 0},
-	  {0xB3, 0x7D, 0x62, 0},
-	  {0xCC, 0xC9, 0x7A, 0},
-	  {0x70, 0xB3, 0x62, 0},
-	  {0x40, 0x80, 0x6A, 0},
-	  {0x27, 0x44, 0x57, 0},
-	  {0xCC, 0xCC, 0xCC, 0},
-	  {0x99, 0x94, 0x91, 0},
-	  {0x66, 0x5C, 0x5F, 0},
-	  {0x33, 0x2B, 0x33, 0},
-	  {0x80, 0x4E, 0x46, 0},
-	  {0x4D, 0x2A, 0x2A, 0}}},
-	/* 33 */
-	{"taffy16",
-	 {{0x22, 0x25, 0x33, 0},
-	  {0x62, 0x75, 0xBA, 0},
-	  {0xA3, 0xC0, 0xE6, 0},
-	  {0xFA, 0xFF, 0xFC, 0},
-	  {0xFF, 0xAB, 0x7B, 0},
-	  {0xFF, 0x6C, 0x7A, 0},
-	  {0xDC, 0x43, 0x5B, 0},
-	  {0x3F, 0x48, 0xC2, 0},
-	  {0x44, 0x8D, 0xE7, 0},
-	  {0x2B, 0xDB, 0x72, 0},
-	  {0xA7, 0xF5, 0x47, 0},
-	  {0xFF, 0xEB, 0x33, 0},
-	  {0xF5, 0x89, 0x31, 0},
-	  {0xDB, 0x4B, 0x3D, 0},
-	  {0xA6, 0x3D, 0x57, 0},
-	  {0x36, 0x35, 0x4D, 0}}},
-	/* 34 */
-	{"pastelpop16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xFF, 0xFC, 0xFF, 0},
-	  {0xE6, 0xE1, 0xF2, 0},
-	  {0xB2, 0xB7, 0xE1, 0},
-	  {0x59, 0x5B, 0x7D, 0},
-	  {0x7B, 0x8A, 0xC6, 0},
-	  {0xFF, 0xD9, 0xF4, 0},
-	  {0xE1, 0xAD, 0xC3, 0},
-	  {0xAD, 0x80, 0xA6, 0},
-	  {0xFB, 0xA2, 0xD7, 0},
-	  {0xFA, 0xE0, 0xC7, 0},
-	  {0xF0, 0xAB, 0xAB, 0},
-	  {0x97, 0xC4, 0xAA, 0},
-	  {0xBF, 0xED, 0xF5, 0},
-	  {0x73, 0xC9, 0xEB, 0},
-	  {0xCA, 0xAF, 0xF5, 0}}},
-	/* 35 */
-	{"punolite",
-	 {{0x64, 0xC2, 0x24, 0},
-	  {0x0F, 0xA1, 0x0D, 0},
-	  {0x09, 0x79, 0x38, 0},
-	  {0x0B, 0x64, 0x57, 0},
-	  {0x0A, 0x50, 0x58, 0},
-	  {0x0A, 0x41, 0x58, 0},
-	  {0x0A, 0x2E, 0x58, 0},
-	  {0x09, 0x18, 0x37, 0},
-	  {0x28, 0x19, 0x61, 0},
-	  {0x55, 0x20, 0x67, 0},
-	  {0x70, 0x27, 0x63, 0},
-	  {0x86, 0x34, 0x53, 0},
-	  {0xA1, 0x4B, 0x4B, 0},
-	  {0xB6, 0x7A, 0x5B, 0},
-	  {0xC8, 0xA2, 0x6E, 0},
-	  {0xE1, 0xD4, 0x83, 0}}},
-	/* 36 */
-	{"daylight16",
-	 {{0xF2, 0xD3, 0xAC, 0},
-	  {0xE7, 0xA7, 0x6C, 0},
-	  {0xC2, 0x84, 0x62, 0},
-	  {0x90, 0x5B, 0x54, 0},
-	  {0x51, 0x3A, 0x3D, 0},
-	  {0x7A, 0x69, 0x77, 0},
-	  {0x87, 0x8C, 0x87, 0},
-	  {0xB5, 0xC6, 0x9A, 0},
-	  {0x27, 0x22, 0x23, 0},
-	  {0x60, 0x6B, 0x31, 0},
-	  {0xB1, 0x9E, 0x3F, 0},
-	  {0xF8, 0xC6, 0x5C, 0},
-	  {0xD5, 0x8B, 0x39, 0},
-	  {0x99, 0x63, 0x36, 0},
-	  {0x6A, 0x42, 0x2C, 0},
-	  {0xB5, 0x5B, 0x39, 0}}},
-	/* 37 */
-	{"urbex16",
-	 {{0xCB, 0xD1, 0xBE, 0},
-	  {0x8F, 0x93, 0x89, 0},
-	  {0x52, 0x53, 0x4C, 0},
-	  {0x26, 0x20, 0x1D, 0},
-	  {0xE0, 0xA4, 0x6E, 0},
-	  {0x91, 0xA4, 0x7A, 0},
-	  {0x5D, 0x76, 0x43, 0},
-	  {0x4D, 0x53, 0x3A, 0},
-	  {0xA9, 0x31, 0x30, 0},
-	  {0x7A, 0x13, 0x38, 0},
-	  {0x83, 0x46, 0x64, 0},
-	  {0x91, 0x76, 0x92, 0},
-	  {0x16, 0x07, 0x12, 0},
-	  {0x59, 0x30, 0x84, 0},
-	  {0x38, 0x70, 0xBE, 0},
-	  {0x57, 0x9F, 0xB4, 0}}},
-	/* 38 */
-	{"shiny16",
-	 {{0x1F, 0x17, 0x23, 0},
-	  {0x3C, 0x2F, 0x52, 0},
-	  {0x8C, 0x7F, 0x90, 0},
-	  {0xBC, 0xB0, 0xB3, 0},
-	  {0xE2, 0xE2, 0xE2, 0},
-	  {0xD8, 0x68, 0x30, 0},
-	  {0xF0, 0x95, 0x48, 0},
-	  {0xEF, 0xD0, 0x81, 0},
-	  {0xB2, 0x27, 0x41, 0},
-	  {0xF5, 0x46, 0x4C, 0},
-	  {0xF7, 0x9C, 0x88, 0},
-	  {0x46, 0x56, 0xA5, 0},
-	  {0x49, 0x95, 0xF3, 0},
-	  {0x72, 0xDE, 0xEB, 0},
-	  {0x3E, 0xC5, 0x4B, 0},
-	  {0xB4, 0xE6, 0x56, 0}}},
-	/* 39 */
-	{"aragon16",
-	 {{0xF9, 0xF8, 0xDD, 0},
-	  {0xD2, 0xE2, 0x91, 0},
-	  {0xA8, 0xD4, 0x55, 0},
-	  {0x9C, 0xAB, 0x6C, 0},
-	  {0x5C, 0x8D, 0x58, 0},
-	  {0x3B, 0x47, 0x3C, 0},
-	  {0x8B, 0x88, 0x93, 0},
-	  {0x54, 0x55, 0x5C, 0},
-	  {0xE0, 0xBF, 0x7A, 0},
-	  {0xBA, 0x95, 0x72, 0},
-	  {0x87, 0x66, 0x61, 0},
-	  {0x27, 0x21, 0x20, 0},
-	  {0xB7, 0xC4, 0xD0, 0},
-	  {0x8D, 0xAA, 0xD6, 0},
-	  {0x91, 0x97, 0xB6, 0},
-	  {0x6B, 0x72, 0xD4, 0}}},
-	/* 40 */
-	{"sotspalette",
-	 {{0x92, 0x50, 0x3F, 0},
-	  {0x70, 0x3A, 0x28, 0},
-	  {0x56, 0x45, 0x2B, 0},
-	  {0x40, 0x35, 0x21, 0},
-	  {0xCF, 0xBC, 0x95, 0},
-	  {0x94, 0x95, 0x76, 0},
-	  {0x81, 0x78, 0x4D, 0},
-	  {0x60, 0x5F, 0x33, 0},
-	  {0x7A, 0x7E, 0x67, 0},
-	  {0x93, 0xA3, 0x99, 0},
-	  {0x51, 0x67, 0x5A, 0},
-	  {0x2F, 0x48, 0x45, 0},
-	  {0x42, 0x59, 0x61, 0},
-	  {0x46, 0x7E, 0x73, 0},
-	  {0x01, 0x14, 0x1A, 0},
-	  {0x20, 0x36, 0x33, 0}}},
-	/* 41 */
-	{"colorquest",
-	 {{0x99, 0xD4, 0xAA, 0},
-	  {0x49, 0x8E, 0x86, 0},
-	  {0x32, 0x48, 0x59, 0},
-	  {0x43, 0x7A, 0x4D, 0},
-	  {0x7D, 0xBE, 0x58, 0},
-	  {0xEA, 0xDB, 0x77, 0},
-	  {0xDC, 0x82, 0x54, 0},
-	  {0xC1, 0x3D, 0x37, 0},
-	  {0x61, 0x36, 0x3D, 0},
-	  {0xB0, 0x61, 0x63, 0},
-	  {0xE6, 0xAF, 0x89, 0},
-	  {0xFF, 0xF9, 0xE5, 0},
-	  {0xC1, 0xA6, 0x8C, 0},
-	  {0x8B, 0x69, 0x62, 0},
-	  {0x0D, 0x0B, 0x0D, 0},
-	  {0x9D, 0x57, 0x45, 0}}},
-	/* 42 */
-	{"outrunner16",
-	 {{0x4D, 0x00, 0x4C, 0},
-	  {0x8F, 0x00, 0x76, 0},
-	  {0xC7, 0x00, 0x83, 0},
-	  {0xF5, 0x00, 0x78, 0},
-	  {0xFF, 0x47, 0x64, 0},
-	  {0xFF, 0x93, 0x93, 0},
-	  {0xFF, 0xD5, 0xCC, 0},
-	  {0xFF, 0xF3, 0xF0, 0},
-	  {0x00, 0x02, 0x21, 0},
-	  {0x00, 0x07, 0x69, 0},
-	  {0x00, 0x22, 0x8F, 0},
-	  {0x00, 0x50, 0xC7, 0},
-	  {0x00, 0x8B, 0xF5, 0},
-	  {0x00, 0xBB, 0xFF, 0},
-	  {0x47, 0xED, 0xFF, 0},
-	  {0x93, 0xFF, 0xF8, 0}}},
-	/* 43 */
-	{"systemmini16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x68, 0x60, 0x5C, 0},
-	  {0xB0, 0xB0, 0xB8, 0},
-	  {0xFC, 0xFC, 0xFC, 0},
-	  {0x1C, 0x38, 0xAC, 0},
-	  {0x70, 0x70, 0xFC, 0},
-	  {0xA8, 0x28, 0x14, 0},
-	  {0xFC, 0x48, 0x48, 0},
-	  {0x20, 0x88, 0x00, 0},
-	  {0x70, 0xF8, 0x28, 0},
-	  {0xB8, 0x2C, 0xD0, 0},
-	  {0xFC, 0x74, 0xEC, 0},
-	  {0xAC, 0x58, 0x1C, 0},
-	  {0xF8, 0xA8, 0x50, 0},
-	  {0x3C, 0xD4, 0xE4, 0},
-	  {0xF8, 0xEC, 0x20, 0}}},
-	/* 44 */
-	{"anb16",
-	 {{0x0A, 0x08, 0x0D, 0},
-	  {0x69, 0x75, 0x94, 0},
-	  {0xDF, 0xE9, 0xF5, 0},
-	  {0xF7, 0xAA, 0xA8, 0},
-	  {0xD4, 0x68, 0x9A, 0},
-	  {0x78, 0x2C, 0x96, 0},
-	  {0xE8, 0x35, 0x62, 0},
-	  {0xF2, 0x82, 0x5C, 0},
-	  {0xFF, 0xC7, 0x6E, 0},
-	  {0x88, 0xC4, 0x4D, 0},
-	  {0x3F, 0x9E, 0x59, 0},
-	  {0x37, 0x34, 0x61, 0},
-	  {0x48, 0x54, 0xA8, 0},
-	  {0x71, 0x99, 0xD9, 0},
-	  {0x9E, 0x52, 0x52, 0},
-	  {0x4D, 0x25, 0x36, 0}}},
-	/* 45 */
-	{"corruption16",
-	 {{0xE1, 0xD8, 0xCB, 0},
-	  {0xC3, 0xB1, 0x97, 0},
-	  {0xA6, 0x8A, 0x64, 0},
-	  {0x61, 0x4F, 0x38, 0},
-	  {0x36, 0x2C, 0x20, 0},
-	  {0x82, 0x99, 0x8F, 0},
-	  {0x52, 0x5E, 0x5A, 0},
-	  {0x3A, 0x40, 0x40, 0},
-	  {0x22, 0x23, 0x26, 0},
-	  {0x0A, 0x0D, 0x0A, 0},
-	  {0x20, 0x33, 0x1F, 0},
-	  {0x49, 0x58, 0x40, 0},
-	  {0x88, 0x8F, 0x72, 0},
-	  {0xC7, 0xC7, 0xA5, 0},
-	  {0xDE, 0x8D, 0x7D, 0},
-	  {0x83, 0x31, 0x21, 0}}},
-	/* 46 */
-	{"magicolor16",
-	 {{0x1D, 0x18, 0x19, 0},
-	  {0x48, 0x26, 0x32, 0},
-	  {0x27, 0x36, 0x35, 0},
-	  {0x4D, 0x3D, 0x2F, 0},
-	  {0x93, 0x36, 0x33, 0},
-	  {0x31, 0x64, 0x36, 0},
-	  {0x82, 0x5C, 0x3A, 0},
-	  {0xB9, 0x53, 0x58, 0},
-	  {0xC7, 0x73, 0x31, 0},
-	  {0x61, 0x7A, 0x6F, 0},
-	  {0x7F, 0xA5, 0x33, 0},
-	  {0xCA, 0x98, 0x64, 0},
-	  {0xAF, 0xAA, 0x94, 0},
-	  {0x7D, 0xCF, 0xA8, 0},
-	  {0xE7, 0xDC, 0x58, 0},
-	  {0xF7, 0xF6, 0xDB, 0}}},
-	/* 47 */
-	{"c64",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x4A, 0x4A, 0x4A, 0},
-	  {0x7B, 0x7B, 0x7B, 0},
-	  {0xB2, 0xB2, 0xB2, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x81, 0x33, 0x38, 0},
-	  {0xC4, 0x6C, 0x71, 0},
-	  {0x55, 0x38, 0x00, 0},
-	  {0x8E, 0x50, 0x29, 0},
-	  {0xED, 0xF1, 0x71, 0},
-	  {0xA9, 0xFF, 0x9F, 0},
-	  {0x56, 0xAC, 0x4D, 0},
-	  {0x75, 0xCE, 0xC8, 0},
-	  {0x70, 0x6D, 0xEB, 0},
-	  {0x2E, 0x2C, 0x9B, 0},
-	  {0x8E, 0x3C, 0x97, 0}}},
-	/* 48 */
-	{"herbsnspices",
-	 {{0x59, 0x3A, 0x31, 0},
-	  {0x39, 0x20, 0x2E, 0},
-	  {0x61, 0x31, 0x40, 0},
-	  {0x83, 0x44, 0x3E, 0},
-	  {0xC9, 0x8D, 0x3F, 0},
-	  {0xDA, 0xC2, 0x82, 0},
-	  {0x9A, 0x94, 0x5C, 0},
-	  {0x6B, 0x66, 0x57, 0},
-	  {0x38, 0x41, 0x50, 0},
-	  {0x6E, 0x7E, 0x8D, 0},
-	  {0x90, 0xB5, 0xC6, 0},
-	  {0xF5, 0xEF, 0xE8, 0},
-	  {0xAB, 0x99, 0xA4, 0},
-	  {0x55, 0x51, 0x6F, 0},
-	  {0x46, 0x35, 0x54, 0},
-	  {0x17, 0x11, 0x1A, 0}}},
-	/* 49 */
-	{"trixbit",
-	 {{0x0F, 0x0D, 0x0F, 0},
-	  {0xD0, 0x1F, 0x6C, 0},
-	  {0x73, 0x20, 0x50, 0},
-	  {0xB5, 0x4E, 0x35, 0},
-	  {0xF7, 0x98, 0x31, 0},
-	  {0x86, 0xBD, 0x28, 0},
-	  {0x18, 0x4A, 0x4A, 0},
-	  {0x1E, 0x1A, 0x4F, 0},
-	  {0x2D, 0xA1, 0xC4, 0},
-	  {0x7D, 0x45, 0x82, 0},
-	  {0xDC, 0xA8, 0xC9, 0},
-	  {0xF7, 0xE0, 0xB2, 0},
-	  {0xE3, 0x7F, 0x8F, 0},
-	  {0xF7, 0xF1, 0xE4, 0},
-	  {0xB5, 0xA9, 0xA3, 0},
-	  {0x5F, 0x56, 0x66, 0}}},
-	/* 50 */
-	{"retrobubble",
-	 {{0x9D, 0xC1, 0xC0, 0},
-	  {0x52, 0x5B, 0x80, 0},
-	  {0x31, 0x21, 0x39, 0},
-	  {0x12, 0x0E, 0x1F, 0},
-	  {0x28, 0x46, 0x46, 0},
-	  {0x62, 0xAB, 0x46, 0},
-	  {0x95, 0x53, 0x3D, 0},
-	  {0x6A, 0x24, 0x35, 0},
-	  {0x65, 0x41, 0x47, 0},
-	  {0xFF, 0xF1, 0x69, 0},
-	  {0xD7, 0x79, 0x3F, 0},
-	  {0xAB, 0x32, 0x29, 0},
-	  {0x9E, 0x8F, 0x84, 0},
-	  {0xFF, 0xFA, 0xCE, 0},
-	  {0xE0, 0xB5, 0x6D, 0},
-	  {0xF6, 0x8B, 0x69, 0}}},
-	/* 51 */
-	{"flowers",
-	 {{0x61, 0x38, 0x32, 0},
-	  {0x8B, 0x58, 0x51, 0},
-	  {0xBF, 0x8F, 0x75, 0},
-	  {0xFF, 0xDE, 0xB2, 0},
-	  {0xFF, 0xA5, 0xA5, 0},
-	  {0xFF, 0x8D, 0xB5, 0},
-	  {0xB8, 0x7C, 0xA4, 0},
-	  {0x85, 0x60, 0x82, 0},
-	  {0x5A, 0x4A, 0x60, 0},
-	  {0x73, 0x62, 0x8B, 0},
-	  {0x88, 0x7F, 0xCE, 0},
-	  {0x8C, 0xC1, 0xD4, 0},
-	  {0x8B, 0xF0, 0xC4, 0},
-	  {0x78, 0xBA, 0xB4, 0},
-	  {0x52, 0x73, 0x78, 0},
-	  {0x2F, 0x44, 0x47, 0}}},
-	/* 52 */
-	{"arq16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xD1, 0x9D, 0},
-	  {0xAE, 0xB5, 0xBD, 0},
-	  {0x4D, 0x80, 0xC9, 0},
-	  {0xE9, 0x38, 0x41, 0},
-	  {0x10, 0x08, 0x20, 0},
-	  {0x51, 0x1E, 0x43, 0},
-	  {0x05, 0x44, 0x94, 0},
-	  {0xF1, 0x89, 0x2D, 0},
-	  {0x82, 0x3E, 0x2C, 0},
-	  {0xFF, 0xA9, 0xA9, 0},
-	  {0x5A, 0xE1, 0x50, 0},
-	  {0xFF, 0xE9, 0x47, 0},
-	  {0x7D, 0x3E, 0xBF, 0},
-	  {0xEB, 0x6C, 0x82, 0},
-	  {0x1E, 0x8A, 0x4C, 0}}},
-	/* 53 */
-	{"graveyardmist",
-	 {{0x0B, 0x0D, 0x0A, 0},
-	  {0x38, 0x37, 0x30, 0},
-	  {0x66, 0x5F, 0x57, 0},
-	  {0x82, 0x85, 0x7B, 0},
-	  {0xB1, 0xB8, 0xA9, 0},
-	  {0xDE, 0xE6, 0xB8, 0},
-	  {0x95, 0xBD, 0xB2, 0},
-	  {0x5A, 0x7B, 0x85, 0},
-	  {0x27, 0x32, 0x45, 0},
-	  {0x47, 0x7A, 0x5A, 0},
-	  {0x81, 0xBA, 0x78, 0},
-	  {0xD4, 0xEA, 0x92, 0},
-	  {0xB5, 0x97, 0x66, 0},
-	  {0x8F, 0x54, 0x50, 0},
-	  {0x66, 0x40, 0x3C, 0},
-	  {0x40, 0x29, 0x2F, 0}}},
-	/* 54 */
-	{"bloom16",
-	 {{0xFF, 0x90, 0x72, 0},
-	  {0xFF, 0xC5, 0x67, 0},
-	  {0xFC, 0xE3, 0x9A, 0},
-	  {0xF7, 0xF7, 0xC7, 0},
-	  {0xAF, 0xE4, 0x8D, 0},
-	  {0x61, 0xD8, 0x68, 0},
-	  {0x29, 0xAB, 0x7D, 0},
-	  {0x2B, 0x75, 0xB7, 0},
-	  {0x00, 0x40, 0x8F, 0},
-	  {0x09, 0x28, 0x67, 0},
-	  {0x11, 0x0F, 0x3E, 0},
-	  {0x37, 0x1A, 0x77, 0},
-	  {0x6F, 0x2A, 0x8F, 0},
-	  {0xAB, 0x2A, 0xA3, 0},
-	  {0xD6, 0x4D, 0x9A, 0},
-	  {0xFF, 0x71, 0x8C, 0}}},
-	/* 55 */
-	{"o16",
-	 {{0xF9, 0xFF, 0xF2, 0},
-	  {0xF5, 0xD6, 0x78, 0},
-	  {0x6B, 0xE0, 0xBF, 0},
-	  {0xBA, 0xB1, 0x97, 0},
-	  {0x96, 0xD4, 0x5B, 0},
-	  {0xF5, 0x6C, 0x77, 0},
-	  {0xE0, 0x86, 0x4A, 0},
-	  {0x59, 0x90, 0x9E, 0},
-	  {0x57, 0x94, 0x60, 0},
-	  {0x9E, 0x48, 0x91, 0},
-	  {0x6E, 0x66, 0x60, 0},
-	  {0x50, 0x52, 0x73, 0},
-	  {0xAB, 0x37, 0x37, 0},
-	  {0x69, 0x3C, 0x36, 0},
-	  {0x3A, 0x36, 0x3D, 0},
-	  {0x20, 0x20, 0x26, 0}}},
-	/* 56 */
-	{"rgrproto16",
-	 {{0xFF, 0xF9, 0xB3, 0},
-	  {0xB9, 0xC5, 0xCC, 0},
-	  {0x47, 0x74, 0xB3, 0},
-	  {0x14, 0x4B, 0x66, 0},
-	  {0x8F, 0xB3, 0x47, 0},
-	  {0x2E, 0x99, 0x4E, 0},
-	  {0xF2, 0x90, 0x66, 0},
-	  {0xE6, 0x50, 0x50, 0},
-	  {0x70, 0x7D, 0x7C, 0},
-	  {0x29, 0x3C, 0x40, 0},
-	  {0x17, 0x0B, 0x1A, 0},
-	  {0x0A, 0x01, 0x0D, 0},
-	  {0x57, 0x09, 0x32, 0},
-	  {0x87, 0x1E, 0x2E, 0},
-	  {0xFF, 0xBF, 0x40, 0},
-	  {0xCC, 0x14, 0x24, 0}}},
-	/* 57 */
-	{"kitchen16",
-	 {{0x12, 0x0E, 0x23, 0},
-	  {0x5A, 0x26, 0x5E, 0},
-	  {0x8D, 0x2D, 0x4E, 0},
-	  {0xBA, 0x61, 0x56, 0},
-	  {0xF2, 0xA6, 0x5E, 0},
-	  {0xFF, 0xCE, 0x95, 0},
-	  {0x10, 0xD2, 0x75, 0},
-	  {0x00, 0x78, 0x99, 0},
-	  {0x47, 0x3B, 0x78, 0},
-	  {0x32, 0x3E, 0x4F, 0},
-	  {0x63, 0x66, 0x86, 0},
-	  {0x8C, 0x88, 0xA5, 0},
-	  {0xE2, 0xD9, 0xEA, 0},
-	  {0xFF, 0xFF, 0xF5, 0},
-	  {0xEA, 0xCE, 0xBD, 0},
-	  {0xB4, 0x88, 0x94, 0}}},
-	/* 58 */
-	{"peachypop16",
-	 {{0xFD, 0xFF, 0xFF, 0},
-	  {0xFF, 0x86, 0x86, 0},
-	  {0xFB, 0x47, 0x71, 0},
-	  {0xCE, 0x18, 0x6A, 0},
-	  {0x8F, 0x0B, 0x5F, 0},
-	  {0x53, 0x03, 0x4B, 0},
-	  {0xAD, 0x6D, 0xEA, 0},
-	  {0x9F, 0xB9, 0xFF, 0},
-	  {0x56, 0x7F, 0xEB, 0},
-	  {0x0A, 0x54, 0x7B, 0},
-	  {0x27, 0x8C, 0x7F, 0},
-	  {0x0C, 0xE7, 0xA7, 0},
-	  {0xAC, 0xFC, 0xAD, 0},
-	  {0xFF, 0xEC, 0x6D, 0},
-	  {0xFF, 0xA7, 0x63, 0},
-	  {0xFF, 0x40, 0x40, 0}}},
-	/* 59 */
-	{"mystic16",
-	 {{0x16, 0x0D, 0x13, 0},
-	  {0x31, 0x29, 0x3E, 0},
-	  {0x4D, 0x66, 0x60, 0},
-	  {0x95, 0xB6, 0x66, 0},
-	  {0xEF, 0x9E, 0x4E, 0},
-	  {0xAD, 0x40, 0x30, 0},
-	  {0x56, 0x21, 0x2A, 0},
-	  {0x90, 0x4B, 0x41, 0},
-	  {0xA6, 0x99, 0x98, 0},
-	  {0x5F, 0x57, 0x5E, 0},
-	  {0x8E, 0xB8, 0x9E, 0},
-	  {0xF6, 0xF2, 0xC3, 0},
-	  {0xE7, 0x9B, 0x7C, 0},
-	  {0x9B, 0x4C, 0x63, 0},
-	  {0x43, 0x21, 0x42, 0},
-	  {0xD1, 0x93, 0x5F, 0}}},
-	/* 60 */
-	{"muddygrass16",
-	 {{0x10, 0x0A, 0x0A, 0},
-	  {0x33, 0x30, 0x25, 0},
-	  {0x58, 0x5E, 0x53, 0},
-	  {0xA5, 0xA5, 0x89, 0},
-	  {0xEA, 0xE5, 0xD1, 0},
-	  {0xDE, 0xC6, 0x66, 0},
-	  {0x97, 0xAB, 0x50, 0},
-	  {0x51, 0x6B, 0x38, 0},
-	  {0x25, 0x15, 0x0F, 0},
-	  {0x52, 0x27, 0x32, 0},
-	  {0x9C, 0x32, 0x3C, 0},
-	  {0xC4, 0x66, 0x3D, 0},
-	  {0xE4, 0x8D, 0x80, 0},
-	  {0x63, 0x92, 0xAF, 0},
-	  {0x2C, 0x3C, 0x6A, 0},
-	  {0x2C, 0x1D, 0x34, 0}}},
-	/* 61 */
-	{"sara98a",
-	 {{0xB6, 0x10, 0x30, 0},
-	  {0xE2, 0x40, 0x50, 0},
-	  {0xEE, 0x71, 0x75, 0},
-	  {0xF6, 0x9D, 0x9D, 0},
-	  {0xFF, 0xFF, 0xF2, 0},
-	  {0xEA, 0xD6, 0xAA, 0},
-	  {0xDA, 0xA5, 0x6D, 0},
-	  {0xCA, 0x71, 0x3C, 0},
-	  {0xAE, 0x4C, 0x30, 0},
-	  {0x7D, 0x18, 0x18, 0},
-	  {0x55, 0x10, 0x08, 0},
-	  {0x71, 0x34, 0x10, 0},
-	  {0x65, 0x71, 0x50, 0},
-	  {0x71, 0x95, 0x8D, 0},
-	  {0xA5, 0xBA, 0xAE, 0},
-	  {0x1C, 0x08, 0x10, 0}}},
-	/* 62 */
-	{"atepalette",
-	 {{0xF8, 0xB8, 0x88, 0},
-	  {0xF8, 0x8E, 0x89, 0},
-	  {0xE8, 0x68, 0x78, 0},
-	  {0x98, 0x58, 0x98, 0},
-	  {0x16, 0x24, 0x32, 0},
-	  {0x48, 0x88, 0x88, 0},
-	  {0x48, 0xBD, 0x68, 0},
-	  {0xD8, 0xE8, 0x88, 0},
-	  {0xE8, 0xF8, 0xF8, 0},
-	  {0xA8, 0xB8, 0xF8, 0},
-	  {0x84, 0x84, 0xF8, 0},
-	  {0x48, 0x48, 0x88, 0},
-	  {0x48, 0x68, 0xE8, 0},
-	  {0x68, 0xA8, 0xE8, 0},
-	  {0xF8, 0xB8, 0xC8, 0},
-	  {0xF8, 0x89, 0xC8, 0}}},
-	/* 63 */
-	{"peregrine16",
-	 {{0x38, 0x31, 0x31, 0},
-	  {0x63, 0x41, 0x57, 0},
-	  {0x91, 0x83, 0x7D, 0},
-	  {0xC2, 0xB6, 0x95, 0},
-	  {0xDB, 0xD0, 0x9A, 0},
-	  {0xE6, 0xE1, 0xCA, 0},
-	  {0xCC, 0x9C, 0x66, 0},
-	  {0xB7, 0x57, 0x7A, 0},
-	  {0x8A, 0x50, 0x80, 0},
-	  {0xC2, 0x91, 0xA2, 0},
-	  {0xD6, 0xB8, 0xA7, 0},
-	  {0xB0, 0xC2, 0xB5, 0},
-	  {0x96, 0x9E, 0x61, 0},
-	  {0x53, 0x87, 0x78, 0},
-	  {0x29, 0x58, 0x68, 0},
-	  {0x34, 0x3E, 0x61, 0}}},
-	/* 64 */
-	{"blankvhsbox",
-	 {{0xFE, 0xF6, 0xDD, 0},
-	  {0xF3, 0xE4, 0x6D, 0},
-	  {0xBF, 0x98, 0xAC, 0},
-	  {0xB1, 0x73, 0x9A, 0},
-	  {0xED, 0x72, 0x75, 0},
-	  {0xEB, 0x5B, 0x2B, 0},
-	  {0xE1, 0x20, 0x2D, 0},
-	  {0xE6, 0x72, 0x16, 0},
-	  {0xED, 0xD6, 0x00, 0},
-	  {0x0E, 0x87, 0x43, 0},
-	  {0xA0, 0xC5, 0xC6, 0},
-	  {0x0A, 0x5C, 0x9F, 0},
-	  {0x39, 0x28, 0x74, 0},
-	  {0xC3, 0x34, 0x79, 0},
-	  {0x86, 0x21, 0x5F, 0},
-	  {0x21, 0x24, 0x25, 0}}},
-	/* 65 */
-	{"grayscale16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x18, 0x18, 0x18, 0},
-	  {0x28, 0x28, 0x28, 0},
-	  {0x38, 0x38, 0x38, 0},
-	  {0x47, 0x47, 0x47, 0},
-	  {0x56, 0x56, 0x56, 0},
-	  {0x64, 0x64, 0x64, 0},
-	  {0x71, 0x71, 0x71, 0},
-	  {0x7E, 0x7E, 0x7E, 0},
-	  {0x8C, 0x8C, 0x8C, 0},
-	  {0x9B, 0x9B, 0x9B, 0},
-	  {0xAB, 0xAB, 0xAB, 0},
-	  {0xBD, 0xBD, 0xBD, 0},
-	  {0xD1, 0xD1, 0xD1, 0},
-	  {0xE7, 0xE7, 0xE7, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 66 */
-	{"jonk16",
-	 {{0x24, 0x2E, 0x36, 0},
-	  {0x45, 0x59, 0x51, 0},
-	  {0x79, 0x87, 0x66, 0},
-	  {0xB7, 0xBC, 0xA2, 0},
-	  {0xD6, 0xD6, 0xD6, 0},
-	  {0xF4, 0xF0, 0xEA, 0},
-	  {0x69, 0x88, 0xA1, 0},
-	  {0xA1, 0xB0, 0xBE, 0},
-	  {0x59, 0x5B, 0x7C, 0},
-	  {0x95, 0x81, 0x9D, 0},
-	  {0xC9, 0xA5, 0xA9, 0},
-	  {0xF4, 0xDE, 0xC2, 0},
-	  {0x70, 0x4F, 0x4F, 0},
-	  {0xB7, 0x63, 0x5B, 0},
-	  {0xE3, 0x96, 0x69, 0},
-	  {0xEB, 0xC7, 0x90, 0}}},
-	/* 67 */
-	{"console16",
-	 {{0xFF, 0x03, 0x2B, 0},
-	  {0x80, 0x00, 0x34, 0},
-	  {0xFF, 0xFF, 0x0D, 0},
-	  {0xFF, 0x8F, 0x00, 0},
-	  {0x0A, 0xFF, 0x0A, 0},
-	  {0x00, 0x70, 0x62, 0},
-	  {0x0D, 0xFF, 0xFF, 0},
-	  {0x3C, 0x80, 0xDB, 0},
-	  {0x29, 0x29, 0xFF, 0},
-	  {0x2D, 0x00, 0x6E, 0},
-	  {0xFF, 0x08, 0xFF, 0},
-	  {0x6E, 0x00, 0x85, 0},
-	  {0x26, 0x0A, 0x34, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x7D, 0x7D, 0xA3, 0}}},
-	/* 68 */
-	{"reha16",
-	 {{0x01, 0x0E, 0x05, 0},
-	  {0x12, 0x23, 0x03, 0},
-	  {0x2B, 0x2C, 0x21, 0},
-	  {0x3B, 0x34, 0x53, 0},
-	  {0x67, 0x3D, 0x49, 0},
-	  {0x1E, 0x62, 0x4E, 0},
-	  {0x94, 0x3B, 0x38, 0},
-	  {0x8D, 0x61, 0x48, 0},
-	  {0x9B, 0x6E, 0x70, 0},
-	  {0x3B, 0x88, 0x4C, 0},
-	  {0xB5, 0x7E, 0x67, 0},
-	  {0xBC, 0x9B, 0x72, 0},
-	  {0x51, 0xB0, 0x9D, 0},
-	  {0xD4, 0xB0, 0xA2, 0},
-	  {0xD3, 0xCF, 0xB1, 0},
-	  {0xF5, 0xE1, 0xE8, 0}}},
-	/* 69 */
-	{"retrocal",
-	 {{0x2E, 0x1B, 0x37, 0},
-	  {0x4E, 0x53, 0xA2, 0},
-	  {0x73, 0x94, 0xBA, 0},
-	  {0xE6, 0xE1, 0xCC, 0},
-	  {0x28, 0x52, 0x4E, 0},
-	  {0x3A, 0x7E, 0x4C, 0},
-	  {0x7D, 0xA4, 0x46, 0},
-	  {0xED, 0xD1, 0x5A, 0},
-	  {0x4B, 0x1D, 0x45, 0},
-	  {0x8C, 0x31, 0x5D, 0},
-	  {0xCF, 0x4F, 0x4F, 0},
-	  {0xF6, 0x78, 0x8D, 0},
-	  {0x6A, 0x51, 0x54, 0},
-	  {0xA4, 0x5A, 0x41, 0},
-	  {0xD8, 0x7E, 0x46, 0},
-	  {0xB4, 0x9A, 0x8D, 0}}},
-	/* 70 */
-	{"sulu",
-	 {{0xEE, 0x70, 0xB5, 0},
-	  {0xEE, 0xB5, 0x70, 0},
-	  {0xB5, 0xEE, 0x70, 0},
-	  {0x70, 0xEE, 0xB5, 0},
-	  {0x70, 0xB5, 0xEE, 0},
-	  {0xB5, 0x70, 0xEE, 0},
-	  {0xBA, 0xBA, 0xD3, 0},
-	  {0x47, 0x47, 0x51, 0},
-	  {0xFF, 0xBC, 0xEC, 0},
-	  {0xFF, 0xEC, 0xBC, 0},
-	  {0xEC, 0xFF, 0xBC, 0},
-	  {0xBC, 0xFF, 0xEC, 0},
-	  {0xBC, 0xEC, 0xFF, 0},
-	  {0xEC, 0xBC, 0xFF, 0},
-	  {0xE3, 0xE3, 0xF2, 0},
-	  {0x8E, 0x8E, 0xA3, 0}}},
-	/* 71 */
-	{"picodb",
-	 {{0x12, 0x09, 0x19, 0},
-	  {0x1B, 0x1F, 0x4B, 0},
-	  {0x59, 0x29, 0x42, 0},
-	  {0x10, 0x68, 0x36, 0},
-	  {0x85, 0x4A, 0x2F, 0},
-	  {0x4D, 0x4B, 0x44, 0},
-	  {0xA4, 0xB2, 0xBF, 0},
-	  {0xDE, 0xEE, 0xD6, 0},
-	  {0xD0, 0x46, 0x48, 0},
-	  {0xED, 0x8F, 0x3B, 0},
-	  {0xEB, 0xD9, 0x51, 0},
-	  {0x61, 0xAD, 0x36, 0},
-	  {0x51, 0x90, 0xC8, 0},
-	  {0x77, 0x6E, 0x87, 0},
-	  {0xE3, 0x84, 0xA2, 0},
-	  {0xE5, 0xBB, 0xA7, 0}}},
-	/* 72 */
-	{"cthulhu16",
-	 {{0x1D, 0x25, 0x31, 0},
-	  {0xA5, 0xE5, 0xC5, 0},
-	  {0xF0, 0xFA, 0xFD, 0},
-	  {0x52, 0xA5, 0x93, 0},
-	  {0x2B, 0x62, 0x67, 0},
-	  {0x1E, 0x30, 0x3A, 0},
-	  {0x3B, 0x42, 0x51, 0},
-	  {0x52, 0x7B, 0x92, 0},
-	  {0x7D, 0xC1, 0xC1, 0},
-	  {0xC7, 0xFF, 0xF3, 0},
-	  {0xB8, 0xCB, 0xD8, 0},
-	  {0x7E, 0x8D, 0xA1, 0},
-	  {0x8F, 0xA9, 0x90, 0},
-	  {0xE5, 0xDE, 0xBB, 0},
-	  {0xCE, 0xA0, 0x61, 0},
-	  {0x85, 0x47, 0x31, 0}}},
-	/* 73 */
-	{"hilda",
-	 {{0xE2, 0xD9, 0xE4, 0},
-	  {0x6C, 0x9A, 0x9A, 0},
-	  {0x52, 0x67, 0x5D, 0},
-	  {0x37, 0x40, 0x3B, 0},
-	  {0xF3, 0xC8, 0x93, 0},
-	  {0xE5, 0x98, 0x7D, 0},
-	  {0xCB, 0x5E, 0x5C, 0},
-	  {0x72, 0x33, 0x4C, 0},
-	  {0xC0, 0xA5, 0xA9, 0},
-	  {0xBF, 0x7D, 0x85, 0},
-	  {0x80, 0x4D, 0x53, 0},
-	  {0x40, 0x30, 0x38, 0},
-	  {0x7C, 0x8F, 0xB2, 0},
-	  {0x4C, 0x52, 0x74, 0},
-	  {0x2E, 0x33, 0x4D, 0},
-	  {0x1F, 0x20, 0x25, 0}}},
-	/* 74 */
-	{"rampy16",
-	 {{0x25, 0x29, 0x45, 0},
-	  {0x51, 0x53, 0x69, 0},
-	  {0x84, 0x8F, 0xA1, 0},
-	  {0xD9, 0xD9, 0xCC, 0},
-	  {0xA1, 0x35, 0x67, 0},
-	  {0xE0, 0x67, 0x67, 0},
-	  {0x7D, 0x30, 0x9C, 0},
-	  {0xBD, 0x46, 0xB7, 0},
-	  {0x4E, 0x4C, 0xC7, 0},
-	  {0x5D, 0x74, 0xCF, 0},
-	  {0x79, 0x94, 0xD4, 0},
-	  {0x79, 0xBE, 0xE0, 0},
-	  {0x63, 0xB0, 0x4F, 0},
-	  {0xA7, 0xD9, 0x50, 0},
-	  {0xD4, 0x99, 0x6A, 0},
-	  {0xD9, 0xCF, 0x91, 0}}},
-	/* 75 */
-	{"mem16",
-	 {{0x29, 0x21, 0x3B, 0},
-	  {0x36, 0x3D, 0x69, 0},
-	  {0x7F, 0x4A, 0x3D, 0},
-	  {0xD0, 0x57, 0x57, 0},
-	  {0xFC, 0x98, 0x49, 0},
-	  {0xFF, 0xD5, 0x59, 0},
-	  {0x8C, 0xCC, 0x4B, 0},
-	  {0x3E, 0x9D, 0x4D, 0},
-	  {0x3E, 0x62, 0x78, 0},
-	  {0x47, 0x89, 0xB2, 0},
-	  {0x99, 0xAE, 0xB4, 0},
-	  {0x88, 0xDF, 0xD7, 0},
-	  {0xFF, 0xF9, 0xB6, 0},
-	  {0xFF, 0xBE, 0x97, 0},
-	  {0xF6, 0x77, 0x9C, 0},
-	  {0x9F, 0x57, 0xAF, 0}}},
-	/* 76 */
-	{"tymm16",
-	 {{0xDE, 0xCE, 0xB4, 0},
-	  {0x9C, 0xAB, 0xB1, 0},
-	  {0x80, 0x80, 0x78, 0},
-	  {0x53, 0x4A, 0x3B, 0},
-	  {0xE0, 0x9B, 0x4D, 0},
-	  {0xA1, 0x7D, 0x37, 0},
-	  {0x78, 0x5C, 0x3B, 0},
-	  {0x3E, 0x2B, 0x22, 0},
-	  {0xBB, 0x8F, 0x6B, 0},
-	  {0x7A, 0x62, 0x60, 0},
-	  {0x4B, 0x41, 0x58, 0},
-	  {0xBB, 0x64, 0x3A, 0},
-	  {0x8D, 0x3E, 0x29, 0},
-	  {0x5E, 0x29, 0x2F, 0},
-	  {0x79, 0x92, 0x40, 0},
-	  {0x63, 0x60, 0x2E, 0}}},
-	/* 77 */
-	{"melody16",
-	 {{0xC6, 0x86, 0xCA, 0},
-	  {0x78, 0x53, 0xA7, 0},
-	  {0x3C, 0x3E, 0x66, 0},
-	  {0x5D, 0x91, 0xD8, 0},
-	  {0x9D, 0xDD, 0xF0, 0},
-	  {0xEF, 0xF5, 0xF5, 0},
-	  {0xA3, 0xB0, 0xBB, 0},
-	  {0x67, 0x6B, 0x8B, 0},
-	  {0x23, 0x23, 0x2E, 0},
-	  {0x4D, 0x33, 0x47, 0},
-	  {0x8E, 0x51, 0x6A, 0},
-	  {0xCE, 0x63, 0x74, 0},
-	  {0xF4, 0xAE, 0x70, 0},
-	  {0xF1, 0xDE, 0x82, 0},
-	  {0x6F, 0xC4, 0x53, 0},
-	  {0x3D, 0x83, 0x67, 0}}},
-	/* 78 */
-	{"vigarospalette",
-	 {{0xF6, 0xE5, 0xD3, 0},
-	  {0xC9, 0xC1, 0xB0, 0},
-	  {0xC1, 0x9E, 0x89, 0},
-	  {0x97, 0x86, 0x7D, 0},
-	  {0x7C, 0x66, 0x64, 0},
-	  {0x5B, 0x4D, 0x4C, 0},
-	  {0x39, 0x39, 0x39, 0},
-	  {0x25, 0x25, 0x28, 0},
-	  {0x0D, 0x10, 0x13, 0},
-	  {0xB3, 0xCA, 0xC9, 0},
-	  {0x79, 0x96, 0x94, 0},
-	  {0x55, 0x69, 0x67, 0},
-	  {0x8D, 0x46, 0x40, 0},
-	  {0x83, 0x37, 0x35, 0},
-	  {0x64, 0x2F, 0x2F, 0},
-	  {0x49, 0x26, 0x22, 0}}},
-	/* 79 */
-	{"triton16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x2B, 0x22, 0x32, 0},
-	  {0x47, 0x37, 0x59, 0},
-	  {0x98, 0x87, 0x9F, 0},
-	  {0x23, 0x24, 0x33, 0},
-	  {0x5F, 0x6F, 0x87, 0},
-	  {0x82, 0x9E, 0xB3, 0},
-	  {0x93, 0xAB, 0xC2, 0},
-	  {0x1A, 0x21, 0x20, 0},
-	  {0x42, 0x48, 0x49, 0},
-	  {0x5E, 0x71, 0x73, 0},
-	  {0xC3, 0xB3, 0xC8, 0},
-	  {0x86, 0x62, 0x73, 0},
-	  {0xA2, 0x87, 0x8A, 0},
-	  {0xB0, 0x9E, 0xA0, 0},
-	  {0xDA, 0xCE, 0xD3, 0}}},
-	/* 80 */
-	{"miri16",
-	 {{0x1B, 0x1B, 0x17, 0},
-	  {0x43, 0x32, 0x26, 0},
-	  {0x30, 0x40, 0x8C, 0},
-	  {0x57, 0x56, 0x47, 0},
-	  {0x3F, 0x60, 0x50, 0},
-	  {0x8E, 0x3A, 0x47, 0},
-	  {0x86, 0x55, 0x3B, 0},
-	  {0x6B, 0x6A, 0xB3, 0},
-	  {0x6B, 0x76, 0x36, 0},
-	  {0xA9, 0x69, 0x60, 0},
-	  {0x5E, 0x8B, 0x9B, 0},
-	  {0x9C, 0x78, 0x29, 0},
-	  {0xAC, 0x82, 0xB2, 0},
-	  {0xAD, 0x96, 0x88, 0},
-	  {0xD8, 0xB4, 0x7A, 0},
-	  {0xEC, 0xD9, 0xD6, 0}}},
-	/* 81 */
-	{"tyadv16",
-	 {{0xCA, 0xA9, 0x82, 0},
-	  {0xAA, 0x80, 0x85, 0},
-	  {0x85, 0x64, 0x40, 0},
-	  {0x4A, 0x47, 0x3A, 0},
-	  {0xB9, 0x6F, 0x2C, 0},
-	  {0x77, 0x40, 0x24, 0},
-	  {0x4E, 0x28, 0x23, 0},
-	  {0x8B, 0x9A, 0x3B, 0},
-	  {0x39, 0x7A, 0x41, 0},
-	  {0x2C, 0x40, 0x3C, 0},
-	  {0x62, 0x9C, 0xC5, 0},
-	  {0x67, 0x62, 0x8A, 0},
-	  {0x36, 0x44, 0x5A, 0},
-	  {0x70, 0x70, 0x68, 0},
-	  {0x33, 0x33, 0x3A, 0},
-	  {0x18, 0x20, 0x29, 0}}},
-	/* 82 */
-	{"nebulaspace",
-	 {{0x0A, 0x40, 0x1A, 0},
-	  {0x6D, 0x85, 0x2C, 0},
-	  {0xB3, 0xA7, 0x24, 0},
-	  {0xE6, 0xEB, 0x6A, 0},
-	  {0xED, 0xE8, 0xE1, 0},
-	  {0xA7, 0xDB, 0xBB, 0},
-	  {0x5D, 0x85, 0x8C, 0},
-	  {0x3D, 0x47, 0x6E, 0},
-	  {0x32, 0x24, 0x4D, 0},
-	  {0x27, 0x14, 0x2B, 0},
-	  {0xD6, 0xC2, 0xBA, 0},
-	  {0xBF, 0x96, 0x84, 0},
-	  {0xA6, 0x63, 0x72, 0},
-	  {0x73, 0x37, 0x54, 0},
-	  {0x45, 0x1E, 0x3E, 0},
-	  {0x2E, 0x0F, 0x29, 0}}},
-	/* 83 */
-	{"8minutespast8",
-	 {{0x48, 0x38, 0x58, 0},
-	  {0x18, 0x58, 0x68, 0},
-	  {0x18, 0x78, 0x68, 0},
-	  {0x28, 0xA3, 0x88, 0},
-	  {0x88, 0x30, 0x28, 0},
-	  {0xA8, 0x48, 0x28, 0},
-	  {0xB8, 0x8A, 0x38, 0},
-	  {0x86, 0x48, 0x08, 0},
-	  {0x98, 0x68, 0x18, 0},
-	  {0xB8, 0xA8, 0x38, 0},
-	  {0x48, 0x78, 0x28, 0},
-	  {0x18, 0x68, 0x48, 0},
-	  {0xB8, 0xB8, 0xB8, 0},
-	  {0x78, 0x78, 0x78, 0},
-	  {0x48, 0x48, 0x48, 0},
-	  {0x18, 0x18, 0x18, 0}}},
-	/* 84 */
-	{"edgsoft16",
-	 {{0xFE, 0xFE, 0xD7, 0},
-	  {0xDB, 0xBC, 0x96, 0},
-	  {0xDD, 0xAC, 0x46, 0},
-	  {0xC2, 0x59, 0x40, 0},
-	  {0x68, 0x3D, 0x64, 0},
-	  {0x9C, 0x66, 0x59, 0},
-	  {0x88, 0x43, 0x4F, 0},
-	  {0x4D, 0x28, 0x31, 0},
-	  {0xA9, 0xAB, 0xA3, 0},
-	  {0x66, 0x68, 0x69, 0},
-	  {0x51, 0xB1, 0xCA, 0},
-	  {0x17, 0x73, 0xB8, 0},
-	  {0x63, 0x9F, 0x5B, 0},
-	  {0x37, 0x6E, 0x49, 0},
-	  {0x32, 0x34, 0x41, 0},
-	  {0x16, 0x13, 0x23, 0}}},
-	/* 85 */
-	{"cartoonarmy",
-	 {{0x20, 0x16, 0x16, 0},
-	  {0x37, 0x40, 0x3B, 0},
-	  {0x4D, 0x6A, 0x89, 0},
-	  {0x93, 0xAA, 0xE2, 0},
-	  {0x97, 0x5C, 0xAC, 0},
-	  {0x5B, 0x2A, 0x4D, 0},
-	  {0xE5, 0x3D, 0x63, 0},
-	  {0xF8, 0xA0, 0x95, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xC1, 0xBF, 0xBE, 0},
-	  {0x7D, 0x70, 0x7B, 0},
-	  {0x82, 0x25, 0x25, 0},
-	  {0xB0, 0x70, 0x32, 0},
-	  {0xE6, 0xC3, 0x69, 0},
-	  {0x72, 0x89, 0x33, 0},
-	  {0xAA, 0xDE, 0x6E, 0}}},
-	/* 86 */
-	{"vaporhaze16",
-	 {{0x00, 0x47, 0x4F, 0},
-	  {0x22, 0x50, 0x54, 0},
-	  {0x47, 0x5B, 0x58, 0},
-	  {0x6A, 0x64, 0x5D, 0},
-	  {0x8E, 0x6E, 0x61, 0},
-	  {0xB1, 0x77, 0x66, 0},
-	  {0xD4, 0x82, 0x6B, 0},
-	  {0xF8, 0x8C, 0x6E, 0},
-	  {0x15, 0x6D, 0x8E, 0},
-	  {0x46, 0x7B, 0x96, 0},
-	  {0x6B, 0x86, 0x9B, 0},
-	  {0x8E, 0x8F, 0x9F, 0},
-	  {0xB1, 0x99, 0xA3, 0},
-	  {0xD5, 0xA3, 0xA7, 0},
-	  {0xF8, 0xAD, 0xAC, 0},
-	  {0xFF, 0xBD, 0xBB, 0}}},
-	/* 87 */
-	{"alia16",
-	 {{0x1E, 0x20, 0x21, 0},
-	  {0x51, 0x24, 0x50, 0},
-	  {0x60, 0x52, 0x22, 0},
-	  {0x47, 0x55, 0x9D, 0},
-	  {0x8F, 0x41, 0x6A, 0},
-	  {0xCA, 0x47, 0x5A, 0},
-	  {0x45, 0x88, 0x55, 0},
-	  {0x7F, 0x72, 0x66, 0},
-	  {0x7A, 0x88, 0x9A, 0},
-	  {0xE1, 0x66, 0xBC, 0},
-	  {0xAB, 0x93, 0x3E, 0},
-	  {0xDB, 0x8E, 0x81, 0},
-	  {0xA7, 0xA8, 0xDD, 0},
-	  {0xEE, 0xB4, 0x87, 0},
-	  {0xCC, 0xD2, 0xC9, 0},
-	  {0xF8, 0xE6, 0xE6, 0}}},
-	/* 88 */
-	{"aap16",
-	 {{0x07, 0x07, 0x08, 0},
-	  {0x33, 0x22, 0x22, 0},
-	  {0x77, 0x44, 0x33, 0},
-	  {0xCC, 0x88, 0x55, 0},
-	  {0x99, 0x33, 0x11, 0},
-	  {0xDD, 0x77, 0x11, 0},
-	  {0xFF, 0xDD, 0x55, 0},
-	  {0xFF, 0xFF, 0x33, 0},
-	  {0x55, 0xAA, 0x44, 0},
-	  {0x11, 0x55, 0x22, 0},
-	  {0x44, 0xEE, 0xBB, 0},
-	  {0x33, 0x88, 0xDD, 0},
-	  {0x55, 0x44, 0xAA, 0},
-	  {0x55, 0x55, 0x77, 0},
-	  {0xAA, 0xBB, 0xBB, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 89 */
-	{"oldsand16",
-	 {{0xB4, 0xC9, 0xD8, 0},
-	  {0xA5, 0xA3, 0xB3, 0},
-	  {0x7E, 0x8E, 0x99, 0},
-	  {0x4E, 0x5D, 0x66, 0},
-	  {0xB0, 0xC0, 0x9A, 0},
-	  {0x8F, 0x9F, 0x91, 0},
-	  {0x7A, 0x88, 0x5E, 0},
-	  {0x52, 0x57, 0x47, 0},
-	  {0xDD, 0xB9, 0xA1, 0},
-	  {0xA0, 0xA2, 0x94, 0},
-	  {0xA3, 0x85, 0x6D, 0},
-	  {0x6F, 0x5F, 0x52, 0},
-	  {0xD2, 0x9A, 0x8D, 0},
-	  {0xA0, 0x94, 0x9A, 0},
-	  {0xA0, 0x6B, 0x63, 0},
-	  {0x6E, 0x50, 0x4D, 0}}},
-	/* 90 */
-	{"invertcompatible",
-	 {{0x23, 0x4E, 0xAF, 0},
-	  {0x11, 0xAB, 0xBC, 0},
-	  {0x72, 0xDF, 0xB5, 0},
-	  {0x56, 0xA2, 0x2F, 0},
-	  {0x0B, 0x6A, 0x59, 0},
-	  {0x1D, 0x1F, 0x26, 0},
-	  {0x61, 0x42, 0x24, 0},
-	  {0x6E, 0x6F, 0x62, 0},
-	  {0x91, 0x90, 0x9D, 0},
-	  {0x9E, 0xBD, 0xDB, 0},
-	  {0xE2, 0xE0, 0xD9, 0},
-	  {0xF4, 0x95, 0xA6, 0},
-	  {0xA9, 0x5D, 0xD0, 0},
-	  {0x8D, 0x20, 0x4A, 0},
-	  {0xEE, 0x54, 0x43, 0},
-	  {0xDC, 0xB1, 0x50, 0}}},
-	/* 91 */
-	{"jehkoba16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x98, 0xD9, 0xD3, 0},
-	  {0x2B, 0xBC, 0xD9, 0},
-	  {0x29, 0x80, 0xA6, 0},
-	  {0x21, 0xA6, 0x5D, 0},
-	  {0x97, 0xBF, 0x30, 0},
-	  {0xF0, 0xCD, 0x30, 0},
-	  {0xF2, 0xEC, 0xE6, 0},
-	  {0xFF, 0x99, 0x59, 0},
-	  {0xBF, 0x60, 0x60, 0},
-	  {0xFF, 0xA6, 0xA6, 0},
-	  {0xFF, 0x33, 0x66, 0},
-	  {0x99, 0x45, 0x7D, 0},
-	  {0x40, 0x40, 0x80, 0},
-	  {0x6B, 0x86, 0xB3, 0},
-	  {0x08, 0x09, 0x1A, 0}}},
-	/* 92 */
-	{"soldier16",
-	 {{0xFF, 0xFD, 0xDA, 0},
-	  {0xF1, 0xD2, 0x9E, 0},
-	  {0xB5, 0x8C, 0x6E, 0},
-	  {0x6B, 0x4A, 0x41, 0},
-	  {0x3B, 0x24, 0x22, 0},
-	  {0x66, 0x59, 0x53, 0},
-	  {0xA3, 0x9D, 0x77, 0},
-	  {0xEB, 0xDC, 0x6C, 0},
-	  {0xD9, 0x90, 0x3D, 0},
-	  {0xA7, 0x51, 0x2D, 0},
-	  {0x6B, 0x27, 0x27, 0},
-	  {0x3B, 0x1B, 0x23, 0},
-	  {0x17, 0x0F, 0x0D, 0},
-	  {0x1E, 0x2F, 0x27, 0},
-	  {0x51, 0x63, 0x4D, 0},
-	  {0x9D, 0xBA, 0x6C, 0}}},
-	/* 93 */
-	{"feelthesun16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x29, 0x1A, 0x13, 0},
-	  {0x72, 0x4C, 0x30, 0},
-	  {0xB6, 0x8C, 0x56, 0},
-	  {0xFF, 0xF0, 0xA0, 0},
-	  {0x46, 0x30, 0x07, 0},
-	  {0x75, 0x5A, 0x0B, 0},
-	  {0xAB, 0x81, 0x1D, 0},
-	  {0x5E, 0x26, 0x0E, 0},
-	  {0xA1, 0x43, 0x0F, 0},
-	  {0xFF, 0x8B, 0x18, 0},
-	  {0xF6, 0xBF, 0x3A, 0},
-	  {0x55, 0x20, 0x12, 0},
-	  {0x9A, 0x36, 0x1E, 0},
-	  {0xEB, 0x57, 0x31, 0},
-	  {0xEE, 0x98, 0x52, 0}}},
-	/* 94 */
-	{"agedterracotta16",
-	 {{0x34, 0x31, 0x28, 0},
-	  {0x50, 0x49, 0x39, 0},
-	  {0x5C, 0x68, 0x52, 0},
-	  {0x6C, 0x74, 0x4C, 0},
-	  {0x7D, 0x82, 0x49, 0},
-	  {0xA3, 0x9E, 0x55, 0},
-	  {0xCA, 0xB5, 0x67, 0},
-	  {0x77, 0x3F, 0x35, 0},
-	  {0x84, 0x56, 0x40, 0},
-	  {0xA0, 0x77, 0x54, 0},
-	  {0xBC, 0x99, 0x78, 0},
-	  {0xD6, 0xC1, 0x9D, 0},
-	  {0xEA, 0xDC, 0xC1, 0},
-	  {0xF7, 0xF0, 0xDD, 0},
-	  {0xFF, 0xFB, 0xED, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 95 */
-	{"cottoncity",
-	 {{0x83, 0x42, 0x00, 0},
-	  {0x32, 0x32, 0x13, 0},
-	  {0x2B, 0x6C, 0x21, 0},
-	  {0x88, 0x8D, 0x0D, 0},
-	  {0xFF, 0xC2, 0x49, 0},
-	  {0xDA, 0x6D, 0x00, 0},
-	  {0xA2, 0x28, 0x00, 0},
-	  {0x64, 0x00, 0x00, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x1D, 0x1D, 0x67, 0},
-	  {0x26, 0x4B, 0xAB, 0},
-	  {0x40, 0x9E, 0x9E, 0},
-	  {0xA6, 0xDA, 0x97, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x91, 0x91, 0xAA, 0},
-	  {0x55, 0x55, 0x55, 0}}},
-	/* 96 */
-	{"morganne16",
-	 {{0x1F, 0x1F, 0x22, 0},
-	  {0xA7, 0x95, 0x4E, 0},
-	  {0xA2, 0x65, 0x1B, 0},
-	  {0x69, 0x4E, 0x4B, 0},
-	  {0x9B, 0x79, 0x6E, 0},
-	  {0x58, 0x2A, 0x34, 0},
-	  {0x8F, 0x2A, 0x4D, 0},
-	  {0x9D, 0x5D, 0x85, 0},
-	  {0xBB, 0xA7, 0xA4, 0},
-	  {0xCA, 0xC9, 0xAB, 0},
-	  {0x54, 0x5C, 0x89, 0},
-	  {0x32, 0x2B, 0x3B, 0},
-	  {0x73, 0x86, 0x50, 0},
-	  {0x76, 0xB0, 0x98, 0},
-	  {0x52, 0x39, 0x64, 0},
-	  {0x5C, 0x85, 0xA8, 0}}},
-	/* 97 */
-	{"kawaii16",
-	 {{0x65, 0x47, 0x1E, 0},
-	  {0xB5, 0x70, 0x75, 0},
-	  {0xDC, 0xAB, 0x80, 0},
-	  {0xF8, 0xD8, 0xAB, 0},
-	  {0xB8, 0xAA, 0xAA, 0},
-	  {0xFF, 0xF5, 0xF5, 0},
-	  {0xFC, 0xA5, 0xC2, 0},
-	  {0xEC, 0x46, 0x46, 0},
-	  {0xFF, 0xA3, 0x22, 0},
-	  {0xF9, 0xFA, 0x93, 0},
-	  {0x7B, 0xC1, 0x88, 0},
-	  {0x8E, 0xD3, 0xF8, 0},
-	  {0x59, 0x89, 0xA3, 0},
-	  {0xD7, 0x93, 0xFA, 0},
-	  {0x74, 0x51, 0x8E, 0},
-	  {0x1D, 0x17, 0x3C, 0}}},
-	/* 98 */
-	{"versitle16",
-	 {{0x0C, 0x0B, 0x0F, 0},
-	  {0xAF, 0x3F, 0x52, 0},
-	  {0x5F, 0x39, 0x59, 0},
-	  {0x2E, 0x29, 0x37, 0},
-	  {0x90, 0x5C, 0x9A, 0},
-	  {0xD7, 0x8D, 0x42, 0},
-	  {0x93, 0x59, 0x3B, 0},
-	  {0x8D, 0x92, 0xAC, 0},
-	  {0xD4, 0x7F, 0xB0, 0},
-	  {0xDD, 0xDD, 0x50, 0},
-	  {0x75, 0xB5, 0x46, 0},
-	  {0x4A, 0x6D, 0xB2, 0},
-	  {0xF3, 0xCB, 0x94, 0},
-	  {0xEF, 0xF0, 0xE9, 0},
-	  {0xA7, 0xD6, 0xDA, 0},
-	  {0x56, 0xA1, 0xC8, 0}}},
-	/* 99 */
-	{"colorquestr",
-	 {{0x95, 0xCE, 0xCD, 0},
-	  {0x4C, 0x89, 0x8B, 0},
-	  {0x0E, 0x3E, 0x5B, 0},
-	  {0x15, 0x89, 0x4C, 0},
-	  {0x95, 0xCE, 0x56, 0},
-	  {0xEE, 0xEE, 0x77, 0},
-	  {0xF7, 0xA0, 0x46, 0},
-	  {0xD6, 0x4B, 0x33, 0},
-	  {0x5A, 0x34, 0x0E, 0},
-	  {0xB0, 0x56, 0x70, 0},
-	  {0xFF, 0xAD, 0x93, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xAC, 0xAA, 0xAC, 0},
-	  {0x62, 0x65, 0x62, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xAD, 0x60, 0x1A, 0}}},
-	/* 100 */
-	{"bittersweet16",
-	 {{0x1E, 0x18, 0x18, 0},
-	  {0x53, 0x4C, 0x56, 0},
-	  {0x97, 0x97, 0x8E, 0},
-	  {0xDE, 0xDC, 0xD3, 0},
-	  {0x7E, 0xC0, 0xC2, 0},
-	  {0x41, 0x6F, 0x8A, 0},
-	  {0x3F, 0x35, 0x5B, 0},
-	  {0x7D, 0x3B, 0x55, 0},
-	  {0xB1, 0x48, 0x52, 0},
-	  {0xBE, 0x81, 0x62, 0},
-	  {0xD4, 0xA0, 0x9D, 0},
-	  {0xE1, 0xBE, 0x88, 0},
-	  {0x97, 0xB6, 0x68, 0},
-	  {0x56, 0x8F, 0x73, 0},
-	  {0x68, 0x5D, 0x45, 0},
-	  {0x54, 0x37, 0x34, 0}}},
-	/* 101 */
-	{"pastel16",
-	 {{0xEA, 0x72, 0x86, 0},
-	  {0xEA, 0xB2, 0x81, 0},
-	  {0xE3, 0xE1, 0x9F, 0},
-	  {0xA9, 0xC4, 0x84, 0},
-	  {0x5D, 0x93, 0x7B, 0},
-	  {0x58, 0x52, 0x5A, 0},
-	  {0xA0, 0x7C, 0xA7, 0},
-	  {0xF4, 0xA4, 0xBF, 0},
-	  {0xF5, 0xD1, 0xB6, 0},
-	  {0xEE, 0xED, 0xE3, 0},
-	  {0xD6, 0xCE, 0xC2, 0},
-	  {0xA2, 0xA6, 0xA9, 0},
-	  {0x77, 0x7F, 0x8F, 0},
-	  {0xA3, 0xB2, 0xD2, 0},
-	  {0xBF, 0xDE, 0xD8, 0},
-	  {0xBF, 0x79, 0x6D, 0}}},
-	/* 102 */
-	{"vic20",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xA8, 0x73, 0x4A, 0},
-	  {0xE9, 0xB2, 0x87, 0},
-	  {0x77, 0x2D, 0x26, 0},
-	  {0xB6, 0x68, 0x62, 0},
-	  {0x85, 0xD4, 0xDC, 0},
-	  {0xC5, 0xFF, 0xFF, 0},
-	  {0xA8, 0x5F, 0xB4, 0},
-	  {0xE9, 0x9D, 0xF5, 0},
-	  {0x55, 0x9E, 0x4A, 0},
-	  {0x92, 0xDF, 0x87, 0},
-	  {0x42, 0x34, 0x8B, 0},
-	  {0x7E, 0x70, 0xCA, 0},
-	  {0xBD, 0xCC, 0x71, 0},
-	  {0xFF, 0xFF, 0xB0, 0}}},
-	/* 103 */
-	{"gopuri16",
-	 {{0xE6, 0xE1, 0xC8, 0},
-	  {0xB1, 0xBD, 0x8F, 0},
-	  {0xFF, 0xB7, 0x00, 0},
-	  {0xCA, 0x76, 0x17, 0},
-	  {0xF3, 0xB4, 0x7C, 0},
-	  {0xE7, 0x62, 0x4B, 0},
-	  {0x88, 0x64, 0x75, 0},
-	  {0x88, 0x31, 0x29, 0},
-	  {0xBD, 0x6D, 0xAB, 0},
-	  {0x68, 0x3F, 0x94, 0},
-	  {0x00, 0xB1, 0x6B, 0},
-	  {0x0A, 0x67, 0x53, 0},
-	  {0x10, 0x98, 0xB1, 0},
-	  {0x16, 0x5D, 0x7B, 0},
-	  {0x1B, 0x2F, 0x6C, 0},
-	  {0x1D, 0x15, 0x1B, 0}}},
-	/* 104 */
-	{"b16",
-	 {{0xFB, 0xFF, 0xCE, 0},
-	  {0xB4, 0xDC, 0x25, 0},
-	  {0x26, 0xA6, 0x30, 0},
-	  {0x5A, 0xF0, 0xF7, 0},
-	  {0xFB, 0xD4, 0x39, 0},
-	  {0xFF, 0x9C, 0xC9, 0},
-	  {0x25, 0xE2, 0xC0, 0},
-	  {0x08, 0xA0, 0xC0, 0},
-	  {0xF0, 0x94, 0x32, 0},
-	  {0xF4, 0x36, 0x66, 0},
-	  {0xC6, 0x35, 0xBC, 0},
-	  {0x16, 0x5A, 0x7D, 0},
-	  {0xDC, 0x53, 0x2D, 0},
-	  {0xA1, 0x25, 0x36, 0},
-	  {0x6F, 0x28, 0x8B, 0},
-	  {0x26, 0x0E, 0x3E, 0}}},
-	/* 105 */
-	{"bly16",
-	 {{0x33, 0x33, 0x44, 0},
-	  {0x44, 0x44, 0x55, 0},
-	  {0x77, 0x44, 0x44, 0},
-	  {0x44, 0x55, 0x66, 0},
-	  {0xBB, 0x55, 0x55, 0},
-	  {0x66, 0x77, 0x88, 0},
-	  {0x99, 0x66, 0x99, 0},
-	  {0x44, 0x88, 0x88, 0},
-	  {0xDD, 0x88, 0x55, 0},
-	  {0x77, 0xAA, 0x66, 0},
-	  {0x66, 0xAA, 0x99, 0},
-	  {0x99, 0xAA, 0xBB, 0},
-	  {0xEE, 0x99, 0xAA, 0},
-	  {0x88, 0xBB, 0xBB, 0},
-	  {0xEE, 0xBB, 0x77, 0},
-	  {0xEE, 0xDD, 0xCC, 0}}},
-	/* 106 */
-	{"skedd16",
-	 {{0x8C, 0x1E, 0x2C, 0},
-	  {0xDC, 0x44, 0x3C, 0},
-	  {0xFF, 0x8C, 0x66, 0},
-	  {0xC7, 0x5B, 0x38, 0},
-	  {0xD6, 0x6F, 0x24, 0},
-	  {0xE4, 0xBA, 0x32, 0},
-	  {0x21, 0x91, 0x3B, 0},
-	  {0x83, 0xB5, 0x35, 0},
-	  {0xEB, 0xD5, 0xBD, 0},
-	  {0x66, 0xC3, 0xD9, 0},
-	  {0x38, 0x7C, 0xEE, 0},
-	  {0x35, 0x39, 0xA2, 0},
-	  {0x99, 0x8D, 0xA2, 0},
-	  {0x59, 0x4E, 0x6F, 0},
-	  {0x2B, 0x1A, 0x4B, 0},
-	  {0x08, 0x05, 0x0E, 0}}},
-	/* 107 */
-	{"microroguelike",
-	 {{0x22, 0x23, 0x23, 0},
-	  {0x43, 0x43, 0x4F, 0},
-	  {0x60, 0x60, 0x70, 0},
-	  {0x7E, 0x7E, 0x8F, 0},
-	  {0xC2, 0xC2, 0xD1, 0},
-	  {0x8C, 0x3F, 0x5D, 0},
-	  {0xBA, 0x61, 0x56, 0},
-	  {0xEB, 0x56, 0x4B, 0},
-	  {0xFF, 0xB5, 0xB5, 0},
-	  {0x3C, 0xA3, 0x70, 0},
-	  {0x5D, 0xDE, 0x87, 0},
-	  {0x64, 0x76, 0xE8, 0},
-	  {0x86, 0xA7, 0xED, 0},
-	  {0xF2, 0xA6, 0x5E, 0},
-	  {0xFF, 0xE4, 0x78, 0},
-	  {0xFF, 0xFF, 0xEB, 0}}},
-	/* 108 */
-	{"simplejpc16",
-	 {{0x05, 0x04, 0x03, 0},
-	  {0x22, 0x1F, 0x31, 0},
-	  {0x54, 0x35, 0x16, 0},
-	  {0x9B, 0x6E, 0x2D, 0},
-	  {0xE1, 0xB0, 0x47, 0},
-	  {0xF5, 0xEE, 0x9B, 0},
-	  {0xFE, 0xFE, 0xFE, 0},
-	  {0x8B, 0xE1, 0xE0, 0},
-	  {0x7C, 0xC2, 0x64, 0},
-	  {0x67, 0x8F, 0xCB, 0},
-	  {0x31, 0x6F, 0x23, 0},
-	  {0x40, 0x4A, 0x68, 0},
-	  {0xA1, 0x4D, 0x3F, 0},
-	  {0xA5, 0x68, 0xD4, 0},
-	  {0x9A, 0x93, 0xB7, 0},
-	  {0xEA, 0x91, 0x82, 0}}},
-	/* 109 */
-	{"sara98a",
-	 {{0xF6, 0xF2, 0xEA, 0},
-	  {0xEA, 0xD2, 0xBA, 0},
-	  {0xEE, 0xAE, 0x8D, 0},
-	  {0xDE, 0x81, 0x65, 0},
-	  {0xB6, 0x44, 0x4C, 0},
-	  {0x81, 0x18, 0x30, 0},
-	  {0x4C, 0x04, 0x1C, 0},
-	  {0x14, 0x00, 0x08, 0},
-	  {0x28, 0x0C, 0x38, 0},
-	  {0x3C, 0x18, 0x71, 0},
-	  {0x69, 0x44, 0x8D, 0},
-	  {0xA1, 0x75, 0xB2, 0},
-	  {0x91, 0xAA, 0xCA, 0},
-	  {0x4C, 0x79, 0xA5, 0},
-	  {0x14, 0x44, 0x69, 0},
-	  {0x04, 0x14, 0x55, 0}}},
-	/* 110 */
-	{"aero16",
-	 {{0xF9, 0xFC, 0xFF, 0},
-	  {0xB7, 0xE8, 0xE8, 0},
-	  {0x7F, 0xFF, 0xEE, 0},
-	  {0x6D, 0xC9, 0xFF, 0},
-	  {0x57, 0x6A, 0xE5, 0},
-	  {0x32, 0xC9, 0x82, 0},
-	  {0x98, 0xEA, 0x96, 0},
-	  {0xCC, 0xFF, 0xA3, 0},
-	  {0x09, 0x1E, 0x26, 0},
-	  {0x48, 0x62, 0x7C, 0},
-	  {0xB3, 0xC4, 0xD6, 0},
-	  {0xFF, 0xF6, 0xD1, 0},
-	  {0xFF, 0xED, 0x96, 0},
-	  {0xFF, 0xB5, 0x66, 0},
-	  {0x9B, 0x2E, 0x8E, 0},
-	  {0x5A, 0x1B, 0x91, 0}}},
-	/* 111 */
-	{"disg16",
-	 {{0xCD, 0xBE, 0xAC, 0},
-	  {0x7B, 0x7D, 0x6A, 0},
-	  {0x4E, 0x55, 0x4E, 0},
-	  {0x35, 0x2F, 0x28, 0},
-	  {0x4A, 0x48, 0x4A, 0},
-	  {0x3C, 0x3B, 0x4A, 0},
-	  {0x34, 0x32, 0x34, 0},
-	  {0x2A, 0x25, 0x2A, 0},
-	  {0xC5, 0xA4, 0x6B, 0},
-	  {0x9F, 0x67, 0x3E, 0},
-	  {0x7A, 0x5C, 0x54, 0},
-	  {0x60, 0x48, 0x4D, 0},
-	  {0xEE, 0x99, 0x9C, 0},
-	  {0x8B, 0x48, 0x4A, 0},
-	  {0x61, 0x32, 0x34, 0},
-	  {0x08, 0x04, 0x00, 0}}},
-	/* 112 */
-	{"icecreamadventure",
-	 {{0x3D, 0x32, 0x2B, 0},
-	  {0x6B, 0x3C, 0x1D, 0},
-	  {0x0B, 0x5F, 0xA4, 0},
-	  {0x8F, 0x27, 0x64, 0},
-	  {0x60, 0x6B, 0x67, 0},
-	  {0xA7, 0x19, 0xB1, 0},
-	  {0x18, 0xB7, 0xB1, 0},
-	  {0xA3, 0x6C, 0x41, 0},
-	  {0xEB, 0x41, 0x63, 0},
-	  {0x94, 0x9F, 0xA3, 0},
-	  {0xD7, 0x74, 0xB9, 0},
-	  {0xDB, 0xC7, 0x8C, 0},
-	  {0xB1, 0xD4, 0x99, 0},
-	  {0xFF, 0x8A, 0x90, 0},
-	  {0xF0, 0xB7, 0xC7, 0},
-	  {0xF0, 0xEE, 0xE2, 0}}},
-	/* 113 */
-	{"regu16",
-	 {{0xCD, 0x37, 0x2F, 0},
-	  {0x28, 0x40, 0xB7, 0},
-	  {0xD3, 0xAB, 0x0C, 0},
-	  {0x12, 0x1C, 0x1C, 0},
-	  {0x3D, 0x39, 0x34, 0},
-	  {0x5E, 0x3C, 0x28, 0},
-	  {0x86, 0x46, 0x30, 0},
-	  {0x4B, 0x61, 0x30, 0},
-	  {0x62, 0x7E, 0x64, 0},
-	  {0x90, 0x62, 0x43, 0},
-	  {0xC6, 0x74, 0x39, 0},
-	  {0xAE, 0x8F, 0x58, 0},
-	  {0x6F, 0xAB, 0xBC, 0},
-	  {0xAF, 0xAE, 0x9E, 0},
-	  {0xCE, 0xC1, 0xD0, 0},
-	  {0xD8, 0xD8, 0xE5, 0}}},
-	/* 114 */
-	{"prospeccal",
-	 {{0x1B, 0x0F, 0x28, 0},
-	  {0x4C, 0x66, 0x84, 0},
-	  {0x83, 0xBF, 0xCA, 0},
-	  {0xF4, 0xF9, 0xE6, 0},
-	  {0x23, 0x3E, 0x38, 0},
-	  {0x35, 0x7B, 0x45, 0},
-	  {0x8A, 0xB9, 0x54, 0},
-	  {0xF2, 0xE0, 0x5A, 0},
-	  {0x31, 0x20, 0x39, 0},
-	  {0x6E, 0x27, 0x45, 0},
-	  {0xC6, 0x43, 0x4E, 0},
-	  {0xE7, 0x93, 0x7E, 0},
-	  {0x54, 0x42, 0x42, 0},
-	  {0x9E, 0x52, 0x3B, 0},
-	  {0xE9, 0x85, 0x49, 0},
-	  {0x8D, 0x88, 0x78, 0}}},
-	/* 115 */
-	{"ramprainbow",
-	 {{0xC6, 0x4D, 0x43, 0},
-	  {0x63, 0x33, 0x24, 0},
-	  {0xB1, 0x6B, 0x33, 0},
-	  {0xE7, 0xB8, 0x60, 0},
-	  {0x64, 0x82, 0x28, 0},
-	  {0x13, 0x43, 0x32, 0},
-	  {0x0C, 0x0C, 0x14, 0},
-	  {0x5F, 0x2B, 0x44, 0},
-	  {0x9C, 0x4C, 0x91, 0},
-	  {0xE7, 0x92, 0x99, 0},
-	  {0xF7, 0xF9, 0xF0, 0},
-	  {0x5B, 0xCE, 0xB9, 0},
-	  {0x42, 0x7A, 0x9E, 0},
-	  {0x34, 0x32, 0x65, 0},
-	  {0x7A, 0x6B, 0x79, 0},
-	  {0xB3, 0xA3, 0xB1, 0}}},
-	/* 116 */
-	{"notepad16pal",
-	 {{0x37, 0x35, 0x45, 0},
-	  {0x61, 0x64, 0x78, 0},
-	  {0xE0, 0xE0, 0xE0, 0},
-	  {0xAE, 0xD6, 0xF5, 0},
-	  {0x4A, 0x82, 0x64, 0},
-	  {0x5D, 0xB3, 0x65, 0},
-	  {0xAD, 0x8C, 0x4B, 0},
-	  {0xC4, 0xB1, 0x52, 0},
-	  {0x5A, 0x6E, 0xAD, 0},
-	  {0x7C, 0x9F, 0xD9, 0},
-	  {0xC9, 0x59, 0x7A, 0},
-	  {0xE8, 0x89, 0x9E, 0},
-	  {0x69, 0x56, 0x61, 0},
-	  {0x8F, 0x6F, 0x7A, 0},
-	  {0xC4, 0xA0, 0x82, 0},
-	  {0xE5, 0xCE, 0xA5, 0}}},
-	/* 117 */
-	{"yunopc98",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x99, 0xAA, 0xBB, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x77, 0x33, 0x33, 0},
-	  {0xBB, 0x77, 0x66, 0},
-	  {0xEE, 0xAA, 0x99, 0},
-	  {0xFF, 0xDD, 0xCC, 0},
-	  {0x55, 0x66, 0xCC, 0},
-	  {0xBB, 0xCC, 0xFF, 0},
-	  {0x22, 0x22, 0x22, 0},
-	  {0x44, 0x44, 0x44, 0},
-	  {0x55, 0x66, 0x66, 0},
-	  {0x33, 0x99, 0x88, 0},
-	  {0xFF, 0xBB, 0x66, 0},
-	  {0xDD, 0x44, 0x55, 0},
-	  {0xFF, 0x99, 0xAA, 0}}},
-	/* 118 */
-	{"loophero16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x23, 0x23, 0x23, 0},
-	  {0x60, 0x22, 0x17, 0},
-	  {0x3A, 0x3F, 0x3F, 0},
-	  {0x81, 0x59, 0x38, 0},
-	  {0x62, 0x64, 0x39, 0},
-	  {0x68, 0x6F, 0x6F, 0},
-	  {0x49, 0x7A, 0xA7, 0},
-	  {0xCD, 0x66, 0x27, 0},
-	  {0x87, 0x9B, 0x42, 0},
-	  {0xAF, 0x91, 0x56, 0},
-	  {0x5E, 0xA2, 0xB0, 0},
-	  {0x9F, 0xA0, 0x89, 0},
-	  {0xA4, 0xBE, 0xC1, 0},
-	  {0xDB, 0xCE, 0x2D, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 119 */
-	{"cookie16",
-	 {{0x1B, 0x1A, 0x1A, 0},
-	  {0x4E, 0x38, 0x46, 0},
-	  {0x7F, 0x38, 0x37, 0},
-	  {0x1F, 0x6C, 0x37, 0},
-	  {0x62, 0x5C, 0x4C, 0},
-	  {0x0A, 0x8A, 0x69, 0},
-	  {0xBA, 0x55, 0x4E, 0},
-	  {0x60, 0x92, 0x38, 0},
-	  {0x7E, 0x7B, 0x71, 0},
-	  {0xAB, 0x85, 0x2E, 0},
-	  {0x3B, 0xB2, 0xB8, 0},
-	  {0xBD, 0x8B, 0x67, 0},
-	  {0xBF, 0xB2, 0x4C, 0},
-	  {0xC9, 0xB4, 0x9C, 0},
-	  {0x8E, 0xF6, 0xC4, 0},
-	  {0xE9, 0xD7, 0xBD, 0}}},
-	/* 120 */
-	{"macintosh2",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xFF, 0x65, 0x00, 0},
-	  {0xDC, 0x00, 0x00, 0},
-	  {0xFF, 0x00, 0x97, 0},
-	  {0x36, 0x00, 0x97, 0},
-	  {0x00, 0x00, 0xCA, 0},
-	  {0x00, 0x97, 0xFF, 0},
-	  {0x00, 0xA8, 0x00, 0},
-	  {0x00, 0x65, 0x00, 0},
-	  {0x65, 0x36, 0x00, 0},
-	  {0x97, 0x65, 0x36, 0},
-	  {0xB9, 0xB9, 0xB9, 0},
-	  {0x86, 0x86, 0x86, 0},
-	  {0x45, 0x45, 0x45, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 121 */
-	{"ashorthike",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x4A, 0x59, 0x33, 0},
-	  {0xBD, 0xC0, 0x39, 0},
-	  {0xEB, 0xD4, 0x77, 0},
-	  {0xC0, 0xAC, 0x3F, 0},
-	  {0xDA, 0x83, 0x32, 0},
-	  {0xFF, 0xB5, 0x5C, 0},
-	  {0xF2, 0x68, 0x5B, 0},
-	  {0xC1, 0x49, 0x2C, 0},
-	  {0xA7, 0x34, 0x28, 0},
-	  {0x57, 0x2D, 0x42, 0},
-	  {0x43, 0xA2, 0x9C, 0},
-	  {0x6C, 0xC7, 0xC0, 0},
-	  {0xEB, 0xDD, 0xDA, 0},
-	  {0xC9, 0xBC, 0xB4, 0},
-	  {0x84, 0x6E, 0x5A, 0}}},
-	/* 122 */
-	{"skinjob16",
-	 {{0x21, 0x22, 0x25, 0},
-	  {0x29, 0x27, 0x2C, 0},
-	  {0x3C, 0x35, 0x37, 0},
-	  {0x49, 0x45, 0x43, 0},
-	  {0x58, 0x50, 0x4B, 0},
-	  {0x5E, 0x62, 0x59, 0},
-	  {0x72, 0x6B, 0x73, 0},
-	  {0x90, 0x75, 0x77, 0},
-	  {0x7B, 0x8E, 0x95, 0},
-	  {0xB1, 0x8D, 0xA1, 0},
-	  {0xC2, 0xA7, 0x83, 0},
-	  {0xA9, 0xC2, 0xA4, 0},
-	  {0xCE, 0xC6, 0xC0, 0},
-	  {0xE4, 0xD2, 0xC6, 0},
-	  {0xF3, 0xE9, 0xC4, 0},
-	  {0xFB, 0xED, 0xE4, 0}}},
-	/* 123 */
-	{"psyche16",
-	 {{0xFA, 0xFA, 0xFA, 0},
-	  {0xEB, 0xE8, 0xDA, 0},
-	  {0xFF, 0x71, 0x96, 0},
-	  {0xEB, 0x41, 0x8A, 0},
-	  {0x30, 0x40, 0x59, 0},
-	  {0x07, 0x18, 0x22, 0},
-	  {0xF0, 0x00, 0x7D, 0},
-	  {0x7F, 0x0D, 0x4B, 0},
-	  {0x96, 0x2B, 0xB5, 0},
-	  {0x3C, 0x43, 0xAD, 0},
-	  {0xFF, 0xDD, 0x5F, 0},
-	  {0xFB, 0xB0, 0x3B, 0},
-	  {0xB9, 0xE2, 0x26, 0},
-	  {0x5A, 0xB0, 0x0F, 0},
-	  {0x5D, 0xD8, 0xD6, 0},
-	  {0x40, 0xA0, 0x95, 0}}},
-	/* 124 */
-	{"lvamaranthus16",
-	 {{0x00, 0x0A, 0x4C, 0},
-	  {0x7F, 0x55, 0xF6, 0},
-	  {0x5C, 0x30, 0x96, 0},
-	  {0x40, 0x21, 0x60, 0},
-	  {0x98, 0x00, 0x8C, 0},
-	  {0xE1, 0x36, 0xA0, 0},
-	  {0xF6, 0x55, 0x9E, 0},
-	  {0xF5, 0x73, 0x88, 0},
-	  {0xF4, 0x9C, 0x90, 0},
-	  {0xF2, 0xC3, 0xAC, 0},
-	  {0xE4, 0xF2, 0x79, 0},
-	  {0xCB, 0xB5, 0x3A, 0},
-	  {0xD9, 0x8F, 0x1E, 0},
-	  {0xCA, 0x56, 0x18, 0},
-	  {0x83, 0x1C, 0x2F, 0},
-	  {0xCA, 0x18, 0x39, 0}}},
-	/* 125 */
-	{"nannermuffins",
-	 {{0x28, 0x25, 0x2D, 0},
-	  {0x45, 0x38, 0x49, 0},
-	  {0x40, 0x4A, 0x5E, 0},
-	  {0x7A, 0x4D, 0x49, 0},
-	  {0x3F, 0x70, 0x5F, 0},
-	  {0xBA, 0x61, 0x5F, 0},
-	  {0x5C, 0x84, 0x99, 0},
-	  {0x93, 0x88, 0x8A, 0},
-	  {0xBF, 0x88, 0x70, 0},
-	  {0x7B, 0xAE, 0x79, 0},
-	  {0xE2, 0x9B, 0x84, 0},
-	  {0x82, 0xBF, 0xC9, 0},
-	  {0xE2, 0xB3, 0x98, 0},
-	  {0xC2, 0xCF, 0x8F, 0},
-	  {0xEE, 0xD1, 0x9E, 0},
-	  {0xEB, 0xE8, 0xC9, 0}}},
-	/* 126 */
-	{"pp16",
-	 {{0x2B, 0x0A, 0x03, 0},
-	  {0x69, 0x27, 0x31, 0},
-	  {0x83, 0x40, 0x3A, 0},
-	  {0xAB, 0x61, 0x3B, 0},
-	  {0xB5, 0x77, 0x35, 0},
-	  {0xBF, 0x91, 0x4F, 0},
-	  {0xC1, 0xB3, 0x67, 0},
-	  {0x5C, 0xBB, 0x72, 0},
-	  {0x49, 0xAF, 0x75, 0},
-	  {0x5D, 0x99, 0x84, 0},
-	  {0x5D, 0x7C, 0x8F, 0},
-	  {0x63, 0x36, 0x4E, 0},
-	  {0x63, 0x41, 0x6B, 0},
-	  {0x6A, 0x54, 0x89, 0},
-	  {0x65, 0x69, 0xA0, 0},
-	  {0x62, 0x7B, 0xB4, 0}}},
-	/* 127 */
-	{"16metallic",
-	 {{0xFA, 0xBA, 0xF8, 0},
-	  {0x53, 0x44, 0x59, 0},
-	  {0x31, 0x12, 0x90, 0},
-	  {0x17, 0x0F, 0x1A, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x86, 0x6C, 0x85, 0},
-	  {0x27, 0x48, 0x93, 0},
-	  {0x33, 0x0B, 0x11, 0},
-	  {0xB5, 0xE9, 0xD4, 0},
-	  {0x81, 0xBD, 0xE6, 0},
-	  {0x38, 0x77, 0xC5, 0},
-	  {0x56, 0x1D, 0x25, 0},
-	  {0xFC, 0xE7, 0x78, 0},
-	  {0xC8, 0x8F, 0x49, 0},
-	  {0xA4, 0x56, 0x2A, 0},
-	  {0x97, 0x3A, 0x35, 0}}},
-	/* 128 */
-	{"gemspark16",
-	 {{0x24, 0x17, 0x29, 0},
-	  {0x2B, 0x30, 0x52, 0},
-	  {0x6D, 0x4E, 0x87, 0},
-	  {0xAD, 0x7D, 0xA9, 0},
-	  {0xD9, 0xB4, 0xBB, 0},
-	  {0xDF, 0xEE, 0xE9, 0},
-	  {0x9E, 0xD3, 0xDB, 0},
-	  {0x65, 0x88, 0xCF, 0},
-	  {0x29, 0x64, 0x75, 0},
-	  {0x41, 0x54, 0x2B, 0},
-	  {0x2D, 0x8A, 0x4C, 0},
-	  {0x81, 0xB3, 0x5D, 0},
-	  {0xD4, 0xCA, 0x81, 0},
-	  {0xB0, 0x7D, 0x56, 0},
-	  {0xAB, 0x52, 0x59, 0},
-	  {0x54, 0x35, 0x33, 0}}},
-	/* 129 */
-	{"colorblindpalette16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x25, 0x25, 0x25, 0},
-	  {0x67, 0x67, 0x67, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x17, 0x17, 0x23, 0},
-	  {0x00, 0x49, 0x49, 0},
-	  {0x00, 0x99, 0x99, 0},
-	  {0x22, 0xCF, 0x22, 0},
-	  {0x49, 0x00, 0x92, 0},
-	  {0x00, 0x6D, 0xDB, 0},
-	  {0xB6, 0x6D, 0xFF, 0},
-	  {0xFF, 0x6D, 0xB6, 0},
-	  {0x92, 0x00, 0x00, 0},
-	  {0x8F, 0x4E, 0x00, 0},
-	  {0xDB, 0x6D, 0x00, 0},
-	  {0xFF, 0xDF, 0x4D, 0}}},
-	/* 130 */
-	{"pearald",
-	 {{0x3F, 0xE3, 0x92, 0},
-	  {0x3D, 0xC5, 0x8D, 0},
-	  {0x3A, 0xA9, 0x86, 0},
-	  {0x37, 0x9A, 0x8A, 0},
-	  {0x34, 0x82, 0x88, 0},
-	  {0x32, 0x60, 0x77, 0},
-	  {0x2B, 0x3A, 0x68, 0},
-	  {0x12, 0x08, 0x55, 0},
-	  {0x24, 0x13, 0x56, 0},
-	  {0x35, 0x1E, 0x56, 0},
-	  {0x59, 0x31, 0x61, 0},
-	  {0x7A, 0x44, 0x6D, 0},
-	  {0x97, 0x59, 0x73, 0},
-	  {0xB0, 0x60, 0x6E, 0},
-	  {0xC9, 0x62, 0x66, 0},
-	  {0xE1, 0x68, 0x63, 0}}},
-	/* 131 */
-	{"doomed",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x1B, 0x3E, 0x3C, 0},
-	  {0x3E, 0x5B, 0x51, 0},
-	  {0x6E, 0x7E, 0x55, 0},
-	  {0xA9, 0xA9, 0x6B, 0},
-	  {0xFF, 0xE1, 0xCB, 0},
-	  {0xFF, 0xC1, 0x90, 0},
-	  {0xFF, 0xB5, 0x4A, 0},
-	  {0xFF, 0x88, 0x37, 0},
-	  {0xFF, 0x5D, 0x00, 0},
-	  {0xBA, 0x45, 0x09, 0},
-	  {0x90, 0x22, 0x00, 0},
-	  {0x4E, 0x0D, 0x00, 0},
-	  {0xDD, 0x22, 0x00, 0},
-	  {0xFF, 0x4E, 0x1D, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 132 */
-	{"evangelist16",
-	 {{0x1B, 0x28, 0x25, 0},
-	  {0xEB, 0x3B, 0x35, 0},
-	  {0x9F, 0x1F, 0x4A, 0},
-	  {0x5E, 0x1D, 0xA8, 0},
-	  {0x8B, 0x4F, 0xAE, 0},
-	  {0x79, 0x7D, 0xB2, 0},
-	  {0xB8, 0x9B, 0xE2, 0},
-	  {0xB5, 0xBB, 0xFF, 0},
-	  {0xE3, 0xD4, 0xFF, 0},
-	  {0x74, 0x4A, 0x6A, 0},
-	  {0xC4, 0x7D, 0x9B, 0},
-	  {0xD4, 0xA3, 0xCB, 0},
-	  {0x6A, 0x90, 0x7D, 0},
-	  {0xB2, 0xC0, 0x84, 0},
-	  {0xF2, 0xE8, 0x9D, 0},
-	  {0xFF, 0xFF, 0xF4, 0}}},
-	/* 133 */
-	{"shine16",
-	 {{0x9D, 0xE4, 0xE4, 0},
-	  {0x5D, 0x9D, 0xDD, 0},
-	  {0x07, 0x07, 0x60, 0},
-	  {0x61, 0x2F, 0x93, 0},
-	  {0xBF, 0x66, 0xBF, 0},
-	  {0xFD, 0xEF, 0xFF, 0},
-	  {0xB9, 0x9C, 0xD4, 0},
-	  {0x78, 0x4A, 0x5F, 0},
-	  {0x2B, 0x00, 0x00, 0},
-	  {0x49, 0x13, 0x2F, 0},
-	  {0xBE, 0x31, 0x31, 0},
-	  {0xEF, 0xA6, 0x5D, 0},
-	  {0xEC, 0xEC, 0x77, 0},
-	  {0x97, 0xD9, 0x54, 0},
-	  {0x2D, 0x89, 0x2D, 0},
-	  {0x15, 0x3F, 0x2F, 0}}},
-	/* 134 */
-	{"winterfes",
-	 {{0x3C, 0x1C, 0x4A, 0},
-	  {0x57, 0x40, 0x84, 0},
-	  {0x65, 0x5E, 0xC0, 0},
-	  {0x5A, 0x78, 0xE3, 0},
-	  {0x54, 0x9F, 0xFF, 0},
-	  {0x4F, 0xD8, 0xFF, 0},
-	  {0x7F, 0xFF, 0xFF, 0},
-	  {0xBF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xDA, 0xEF, 0},
-	  {0xFF, 0xA8, 0xDF, 0},
-	  {0xEF, 0x60, 0xBF, 0},
-	  {0xE7, 0x16, 0xAC, 0},
-	  {0x99, 0x16, 0x74, 0},
-	  {0x5C, 0x02, 0x4A, 0},
-	  {0x30, 0x00, 0x20, 0}}},
-	/* 135 */
-	{"tpwcomic",
-	 {{0xFF, 0xD8, 0xBA, 0},
-	  {0xF7, 0xA9, 0x83, 0},
-	  {0xF2, 0x8A, 0x91, 0},
-	  {0xDB, 0x3B, 0x5D, 0},
-	  {0x57, 0x25, 0x3B, 0},
-	  {0xAC, 0x29, 0x25, 0},
-	  {0xEF, 0x69, 0x2F, 0},
-	  {0xEC, 0xA5, 0x49, 0},
-	  {0x3E, 0x88, 0xB7, 0},
-	  {0x4B, 0x3B, 0x9C, 0},
-	  {0x6A, 0x6C, 0x56, 0},
-	  {0xAD, 0xAC, 0x8E, 0},
-	  {0xFF, 0xF4, 0xE0, 0},
-	  {0xCE, 0xCF, 0xBF, 0},
-	  {0x93, 0x94, 0x87, 0},
-	  {0x2B, 0x2B, 0x26, 0}}},
-	/* 136 */
-	{"sk16",
-	 {{0x24, 0x97, 0xFC, 0},
-	  {0x28, 0x3D, 0x85, 0},
-	  {0x27, 0x1F, 0x36, 0},
-	  {0x59, 0x2B, 0x66, 0},
-	  {0xA6, 0x0D, 0x0D, 0},
-	  {0xFF, 0x5A, 0x00, 0},
-	  {0xFC, 0xB5, 0x00, 0},
-	  {0xED, 0xE5, 0x47, 0},
-	  {0x85, 0xD4, 0x51, 0},
-	  {0x02, 0x99, 0x25, 0},
-	  {0x00, 0x40, 0x1C, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x47, 0x53, 0x70, 0},
-	  {0x79, 0x8B, 0x94, 0},
-	  {0x99, 0xCF, 0xC5, 0},
-	  {0xEB, 0xFF, 0xCC, 0}}},
-	/* 137 */
-	{"softel16",
-	 {{0xFF, 0xFE, 0xF9, 0},
-	  {0xF8, 0xF2, 0xE1, 0},
-	  {0xD7, 0xE2, 0xDE, 0},
-	  {0xFC, 0xEA, 0x9E, 0},
-	  {0xFF, 0xDC, 0x86, 0},
-	  {0xDB, 0x83, 0x5E, 0},
-	  {0xCA, 0xEF, 0xA6, 0},
-	  {0xA7, 0xD0, 0x74, 0},
-	  {0x8B, 0xA7, 0x64, 0},
-	  {0xF3, 0x66, 0x84, 0},
-	  {0xF3, 0x50, 0x6F, 0},
-	  {0x9C, 0x40, 0x71, 0},
-	  {0xA0, 0xD7, 0xEB, 0},
-	  {0x62, 0x87, 0xBE, 0},
-	  {0x5E, 0x5E, 0x80, 0},
-	  {0x40, 0x4B, 0x4F, 0}}},
-	/* 138 */
-	{"pyxel",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x2B, 0x33, 0x5F, 0},
-	  {0x7E, 0x20, 0x72, 0},
-	  {0x19, 0x95, 0x9C, 0},
-	  {0x8B, 0x48, 0x52, 0},
-	  {0x39, 0x5C, 0x98, 0},
-	  {0xA9, 0xC1, 0xFF, 0},
-	  {0xEE, 0xEE, 0xEE, 0},
-	  {0xD4, 0x18, 0x6C, 0},
-	  {0xD3, 0x84, 0x41, 0},
-	  {0xE9, 0xC3, 0x5B, 0},
-	  {0xA3, 0xA3, 0xA3, 0},
-	  {0x70, 0xC6, 0xA9, 0},
-	  {0x76, 0x96, 0xDE, 0},
-	  {0xFF, 0x97, 0x98, 0},
-	  {0xED, 0xC7, 0xB0, 0}}},
-	/* 139 */
-	{"softnature",
-	 {{0x09, 0x09, 0x09, 0},
-	  {0x10, 0x1A, 0x09, 0},
-	  {0x38, 0x3D, 0x12, 0},
-	  {0x6F, 0x78, 0x2A, 0},
-	  {0xB8, 0xAF, 0x4E, 0},
-	  {0xDA, 0xDC, 0x72, 0},
-	  {0xE3, 0xEC, 0xA7, 0},
-	  {0xE8, 0xD9, 0x73, 0},
-	  {0xCA, 0x90, 0x37, 0},
-	  {0xC5, 0x77, 0x38, 0},
-	  {0xD2, 0x81, 0x5F, 0},
-	  {0x8D, 0x3A, 0x17, 0},
-	  {0x3C, 0x18, 0x06, 0},
-	  {0x4F, 0x74, 0x2A, 0},
-	  {0x6E, 0xA6, 0x66, 0},
-	  {0xAD, 0xDC, 0xD3, 0}}},
-	/* 140 */
-	{"largecoffee",
-	 {{0xC9, 0x4B, 0x98, 0},
-	  {0xFF, 0x63, 0xA2, 0},
-	  {0xFF, 0x90, 0xB7, 0},
-	  {0xFF, 0xCE, 0xD1, 0},
-	  {0xFF, 0xF6, 0xE0, 0},
-	  {0xC2, 0xFF, 0xA6, 0},
-	  {0x6B, 0xFF, 0xA4, 0},
-	  {0x7C, 0xCE, 0xB8, 0},
-	  {0x70, 0x74, 0x9D, 0},
-	  {0x9E, 0x8B, 0xFF, 0},
-	  {0xC0, 0xB5, 0xFF, 0},
-	  {0xEE, 0xCA, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xC2, 0xFF, 0xF7, 0},
-	  {0xB0, 0xE8, 0xFF, 0},
-	  {0x8A, 0xB3, 0xCF, 0}}},
-	/* 141 */
-	{"jrcomp",
-	 {{0x03, 0x06, 0x25, 0},
-	  {0x00, 0x00, 0xE8, 0},
-	  {0x07, 0x7C, 0x35, 0},
-	  {0x02, 0x85, 0x66, 0},
-	  {0x9F, 0x24, 0x41, 0},
-	  {0x6B, 0x03, 0xCA, 0},
-	  {0x4B, 0x74, 0x32, 0},
-	  {0x81, 0x89, 0x9E, 0},
-	  {0x1C, 0x25, 0x36, 0},
-	  {0x0E, 0x59, 0xF0, 0},
-	  {0x2C, 0xC6, 0x4E, 0},
-	  {0x0B, 0xC3, 0xA9, 0},
-	  {0xE8, 0x56, 0x85, 0},
-	  {0xC1, 0x37, 0xFF, 0},
-	  {0xA7, 0xC2, 0x51, 0},
-	  {0xCE, 0xD9, 0xED, 0}}},
-	/* 142 */
-	{"adl16",
-	 {{0x01, 0x0D, 0x1A, 0},
-	  {0x48, 0x2A, 0x37, 0},
-	  {0x16, 0x2F, 0x62, 0},
-	  {0x5D, 0x28, 0x5A, 0},
-	  {0x19, 0x57, 0x40, 0},
-	  {0xAF, 0x28, 0x41, 0},
-	  {0x9A, 0x58, 0x54, 0},
-	  {0x35, 0x7B, 0xD8, 0},
-	  {0x88, 0x82, 0x83, 0},
-	  {0x43, 0xAB, 0x72, 0},
-	  {0xF7, 0x80, 0x57, 0},
-	  {0x83, 0xC3, 0xD4, 0},
-	  {0xFD, 0xB1, 0x93, 0},
-	  {0xC2, 0xE0, 0x59, 0},
-	  {0xFF, 0xDA, 0x57, 0},
-	  {0xFF, 0xF3, 0xEE, 0}}},
-	/* 143 */
-	{"sicklyrainbow",
-	 {{0xFA, 0xFF, 0xEC, 0},
-	  {0xD3, 0xD6, 0xF0, 0},
-	  {0xAB, 0xAE, 0xF5, 0},
-	  {0x84, 0x85, 0xFA, 0},
-	  {0xC8, 0xFF, 0x00, 0},
-	  {0xD6, 0xCC, 0x17, 0},
-	  {0xE3, 0x99, 0x2E, 0},
-	  {0xF1, 0x66, 0x45, 0},
-	  {0xAD, 0xD6, 0x40, 0},
-	  {0x92, 0xAE, 0x80, 0},
-	  {0x77, 0x85, 0xBF, 0},
-	  {0x5A, 0x5A, 0xFF, 0},
-	  {0x85, 0x52, 0xD6, 0},
-	  {0xAE, 0x48, 0xAE, 0},
-	  {0xD6, 0x3D, 0x85, 0},
-	  {0xFF, 0x32, 0x5A, 0}}},
-	/* 144 */
-	{"warmsummer",
-	 {{0x27, 0x20, 0x1C, 0},
-	  {0x76, 0x4C, 0x31, 0},
-	  {0xAE, 0x86, 0x61, 0},
-	  {0xA3, 0x82, 0x5B, 0},
-	  {0xDD, 0xBB, 0x94, 0},
-	  {0xFD, 0xF7, 0xD5, 0},
-	  {0xFE, 0xF2, 0xC2, 0},
-	  {0xF2, 0xCE, 0x9A, 0},
-	  {0xE2, 0xA2, 0x5E, 0},
-	  {0xCC, 0x96, 0x62, 0},
-	  {0xA9, 0x91, 0x76, 0},
-	  {0x7E, 0x6D, 0x59, 0},
-	  {0xA0, 0x56, 0x3D, 0},
-	  {0xD2, 0x75, 0x57, 0},
-	  {0xB0, 0x9C, 0x4C, 0},
-	  {0x86, 0x6D, 0x1D, 0}}},
-	/* 145 */
-	{"snowl16",
-	 {{0x1E, 0x15, 0x1E, 0},
-	  {0x4D, 0x4C, 0x47, 0},
-	  {0x7C, 0x79, 0x73, 0},
-	  {0xB8, 0xB4, 0xA9, 0},
-	  {0x4B, 0x35, 0x6F, 0},
-	  {0x74, 0x6E, 0xB1, 0},
-	  {0xAF, 0x7F, 0xA3, 0},
-	  {0x73, 0xB5, 0xDE, 0},
-	  {0x5B, 0x2A, 0x35, 0},
-	  {0xB1, 0x4A, 0x5E, 0},
-	  {0xB1, 0x5C, 0x47, 0},
-	  {0xDC, 0xDE, 0x73, 0},
-	  {0x35, 0x6F, 0x54, 0},
-	  {0x76, 0xB1, 0x5A, 0},
-	  {0xDE, 0xBE, 0x98, 0},
-	  {0xDE, 0xDA, 0xCB, 0}}},
-	/* 146 */
-	{"fztethereal16",
-	 {{0xF3, 0xF3, 0xF3, 0},
-	  {0xF9, 0xC2, 0xA4, 0},
-	  {0xB8, 0x70, 0x0E, 0},
-	  {0x5E, 0x0D, 0x24, 0},
-	  {0xA2, 0x9E, 0xB4, 0},
-	  {0xC2, 0x59, 0xDF, 0},
-	  {0x8F, 0x27, 0xB8, 0},
-	  {0xC1, 0x00, 0x2B, 0},
-	  {0x6C, 0x60, 0x6F, 0},
-	  {0x00, 0x47, 0xED, 0},
-	  {0x00, 0xA8, 0xF3, 0},
-	  {0xDD, 0xB4, 0x11, 0},
-	  {0x00, 0x49, 0x52, 0},
-	  {0x07, 0x86, 0x5C, 0},
-	  {0x00, 0xC3, 0x7D, 0},
-	  {0x05, 0x1C, 0x25, 0}}},
-	/* 147 */
-	{"combi16",
-	 {{0x06, 0x03, 0x10, 0},
-	  {0x25, 0x2B, 0xC5, 0},
-	  {0x7C, 0x3D, 0x13, 0},
-	  {0x53, 0x51, 0x55, 0},
-	  {0x9C, 0x2F, 0x9B, 0},
-	  {0x23, 0x97, 0x25, 0},
-	  {0xD8, 0x4B, 0x37, 0},
-	  {0x2D, 0x9F, 0x62, 0},
-	  {0x82, 0x72, 0xEC, 0},
-	  {0xBF, 0x83, 0x21, 0},
-	  {0xED, 0x62, 0x94, 0},
-	  {0x77, 0xD0, 0x51, 0},
-	  {0x5E, 0xD6, 0xEA, 0},
-	  {0xB7, 0xBA, 0x9D, 0},
-	  {0xE5, 0xE0, 0x52, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 148 */
-	{"sara98b",
-	 {{0xFA, 0xE2, 0xCA, 0},
-	  {0xE2, 0xAE, 0x89, 0},
-	  {0xD6, 0x79, 0x59, 0},
-	  {0xBE, 0x3C, 0x28, 0},
-	  {0x7D, 0x28, 0x14, 0},
-	  {0x50, 0x1C, 0x0C, 0},
-	  {0x28, 0x10, 0x04, 0},
-	  {0x08, 0x08, 0x08, 0},
-	  {0x1C, 0x20, 0x2C, 0},
-	  {0x38, 0x48, 0x65, 0},
-	  {0x44, 0x71, 0x9D, 0},
-	  {0x79, 0x99, 0xBA, 0},
-	  {0xBA, 0xC2, 0xCE, 0},
-	  {0xCE, 0x8D, 0x91, 0},
-	  {0xC6, 0x5D, 0x6D, 0},
-	  {0x9D, 0x2C, 0x40, 0}}},
-	/* 149 */
-	{"beetbit",
-	 {{0xFF, 0xF5, 0xB5, 0},
-	  {0x38, 0xBE, 0x77, 0},
-	  {0x22, 0x8F, 0x55, 0},
-	  {0x12, 0x61, 0x33, 0},
-	  {0x74, 0x74, 0x0A, 0},
-	  {0xB2, 0xAD, 0x14, 0},
-	  {0xFF, 0xBE, 0x3F, 0},
-	  {0xD1, 0x61, 0x10, 0},
-	  {0x87, 0x25, 0x06, 0},
-	  {0x58, 0x06, 0x1E, 0},
-	  {0x91, 0x06, 0x31, 0},
-	  {0xF1, 0x16, 0x4B, 0},
-	  {0xA9, 0x8F, 0xA3, 0},
-	  {0x6E, 0x4D, 0x70, 0},
-	  {0x47, 0x18, 0x47, 0},
-	  {0x23, 0x06, 0x0F, 0}}},
-	/* 150 */
-	{"murk16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x08, 0x45, 0x7E, 0},
-	  {0x8E, 0x7E, 0xCA, 0},
-	  {0xFD, 0xB0, 0xF7, 0},
-	  {0x59, 0x96, 0xBC, 0},
-	  {0x97, 0xE7, 0xEC, 0},
-	  {0x6A, 0x23, 0x37, 0},
-	  {0x62, 0x75, 0x43, 0},
-	  {0x7B, 0x6D, 0x55, 0},
-	  {0xB5, 0xA8, 0x63, 0},
-	  {0xBD, 0x3B, 0x56, 0},
-	  {0xED, 0x8F, 0x87, 0},
-	  {0x9F, 0x5A, 0x49, 0},
-	  {0xCF, 0xA3, 0x7D, 0},
-	  {0xEF, 0xDB, 0xB7, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 151 */
-	{"bonesky",
-	 {{0xBC, 0xE7, 0xE5, 0},
-	  {0x91, 0x9D, 0xC2, 0},
-	  {0x65, 0x5A, 0xA1, 0},
-	  {0x32, 0x1B, 0x80, 0},
-	  {0xD4, 0x7C, 0x75, 0},
-	  {0x9F, 0x68, 0x61, 0},
-	  {0x6E, 0x54, 0x4F, 0},
-	  {0x3E, 0x40, 0x3D, 0},
-	  {0xAD, 0xF9, 0xB5, 0},
-	  {0xA0, 0xBF, 0xB0, 0},
-	  {0x8E, 0x88, 0xA9, 0},
-	  {0x76, 0x53, 0xA0, 0},
-	  {0xDE, 0xD5, 0x7B, 0},
-	  {0xBD, 0xAF, 0x73, 0},
-	  {0x9E, 0x8B, 0x6B, 0},
-	  {0x80, 0x69, 0x62, 0}}},
-	/* 152 */
-	{"dga16",
-	 {{0x01, 0x01, 0x01, 0},
-	  {0x03, 0x1B, 0x75, 0},
-	  {0x10, 0x8C, 0x00, 0},
-	  {0x17, 0xBB, 0xD3, 0},
-	  {0x72, 0x0C, 0x0A, 0},
-	  {0x6C, 0x1C, 0x9E, 0},
-	  {0xB2, 0x51, 0x16, 0},
-	  {0xB8, 0xB0, 0xA8, 0},
-	  {0x4A, 0x48, 0x42, 0},
-	  {0x0B, 0x63, 0xC4, 0},
-	  {0x9B, 0xCE, 0x00, 0},
-	  {0x73, 0xF5, 0xD5, 0},
-	  {0xE8, 0x9E, 0x00, 0},
-	  {0xFF, 0x7B, 0xDB, 0},
-	  {0xFE, 0xF2, 0x55, 0},
-	  {0xFF, 0xFF, 0xFE, 0}}},
-	/* 153 */
-	{"tyif16",
-	 {{0xDE, 0xCE, 0xB4, 0},
-	  {0x97, 0xB6, 0xC1, 0},
-	  {0x67, 0x87, 0x82, 0},
-	  {0xB6, 0xA8, 0x7B, 0},
-	  {0xB1, 0x86, 0x52, 0},
-	  {0x97, 0x77, 0x60, 0},
-	  {0x90, 0x54, 0x4D, 0},
-	  {0x5E, 0x4A, 0x48, 0},
-	  {0x81, 0x87, 0x65, 0},
-	  {0x5F, 0x5D, 0x4F, 0},
-	  {0x81, 0x90, 0x4D, 0},
-	  {0x68, 0x65, 0x44, 0},
-	  {0x53, 0x4A, 0x3B, 0},
-	  {0x3D, 0x44, 0x3B, 0},
-	  {0x2F, 0x2C, 0x27, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 154 */
-	{"cozyadventure",
-	 {{0xFF, 0xD8, 0x87, 0},
-	  {0xEB, 0x93, 0x61, 0},
-	  {0xDA, 0x5E, 0x4E, 0},
-	  {0xAB, 0x23, 0x30, 0},
-	  {0xDF, 0xFF, 0xFF, 0},
-	  {0xB5, 0xDE, 0x89, 0},
-	  {0x6A, 0xAB, 0x7C, 0},
-	  {0x26, 0x61, 0x6B, 0},
-	  {0xA2, 0xDC, 0xEB, 0},
-	  {0x75, 0x9E, 0xD0, 0},
-	  {0x43, 0x4E, 0xA8, 0},
-	  {0x2A, 0x21, 0x40, 0},
-	  {0xE1, 0xA7, 0xC5, 0},
-	  {0xAB, 0x7A, 0xC6, 0},
-	  {0x73, 0x5B, 0xAB, 0},
-	  {0x3B, 0x37, 0x72, 0}}},
-	/* 155 */
-	{"etern16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xAD, 0xA9, 0x7D, 0},
-	  {0xFF, 0xDB, 0x80, 0},
-	  {0xE6, 0x9C, 0x53, 0},
-	  {0xBD, 0x68, 0x3A, 0},
-	  {0x85, 0x4F, 0x3A, 0},
-	  {0x63, 0x38, 0x45, 0},
-	  {0x85, 0xEB, 0x81, 0},
-	  {0x63, 0xD4, 0xBD, 0},
-	  {0x56, 0xA0, 0xA6, 0},
-	  {0x41, 0x60, 0x78, 0},
-	  {0x39, 0x36, 0x5C, 0},
-	  {0x21, 0x23, 0x33, 0},
-	  {0xAB, 0x43, 0x2E, 0},
-	  {0x85, 0x17, 0x2B, 0},
-	  {0x57, 0x10, 0x27, 0}}},
-	/* 156 */
-	{"sleightofhand",
-	 {{0xEE, 0xF7, 0xD2, 0},
-	  {0xCE, 0xE1, 0xBD, 0},
-	  {0xB4, 0xCB, 0x9F, 0},
-	  {0xD7, 0xBC, 0x63, 0},
-	  {0x9C, 0x8E, 0x5C, 0},
-	  {0xF3, 0xF7, 0x63, 0},
-	  {0x7E, 0x77, 0x5D, 0},
-	  {0xDF, 0xDF, 0x80, 0},
-	  {0xE9, 0xEB, 0x7A, 0},
-	  {0xD1, 0xD0, 0x6B, 0},
-	  {0x8C, 0xB5, 0x60, 0},
-	  {0xA3, 0xD6, 0x67, 0},
-	  {0xC0, 0xAA, 0x60, 0},
-	  {0x73, 0xA1, 0x67, 0},
-	  {0xB2, 0xE8, 0x6D, 0},
-	  {0x77, 0x8F, 0x63, 0}}},
-	/* 157 */
-	{"warm",
-	 {{0x3F, 0x05, 0x13, 0},
-	  {0x71, 0x0A, 0x0A, 0},
-	  {0xB8, 0x31, 0x13, 0},
-	  {0xD9, 0x5B, 0x1B, 0},
-	  {0xE0, 0x75, 0x32, 0},
-	  {0xE3, 0xB2, 0x58, 0},
-	  {0xE2, 0xCC, 0x72, 0},
-	  {0xE6, 0xE2, 0x96, 0},
-	  {0xE5, 0xEC, 0xD3, 0},
-	  {0xD0, 0xE4, 0xBA, 0},
-	  {0xB5, 0xE2, 0xA5, 0},
-	  {0x87, 0xE0, 0x8A, 0},
-	  {0x2B, 0xBC, 0x72, 0},
-	  {0x21, 0x9E, 0x8F, 0},
-	  {0x15, 0x5D, 0x7B, 0},
-	  {0x18, 0x1C, 0x39, 0}}},
-	/* 158 */
-	{"nord",
-	 {{0x2E, 0x34, 0x40, 0},
-	  {0x3B, 0x42, 0x52, 0},
-	  {0x43, 0x4C, 0x5E, 0},
-	  {0x4C, 0x56, 0x6A, 0},
-	  {0xD8, 0xDE, 0xE9, 0},
-	  {0xE5, 0xE9, 0xF0, 0},
-	  {0xEC, 0xEF, 0xF4, 0},
-	  {0x8F, 0xBC, 0xBB, 0},
-	  {0x88, 0xC0, 0xD0, 0},
-	  {0x81, 0xA1, 0xC1, 0},
-	  {0x5E, 0x81, 0xAC, 0},
-	  {0xBF, 0x61, 0x6A, 0},
-	  {0xD0, 0x87, 0x70, 0},
-	  {0xEB, 0xCB, 0x8B, 0},
-	  {0xA3, 0xBE, 0x8C, 0},
-	  {0xB4, 0x8E, 0xAD, 0}}},
-	/* 159 */
-	{"Unnamed",
-	 {{0x38, 0x50, 0x74, 0},
-	  {0x46, 0x70, 0xA2, 0},
-	  {0x70, 0x81, 0x9D, 0},
-	  {0x86, 0xA2, 0xB8, 0},
-	  {0xC0, 0xD1, 0xDE, 0},
-	  {0xB2, 0xA0, 0x8A, 0},
-	  {0xD9, 0xB4, 0x8A, 0},
-	  {0xFE, 0xEB, 0x9F, 0},
-	  {0xFF, 0xEB, 0xBC, 0},
-	  {0xF0, 0xD1, 0xA5, 0},
-	  {0x96, 0x89, 0x81, 0},
-	  {0x7F, 0x75, 0x74, 0},
-	  {0x48, 0x48, 0x50, 0},
-	  {0x31, 0x38, 0x48, 0},
-	  {0x1C, 0x28, 0x3E, 0},
-	  {0x0B, 0x13, 0x21, 0}}},
-	/* 160 */
-	{"trl16",
-	 {{0x17, 0x17, 0x1C, 0},
-	  {0x28, 0x2A, 0x30, 0},
-	  {0x49, 0x36, 0x3A, 0},
-	  {0x40, 0x47, 0x35, 0},
-	  {0x3B, 0x53, 0x6A, 0},
-	  {0x9B, 0x35, 0x35, 0},
-	  {0x92, 0x58, 0x3F, 0},
-	  {0x21, 0x92, 0x7E, 0},
-	  {0xA1, 0x6A, 0x41, 0},
-	  {0x7E, 0x7B, 0x71, 0},
-	  {0x71, 0xA1, 0x4E, 0},
-	  {0xBE, 0x8D, 0x68, 0},
-	  {0x7A, 0xBB, 0xB9, 0},
-	  {0xD9, 0xBD, 0x66, 0},
-	  {0xE8, 0xC6, 0xA1, 0},
-	  {0xDC, 0xD6, 0xCF, 0}}},
-	/* 161 */
-	{"lump16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x20, 0x12, 0x3B, 0},
-	  {0x45, 0x1C, 0x33, 0},
-	  {0xA8, 0x27, 0x4B, 0},
-	  {0xED, 0x73, 0x32, 0},
-	  {0xFF, 0xF1, 0x67, 0},
-	  {0xFF, 0xFF, 0xD9, 0},
-	  {0x7D, 0xEF, 0xFF, 0},
-	  {0x2D, 0xD6, 0x60, 0},
-	  {0x2C, 0x7C, 0xC7, 0},
-	  {0x30, 0x30, 0xA1, 0},
-	  {0x38, 0x13, 0x78, 0},
-	  {0x8C, 0x2D, 0xA6, 0},
-	  {0xF5, 0x7F, 0xC6, 0},
-	  {0xFF, 0xD7, 0xA8, 0},
-	  {0xC8, 0x76, 0x5C, 0}}},
-	/* 162 */
-	{"choco16",
-	 {{0xBC, 0xDA, 0xE4, 0},
-	  {0x84, 0x9F, 0xF3, 0},
-	  {0x6C, 0x5C, 0xE3, 0},
-	  {0x46, 0x48, 0x89, 0},
-	  {0x1F, 0x45, 0x40, 0},
-	  {0x29, 0x79, 0x44, 0},
-	  {0x6D, 0xA2, 0x5B, 0},
-	  {0xDC, 0xE6, 0x81, 0},
-	  {0xC6, 0xA5, 0x4B, 0},
-	  {0xB6, 0x57, 0x2B, 0},
-	  {0x87, 0x1E, 0x1E, 0},
-	  {0xC7, 0x2D, 0x51, 0},
-	  {0xFA, 0x4D, 0xB4, 0},
-	  {0xFF, 0xAD, 0xB5, 0},
-	  {0xA2, 0x57, 0x4F, 0},
-	  {0x5E, 0x30, 0x31, 0}}},
-	/* 163 */
-	{"brknpoint",
-	 {{0xF5, 0xF5, 0xFA, 0},
-	  {0x05, 0x05, 0x05, 0},
-	  {0xE2, 0xE7, 0xCB, 0},
-	  {0xD1, 0xCE, 0xAD, 0},
-	  {0xC4, 0xB5, 0xA0, 0},
-	  {0xAD, 0x94, 0x88, 0},
-	  {0xCC, 0x94, 0xA3, 0},
-	  {0xF6, 0x6A, 0xF3, 0},
-	  {0xBC, 0x56, 0xE9, 0},
-	  {0x74, 0x41, 0xD5, 0},
-	  {0x0E, 0x0E, 0x26, 0},
-	  {0x36, 0x3C, 0x78, 0},
-	  {0x4A, 0x6E, 0x8D, 0},
-	  {0x6A, 0x9D, 0x81, 0},
-	  {0x89, 0xB3, 0x86, 0},
-	  {0xB5, 0xD0, 0xAA, 0}}},
-	/* 164 */
-	{"better16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x18, 0x18, 0x80, 0},
-	  {0x50, 0x28, 0x10, 0},
-	  {0x40, 0x40, 0x40, 0},
-	  {0x18, 0x58, 0x10, 0},
-	  {0xB0, 0x10, 0x10, 0},
-	  {0x58, 0x58, 0xE8, 0},
-	  {0xB8, 0x38, 0xC0, 0},
-	  {0x80, 0x80, 0x80, 0},
-	  {0x30, 0xA8, 0x28, 0},
-	  {0xF0, 0x80, 0x00, 0},
-	  {0x88, 0xB0, 0xF8, 0},
-	  {0x38, 0xD0, 0xC0, 0},
-	  {0xE8, 0xC8, 0xA8, 0},
-	  {0xF8, 0xE8, 0x40, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 165 */
-	{"vigor",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x05, 0x21, 0x53, 0},
-	  {0x4E, 0x38, 0x13, 0},
-	  {0x94, 0x08, 0x25, 0},
-	  {0x6B, 0x4D, 0x8B, 0},
-	  {0x5C, 0x5C, 0x5E, 0},
-	  {0xEB, 0x63, 0x0D, 0},
-	  {0xE8, 0x5C, 0x99, 0},
-	  {0x5E, 0x85, 0xC4, 0},
-	  {0x8B, 0x8C, 0x90, 0},
-	  {0x73, 0xC4, 0x89, 0},
-	  {0xC4, 0xCC, 0xCC, 0},
-	  {0xA1, 0xD6, 0xCE, 0},
-	  {0xD3, 0xEC, 0xB5, 0},
-	  {0xF9, 0xF8, 0xD6, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 166 */
-	{"sness",
-	 {{0xF5, 0xF5, 0xF5, 0},
-	  {0xA9, 0xB3, 0x99, 0},
-	  {0x61, 0x6B, 0x6D, 0},
-	  {0x18, 0x10, 0x10, 0},
-	  {0x8D, 0x02, 0x2E, 0},
-	  {0xE7, 0x18, 0x61, 0},
-	  {0xFF, 0xA9, 0x95, 0},
-	  {0xC6, 0x92, 0x4F, 0},
-	  {0x88, 0x58, 0x18, 0},
-	  {0xDC, 0x6F, 0x0F, 0},
-	  {0xF6, 0xD7, 0x14, 0},
-	  {0x0B, 0xDB, 0x52, 0},
-	  {0x13, 0x8E, 0x7D, 0},
-	  {0x2B, 0x45, 0x55, 0},
-	  {0x71, 0x61, 0xDE, 0},
-	  {0x80, 0xBE, 0xDB, 0}}},
-	/* 167 */
-	{"enos16",
-	 {{0xFA, 0xFA, 0xFA, 0},
-	  {0xD4, 0xD4, 0xD4, 0},
-	  {0x9D, 0x9D, 0x9D, 0},
-	  {0x4B, 0x4B, 0x4B, 0},
-	  {0xF9, 0xD3, 0x81, 0},
-	  {0xEA, 0xAF, 0x4D, 0},
-	  {0xF9, 0x93, 0x8A, 0},
-	  {0xE7, 0x59, 0x52, 0},
-	  {0x9A, 0xD1, 0xF9, 0},
-	  {0x58, 0xAE, 0xEE, 0},
-	  {0x8D, 0xED, 0xA7, 0},
-	  {0x44, 0xC5, 0x5B, 0},
-	  {0xC3, 0xA7, 0xE1, 0},
-	  {0x95, 0x69, 0xC8, 0},
-	  {0xBA, 0xB5, 0xAA, 0},
-	  {0x94, 0x8E, 0x82, 0}}},
-	/* 168 */
-	{"lopalette",
-	 {{0x3A, 0x3A, 0x3A, 0},
-	  {0x81, 0x71, 0x9A, 0},
-	  {0xA7, 0x77, 0xB7, 0},
-	  {0xD8, 0xB0, 0xC0, 0},
-	  {0xEF, 0xAF, 0xBF, 0},
-	  {0xDF, 0x77, 0xA7, 0},
-	  {0xCF, 0x4F, 0x2F, 0},
-	  {0xF7, 0x9F, 0x4F, 0},
-	  {0xF7, 0xDF, 0x6F, 0},
-	  {0xCF, 0x9F, 0x00, 0},
-	  {0xA7, 0x6F, 0x47, 0},
-	  {0x47, 0x9F, 0x57, 0},
-	  {0x9F, 0xCF, 0x7F, 0},
-	  {0xA0, 0xD0, 0xF8, 0},
-	  {0x88, 0xA0, 0xF0, 0},
-	  {0xF8, 0xE8, 0xF8, 0}}},
-	/* 169 */
-	{"satellitesky16",
-	 {{0x87, 0xD6, 0xFF, 0},
-	  {0x87, 0xB3, 0xFF, 0},
-	  {0x87, 0x91, 0xFF, 0},
-	  {0x7D, 0x84, 0xD2, 0},
-	  {0x87, 0x5D, 0xBD, 0},
-	  {0x41, 0x4C, 0xCC, 0},
-	  {0x0B, 0x14, 0x7C, 0},
-	  {0x04, 0x0A, 0x48, 0},
-	  {0x1C, 0x27, 0x98, 0},
-	  {0x33, 0x3C, 0x9F, 0},
-	  {0x50, 0x58, 0xB2, 0},
-	  {0x74, 0x7A, 0xB6, 0},
-	  {0x9F, 0x88, 0xCB, 0},
-	  {0xCC, 0x8C, 0xE0, 0},
-	  {0xEE, 0x97, 0xE7, 0},
-	  {0xFF, 0xA5, 0xCF, 0}}},
-	/* 170 */
-	{"st16natural",
-	 {{0x09, 0x09, 0x0A, 0},
-	  {0x5C, 0x21, 0x2D, 0},
-	  {0xC2, 0x38, 0x2F, 0},
-	  {0xE0, 0x91, 0x36, 0},
-	  {0xEB, 0xDF, 0x42, 0},
-	  {0x87, 0xCC, 0x39, 0},
-	  {0x25, 0x66, 0x2D, 0},
-	  {0x37, 0x99, 0x6B, 0},
-	  {0x63, 0xC7, 0xE0, 0},
-	  {0x4D, 0x56, 0xD6, 0},
-	  {0x3C, 0x28, 0x70, 0},
-	  {0x70, 0x33, 0x8F, 0},
-	  {0xE0, 0x75, 0xBC, 0},
-	  {0xFD, 0xFF, 0xF5, 0},
-	  {0x9D, 0xA3, 0xA0, 0},
-	  {0x45, 0x47, 0x47, 0}}},
-	/* 171 */
-	{"bitdream",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x49, 0x00, 0x00, 0},
-	  {0x00, 0x49, 0x00, 0},
-	  {0x22, 0x12, 0x3B, 0},
-	  {0xFF, 0xA0, 0x44, 0},
-	  {0xC8, 0x4C, 0x0C, 0},
-	  {0x6F, 0x8B, 0x6F, 0},
-	  {0x5C, 0x70, 0xFF, 0},
-	  {0xFC, 0xD8, 0xA8, 0},
-	  {0xF0, 0x18, 0x51, 0},
-	  {0x00, 0xA8, 0x30, 0},
-	  {0x5E, 0xCC, 0xF7, 0},
-	  {0xFF, 0xFF, 0xF1, 0},
-	  {0xF7, 0x9C, 0x9C, 0},
-	  {0xB6, 0xFF, 0x49, 0},
-	  {0xDB, 0x6D, 0xFF, 0}}},
-	/* 172 */
-	{"hypertropicpalette",
-	 {{0x08, 0x08, 0x08, 0},
-	  {0x27, 0x23, 0x24, 0},
-	  {0x57, 0x26, 0x1B, 0},
-	  {0x5E, 0x51, 0x2E, 0},
-	  {0xEE, 0xF2, 0xF3, 0},
-	  {0x60, 0x66, 0x5F, 0},
-	  {0xD3, 0x2D, 0x29, 0},
-	  {0xE4, 0xC2, 0x21, 0},
-	  {0x34, 0x47, 0x25, 0},
-	  {0x1B, 0x32, 0x4E, 0},
-	  {0x2C, 0x4F, 0x62, 0},
-	  {0x4C, 0x3B, 0x44, 0},
-	  {0x28, 0x8D, 0x4C, 0},
-	  {0x2C, 0x71, 0xAA, 0},
-	  {0x3A, 0x8C, 0xC1, 0},
-	  {0xC2, 0x7B, 0x85, 0}}},
-	/* 173 */
-	{"europa16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x75, 0xCE, 0xEA, 0},
-	  {0x31, 0x7A, 0xD7, 0},
-	  {0x28, 0x37, 0x85, 0},
-	  {0x1A, 0x1B, 0x35, 0},
-	  {0x2E, 0x35, 0x4E, 0},
-	  {0x4F, 0x66, 0x78, 0},
-	  {0xA4, 0xBC, 0xC2, 0},
-	  {0xEC, 0xF8, 0x60, 0},
-	  {0x94, 0xD4, 0x46, 0},
-	  {0x3B, 0x78, 0x50, 0},
-	  {0x20, 0x32, 0x2E, 0},
-	  {0x51, 0x20, 0x31, 0},
-	  {0xA4, 0x3E, 0x4B, 0},
-	  {0xDC, 0x7D, 0x5E, 0},
-	  {0xF0, 0xCC, 0x90, 0}}},
-	/* 174 */
-	{"adb16",
-	 {{0x0E, 0x0A, 0x16, 0},
-	  {0x35, 0x3A, 0x41, 0},
-	  {0x57, 0x5C, 0x53, 0},
-	  {0x90, 0x98, 0x9E, 0},
-	  {0xF3, 0xF6, 0xF1, 0},
-	  {0xD7, 0x8C, 0x8E, 0},
-	  {0xC6, 0x35, 0x3D, 0},
-	  {0x43, 0x2D, 0x2D, 0},
-	  {0x90, 0x54, 0x29, 0},
-	  {0xDE, 0x82, 0x2E, 0},
-	  {0xE8, 0xD9, 0x64, 0},
-	  {0x93, 0xC0, 0x2A, 0},
-	  {0x3B, 0x72, 0x20, 0},
-	  {0x21, 0x48, 0x79, 0},
-	  {0x44, 0x8F, 0xDF, 0},
-	  {0x8F, 0xCE, 0xDC, 0}}},
-	/* 175 */
-	{"harpy16",
-	 {{0xE0, 0xAA, 0xAF, 0},
-	  {0x7F, 0x5E, 0x85, 0},
-	  {0x32, 0x2E, 0x36, 0},
-	  {0x6A, 0x3B, 0x50, 0},
-	  {0xAD, 0x7F, 0x5B, 0},
-	  {0xED, 0xD1, 0x89, 0},
-	  {0xF4, 0x9C, 0x8C, 0},
-	  {0xDC, 0x40, 0x70, 0},
-	  {0x55, 0x55, 0x62, 0},
-	  {0x91, 0x87, 0x86, 0},
-	  {0xCD, 0xBE, 0xC8, 0},
-	  {0xFB, 0xF5, 0xDB, 0},
-	  {0xB5, 0xDD, 0xBA, 0},
-	  {0x61, 0x9A, 0x8A, 0},
-	  {0x5D, 0x7F, 0xB1, 0},
-	  {0xA9, 0xD3, 0xCD, 0}}},
-	/* 176 */
-	{"disonant16",
-	 {{0x22, 0x22, 0x22, 0},
-	  {0x31, 0x32, 0x2C, 0},
-	  {0x5B, 0x42, 0x3B, 0},
-	  {0x60, 0x80, 0x7F, 0},
-	  {0x65, 0x26, 0x1D, 0},
-	  {0x86, 0x2F, 0x02, 0},
-	  {0x86, 0x43, 0x64, 0},
-	  {0x86, 0x43, 0xEA, 0},
-	  {0xE3, 0x62, 0xFD, 0},
-	  {0xFE, 0xBF, 0xF8, 0},
-	  {0xFC, 0xDA, 0xFD, 0},
-	  {0xFF, 0xFA, 0xFF, 0},
-	  {0x50, 0x43, 0xC7, 0},
-	  {0x93, 0x94, 0xFE, 0},
-	  {0xC4, 0xDE, 0xFF, 0},
-	  {0xF5, 0xF5, 0xFF, 0}}},
-	/* 177 */
-	{"mapple16",
-	 {{0xDC, 0x00, 0x00, 0},
-	  {0xEA, 0x7D, 0x27, 0},
-	  {0x97, 0x65, 0x36, 0},
-	  {0x65, 0x36, 0x00, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x45, 0x45, 0x45, 0},
-	  {0x91, 0x91, 0x91, 0},
-	  {0xC9, 0xD1, 0x99, 0},
-	  {0x00, 0xA8, 0x00, 0},
-	  {0x00, 0x67, 0x52, 0},
-	  {0x00, 0x00, 0xCA, 0},
-	  {0x51, 0x48, 0x88, 0},
-	  {0x00, 0x97, 0xFF, 0},
-	  {0x98, 0xDB, 0xC9, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xE8, 0x5D, 0xEF, 0}}},
-	/* 178 */
-	{"saturatedc64",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x36, 0x3A, 0x4A, 0},
-	  {0x81, 0x9A, 0xA3, 0},
-	  {0xBE, 0xD0, 0xCA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xDE, 0x1A, 0x4D, 0},
-	  {0xE9, 0x97, 0xAC, 0},
-	  {0x99, 0x43, 0x12, 0},
-	  {0xF2, 0x97, 0x34, 0},
-	  {0xE9, 0xCF, 0x1B, 0},
-	  {0xD4, 0xF0, 0x91, 0},
-	  {0x1F, 0xA3, 0x22, 0},
-	  {0x55, 0xE0, 0xC3, 0},
-	  {0x72, 0xA0, 0xDD, 0},
-	  {0x45, 0x2E, 0xE6, 0},
-	  {0xAE, 0x1F, 0xDB, 0}}},
-	/* 179 */
-	{"autumn",
-	 {{0xEC, 0x6F, 0x1C, 0},
-	  {0xB4, 0x52, 0x2E, 0},
-	  {0x7A, 0x30, 0x30, 0},
-	  {0xF6, 0xAE, 0x3C, 0},
-	  {0xFB, 0xDB, 0x7A, 0},
-	  {0xEA, 0xFB, 0xA3, 0},
-	  {0xE3, 0xF6, 0xD5, 0},
-	  {0x9C, 0xE7, 0x7F, 0},
-	  {0x49, 0xD8, 0x66, 0},
-	  {0x40, 0x87, 0x61, 0},
-	  {0x2D, 0x46, 0x47, 0},
-	  {0x34, 0x54, 0x52, 0},
-	  {0x3A, 0x87, 0x8B, 0},
-	  {0x3D, 0xA4, 0xDB, 0},
-	  {0x95, 0xC5, 0xF2, 0},
-	  {0xCA, 0xCF, 0xF9, 0}}},
-	/* 180 */
-	{"lemon16",
-	 {{0xD5, 0xC7, 0xDA, 0},
-	  {0xF8, 0xCF, 0xA7, 0},
-	  {0xF9, 0xE6, 0xAE, 0},
-	  {0xDF, 0xFE, 0xC9, 0},
-	  {0xBE, 0xA9, 0xC7, 0},
-	  {0xF5, 0xBB, 0x8F, 0},
-	  {0xFB, 0xDE, 0x86, 0},
-	  {0xBF, 0xFC, 0xAD, 0},
-	  {0x7A, 0x57, 0x84, 0},
-	  {0xEE, 0xA2, 0x73, 0},
-	  {0xFB, 0xBD, 0x62, 0},
-	  {0x02, 0xC6, 0x9A, 0},
-	  {0x40, 0x1F, 0x49, 0},
-	  {0xE6, 0x8A, 0x59, 0},
-	  {0xFD, 0xB1, 0x4A, 0},
-	  {0x02, 0x97, 0x76, 0}}},
-	/* 181 */
-	{"lft0",
-	 {{0x12, 0x17, 0x33, 0},
-	  {0x6A, 0x41, 0x73, 0},
-	  {0xC2, 0x8D, 0x98, 0},
-	  {0xD9, 0xCE, 0x9E, 0},
-	  {0x3C, 0x73, 0x68, 0},
-	  {0x3F, 0x48, 0x73, 0},
-	  {0x5F, 0x63, 0x73, 0},
-	  {0x5E, 0x88, 0x53, 0},
-	  {0xA1, 0xCC, 0x95, 0},
-	  {0x8E, 0xBD, 0xB2, 0},
-	  {0xE1, 0xEB, 0xDF, 0},
-	  {0x13, 0x33, 0x2D, 0},
-	  {0x8F, 0x7D, 0x45, 0},
-	  {0x66, 0x40, 0x47, 0},
-	  {0x30, 0x14, 0x2E, 0},
-	  {0xB8, 0x35, 0x4F, 0}}},
-	/* 182 */
-	{"zat16",
-	 {{0x26, 0x0C, 0x72, 0},
-	  {0x5B, 0x27, 0x95, 0},
-	  {0x36, 0x71, 0xB9, 0},
-	  {0x9C, 0xB2, 0xBD, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xDE, 0xA2, 0xA2, 0},
-	  {0xD3, 0x78, 0x0E, 0},
-	  {0x9E, 0x5C, 0x4E, 0},
-	  {0x72, 0x2F, 0x20, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x6E, 0x0F, 0x52, 0},
-	  {0xB0, 0x1E, 0x51, 0},
-	  {0xD6, 0x5C, 0xAB, 0},
-	  {0xDC, 0xD9, 0x44, 0},
-	  {0x36, 0xB4, 0x38, 0},
-	  {0x47, 0x77, 0x10, 0}}},
-	/* 183 */
-	{"mf16",
-	 {{0x16, 0x0B, 0x27, 0},
-	  {0x3E, 0x47, 0x68, 0},
-	  {0x8E, 0x98, 0xB9, 0},
-	  {0xDE, 0xE6, 0xFE, 0},
-	  {0xF3, 0xC4, 0x1C, 0},
-	  {0xF9, 0x86, 0x17, 0},
-	  {0xD4, 0x2C, 0x4F, 0},
-	  {0x5F, 0x02, 0x67, 0},
-	  {0x4A, 0x10, 0xE8, 0},
-	  {0x21, 0x97, 0xF0, 0},
-	  {0x52, 0xDA, 0xF7, 0},
-	  {0xBB, 0x4D, 0x11, 0},
-	  {0xED, 0x7F, 0xB8, 0},
-	  {0x30, 0xFC, 0xA6, 0},
-	  {0x17, 0xBA, 0x7D, 0},
-	  {0x05, 0x62, 0x44, 0}}},
-	/* 184 */
-	{"astron16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xE0, 0xE0, 0xE0, 0},
-	  {0xA0, 0xA0, 0xA0, 0},
-	  {0x40, 0x40, 0x40, 0},
-	  {0x50, 0x30, 0x20, 0},
-	  {0xE0, 0xA0, 0x60, 0},
-	  {0xE0, 0xE0, 0x40, 0},
-	  {0xE0, 0x60, 0x20, 0},
-	  {0xA0, 0x20, 0x20, 0},
-	  {0xC0, 0x20, 0xE0, 0},
-	  {0xE0, 0x80, 0xC0, 0},
-	  {0x60, 0xE0, 0xC0, 0},
-	  {0x20, 0x80, 0xA0, 0},
-	  {0x20, 0x20, 0x80, 0},
-	  {0x20, 0x60, 0x00, 0},
-	  {0x40, 0xC0, 0x20, 0}}},
-	/* 185 */
-	{"jr16",
-	 {{0x04, 0x04, 0x04, 0},
-	  {0x00, 0x01, 0x5D, 0},
-	  {0x00, 0x38, 0x08, 0},
-	  {0x00, 0x37, 0x4B, 0},
-	  {0x58, 0x0A, 0x0A, 0},
-	  {0x52, 0x0A, 0x54, 0},
-	  {0x7A, 0x38, 0x20, 0},
-	  {0x4B, 0x49, 0x56, 0},
-	  {0x81, 0xF4, 0xB1, 0},
-	  {0x72, 0xFF, 0xFF, 0},
-	  {0xA2, 0xA2, 0xAC, 0},
-	  {0x4D, 0x84, 0xFF, 0},
-	  {0xD7, 0x6F, 0x6C, 0},
-	  {0xD8, 0x87, 0xF0, 0},
-	  {0xF6, 0xF8, 0xAD, 0},
-	  {0xF5, 0xFF, 0xFD, 0}}},
-	/* 186 */
-	{"juicy16",
-	 {{0x11, 0x0F, 0x0E, 0},
-	  {0x2B, 0x1E, 0x17, 0},
-	  {0x55, 0x33, 0x2D, 0},
-	  {0x9C, 0x57, 0x49, 0},
-	  {0xC1, 0x30, 0x4E, 0},
-	  {0xFE, 0x68, 0x54, 0},
-	  {0xF2, 0xA8, 0x53, 0},
-	  {0xF3, 0xD6, 0xAF, 0},
-	  {0x2F, 0x9F, 0x6C, 0},
-	  {0x91, 0xE8, 0x7A, 0},
-	  {0xF2, 0xE5, 0x7C, 0},
-	  {0xE5, 0xEF, 0xEE, 0},
-	  {0x2F, 0x38, 0xA8, 0},
-	  {0x52, 0x73, 0xDD, 0},
-	  {0x77, 0xC3, 0xF6, 0},
-	  {0xA1, 0xE8, 0xD5, 0}}},
-	/* 187 */
-	{"dibbles",
-	 {{0xF0, 0x3C, 0x37, 0},
-	  {0xED, 0x88, 0x52, 0},
-	  {0xF2, 0xCD, 0x75, 0},
-	  {0xBA, 0xE0, 0x87, 0},
-	  {0x6D, 0xCB, 0x93, 0},
-	  {0x47, 0x89, 0x7A, 0},
-	  {0x49, 0x75, 0x8F, 0},
-	  {0x2C, 0x38, 0x5A, 0},
-	  {0x1F, 0x23, 0x38, 0},
-	  {0x58, 0x35, 0x93, 0},
-	  {0xA5, 0x4A, 0xBB, 0},
-	  {0xD5, 0x7B, 0xB6, 0},
-	  {0x99, 0x4A, 0x11, 0},
-	  {0xCA, 0x70, 0x15, 0},
-	  {0xF7, 0xD2, 0xAE, 0},
-	  {0xC7, 0xCA, 0xBD, 0}}},
-	/* 188 */
-	{"gigaboy16",
-	 {{0x27, 0x30, 0x1C, 0},
-	  {0x4D, 0x61, 0x3B, 0},
-	  {0x72, 0x84, 0x48, 0},
-	  {0x9F, 0xB0, 0x60, 0},
-	  {0x94, 0xE0, 0xC7, 0},
-	  {0x69, 0xA3, 0x98, 0},
-	  {0x44, 0x6A, 0x69, 0},
-	  {0x1B, 0x29, 0x2C, 0},
-	  {0x23, 0x20, 0x1A, 0},
-	  {0x3E, 0x37, 0x29, 0},
-	  {0x77, 0x6B, 0x4B, 0},
-	  {0xA7, 0x93, 0x68, 0},
-	  {0xDB, 0xE2, 0xED, 0},
-	  {0xA1, 0xA1, 0xAB, 0},
-	  {0x47, 0x46, 0x4B, 0},
-	  {0x1D, 0x1D, 0x1F, 0}}},
-	/* 189 */
-	{"huc16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xCC, 0x4E, 0},
-	  {0xFA, 0x70, 0x33, 0},
-	  {0xE5, 0x2F, 0x1B, 0},
-	  {0xAC, 0x23, 0x85, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x37, 0x1B, 0x14, 0},
-	  {0x73, 0x35, 0x25, 0},
-	  {0xFA, 0xA1, 0xB2, 0},
-	  {0x9A, 0x8A, 0xA6, 0},
-	  {0x9C, 0xCD, 0xD5, 0},
-	  {0x22, 0x7D, 0x66, 0},
-	  {0x78, 0x78, 0x78, 0},
-	  {0x29, 0x3A, 0x72, 0},
-	  {0x6E, 0xA7, 0x63, 0},
-	  {0x24, 0x4E, 0x32, 0}}},
-	/* 190 */
-	{"smooth16",
-	 {{0x0D, 0x15, 0x21, 0},
-	  {0x35, 0x06, 0x29, 0},
-	  {0xFF, 0xFF, 0xEE, 0},
-	  {0x6E, 0xEB, 0xF2, 0},
-	  {0x30, 0x8A, 0xCE, 0},
-	  {0x25, 0x43, 0x71, 0},
-	  {0x19, 0x21, 0x40, 0},
-	  {0x2B, 0x62, 0x76, 0},
-	  {0x36, 0xAD, 0x6E, 0},
-	  {0xA1, 0xFF, 0x7B, 0},
-	  {0xFF, 0xCA, 0x5C, 0},
-	  {0xEB, 0x6E, 0x21, 0},
-	  {0x9F, 0x2A, 0x38, 0},
-	  {0x57, 0x10, 0x2E, 0},
-	  {0xA4, 0x41, 0x41, 0},
-	  {0xFF, 0xCC, 0x9D, 0}}},
-	/* 191 */
-	{"myfirstpalette",
-	 {{0x10, 0x53, 0x9F, 0},
-	  {0x19, 0x45, 0x76, 0},
-	  {0x10, 0x2C, 0x4D, 0},
-	  {0x0D, 0x1B, 0x2B, 0},
-	  {0x9F, 0x43, 0x10, 0},
-	  {0x76, 0x36, 0x19, 0},
-	  {0x4D, 0x23, 0x10, 0},
-	  {0x2B, 0x16, 0x0D, 0},
-	  {0x10, 0x9F, 0x9F, 0},
-	  {0x19, 0x76, 0x6E, 0},
-	  {0x10, 0x4D, 0x45, 0},
-	  {0x0D, 0x2B, 0x25, 0},
-	  {0x38, 0x10, 0x9F, 0},
-	  {0x2F, 0x19, 0x76, 0},
-	  {0x21, 0x10, 0x4D, 0},
-	  {0x14, 0x0D, 0x2B, 0}}},
-	/* 192 */
-	{"human16",
-	 {{0xCC, 0x79, 0xA7, 0},
-	  {0xD5, 0x5E, 0x00, 0},
-	  {0xE6, 0x9F, 0x00, 0},
-	  {0xF0, 0xE4, 0x42, 0},
-	  {0x00, 0x9E, 0x73, 0},
-	  {0x56, 0xB4, 0xE9, 0},
-	  {0x00, 0x72, 0xB2, 0},
-	  {0x65, 0x4D, 0x73, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xAE, 0xB3, 0xB8, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x2B, 0x23, 0x1C, 0},
-	  {0x4C, 0x34, 0x2A, 0},
-	  {0x8F, 0x6D, 0x45, 0},
-	  {0xAF, 0x92, 0x71, 0},
-	  {0xE4, 0xD0, 0xB5, 0}}},
-	/* 193 */
-	{"famicube16",
-	 {{0xE0, 0x3C, 0x28, 0},
-	  {0x87, 0x16, 0x46, 0},
-	  {0xA3, 0x28, 0xB3, 0},
-	  {0xFF, 0x82, 0xCE, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x9B, 0xA0, 0xEF, 0},
-	  {0x7B, 0x7B, 0x7B, 0},
-	  {0x41, 0x5D, 0x66, 0},
-	  {0x0D, 0x20, 0x30, 0},
-	  {0x0A, 0x89, 0xFF, 0},
-	  {0x25, 0xE2, 0xCD, 0},
-	  {0x00, 0x60, 0x4B, 0},
-	  {0x93, 0x97, 0x17, 0},
-	  {0xFF, 0xBB, 0x31, 0},
-	  {0xAE, 0x6C, 0x37, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 194 */
-	{"explorers16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x1D, 0x2B, 0x53, 0},
-	  {0x06, 0x5A, 0xB5, 0},
-	  {0x29, 0xAD, 0xFF, 0},
-	  {0x74, 0x2F, 0x29, 0},
-	  {0xAB, 0x52, 0x36, 0},
-	  {0xFF, 0x6E, 0x59, 0},
-	  {0xFF, 0xCC, 0xAA, 0},
-	  {0x12, 0x53, 0x59, 0},
-	  {0x00, 0x87, 0x51, 0},
-	  {0x00, 0xE4, 0x36, 0},
-	  {0xA8, 0xE7, 0x2E, 0},
-	  {0xF3, 0xEF, 0x7D, 0},
-	  {0xFF, 0xA3, 0x00, 0},
-	  {0xFF, 0x00, 0x4D, 0},
-	  {0x42, 0x21, 0x36, 0}}},
-	/* 195 */
-	{"dotoppenal16",
-	 {{0x44, 0x28, 0x31, 0},
-	  {0x62, 0x3A, 0x46, 0},
-	  {0x75, 0x51, 0x51, 0},
-	  {0xA1, 0x7A, 0x60, 0},
-	  {0x2E, 0x43, 0x2F, 0},
-	  {0x37, 0x5C, 0x51, 0},
-	  {0x56, 0x6F, 0x95, 0},
-	  {0x67, 0x8C, 0xAE, 0},
-	  {0xDC, 0x7D, 0x7D, 0},
-	  {0xF5, 0xB0, 0xAC, 0},
-	  {0xF6, 0xE4, 0xC1, 0},
-	  {0xB1, 0xA2, 0x9D, 0},
-	  {0x6A, 0xA8, 0xBD, 0},
-	  {0xAB, 0xF1, 0xF5, 0},
-	  {0xC1, 0xD3, 0xF7, 0},
-	  {0xA8, 0xB7, 0xC6, 0}}},
-	/* 196 */
-	{"retrolines",
-	 {{0x1C, 0x1B, 0x1B, 0},
-	  {0xFF, 0xF1, 0xE8, 0},
-	  {0xD5, 0xD7, 0xB6, 0},
-	  {0xC5, 0xD6, 0xDB, 0},
-	  {0xCF, 0xB2, 0xDF, 0},
-	  {0xFF, 0x4D, 0xED, 0},
-	  {0xFF, 0x42, 0x42, 0},
-	  {0xFF, 0x7D, 0x00, 0},
-	  {0xFF, 0xCF, 0x29, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0x00, 0xF7, 0x3A, 0},
-	  {0x5B, 0xE3, 0xE3, 0},
-	  {0x29, 0xAD, 0xFF, 0},
-	  {0x6D, 0x46, 0x26, 0},
-	  {0xAB, 0x52, 0x36, 0},
-	  {0xBE, 0x6E, 0x2B, 0}}},
-	/* 197 */
-	{"britepainte",
-	 {{0xFF, 0x00, 0x77, 0},
-	  {0xFF, 0x00, 0xCC, 0},
-	  {0xCC, 0x00, 0xFF, 0},
-	  {0xFF, 0x77, 0xFF, 0},
-	  {0x77, 0x00, 0x77, 0},
-	  {0x77, 0x00, 0xFF, 0},
-	  {0x77, 0x77, 0xFF, 0},
-	  {0x00, 0x77, 0xFF, 0},
-	  {0x00, 0xCC, 0xFF, 0},
-	  {0x00, 0xFF, 0xCC, 0},
-	  {0x00, 0xFF, 0x77, 0},
-	  {0xFF, 0xFF, 0x77, 0},
-	  {0xFF, 0xCC, 0x77, 0},
-	  {0xFF, 0xFF, 0xCC, 0},
-	  {0xFF, 0xCC, 0xCC, 0},
-	  {0xFF, 0x77, 0x77, 0}}},
-	/* 198 */
-	{"autumnbreeze",
-	 {{0x2D, 0x1A, 0x15, 0},
-	  {0x6B, 0x25, 0x11, 0},
-	  {0xB6, 0x1D, 0x1D, 0},
-	  {0xCE, 0x42, 0x1A, 0},
-	  {0xE5, 0x65, 0x20, 0},
-	  {0xE7, 0x7E, 0x1B, 0},
-	  {0xF7, 0xA3, 0x1B, 0},
-	  {0xFF, 0xBB, 0x18, 0},
-	  {0xD9, 0xCD, 0xBD, 0},
-	  {0xF6, 0xF0, 0xE9, 0},
-	  {0xE5, 0xD1, 0xA3, 0},
-	  {0xE5, 0xC5, 0x7B, 0},
-	  {0xE1, 0xB3, 0x6A, 0},
-	  {0x70, 0x34, 0x24, 0},
-	  {0x90, 0x49, 0x36, 0},
-	  {0xA3, 0x5C, 0x49, 0}}},
-	/* 199 */
-	{"2pow4",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xC9, 0xC6, 0xDB, 0},
-	  {0x76, 0x7C, 0x98, 0},
-	  {0x3A, 0x3A, 0x6F, 0},
-	  {0x47, 0x97, 0xDE, 0},
-	  {0x96, 0xEC, 0xCC, 0},
-	  {0xD5, 0xA9, 0xFF, 0},
-	  {0xA0, 0x49, 0xBB, 0},
-	  {0x56, 0x32, 0x43, 0},
-	  {0xD9, 0x3E, 0x48, 0},
-	  {0xFE, 0xA6, 0x9B, 0},
-	  {0xC4, 0x72, 0x31, 0},
-	  {0xF9, 0xD0, 0x71, 0},
-	  {0x5B, 0xAF, 0x34, 0},
-	  {0x24, 0x43, 0x44, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 200 */
-	{"magik16",
-	 {{0x1C, 0x1E, 0x1F, 0},
-	  {0x3C, 0x43, 0x48, 0},
-	  {0x66, 0x8B, 0x90, 0},
-	  {0xBE, 0xE5, 0xE1, 0},
-	  {0xFB, 0xFC, 0xEB, 0},
-	  {0xE9, 0xCE, 0xA8, 0},
-	  {0x9B, 0x5A, 0x44, 0},
-	  {0x59, 0x1E, 0x37, 0},
-	  {0x6D, 0x2F, 0xA7, 0},
-	  {0xD4, 0x54, 0xC6, 0},
-	  {0xE9, 0x8B, 0xB3, 0},
-	  {0xF0, 0xF3, 0xC4, 0},
-	  {0xBD, 0xE9, 0xBF, 0},
-	  {0x82, 0xD3, 0xB0, 0},
-	  {0x58, 0xAA, 0xAD, 0},
-	  {0x23, 0x46, 0x63, 0}}},
-	/* 201 */
-	{"depthblueaerugo",
-	 {{0x1E, 0x07, 0x21, 0},
-	  {0x23, 0x13, 0x2D, 0},
-	  {0x26, 0x20, 0x3A, 0},
-	  {0x30, 0x32, 0x4D, 0},
-	  {0x44, 0x4A, 0x65, 0},
-	  {0x5D, 0x68, 0x7C, 0},
-	  {0x7C, 0x88, 0x93, 0},
-	  {0x9B, 0xA9, 0xAB, 0},
-	  {0x24, 0x2E, 0x35, 0},
-	  {0x2F, 0x48, 0x5C, 0},
-	  {0x46, 0x64, 0x80, 0},
-	  {0x61, 0x8D, 0xA5, 0},
-	  {0x64, 0xA1, 0xC2, 0},
-	  {0x87, 0xD1, 0xEF, 0},
-	  {0x9C, 0xDC, 0xF6, 0},
-	  {0xB4, 0xEA, 0xFF, 0}}},
-	/* 202 */
-	{"sunsetcaveextended",
-	 {{0x0D, 0x0D, 0x0D, 0},
-	  {0x3F, 0x3F, 0x3F, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x3D, 0x42, 0x6E, 0},
-	  {0x40, 0xB1, 0xD6, 0},
-	  {0xA8, 0xED, 0xFF, 0},
-	  {0x57, 0x94, 0x9E, 0},
-	  {0x4C, 0xD9, 0xBF, 0},
-	  {0xA3, 0xFF, 0xD1, 0},
-	  {0x6E, 0x3D, 0x59, 0},
-	  {0xD5, 0x7D, 0x95, 0},
-	  {0xFF, 0xA8, 0xBF, 0},
-	  {0xFF, 0x3E, 0x97, 0},
-	  {0xFF, 0x98, 0x6D, 0},
-	  {0xDF, 0xB5, 0x75, 0},
-	  {0xFF, 0xD8, 0x8C, 0}}},
-	/* 203 */
-	{"tyhotb16",
-	 {{0xCB, 0xC4, 0xBA, 0},
-	  {0xB8, 0xBB, 0x66, 0},
-	  {0xA7, 0x8A, 0x55, 0},
-	  {0x73, 0x61, 0x50, 0},
-	  {0x5E, 0x37, 0x43, 0},
-	  {0x94, 0x97, 0x71, 0},
-	  {0x68, 0x6F, 0x6F, 0},
-	  {0x82, 0x4F, 0x42, 0},
-	  {0x4E, 0x36, 0x23, 0},
-	  {0x2A, 0x27, 0x1E, 0},
-	  {0x77, 0x95, 0xB1, 0},
-	  {0x49, 0x7D, 0x63, 0},
-	  {0x42, 0x5A, 0x68, 0},
-	  {0x3E, 0x34, 0x3E, 0},
-	  {0x2D, 0x2C, 0x34, 0},
-	  {0x13, 0x0F, 0x0E, 0}}},
-	/* 204 */
-	{"tyrw16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x6C, 0x6B, 0x70, 0},
-	  {0x2A, 0x34, 0x31, 0},
-	  {0xF3, 0xAE, 0x76, 0},
-	  {0xD5, 0x6B, 0x3B, 0},
-	  {0x8D, 0x70, 0x24, 0},
-	  {0xBB, 0x29, 0x17, 0},
-	  {0x6D, 0x31, 0x3C, 0},
-	  {0x7B, 0xBD, 0xFF, 0},
-	  {0x40, 0xA0, 0x66, 0},
-	  {0x35, 0x67, 0x6D, 0},
-	  {0x3B, 0x53, 0x1D, 0},
-	  {0xF3, 0x76, 0x85, 0},
-	  {0xAC, 0x40, 0xCE, 0},
-	  {0x34, 0x37, 0x9D, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 205 */
-	{"ultimaviatarist",
-	 {{0xF0, 0xF0, 0xF0, 0},
-	  {0xC0, 0xA0, 0xA0, 0},
-	  {0x70, 0x60, 0x60, 0},
-	  {0x20, 0x20, 0x20, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x50, 0xF0, 0x50, 0},
-	  {0x00, 0xA0, 0x00, 0},
-	  {0x00, 0x60, 0x00, 0},
-	  {0x50, 0x90, 0xF0, 0},
-	  {0x00, 0x40, 0xD0, 0},
-	  {0x10, 0x10, 0x70, 0},
-	  {0xF0, 0xD0, 0x80, 0},
-	  {0xE0, 0x50, 0x00, 0},
-	  {0xD0, 0x00, 0x00, 0},
-	  {0x50, 0x40, 0x20, 0},
-	  {0xD0, 0x30, 0xD0, 0}}},
-	/* 206 */
-	{"mac16color",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xFC, 0xF3, 0x05, 0},
-	  {0xFF, 0x64, 0x02, 0},
-	  {0xDD, 0x08, 0x06, 0},
-	  {0xF2, 0x08, 0x84, 0},
-	  {0x46, 0x00, 0xA5, 0},
-	  {0x00, 0x00, 0xD4, 0},
-	  {0x02, 0xAB, 0xEA, 0},
-	  {0x1F, 0xB7, 0x14, 0},
-	  {0x00, 0x64, 0x11, 0},
-	  {0x56, 0x2C, 0x05, 0},
-	  {0x90, 0x71, 0x3A, 0},
-	  {0xC0, 0xC0, 0xC0, 0},
-	  {0x80, 0x80, 0x80, 0},
-	  {0x40, 0x40, 0x40, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 207 */
-	{"theperfectpalettepocket",
-	 {{0xFF, 0x97, 0xCE, 0},
-	  {0xF3, 0x23, 0x41, 0},
-	  {0x7E, 0x25, 0x50, 0},
-	  {0xFF, 0xD5, 0xA7, 0},
-	  {0xFB, 0x84, 0x04, 0},
-	  {0x94, 0x4E, 0x2B, 0},
-	  {0xFF, 0xEE, 0x68, 0},
-	  {0x50, 0xC5, 0x55, 0},
-	  {0x17, 0x80, 0x55, 0},
-	  {0x96, 0xFF, 0xFF, 0},
-	  {0x00, 0xAA, 0xFB, 0},
-	  {0x49, 0x42, 0x97, 0},
-	  {0xA7, 0x42, 0xEE, 0},
-	  {0x27, 0x27, 0x27, 0},
-	  {0x91, 0x91, 0x91, 0},
-	  {0xF9, 0xF9, 0xF9, 0}}},
-	/* 208 */
-	{"st16cmmdr",
-	 {{0x06, 0x06, 0x0D, 0},
-	  {0x3D, 0x3D, 0x40, 0},
-	  {0x6C, 0x6B, 0x70, 0},
-	  {0xAB, 0xA7, 0xB0, 0},
-	  {0xF6, 0xEB, 0xF7, 0},
-	  {0x80, 0x1D, 0x1A, 0},
-	  {0xD9, 0x71, 0x62, 0},
-	  {0x4D, 0x39, 0x04, 0},
-	  {0x99, 0x58, 0x1F, 0},
-	  {0xE5, 0xE5, 0x45, 0},
-	  {0x88, 0xD9, 0x41, 0},
-	  {0x1F, 0x99, 0x2F, 0},
-	  {0x67, 0xC8, 0xE5, 0},
-	  {0x82, 0x50, 0xE5, 0},
-	  {0x3F, 0x1F, 0x99, 0},
-	  {0x76, 0x38, 0x8C, 0}}},
-	/* 209 */
-	{"d10d6damage",
-	 {{0x00, 0x00, 0x0D, 0},
-	  {0x17, 0x21, 0x26, 0},
-	  {0x32, 0x40, 0x26, 0},
-	  {0x3E, 0x4E, 0x59, 0},
-	  {0x5C, 0x71, 0x73, 0},
-	  {0x46, 0x8C, 0x8B, 0},
-	  {0x76, 0xA6, 0x32, 0},
-	  {0x99, 0xBF, 0xBD, 0},
-	  {0xBB, 0xD9, 0xB8, 0},
-	  {0xF2, 0xF1, 0xDA, 0},
-	  {0x45, 0x00, 0x2A, 0},
-	  {0x5E, 0x3D, 0x17, 0},
-	  {0x91, 0x3A, 0x2C, 0},
-	  {0xAB, 0x74, 0x44, 0},
-	  {0xD4, 0xA8, 0x3F, 0},
-	  {0xED, 0xDF, 0x48, 0}}},
-	/* 210 */
-	{"possessionerpc98",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xBA, 0xBA, 0xBA, 0},
-	  {0xFE, 0xFE, 0xFE, 0},
-	  {0x89, 0x45, 0x23, 0},
-	  {0xCD, 0x67, 0x54, 0},
-	  {0xEF, 0x98, 0x89, 0},
-	  {0xFE, 0xBA, 0xAB, 0},
-	  {0x01, 0x32, 0x67, 0},
-	  {0x23, 0x76, 0x89, 0},
-	  {0x23, 0xAB, 0xBA, 0},
-	  {0x45, 0x76, 0x45, 0},
-	  {0x23, 0x98, 0x45, 0},
-	  {0x9C, 0xBA, 0x8C, 0},
-	  {0xFE, 0xCD, 0x01, 0},
-	  {0x73, 0x00, 0x31, 0},
-	  {0xEF, 0x01, 0x01, 0}}},
-	/* 211 */
-	{"colodorevic64",
-	 {{0x81, 0x33, 0x38, 0},
-	  {0xE9, 0xB2, 0x87, 0},
-	  {0xA1, 0x68, 0x3C, 0},
-	  {0x55, 0x38, 0x00, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x2E, 0x2C, 0x9B, 0},
-	  {0x70, 0x6D, 0xEB, 0},
-	  {0x6A, 0xBF, 0xC6, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xAD, 0xAD, 0xAD, 0},
-	  {0x7B, 0x7B, 0x7B, 0},
-	  {0x62, 0x62, 0x62, 0},
-	  {0x55, 0x9E, 0x4A, 0},
-	  {0x92, 0xDF, 0x87, 0},
-	  {0xED, 0xF1, 0x71, 0},
-	  {0xE9, 0x9D, 0xF5, 0}}},
-	/* 212 */
-	{"sunparent",
-	 {{0x90, 0x2E, 0x37, 0},
-	  {0xC3, 0x4D, 0x37, 0},
-	  {0xE2, 0x73, 0x30, 0},
-	  {0xEF, 0xA9, 0x55, 0},
-	  {0xF9, 0xDE, 0x88, 0},
-	  {0xF5, 0xF7, 0xC3, 0},
-	  {0x74, 0xE7, 0xDC, 0},
-	  {0x45, 0x8A, 0xD5, 0},
-	  {0x41, 0x53, 0x94, 0},
-	  {0x41, 0x34, 0x59, 0},
-	  {0x37, 0x2B, 0x45, 0},
-	  {0x4A, 0x48, 0x5A, 0},
-	  {0x5E, 0x7B, 0x5F, 0},
-	  {0xBF, 0xAA, 0x6C, 0},
-	  {0xD0, 0x9A, 0x76, 0},
-	  {0xCE, 0x8B, 0xBA, 0}}},
-	/* 213 */
-	{"mnp16",
-	 {{0x00, 0x00, 0x1A, 0},
-	  {0x00, 0x1F, 0x33, 0},
-	  {0x14, 0x4A, 0x57, 0},
-	  {0x47, 0x9B, 0xA3, 0},
-	  {0x72, 0xCC, 0xB3, 0},
-	  {0xA5, 0xF5, 0xCD, 0},
-	  {0xD5, 0xFA, 0xC2, 0},
-	  {0xFF, 0xFF, 0xD8, 0},
-	  {0xFF, 0xEB, 0x91, 0},
-	  {0xFF, 0xC1, 0x57, 0},
-	  {0xB9, 0x6B, 0x27, 0},
-	  {0x75, 0x22, 0x33, 0},
-	  {0xFF, 0xC2, 0xDA, 0},
-	  {0xFF, 0x99, 0xCE, 0},
-	  {0xFB, 0x6F, 0xB3, 0},
-	  {0xBF, 0x2F, 0xA2, 0}}},
-	/* 214 */
-	{"msvgapal",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x80, 0x00, 0x00, 0},
-	  {0x00, 0x80, 0x00, 0},
-	  {0x80, 0x80, 0x00, 0},
-	  {0x00, 0x00, 0x80, 0},
-	  {0x80, 0x00, 0x80, 0},
-	  {0x00, 0x80, 0x80, 0},
-	  {0xC0, 0xC0, 0xC0, 0},
-	  {0x80, 0x80, 0x80, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 215 */
-	{"vampire16",
-	 {{0x0E, 0x01, 0x16, 0},
-	  {0x34, 0x0A, 0x43, 0},
-	  {0x6D, 0x1A, 0x3D, 0},
-	  {0xCA, 0x28, 0x28, 0},
-	  {0xE9, 0x90, 0x39, 0},
-	  {0xF4, 0xE2, 0x7B, 0},
-	  {0x95, 0xC7, 0x4D, 0},
-	  {0x2C, 0x96, 0x39, 0},
-	  {0x0B, 0x4B, 0x3B, 0},
-	  {0x67, 0x39, 0xBC, 0},
-	  {0x7C, 0xA0, 0xF4, 0},
-	  {0xF8, 0xF7, 0xF2, 0},
-	  {0x9A, 0x82, 0x6B, 0},
-	  {0x4B, 0x29, 0x33, 0},
-	  {0x9D, 0x44, 0x2C, 0},
-	  {0xF8, 0xB9, 0x7F, 0}}},
-	/* 216 */
-	{"justaddwater16",
-	 {{0x17, 0x12, 0x24, 0},
-	  {0x5C, 0x35, 0x70, 0},
-	  {0xC7, 0x61, 0x9C, 0},
-	  {0xF7, 0x94, 0xB1, 0},
-	  {0x88, 0x37, 0x4C, 0},
-	  {0xD8, 0x5F, 0x6F, 0},
-	  {0xFF, 0x9C, 0x4D, 0},
-	  {0xED, 0xDB, 0x66, 0},
-	  {0x65, 0xC9, 0x6F, 0},
-	  {0x2D, 0x75, 0x56, 0},
-	  {0x21, 0x3C, 0x4A, 0},
-	  {0x47, 0x7D, 0xA8, 0},
-	  {0x75, 0xC0, 0xE3, 0},
-	  {0xB8, 0x84, 0x76, 0},
-	  {0xFF, 0xCB, 0xA3, 0},
-	  {0xF4, 0xF5, 0xF2, 0}}},
-	/* 217 */
-	{"thanksgivingmeal",
-	 {{0x15, 0x01, 0x02, 0},
-	  {0xEE, 0xEA, 0xE7, 0},
-	  {0x8D, 0x37, 0x26, 0},
-	  {0xAA, 0x41, 0x00, 0},
-	  {0xB3, 0x94, 0x7F, 0},
-	  {0xDA, 0x5A, 0x01, 0},
-	  {0xF2, 0x97, 0x0A, 0},
-	  {0xF9, 0xBF, 0x16, 0},
-	  {0x9F, 0xA0, 0x1E, 0},
-	  {0x4C, 0x54, 0x00, 0},
-	  {0x20, 0x29, 0x14, 0},
-	  {0x61, 0x63, 0x78, 0},
-	  {0x5B, 0x49, 0x5F, 0},
-	  {0x46, 0x44, 0x45, 0},
-	  {0xA7, 0x0F, 0x24, 0},
-	  {0xBF, 0x56, 0x5B, 0}}},
-	/* 218 */
-	{"ruzzihuntuu",
-	 {{0x11, 0x11, 0x25, 0},
-	  {0x52, 0x4B, 0x6D, 0},
-	  {0xB0, 0xC9, 0xC4, 0},
-	  {0xFF, 0xFC, 0xF1, 0},
-	  {0x24, 0x22, 0x72, 0},
-	  {0x34, 0x70, 0xBE, 0},
-	  {0x9F, 0x20, 0x62, 0},
-	  {0xFF, 0x5E, 0x39, 0},
-	  {0x96, 0x3A, 0xBF, 0},
-	  {0xFF, 0x69, 0xF6, 0},
-	  {0x2C, 0x7E, 0x4B, 0},
-	  {0xA0, 0xC3, 0x5F, 0},
-	  {0x43, 0x98, 0xC4, 0},
-	  {0x93, 0xFF, 0xE5, 0},
-	  {0xD2, 0x85, 0x37, 0},
-	  {0xFE, 0xF5, 0x6B, 0}}},
-	/* 219 */
-	{"griefwards",
-	 {{0xA6, 0x02, 0x41, 0},
-	  {0xFF, 0x62, 0x1A, 0},
-	  {0xCF, 0x8D, 0x00, 0},
-	  {0xE3, 0xD8, 0x00, 0},
-	  {0xEB, 0xDC, 0x9B, 0},
-	  {0x52, 0x3C, 0x40, 0},
-	  {0x9E, 0x67, 0x71, 0},
-	  {0xCF, 0xA7, 0xAD, 0},
-	  {0x58, 0x61, 0xA1, 0},
-	  {0x29, 0x00, 0x91, 0},
-	  {0x00, 0x4A, 0x54, 0},
-	  {0x00, 0xBA, 0x4E, 0},
-	  {0xF2, 0xEF, 0xEB, 0},
-	  {0x95, 0x9D, 0x9E, 0},
-	  {0x00, 0xC7, 0xB3, 0},
-	  {0x21, 0x26, 0x21, 0}}},
-	/* 220 */
-	{"darkautumn",
-	 {{0xD9, 0x54, 0x3D, 0},
-	  {0xCC, 0x2B, 0x36, 0},
-	  {0xBD, 0x17, 0x3C, 0},
-	  {0xAA, 0x00, 0x4A, 0},
-	  {0x8C, 0x00, 0x62, 0},
-	  {0x5E, 0x00, 0x5F, 0},
-	  {0x2D, 0x00, 0x45, 0},
-	  {0x0B, 0x01, 0x24, 0},
-	  {0x00, 0x2C, 0x60, 0},
-	  {0x00, 0x56, 0x78, 0},
-	  {0x00, 0x82, 0x75, 0},
-	  {0x00, 0x94, 0x5B, 0},
-	  {0x01, 0xAB, 0x3C, 0},
-	  {0x24, 0xC9, 0x27, 0},
-	  {0x70, 0xDE, 0x40, 0},
-	  {0xB6, 0xEB, 0x67, 0}}},
-	/* 221 */
-	{"ponpon16",
-	 {{0xE8, 0xA6, 0xA6, 0},
-	  {0xA5, 0x72, 0x5F, 0},
-	  {0x6B, 0x3B, 0x29, 0},
-	  {0x4A, 0x12, 0x12, 0},
-	  {0xB1, 0x2C, 0x1C, 0},
-	  {0xFC, 0x79, 0x28, 0},
-	  {0xFF, 0xF1, 0x8A, 0},
-	  {0x78, 0xBB, 0x31, 0},
-	  {0x3B, 0x97, 0x1E, 0},
-	  {0x0A, 0x4B, 0x2D, 0},
-	  {0x43, 0x7A, 0xA0, 0},
-	  {0x8B, 0xE6, 0xE4, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x86, 0x8B, 0x9C, 0},
-	  {0x41, 0x41, 0x56, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 222 */
-	{"tyfpc16",
-	 {{0xCB, 0xC4, 0xBA, 0},
-	  {0x72, 0xA5, 0xB1, 0},
-	  {0x2F, 0x45, 0x41, 0},
-	  {0xB6, 0xA1, 0x47, 0},
-	  {0x8B, 0x8D, 0x5A, 0},
-	  {0x5C, 0x6A, 0x53, 0},
-	  {0x4D, 0x3F, 0x46, 0},
-	  {0x26, 0x29, 0x21, 0},
-	  {0x47, 0xB6, 0x4B, 0},
-	  {0x2C, 0x7D, 0x5A, 0},
-	  {0x51, 0x5A, 0x22, 0},
-	  {0x4A, 0x41, 0x26, 0},
-	  {0xBF, 0x8D, 0x77, 0},
-	  {0xCB, 0x59, 0x3A, 0},
-	  {0x87, 0x5C, 0x30, 0},
-	  {0x70, 0x3A, 0x1A, 0}}},
-	/* 223 */
-	{"warmc64",
-	 {{0x20, 0x0D, 0x06, 0},
-	  {0x4C, 0x3B, 0x31, 0},
-	  {0x87, 0x6F, 0x5E, 0},
-	  {0xD4, 0xB1, 0x92, 0},
-	  {0xFF, 0xF5, 0xC1, 0},
-	  {0x8E, 0x31, 0x25, 0},
-	  {0xA2, 0x4F, 0x34, 0},
-	  {0x4D, 0x22, 0x12, 0},
-	  {0xA8, 0x6D, 0x3B, 0},
-	  {0xF6, 0xB0, 0x44, 0},
-	  {0x5E, 0x77, 0x3C, 0},
-	  {0xC2, 0xE0, 0x87, 0},
-	  {0x77, 0x85, 0x64, 0},
-	  {0x78, 0x53, 0x6E, 0},
-	  {0x5A, 0x32, 0x4A, 0},
-	  {0xAF, 0x48, 0x50, 0}}},
-	/* 224 */
-	{"piotrinvertiblepalette",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x00, 0x99, 0x00, 0},
-	  {0xFF, 0x66, 0xFF, 0},
-	  {0xFF, 0x99, 0x00, 0},
-	  {0x00, 0x66, 0xFF, 0},
-	  {0xCC, 0x66, 0x00, 0},
-	  {0x33, 0x99, 0xFF, 0},
-	  {0x66, 0x66, 0x66, 0},
-	  {0x99, 0x99, 0x99, 0}}},
-	/* 225 */
-	{"rgnb",
-	 {{0x7A, 0x02, 0x16, 0},
-	  {0xEA, 0x20, 0x20, 0},
-	  {0xFF, 0x7D, 0x60, 0},
-	  {0xFF, 0xCC, 0x8E, 0},
-	  {0x2A, 0x06, 0x54, 0},
-	  {0x49, 0x2D, 0xC6, 0},
-	  {0x59, 0x96, 0xFF, 0},
-	  {0x7C, 0xE4, 0xFF, 0},
-	  {0x08, 0x49, 0x20, 0},
-	  {0x16, 0xA0, 0x22, 0},
-	  {0x6C, 0xE5, 0x40, 0},
-	  {0xE1, 0xFF, 0x6D, 0},
-	  {0x0A, 0x06, 0x0F, 0},
-	  {0x5B, 0x4B, 0x56, 0},
-	  {0xC1, 0xB7, 0xAA, 0},
-	  {0xFF, 0xFC, 0xF4, 0}}},
-	/* 226 */
-	{"tyam16",
-	 {{0xE4, 0xC1, 0x83, 0},
-	  {0xBB, 0x8F, 0x6B, 0},
-	  {0xA7, 0x63, 0x4A, 0},
-	  {0x71, 0x51, 0x48, 0},
-	  {0x7A, 0x62, 0x60, 0},
-	  {0x5A, 0x42, 0x56, 0},
-	  {0x33, 0x33, 0x40, 0},
-	  {0x24, 0x22, 0x20, 0},
-	  {0xDE, 0xCE, 0xB4, 0},
-	  {0x9A, 0x93, 0xB7, 0},
-	  {0x63, 0x6A, 0x74, 0},
-	  {0x39, 0x49, 0x49, 0},
-	  {0x87, 0x85, 0x7C, 0},
-	  {0x73, 0x66, 0x3B, 0},
-	  {0x53, 0x4A, 0x3E, 0},
-	  {0x3E, 0x2B, 0x22, 0}}},
-	/* 227 */
-	{"vibrancy16",
-	 {{0x0F, 0x6C, 0x8A, 0},
-	  {0x20, 0xA4, 0xAC, 0},
-	  {0x4D, 0xD2, 0xBE, 0},
-	  {0x61, 0xDF, 0xB4, 0},
-	  {0xB8, 0xED, 0x8E, 0},
-	  {0xE0, 0xF3, 0x79, 0},
-	  {0xF9, 0xFE, 0x54, 0},
-	  {0xFD, 0xD7, 0x4B, 0},
-	  {0xFC, 0xAF, 0x38, 0},
-	  {0xF7, 0x7F, 0x00, 0},
-	  {0xE3, 0x52, 0x05, 0},
-	  {0xAD, 0x3B, 0x54, 0},
-	  {0x88, 0x22, 0x55, 0},
-	  {0x6A, 0x1C, 0x7B, 0},
-	  {0x45, 0x1F, 0x73, 0},
-	  {0x2C, 0x2A, 0x6D, 0}}},
-	/* 228 */
-	{"fourbit",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x96, 0x05, 0x03, 0},
-	  {0x2D, 0x66, 0x05, 0},
-	  {0xBE, 0x69, 0x08, 0},
-	  {0x04, 0x2D, 0x71, 0},
-	  {0x99, 0x33, 0x74, 0},
-	  {0x30, 0x90, 0x74, 0},
-	  {0xC0, 0x93, 0x77, 0},
-	  {0x4E, 0x80, 0x9C, 0},
-	  {0xDC, 0x81, 0x9C, 0},
-	  {0x76, 0xDC, 0x9E, 0},
-	  {0xFF, 0xDC, 0x9E, 0},
-	  {0x4F, 0xA5, 0xFF, 0},
-	  {0xDD, 0xA7, 0xFF, 0},
-	  {0x76, 0xFF, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 229 */
-	{"logdog",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xDB, 0xB6, 0},
-	  {0xDB, 0xB6, 0x49, 0},
-	  {0xDB, 0x92, 0xDB, 0},
-	  {0xDB, 0x92, 0x6D, 0},
-	  {0x6D, 0x92, 0xFF, 0},
-	  {0xB6, 0x92, 0x24, 0},
-	  {0x6D, 0x92, 0xB6, 0},
-	  {0xDB, 0x49, 0x6D, 0},
-	  {0xB6, 0x6D, 0x24, 0},
-	  {0x24, 0x92, 0x6D, 0},
-	  {0x92, 0x49, 0x24, 0},
-	  {0x49, 0x49, 0x92, 0},
-	  {0x24, 0x49, 0x49, 0},
-	  {0x49, 0x00, 0x00, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 230 */
-	{"vibrantdepths",
-	 {{0xC2, 0x2D, 0x4B, 0},
-	  {0xE4, 0x50, 0x42, 0},
-	  {0xE3, 0x5E, 0x3D, 0},
-	  {0xF0, 0x94, 0x69, 0},
-	  {0x17, 0x23, 0x3D, 0},
-	  {0x22, 0x41, 0x68, 0},
-	  {0x67, 0xB6, 0xD0, 0},
-	  {0x45, 0xB3, 0xBF, 0},
-	  {0x67, 0xDC, 0xF0, 0},
-	  {0x7A, 0xF0, 0xEE, 0},
-	  {0xBD, 0xEC, 0xE9, 0},
-	  {0x60, 0x98, 0x84, 0},
-	  {0x79, 0xBC, 0x92, 0},
-	  {0x65, 0xC7, 0xAB, 0},
-	  {0xAC, 0xE3, 0xC8, 0},
-	  {0x23, 0x98, 0x8E, 0}}},
-	/* 231 */
-	{"softcga",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x44, 0x44, 0x55, 0},
-	  {0x22, 0x00, 0x77, 0},
-	  {0x33, 0x22, 0xFF, 0},
-	  {0x66, 0x00, 0x33, 0},
-	  {0xFF, 0x00, 0x33, 0},
-	  {0x77, 0x00, 0x88, 0},
-	  {0xFF, 0x33, 0xDD, 0},
-	  {0x00, 0x77, 0x22, 0},
-	  {0x00, 0xFF, 0x33, 0},
-	  {0x22, 0x77, 0x88, 0},
-	  {0x22, 0xEE, 0xFF, 0},
-	  {0x99, 0x66, 0x00, 0},
-	  {0xFF, 0xEE, 0x33, 0},
-	  {0x77, 0x77, 0x99, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 232 */
-	{"tyogn16",
-	 {{0xAE, 0xC1, 0x9B, 0},
-	  {0x68, 0x96, 0xAC, 0},
-	  {0x63, 0x6A, 0x74, 0},
-	  {0x41, 0x43, 0x5A, 0},
-	  {0x19, 0x1B, 0x2A, 0},
-	  {0x9A, 0x93, 0xB7, 0},
-	  {0x7A, 0x62, 0x60, 0},
-	  {0x4E, 0x4D, 0x42, 0},
-	  {0x6D, 0x8D, 0x4E, 0},
-	  {0x41, 0x6A, 0x5D, 0},
-	  {0x35, 0x3E, 0x2D, 0},
-	  {0xDA, 0xB3, 0x4F, 0},
-	  {0xB1, 0x86, 0x52, 0},
-	  {0x85, 0x51, 0x39, 0},
-	  {0x6D, 0x37, 0x37, 0},
-	  {0x3A, 0x2E, 0x39, 0}}},
-	/* 233 */
-	{"taikonconsole16",
-	 {{0xC6, 0xCA, 0x96, 0},
-	  {0xDA, 0xA5, 0x49, 0},
-	  {0x7A, 0x62, 0x3C, 0},
-	  {0x45, 0x42, 0x36, 0},
-	  {0xAA, 0x7E, 0x6B, 0},
-	  {0xA5, 0x4A, 0x34, 0},
-	  {0x4A, 0x34, 0x34, 0},
-	  {0x20, 0x1B, 0x14, 0},
-	  {0x87, 0x9B, 0x42, 0},
-	  {0x39, 0x7A, 0x41, 0},
-	  {0x2C, 0x40, 0x3C, 0},
-	  {0x60, 0xA5, 0xAF, 0},
-	  {0x47, 0x7F, 0xA5, 0},
-	  {0x54, 0x52, 0x64, 0},
-	  {0x6E, 0x7F, 0x80, 0},
-	  {0x30, 0x30, 0x30, 0}}},
-	/* 234 */
-	{"berryshake",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x6A, 0xFF, 0xF8, 0},
-	  {0x57, 0xD8, 0xFF, 0},
-	  {0x2E, 0x2E, 0x49, 0},
-	  {0xF3, 0x4C, 0xFF, 0},
-	  {0xB2, 0x00, 0xFF, 0},
-	  {0x76, 0x00, 0xE5, 0},
-	  {0x53, 0x35, 0x5E, 0},
-	  {0xFF, 0x4A, 0x97, 0},
-	  {0xFF, 0x15, 0x6B, 0},
-	  {0xD9, 0x00, 0x70, 0},
-	  {0xA3, 0x00, 0x54, 0},
-	  {0xF0, 0xFF, 0x5C, 0},
-	  {0x62, 0xFF, 0x89, 0},
-	  {0x26, 0xDD, 0x7B, 0},
-	  {0x22, 0x7F, 0x5E, 0}}},
-	/* 235 */
-	{"pixelmasks",
-	 {{0x1F, 0xBF, 0x77, 0},
-	  {0x9F, 0xBF, 0x8F, 0},
-	  {0xDF, 0xC7, 0x87, 0},
-	  {0xFF, 0xFF, 0xBF, 0},
-	  {0x67, 0x27, 0x07, 0},
-	  {0xCF, 0x37, 0x07, 0},
-	  {0xFF, 0x77, 0x17, 0},
-	  {0xFF, 0xBF, 0x47, 0},
-	  {0x67, 0x67, 0x17, 0},
-	  {0x57, 0x8F, 0x27, 0},
-	  {0x77, 0xCF, 0x57, 0},
-	  {0xAF, 0xFF, 0x77, 0},
-	  {0xAF, 0x37, 0x57, 0},
-	  {0xDF, 0x57, 0x8F, 0},
-	  {0xFF, 0x8F, 0x8F, 0},
-	  {0xFF, 0xCF, 0x9F, 0}}},
-	/* 236 */
-	{"zeitgeist16",
-	 {{0x14, 0x10, 0x19, 0},
-	  {0x3D, 0x41, 0x4A, 0},
-	  {0x5D, 0x72, 0x7B, 0},
-	  {0xA6, 0xAD, 0xB3, 0},
-	  {0xF7, 0xF7, 0xEF, 0},
-	  {0xE0, 0x55, 0x69, 0},
-	  {0x5B, 0x31, 0x56, 0},
-	  {0x8F, 0x44, 0x38, 0},
-	  {0xDD, 0x84, 0x4B, 0},
-	  {0xEC, 0xB9, 0x84, 0},
-	  {0xE6, 0xE7, 0x59, 0},
-	  {0x62, 0xC4, 0x5A, 0},
-	  {0x2F, 0x71, 0x41, 0},
-	  {0x39, 0x3B, 0x8A, 0},
-	  {0x50, 0x80, 0xD6, 0},
-	  {0x7B, 0xCE, 0xE0, 0}}},
-	/* 237 */
-	{"happyakuharisen",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xB2, 0xE0, 0xCE, 0},
-	  {0xFA, 0xD7, 0xD7, 0},
-	  {0xD7, 0xFF, 0xC2, 0},
-	  {0xA3, 0xA3, 0x9E, 0},
-	  {0x84, 0xBD, 0xA4, 0},
-	  {0xB8, 0x8C, 0xA2, 0},
-	  {0x98, 0xB9, 0x74, 0},
-	  {0x52, 0x52, 0x52, 0},
-	  {0x4A, 0x80, 0x72, 0},
-	  {0x73, 0x45, 0x5D, 0},
-	  {0x61, 0x7A, 0x3E, 0},
-	  {0x14, 0x14, 0x14, 0},
-	  {0x17, 0x31, 0x3B, 0},
-	  {0x3B, 0x1E, 0x2C, 0},
-	  {0x26, 0x40, 0x0F, 0}}},
-	/* 238 */
-	{"croma16",
-	 {{0xB6, 0x57, 0x80, 0},
-	  {0xCD, 0x90, 0x9C, 0},
-	  {0xD1, 0xB3, 0xA2, 0},
-	  {0xF0, 0xF4, 0xC2, 0},
-	  {0xAA, 0xC4, 0x78, 0},
-	  {0x68, 0xA9, 0x61, 0},
-	  {0x3D, 0x80, 0x57, 0},
-	  {0x43, 0x9C, 0x6E, 0},
-	  {0x64, 0xB3, 0xA3, 0},
-	  {0x9B, 0xCF, 0xCB, 0},
-	  {0x67, 0x94, 0xAF, 0},
-	  {0x41, 0x63, 0xA0, 0},
-	  {0x30, 0x23, 0x3A, 0},
-	  {0x51, 0x4A, 0x73, 0},
-	  {0x7A, 0x72, 0xAC, 0},
-	  {0xD2, 0xAA, 0xDB, 0}}},
-	/* 239 */
-	{"super16",
-	 {{0x90, 0x20, 0x68, 0},
-	  {0xF8, 0x18, 0x68, 0},
-	  {0xFF, 0xA8, 0x80, 0},
-	  {0xFF, 0x70, 0x00, 0},
-	  {0xA8, 0x00, 0x10, 0},
-	  {0xFF, 0xA8, 0x00, 0},
-	  {0xFF, 0xFF, 0xA8, 0},
-	  {0xA8, 0xE0, 0x38, 0},
-	  {0x58, 0x00, 0xA8, 0},
-	  {0x68, 0x28, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xE0, 0xD0, 0xFF, 0},
-	  {0xA0, 0x70, 0xC8, 0},
-	  {0x68, 0x30, 0x90, 0},
-	  {0x48, 0x18, 0x68, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 240 */
-	{"tybs16",
-	 {{0xDF, 0xCD, 0xB7, 0},
-	  {0xC5, 0xA4, 0x7B, 0},
-	  {0x9A, 0x7D, 0x4A, 0},
-	  {0x98, 0x9F, 0x3F, 0},
-	  {0x63, 0x65, 0x4A, 0},
-	  {0x29, 0x40, 0x34, 0},
-	  {0x81, 0xA5, 0x98, 0},
-	  {0x45, 0x6B, 0x75, 0},
-	  {0x31, 0x30, 0x45, 0},
-	  {0xC5, 0x81, 0x32, 0},
-	  {0x85, 0x4B, 0x2F, 0},
-	  {0x50, 0x23, 0x17, 0},
-	  {0x9F, 0x57, 0x45, 0},
-	  {0x60, 0x41, 0x45, 0},
-	  {0x35, 0x2E, 0x32, 0},
-	  {0x25, 0x1D, 0x22, 0}}},
-	/* 241 */
-	{"cyberwav16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x79, 0xE4, 0xC9, 0},
-	  {0x00, 0xCC, 0x99, 0},
-	  {0x4C, 0xD4, 0x6B, 0},
-	  {0xC0, 0xE1, 0x25, 0},
-	  {0xFF, 0xE9, 0x00, 0},
-	  {0xFD, 0xC0, 0x0A, 0},
-	  {0xFA, 0x7D, 0x1B, 0},
-	  {0xF8, 0x39, 0x2C, 0},
-	  {0xF7, 0x17, 0x35, 0},
-	  {0xCD, 0x14, 0x34, 0},
-	  {0x84, 0x0F, 0x33, 0},
-	  {0x3C, 0x0B, 0x33, 0},
-	  {0x19, 0x09, 0x33, 0},
-	  {0x0B, 0x04, 0x17, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 242 */
-	{"minecraftia16",
-	 {{0xB0, 0x2E, 0x26, 0},
-	  {0xF9, 0x80, 0x1D, 0},
-	  {0xFE, 0xD8, 0x3D, 0},
-	  {0x80, 0xC7, 0x1F, 0},
-	  {0x5E, 0x7C, 0x16, 0},
-	  {0x16, 0x9C, 0x9C, 0},
-	  {0x3A, 0xB3, 0xDA, 0},
-	  {0x3C, 0x44, 0xAA, 0},
-	  {0x89, 0x32, 0xB8, 0},
-	  {0xC7, 0x4E, 0xBD, 0},
-	  {0xF3, 0x8B, 0xAA, 0},
-	  {0x83, 0x54, 0x32, 0},
-	  {0x1D, 0x1D, 0x21, 0},
-	  {0x47, 0x4F, 0x52, 0},
-	  {0x9D, 0x9D, 0x97, 0},
-	  {0xF9, 0xFF, 0xFE, 0}}},
-	/* 243 */
-	{"tyah16",
-	 {{0xE4, 0xD3, 0xD3, 0},
-	  {0x68, 0x7E, 0x82, 0},
-	  {0x5A, 0x4C, 0x49, 0},
-	  {0x20, 0x20, 0x20, 0},
-	  {0x76, 0xCF, 0xCF, 0},
-	  {0x4D, 0x74, 0x9A, 0},
-	  {0x3D, 0x2D, 0x4D, 0},
-	  {0x55, 0xAA, 0x65, 0},
-	  {0x46, 0x63, 0x2D, 0},
-	  {0x2C, 0x40, 0x3C, 0},
-	  {0x9F, 0x81, 0xC5, 0},
-	  {0xB5, 0x5E, 0x86, 0},
-	  {0x92, 0x32, 0x32, 0},
-	  {0xD5, 0x9A, 0x4A, 0},
-	  {0x9A, 0x56, 0x32, 0},
-	  {0x6A, 0x39, 0x33, 0}}},
-	/* 244 */
-	{"hastyrainbow",
-	 {{0x68, 0xC3, 0xF8, 0},
-	  {0x28, 0x51, 0xB8, 0},
-	  {0x78, 0x12, 0x78, 0},
-	  {0x31, 0x0B, 0x47, 0},
-	  {0x10, 0x10, 0x10, 0},
-	  {0x39, 0x44, 0x4F, 0},
-	  {0x8F, 0x8F, 0xA1, 0},
-	  {0xF0, 0xF0, 0xF0, 0},
-	  {0xEC, 0xEA, 0x9C, 0},
-	  {0x99, 0xE8, 0x59, 0},
-	  {0x18, 0xB4, 0x18, 0},
-	  {0x0E, 0x62, 0x43, 0},
-	  {0x6B, 0x3B, 0x1B, 0},
-	  {0xAA, 0x2D, 0x0E, 0},
-	  {0xEB, 0x76, 0x2D, 0},
-	  {0xCF, 0xB8, 0x20, 0}}},
-	/* 245 */
-	{"agcpalette",
-	 {{0xCB, 0xC6, 0xC0, 0},
-	  {0xBF, 0xCB, 0x69, 0},
-	  {0x61, 0xCB, 0xAC, 0},
-	  {0x4F, 0xBB, 0x64, 0},
-	  {0xCB, 0x80, 0xA3, 0},
-	  {0x8B, 0x8B, 0x8B, 0},
-	  {0x86, 0x76, 0x5D, 0},
-	  {0xB5, 0x4C, 0x66, 0},
-	  {0x5B, 0x75, 0x4F, 0},
-	  {0x4B, 0x6D, 0x6D, 0},
-	  {0x55, 0x55, 0xB8, 0},
-	  {0x5A, 0x52, 0x52, 0},
-	  {0x6B, 0x40, 0x64, 0},
-	  {0x4C, 0x37, 0x37, 0},
-	  {0x2D, 0x27, 0x3B, 0},
-	  {0x22, 0x0C, 0x22, 0}}},
-	/* 246 */
-	{"castleween",
-	 {{0x10, 0xE0, 0x95, 0},
-	  {0x7C, 0xFC, 0x9C, 0},
-	  {0xE7, 0x4A, 0xE8, 0},
-	  {0x97, 0x40, 0xC3, 0},
-	  {0x59, 0x38, 0xAE, 0},
-	  {0x46, 0x46, 0xF5, 0},
-	  {0x56, 0x94, 0xF0, 0},
-	  {0x98, 0xFC, 0xF8, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xFF, 0x8A, 0},
-	  {0xF6, 0xCB, 0x57, 0},
-	  {0xED, 0x6E, 0x6F, 0},
-	  {0xED, 0x32, 0x70, 0},
-	  {0xB0, 0x2A, 0x5F, 0},
-	  {0x33, 0x2D, 0x3F, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 247 */
-	{"intellivision",
-	 {{0x0C, 0x00, 0x05, 0},
-	  {0xA7, 0xA8, 0xA8, 0},
-	  {0xFF, 0xFC, 0xFF, 0},
-	  {0xFF, 0x3E, 0x00, 0},
-	  {0xFF, 0xA6, 0x00, 0},
-	  {0xFA, 0xEA, 0x27, 0},
-	  {0x00, 0x78, 0x0F, 0},
-	  {0x00, 0xA7, 0x20, 0},
-	  {0x6C, 0xCD, 0x30, 0},
-	  {0x00, 0x2D, 0xFF, 0},
-	  {0x5A, 0xCB, 0xFF, 0},
-	  {0xBD, 0x95, 0xFF, 0},
-	  {0xC8, 0x1A, 0x7D, 0},
-	  {0xFF, 0x32, 0x76, 0},
-	  {0x3C, 0x58, 0x00, 0},
-	  {0xC9, 0xD4, 0x64, 0}}},
-	/* 248 */
-	{"demg16",
-	 {{0xCD, 0xBE, 0xAC, 0},
-	  {0x7B, 0x7D, 0x6A, 0},
-	  {0x4E, 0x55, 0x4E, 0},
-	  {0x62, 0x7C, 0x80, 0},
-	  {0x41, 0x6A, 0x5D, 0},
-	  {0x3C, 0x3B, 0x4A, 0},
-	  {0x30, 0x2B, 0x25, 0},
-	  {0x08, 0x04, 0x00, 0},
-	  {0xC5, 0xA4, 0x6B, 0},
-	  {0x9F, 0x67, 0x3E, 0},
-	  {0x75, 0x51, 0x29, 0},
-	  {0x45, 0x2F, 0x29, 0},
-	  {0xBF, 0x8D, 0x77, 0},
-	  {0x7A, 0x5C, 0x54, 0},
-	  {0x8B, 0x48, 0x4A, 0},
-	  {0x6A, 0x34, 0x25, 0}}},
-	/* 249 */
-	{"messengerfromdarknightpc98",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x88, 0x22, 0x44, 0},
-	  {0xBB, 0x11, 0x66, 0},
-	  {0xEE, 0x33, 0x66, 0},
-	  {0xDD, 0x44, 0x55, 0},
-	  {0xFF, 0x88, 0x99, 0},
-	  {0xFF, 0xBB, 0xAA, 0},
-	  {0xFF, 0xDD, 0x88, 0},
-	  {0xFF, 0xDD, 0xBB, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xAA, 0xEE, 0x77, 0},
-	  {0x66, 0x99, 0x77, 0},
-	  {0xBB, 0xBB, 0xFF, 0},
-	  {0x77, 0x44, 0xFF, 0},
-	  {0x66, 0x44, 0x99, 0},
-	  {0x55, 0x22, 0x66, 0}}},
-	/* 250 */
-	{"ruzxspectrum",
-	 {{0x0F, 0x0B, 0x38, 0},
-	  {0x61, 0x6A, 0x82, 0},
-	  {0xAD, 0xB4, 0xB7, 0},
-	  {0xF9, 0xFF, 0xEC, 0},
-	  {0x28, 0x13, 0xA0, 0},
-	  {0x4A, 0x6B, 0xFF, 0},
-	  {0xA0, 0x23, 0x11, 0},
-	  {0xED, 0x17, 0x5F, 0},
-	  {0x73, 0x10, 0x93, 0},
-	  {0xEE, 0x14, 0xB5, 0},
-	  {0x27, 0x8B, 0x61, 0},
-	  {0x9D, 0xFF, 0x26, 0},
-	  {0x1B, 0x69, 0xA7, 0},
-	  {0x47, 0xE9, 0xDF, 0},
-	  {0x7A, 0x57, 0x16, 0},
-	  {0xF7, 0xE5, 0x4D, 0}}},
-	/* 251 */
-	{"lobotomy16",
-	 {{0x78, 0x00, 0x0B, 0},
-	  {0xD2, 0x06, 0x1B, 0},
-	  {0xFC, 0x3A, 0x3A, 0},
-	  {0xFE, 0x8A, 0x76, 0},
-	  {0xBE, 0x9C, 0x83, 0},
-	  {0xD7, 0xC1, 0x8E, 0},
-	  {0xEF, 0xEC, 0xC0, 0},
-	  {0xE9, 0xE9, 0xE9, 0},
-	  {0x16, 0x16, 0x16, 0},
-	  {0x4E, 0x43, 0x61, 0},
-	  {0xA5, 0x62, 0xAF, 0},
-	  {0xC8, 0x73, 0xC6, 0},
-	  {0x00, 0x61, 0xC1, 0},
-	  {0x00, 0x98, 0xC4, 0},
-	  {0x00, 0xEA, 0xDB, 0},
-	  {0x6C, 0xFF, 0xB3, 0}}},
-	/* 252 */
-	{"minecraftwool",
-	 {{0xE9, 0xEC, 0xEC, 0},
-	  {0x8E, 0x8E, 0x86, 0},
-	  {0xF0, 0x76, 0x13, 0},
-	  {0x15, 0x89, 0x91, 0},
-	  {0xBD, 0x44, 0xB3, 0},
-	  {0x79, 0x2A, 0xAC, 0},
-	  {0x3A, 0xAF, 0xD9, 0},
-	  {0x35, 0x39, 0x9D, 0},
-	  {0xF8, 0xC5, 0x27, 0},
-	  {0x72, 0x47, 0x28, 0},
-	  {0x70, 0xB9, 0x19, 0},
-	  {0x54, 0x6D, 0x1B, 0},
-	  {0xED, 0x8D, 0xAC, 0},
-	  {0xA0, 0x27, 0x22, 0},
-	  {0x3E, 0x44, 0x47, 0},
-	  {0x14, 0x15, 0x19, 0}}},
-	/* 253 */
-	{"supercassettevision",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xFF, 0xA1, 0x00, 0},
-	  {0xFF, 0xA0, 0x9F, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xA3, 0xA0, 0x00, 0},
-	  {0x00, 0xA1, 0x00, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0xA0, 0xFF, 0x9D, 0},
-	  {0x00, 0x00, 0x9B, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0xA2, 0x00, 0xFF, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0xA2, 0xA1, 0x9F, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 254 */
-	{"place",
-	 {{0xFF, 0x45, 0x00, 0},
-	  {0xFF, 0xA8, 0x00, 0},
-	  {0xFF, 0xD6, 0x35, 0},
-	  {0x00, 0xA3, 0x68, 0},
-	  {0x7E, 0xED, 0x56, 0},
-	  {0x24, 0x50, 0xA4, 0},
-	  {0x36, 0x90, 0xEA, 0},
-	  {0x51, 0xE9, 0xF4, 0},
-	  {0x81, 0x1E, 0x9F, 0},
-	  {0xB4, 0x4A, 0xC0, 0},
-	  {0xFF, 0x99, 0xAA, 0},
-	  {0x9C, 0x69, 0x26, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x89, 0x8D, 0x90, 0},
-	  {0xD4, 0xD7, 0xD9, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 255 */
-	{"tyak16",
-	 {{0xDE, 0xCE, 0xB4, 0},
-	  {0xBF, 0xAF, 0x81, 0},
-	  {0x7B, 0x75, 0x62, 0},
-	  {0xBD, 0x99, 0x7B, 0},
-	  {0xA7, 0x81, 0x3A, 0},
-	  {0x5A, 0x63, 0x3F, 0},
-	  {0x2D, 0x49, 0x38, 0},
-	  {0x87, 0x52, 0x39, 0},
-	  {0x5E, 0x37, 0x43, 0},
-	  {0x41, 0x30, 0x18, 0},
-	  {0x34, 0x1F, 0x1D, 0},
-	  {0x8A, 0xB1, 0xAB, 0},
-	  {0x4D, 0x5D, 0x5E, 0},
-	  {0x4D, 0x43, 0x4E, 0},
-	  {0x30, 0x30, 0x39, 0},
-	  {0x1A, 0x19, 0x19, 0}}},
-	/* 256 */
-	{"rayleighpalette",
-	 {{0x05, 0x05, 0x06, 0},
-	  {0x19, 0x27, 0x39, 0},
-	  {0x55, 0x18, 0x23, 0},
-	  {0x24, 0x4C, 0x07, 0},
-	  {0x88, 0x51, 0x35, 0},
-	  {0x45, 0x45, 0x4C, 0},
-	  {0x90, 0x8F, 0x88, 0},
-	  {0xFF, 0xFB, 0xE8, 0},
-	  {0xB6, 0x0A, 0x04, 0},
-	  {0xFF, 0x6E, 0x11, 0},
-	  {0xFF, 0xEC, 0x62, 0},
-	  {0x7A, 0xA1, 0x43, 0},
-	  {0x8B, 0xB6, 0xD2, 0},
-	  {0x5A, 0x45, 0xB4, 0},
-	  {0xF0, 0x63, 0x91, 0},
-	  {0xF4, 0xBE, 0x8B, 0}}},
-	/* 257 */
-	{"thebtlofcol",
-	 {{0x5B, 0x2B, 0x2B, 0},
-	  {0x98, 0x4A, 0x49, 0},
-	  {0xC5, 0x93, 0x92, 0},
-	  {0xF3, 0xDC, 0xDC, 0},
-	  {0x2C, 0x49, 0x5B, 0},
-	  {0x49, 0x7A, 0x98, 0},
-	  {0x92, 0xB1, 0xC5, 0},
-	  {0xDC, 0xE9, 0xF3, 0},
-	  {0x92, 0x5F, 0x3D, 0},
-	  {0x7D, 0x83, 0x5C, 0},
-	  {0xC9, 0x93, 0x50, 0},
-	  {0xCF, 0xBD, 0x5E, 0},
-	  {0x1E, 0x1A, 0x1E, 0},
-	  {0x43, 0x3A, 0x43, 0},
-	  {0x71, 0x62, 0x71, 0},
-	  {0xAC, 0xA2, 0xAC, 0}}},
-	/* 258 */
-	{"naturalcoloursystem16",
-	 {{0x1C, 0x10, 0x1C, 0},
-	  {0x4A, 0x39, 0x15, 0},
-	  {0x88, 0x88, 0x64, 0},
-	  {0xDC, 0xDC, 0xC9, 0},
-	  {0xFF, 0xFF, 0xEE, 0},
-	  {0xFF, 0xED, 0x7E, 0},
-	  {0xF0, 0xDC, 0x3E, 0},
-	  {0xF2, 0xA7, 0x5D, 0},
-	  {0xB6, 0x5C, 0x36, 0},
-	  {0xAC, 0x19, 0x00, 0},
-	  {0x6B, 0x00, 0x00, 0},
-	  {0x02, 0x27, 0x16, 0},
-	  {0x00, 0x53, 0x65, 0},
-	  {0x00, 0x77, 0x66, 0},
-	  {0x70, 0xA6, 0x15, 0},
-	  {0x6B, 0xB5, 0xA4, 0}}},
-	/* 259 */
-	{"bounce16",
-	 {{0xEC, 0xE0, 0xD3, 0},
-	  {0xA6, 0xAF, 0xB7, 0},
-	  {0x93, 0x7C, 0x65, 0},
-	  {0x62, 0x5C, 0x5A, 0},
-	  {0x37, 0x1B, 0x1B, 0},
-	  {0x71, 0x37, 0x25, 0},
-	  {0xB7, 0x3A, 0x2F, 0},
-	  {0xE1, 0x7E, 0x39, 0},
-	  {0xF2, 0xC2, 0x37, 0},
-	  {0x6C, 0xA2, 0x39, 0},
-	  {0x36, 0x75, 0x3D, 0},
-	  {0x3B, 0x4C, 0xA8, 0},
-	  {0x5F, 0x91, 0xC1, 0},
-	  {0x6B, 0xC7, 0xAB, 0},
-	  {0xD0, 0x58, 0x9F, 0},
-	  {0x8D, 0x55, 0xAE, 0}}},
-	/* 260 */
-	{"tydd16",
-	 {{0xAF, 0xC0, 0x44, 0},
-	  {0x5A, 0x6D, 0x1E, 0},
-	  {0x50, 0x3C, 0x18, 0},
-	  {0x39, 0x1D, 0x22, 0},
-	  {0x0E, 0x10, 0x2D, 0},
-	  {0xEA, 0xD5, 0xAA, 0},
-	  {0xB8, 0xC1, 0x85, 0},
-	  {0x97, 0x92, 0x56, 0},
-	  {0x87, 0x67, 0x59, 0},
-	  {0xC2, 0x7E, 0x31, 0},
-	  {0x82, 0x43, 0x16, 0},
-	  {0x27, 0x2A, 0x13, 0},
-	  {0x59, 0x87, 0x6F, 0},
-	  {0x16, 0x60, 0x82, 0},
-	  {0x2E, 0x38, 0x49, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 261 */
-	{"bprd16",
-	 {{0x14, 0x0C, 0x00, 0},
-	  {0x69, 0x08, 0x04, 0},
-	  {0xDE, 0x2C, 0x2C, 0},
-	  {0xFA, 0x55, 0x55, 0},
-	  {0x38, 0x24, 0x00, 0},
-	  {0xA1, 0x85, 0x8D, 0},
-	  {0xD0, 0xB2, 0xBA, 0},
-	  {0xFA, 0xCA, 0xCA, 0},
-	  {0x00, 0x20, 0x00, 0},
-	  {0x40, 0x55, 0x44, 0},
-	  {0x61, 0x75, 0x61, 0},
-	  {0x99, 0xB2, 0x95, 0},
-	  {0x0C, 0x30, 0x44, 0},
-	  {0x55, 0x6D, 0x89, 0},
-	  {0x75, 0x95, 0xB6, 0},
-	  {0xDE, 0xEE, 0xFF, 0}}},
-	/* 262 */
-	{"astro16v2",
-	 {{0x15, 0x15, 0x15, 0},
-	  {0x66, 0x66, 0x66, 0},
-	  {0xBB, 0xBB, 0xBB, 0},
-	  {0xEE, 0xEE, 0xEE, 0},
-	  {0xA3, 0x4C, 0x4C, 0},
-	  {0xC7, 0x6C, 0x6C, 0},
-	  {0xBE, 0x96, 0x6B, 0},
-	  {0xE2, 0xC6, 0x8A, 0},
-	  {0x50, 0x69, 0x42, 0},
-	  {0x6D, 0x97, 0x6C, 0},
-	  {0x5E, 0x7D, 0x9D, 0},
-	  {0x92, 0xB5, 0xD9, 0},
-	  {0x53, 0x4C, 0x3F, 0},
-	  {0xA6, 0x9D, 0x8C, 0},
-	  {0xD1, 0xC7, 0xB2, 0},
-	  {0x6D, 0x5F, 0x7F, 0}}},
-	/* 263 */
-	{"rainbow",
-	 {{0x21, 0x20, 0x33, 0},
-	  {0x25, 0x40, 0x92, 0},
-	  {0x38, 0x96, 0xD4, 0},
-	  {0xBF, 0xFF, 0xEE, 0},
-	  {0x26, 0xD0, 0x7E, 0},
-	  {0x06, 0x69, 0x4A, 0},
-	  {0x00, 0x52, 0x44, 0},
-	  {0x0D, 0x00, 0x24, 0},
-	  {0x4E, 0x1F, 0x85, 0},
-	  {0xB6, 0x44, 0xBD, 0},
-	  {0xD6, 0x61, 0x9A, 0},
-	  {0xF0, 0x9A, 0xB4, 0},
-	  {0xE5, 0xB5, 0x27, 0},
-	  {0xD4, 0x80, 0x22, 0},
-	  {0xBF, 0x30, 0x11, 0},
-	  {0x69, 0x12, 0x2D, 0}}},
-	/* 264 */
-	{"bbly44",
-	 {{0x45, 0x11, 0x65, 0},
-	  {0x93, 0x2B, 0x8D, 0},
-	  {0xD3, 0x5B, 0x97, 0},
-	  {0xE3, 0xA3, 0xB4, 0},
-	  {0x5C, 0x25, 0x11, 0},
-	  {0xBD, 0x77, 0x3C, 0},
-	  {0xDF, 0xBC, 0x69, 0},
-	  {0xF2, 0xEB, 0xC7, 0},
-	  {0x08, 0x39, 0x48, 0},
-	  {0x12, 0x74, 0x68, 0},
-	  {0x51, 0xB2, 0x8E, 0},
-	  {0x94, 0xDF, 0xAF, 0},
-	  {0x0E, 0x06, 0x31, 0},
-	  {0x21, 0x28, 0x7E, 0},
-	  {0x50, 0x76, 0xB9, 0},
-	  {0x8A, 0xCD, 0xDE, 0}}},
-	/* 265 */
-	{"yeoldepiratemodde",
-	 {{0xFC, 0xFC, 0xFC, 0},
-	  {0xA4, 0xA4, 0xA4, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x24, 0x30, 0x3C, 0},
-	  {0x55, 0x49, 0x3C, 0},
-	  {0xB6, 0x79, 0x14, 0},
-	  {0xEB, 0x92, 0x3C, 0},
-	  {0xF3, 0xE3, 0x75, 0},
-	  {0xA6, 0xCF, 0x34, 0},
-	  {0x55, 0x92, 0x24, 0},
-	  {0x24, 0x38, 0xEB, 0},
-	  {0x3C, 0xA6, 0xF3, 0},
-	  {0xB2, 0xDB, 0xEB, 0},
-	  {0xDB, 0x79, 0x96, 0},
-	  {0xB8, 0x30, 0x44, 0},
-	  {0xA8, 0x0C, 0x0C, 0}}},
-	/* 266 */
-	{"trklosat16",
-	 {{0x2A, 0x3A, 0x35, 0},
-	  {0x43, 0x5F, 0x55, 0},
-	  {0x64, 0x89, 0x75, 0},
-	  {0x9E, 0xBC, 0xAC, 0},
-	  {0x23, 0x2E, 0x39, 0},
-	  {0x4A, 0x63, 0x69, 0},
-	  {0x66, 0x96, 0x99, 0},
-	  {0xA4, 0xC1, 0xC1, 0},
-	  {0x1C, 0x1D, 0x2E, 0},
-	  {0x56, 0x47, 0x68, 0},
-	  {0xAA, 0x82, 0xAB, 0},
-	  {0xC8, 0xC1, 0xCC, 0},
-	  {0x43, 0x06, 0x09, 0},
-	  {0xA2, 0x15, 0x17, 0},
-	  {0xF8, 0x57, 0x29, 0},
-	  {0xFF, 0xB9, 0x38, 0}}},
-	/* 267 */
-	{"hongbao16",
-	 {{0xF1, 0xD1, 0xAF, 0},
-	  {0xE1, 0xAD, 0x85, 0},
-	  {0xCB, 0x89, 0x6E, 0},
-	  {0xAC, 0x5C, 0x50, 0},
-	  {0x66, 0x2E, 0x17, 0},
-	  {0x97, 0x4C, 0x08, 0},
-	  {0xB7, 0x6F, 0x0F, 0},
-	  {0xD6, 0x96, 0x16, 0},
-	  {0xEE, 0xC9, 0x45, 0},
-	  {0xFF, 0xF1, 0xD5, 0},
-	  {0xFF, 0x93, 0x98, 0},
-	  {0xE9, 0x40, 0x49, 0},
-	  {0xB4, 0x0E, 0x12, 0},
-	  {0x71, 0x03, 0x02, 0},
-	  {0x45, 0x01, 0x04, 0},
-	  {0x13, 0x07, 0x09, 0}}},
-	/* 268 */
-	{"summerzebreeze",
-	 {{0x71, 0x66, 0x70, 0},
-	  {0xA3, 0x85, 0x8C, 0},
-	  {0xFF, 0xCA, 0xC8, 0},
-	  {0xF7, 0xBA, 0x76, 0},
-	  {0xB3, 0x82, 0x60, 0},
-	  {0x73, 0x4E, 0x49, 0},
-	  {0x37, 0x1F, 0x32, 0},
-	  {0x40, 0x47, 0x55, 0},
-	  {0x4A, 0x6F, 0x79, 0},
-	  {0x54, 0x97, 0x9D, 0},
-	  {0x71, 0xBE, 0xBD, 0},
-	  {0x9F, 0xE3, 0xD8, 0},
-	  {0xFF, 0xFF, 0xE0, 0},
-	  {0xA7, 0xD7, 0x8F, 0},
-	  {0x58, 0x8F, 0x6C, 0},
-	  {0x0A, 0x40, 0x2D, 0}}},
-	/* 269 */
-	{"deepfor16",
-	 {{0xF5, 0xF5, 0xD9, 0},
-	  {0xD9, 0xC6, 0x8D, 0},
-	  {0x5F, 0xBA, 0x51, 0},
-	  {0x2D, 0x7F, 0x55, 0},
-	  {0x23, 0x4D, 0x4C, 0},
-	  {0x1B, 0x2A, 0x39, 0},
-	  {0x46, 0x4D, 0x51, 0},
-	  {0x80, 0x8E, 0x8C, 0},
-	  {0x37, 0x4E, 0xB0, 0},
-	  {0x31, 0x26, 0x61, 0},
-	  {0x90, 0x27, 0x27, 0},
-	  {0xC2, 0x73, 0x43, 0},
-	  {0x86, 0x4A, 0x3C, 0},
-	  {0x4D, 0x2E, 0x30, 0},
-	  {0x26, 0x1C, 0x23, 0},
-	  {0x0D, 0x08, 0x14, 0}}},
-	/* 270 */
-	{"halloween",
-	 {{0x5A, 0x0F, 0x0F, 0},
-	  {0x7E, 0x31, 0x0F, 0},
-	  {0xA3, 0x48, 0x00, 0},
-	  {0xBD, 0x6D, 0x14, 0},
-	  {0xFF, 0x09, 0x09, 0},
-	  {0xFF, 0x62, 0x1C, 0},
-	  {0xFF, 0xB7, 0x29, 0},
-	  {0xFF, 0xE0, 0x40, 0},
-	  {0x38, 0x0F, 0x5A, 0},
-	  {0x42, 0x0F, 0x7E, 0},
-	  {0x51, 0x00, 0xA3, 0},
-	  {0x6A, 0x18, 0xBD, 0},
-	  {0x02, 0x85, 0x00, 0},
-	  {0x1A, 0x9A, 0x4B, 0},
-	  {0x46, 0xCA, 0x90, 0},
-	  {0x90, 0xF0, 0xFF, 0}}},
-	/* 271 */
-	{"retroctrlr",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x9F, 0xA0, 0xBA, 0},
-	  {0x4B, 0x4D, 0x70, 0},
-	  {0x15, 0x15, 0x1B, 0},
-	  {0xE2, 0x44, 0x6C, 0},
-	  {0x9E, 0x1E, 0x40, 0},
-	  {0x69, 0x07, 0x21, 0},
-	  {0x40, 0x60, 0xCD, 0},
-	  {0x1B, 0x36, 0x94, 0},
-	  {0x1C, 0x08, 0x69, 0},
-	  {0x6D, 0xE4, 0x62, 0},
-	  {0x3B, 0x96, 0x33, 0},
-	  {0x0C, 0x56, 0x06, 0},
-	  {0xF9, 0xE6, 0x9D, 0},
-	  {0xFF, 0xC9, 0x0A, 0},
-	  {0x94, 0x77, 0x0D, 0}}},
-	/* 272 */
-	{"tymp16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xDF, 0xDF, 0xC3, 0},
-	  {0xB3, 0xB3, 0x72, 0},
-	  {0xA7, 0x98, 0x67, 0},
-	  {0xB3, 0x72, 0x72, 0},
-	  {0x8A, 0x72, 0x72, 0},
-	  {0x72, 0xB3, 0x89, 0},
-	  {0x4F, 0x9C, 0x5D, 0},
-	  {0x6B, 0x7D, 0x6B, 0},
-	  {0xDF, 0xC3, 0xC3, 0},
-	  {0xB3, 0x72, 0xB3, 0},
-	  {0x8A, 0x69, 0xA5, 0},
-	  {0x72, 0xB3, 0xB3, 0},
-	  {0x72, 0x72, 0xB3, 0},
-	  {0x72, 0x72, 0x84, 0},
-	  {0x52, 0x52, 0x52, 0}}},
-	/* 273 */
-	{"illuminate",
-	 {{0x00, 0x00, 0x29, 0},
-	  {0x47, 0x43, 0x78, 0},
-	  {0x86, 0x9D, 0xB5, 0},
-	  {0xDC, 0xE6, 0xE8, 0},
-	  {0xC7, 0x24, 0x12, 0},
-	  {0x66, 0x24, 0x0C, 0},
-	  {0xBD, 0x59, 0x11, 0},
-	  {0xDE, 0x90, 0x42, 0},
-	  {0xB4, 0xC4, 0x06, 0},
-	  {0x3E, 0x63, 0x02, 0},
-	  {0x00, 0xC9, 0x0D, 0},
-	  {0x2C, 0xDB, 0xAD, 0},
-	  {0x00, 0x99, 0xB8, 0},
-	  {0x01, 0x01, 0x6B, 0},
-	  {0x8E, 0x0A, 0xC7, 0},
-	  {0xEB, 0x6A, 0xD1, 0}}},
-	/* 274 */
-	{"transit",
-	 {{0x0C, 0x03, 0x08, 0},
-	  {0x34, 0x16, 0x0B, 0},
-	  {0x61, 0x2F, 0x0E, 0},
-	  {0xD8, 0x2B, 0x00, 0},
-	  {0xFC, 0x6C, 0x00, 0},
-	  {0xFC, 0xD8, 0x00, 0},
-	  {0xFF, 0xE4, 0xAE, 0},
-	  {0xF5, 0x95, 0x62, 0},
-	  {0x84, 0x67, 0x36, 0},
-	  {0x11, 0x19, 0x1E, 0},
-	  {0x2A, 0x2C, 0x49, 0},
-	  {0x47, 0x4F, 0xA2, 0},
-	  {0x5F, 0x9A, 0x77, 0},
-	  {0xB4, 0xD8, 0x00, 0},
-	  {0xF7, 0xFF, 0xFF, 0},
-	  {0xBF, 0xC1, 0xC9, 0}}},
-	/* 275 */
-	{"wilson16",
-	 {{0x11, 0x02, 0x09, 0},
-	  {0x3D, 0x48, 0x5A, 0},
-	  {0x58, 0x4F, 0x28, 0},
-	  {0x8A, 0x95, 0x99, 0},
-	  {0x8F, 0x7B, 0x74, 0},
-	  {0xDC, 0xD1, 0x75, 0},
-	  {0xF0, 0xF5, 0xCD, 0},
-	  {0xF3, 0xF3, 0xEB, 0},
-	  {0x42, 0x19, 0x15, 0},
-	  {0xA8, 0x58, 0x4F, 0},
-	  {0xB4, 0x81, 0x56, 0},
-	  {0xC9, 0xA8, 0x65, 0},
-	  {0x3C, 0x24, 0x18, 0},
-	  {0x49, 0x34, 0x21, 0},
-	  {0x6B, 0x54, 0x34, 0},
-	  {0x7E, 0x66, 0x3A, 0}}},
-	/* 276 */
-	{"campbell",
-	 {{0x0C, 0x0C, 0x0C, 0},
-	  {0x00, 0x37, 0xDA, 0},
-	  {0x13, 0xA1, 0x0E, 0},
-	  {0x3A, 0x96, 0xDD, 0},
-	  {0xC5, 0x0F, 0x1F, 0},
-	  {0x88, 0x17, 0x98, 0},
-	  {0xC1, 0x9C, 0x00, 0},
-	  {0xCC, 0xCC, 0xCC, 0},
-	  {0x76, 0x76, 0x76, 0},
-	  {0x3B, 0x78, 0xFF, 0},
-	  {0x16, 0xC6, 0x0C, 0},
-	  {0x61, 0xD6, 0xD6, 0},
-	  {0xE7, 0x48, 0x56, 0},
-	  {0xB4, 0x00, 0x9E, 0},
-	  {0xF9, 0xF1, 0xA5, 0},
-	  {0xF2, 0xF2, 0xF2, 0}}},
-	/* 277 */
-	{"dotpictdefault",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x7E, 0x7E, 0x7E, 0},
-	  {0xC0, 0xC0, 0xC0, 0},
-	  {0x69, 0x2F, 0x36, 0},
-	  {0xFF, 0x2E, 0x35, 0},
-	  {0xFF, 0x93, 0x1F, 0},
-	  {0x1B, 0xB7, 0x49, 0},
-	  {0xC6, 0xE6, 0x1F, 0},
-	  {0xFF, 0xF2, 0x00, 0},
-	  {0x49, 0x4F, 0xA8, 0},
-	  {0x01, 0xA8, 0xFF, 0},
-	  {0x5B, 0xE1, 0xFF, 0},
-	  {0xB0, 0x68, 0x90, 0},
-	  {0xFF, 0xA0, 0xA8, 0},
-	  {0xFF, 0xE8, 0xD8, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 278 */
-	{"kule",
-	 {{0x29, 0x14, 0x0D, 0},
-	  {0x75, 0x33, 0x55, 0},
-	  {0xAE, 0x5F, 0x50, 0},
-	  {0xE5, 0x69, 0x4E, 0},
-	  {0xE9, 0x8E, 0x70, 0},
-	  {0xFF, 0x9F, 0x2B, 0},
-	  {0xFF, 0xB9, 0x86, 0},
-	  {0xFF, 0xCD, 0x2C, 0},
-	  {0xF2, 0xF1, 0xD5, 0},
-	  {0x7C, 0xE3, 0xFC, 0},
-	  {0x38, 0xD9, 0x89, 0},
-	  {0x3E, 0xA1, 0xD8, 0},
-	  {0x65, 0x62, 0xBD, 0},
-	  {0xC6, 0x77, 0xEA, 0},
-	  {0xF8, 0xA7, 0xD4, 0},
-	  {0xB0, 0x9C, 0xB8, 0}}},
-	/* 279 */
-	{"spectral16",
-	 {{0x02, 0x02, 0x02, 0},
-	  {0x92, 0x92, 0x9A, 0},
-	  {0xFA, 0xFA, 0xFA, 0},
-	  {0xFF, 0xC9, 0x7F, 0},
-	  {0xFF, 0x5F, 0xB4, 0},
-	  {0xFF, 0x14, 0x14, 0},
-	  {0xB9, 0x00, 0x59, 0},
-	  {0xBB, 0x5D, 0x00, 0},
-	  {0xFF, 0x9A, 0x00, 0},
-	  {0xFF, 0xE3, 0x02, 0},
-	  {0x0A, 0xD2, 0x00, 0},
-	  {0x00, 0x9D, 0xAE, 0},
-	  {0x11, 0xD6, 0xFF, 0},
-	  {0x00, 0x54, 0xFF, 0},
-	  {0x3F, 0x00, 0xB8, 0},
-	  {0xA0, 0x00, 0xFF, 0}}},
-	/* 280 */
-	{"rgbiimproved",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xAF, 0x00, 0x00, 0},
-	  {0xCE, 0x5E, 0x13, 0},
-	  {0x32, 0x69, 0x10, 0},
-	  {0x00, 0x81, 0xDD, 0},
-	  {0x00, 0x02, 0x93, 0},
-	  {0xE9, 0x25, 0x8B, 0},
-	  {0xB1, 0xB1, 0xB1, 0},
-	  {0x59, 0x59, 0x59, 0},
-	  {0xFF, 0x9D, 0x00, 0},
-	  {0xFF, 0xDF, 0x52, 0},
-	  {0x8A, 0xD1, 0x18, 0},
-	  {0x53, 0xE4, 0xF7, 0},
-	  {0x98, 0x1C, 0xE0, 0},
-	  {0xFF, 0x74, 0xC5, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 281 */
-	{"solarstars",
-	 {{0xEA, 0xE6, 0xF2, 0},
-	  {0xFF, 0xE0, 0x85, 0},
-	  {0xCC, 0xC1, 0x7A, 0},
-	  {0xBF, 0x4C, 0x63, 0},
-	  {0xA3, 0x49, 0x81, 0},
-	  {0x52, 0x31, 0x2A, 0},
-	  {0x3D, 0x29, 0x1F, 0},
-	  {0x1A, 0x07, 0x0A, 0},
-	  {0x1A, 0x38, 0x66, 0},
-	  {0x2F, 0x61, 0x99, 0},
-	  {0x6B, 0xA7, 0xCF, 0},
-	  {0xBA, 0xE1, 0xF5, 0},
-	  {0xA2, 0xE3, 0xDA, 0},
-	  {0xA3, 0xD9, 0xBE, 0},
-	  {0x4C, 0xA8, 0x6E, 0},
-	  {0x1D, 0x52, 0x34, 0}}},
-	/* 282 */
-	{"thanksmas16",
-	 {{0x34, 0x1D, 0x6D, 0},
-	  {0x00, 0x00, 0x01, 0},
-	  {0x30, 0x1F, 0x29, 0},
-	  {0x55, 0x31, 0x31, 0},
-	  {0x86, 0x7F, 0x6F, 0},
-	  {0x60, 0xA8, 0x5B, 0},
-	  {0xB0, 0xBF, 0x65, 0},
-	  {0x00, 0xA6, 0xB4, 0},
-	  {0x3C, 0x58, 0xF6, 0},
-	  {0xA4, 0x85, 0xF0, 0},
-	  {0xFF, 0xC0, 0x83, 0},
-	  {0xFF, 0x73, 0xC0, 0},
-	  {0xD0, 0x30, 0x43, 0},
-	  {0xF6, 0x94, 0x20, 0},
-	  {0xFF, 0xE1, 0x00, 0},
-	  {0xFF, 0xF7, 0xEA, 0}}},
-	/* 283 */
-	{"colorbit16",
-	 {{0xFD, 0xFF, 0xE3, 0},
-	  {0xFF, 0xE3, 0x3B, 0},
-	  {0xFF, 0xB1, 0xE1, 0},
-	  {0xF9, 0x99, 0x4D, 0},
-	  {0xC3, 0x87, 0x57, 0},
-	  {0xE3, 0x53, 0x53, 0},
-	  {0xAE, 0x40, 0xAB, 0},
-	  {0x60, 0x27, 0x99, 0},
-	  {0x0C, 0x07, 0x28, 0},
-	  {0x88, 0x50, 0x13, 0},
-	  {0x39, 0x86, 0x51, 0},
-	  {0x97, 0xB9, 0x54, 0},
-	  {0x8A, 0xDE, 0xE1, 0},
-	  {0x34, 0x9E, 0xDB, 0},
-	  {0x82, 0x82, 0x82, 0},
-	  {0xBD, 0xBD, 0xBD, 0}}},
-	/* 284 */
-	{"4bitrgb",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x00, 0x55, 0x00, 0},
-	  {0x00, 0xAA, 0x00, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0x00, 0x55, 0xFF, 0},
-	  {0x00, 0xAA, 0xFF, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xFF, 0x55, 0x00, 0},
-	  {0xFF, 0xAA, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0xFF, 0x55, 0xFF, 0},
-	  {0xFF, 0xAA, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 285 */
-	{"turtle16",
-	 {{0xCD, 0xF7, 0xDD, 0},
-	  {0x84, 0xE3, 0x9F, 0},
-	  {0x67, 0xCD, 0x45, 0},
-	  {0x58, 0x9F, 0x62, 0},
-	  {0x82, 0xBE, 0x63, 0},
-	  {0x71, 0xA2, 0x30, 0},
-	  {0x3C, 0x76, 0x41, 0},
-	  {0x33, 0x58, 0x1B, 0},
-	  {0x93, 0x93, 0x2A, 0},
-	  {0x61, 0x61, 0x12, 0},
-	  {0x40, 0x40, 0x16, 0},
-	  {0x25, 0x25, 0x0B, 0},
-	  {0xD9, 0xCD, 0x93, 0},
-	  {0xAF, 0xA5, 0x82, 0},
-	  {0x86, 0x7B, 0x53, 0},
-	  {0x4D, 0x49, 0x3A, 0}}},
-	/* 286 */
-	{"loveydovey16",
-	 {{0xF1, 0xF2, 0xDA, 0},
-	  {0x51, 0x4E, 0x61, 0},
-	  {0x00, 0x23, 0x2B, 0},
-	  {0x50, 0x0F, 0x22, 0},
-	  {0x76, 0x1F, 0x28, 0},
-	  {0xCC, 0x36, 0x36, 0},
-	  {0x6E, 0x3F, 0x73, 0},
-	  {0xCE, 0x4B, 0x7A, 0},
-	  {0xEE, 0xA0, 0xD3, 0},
-	  {0xFF, 0x77, 0x77, 0},
-	  {0xFF, 0xCE, 0x96, 0},
-	  {0xF2, 0xEF, 0x91, 0},
-	  {0x9C, 0x9E, 0xE7, 0},
-	  {0x47, 0x77, 0x77, 0},
-	  {0x33, 0x51, 0x7D, 0},
-	  {0x25, 0x33, 0x4D, 0}}},
-	/* 287 */
-	{"sfpc98",
-	 {{0x19, 0x1B, 0x1D, 0},
-	  {0x43, 0x49, 0x4D, 0},
-	  {0xAD, 0xC0, 0xA7, 0},
-	  {0xF0, 0xF2, 0xF0, 0},
-	  {0x4E, 0x13, 0x15, 0},
-	  {0xED, 0x7E, 0x3C, 0},
-	  {0xF3, 0xB3, 0x8D, 0},
-	  {0x3D, 0xED, 0x3B, 0},
-	  {0x0D, 0x20, 0x39, 0},
-	  {0x5F, 0x90, 0xD2, 0},
-	  {0xAA, 0xE4, 0xEE, 0},
-	  {0x1D, 0x73, 0x1C, 0},
-	  {0x24, 0x1B, 0x72, 0},
-	  {0x4B, 0x38, 0xEF, 0},
-	  {0x82, 0x1E, 0x62, 0},
-	  {0xEF, 0x38, 0xB5, 0}}},
-	/* 288 */
-	{"surfsup",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xCE, 0xE0, 0xDC, 0},
-	  {0x9B, 0xAD, 0xB7, 0},
-	  {0x70, 0x81, 0x8F, 0},
-	  {0xDF, 0xE0, 0x8E, 0},
-	  {0xC0, 0xBA, 0x9C, 0},
-	  {0x81, 0x76, 0x5A, 0},
-	  {0xDA, 0x76, 0x56, 0},
-	  {0xAC, 0x32, 0x32, 0},
-	  {0x6F, 0x52, 0x80, 0},
-	  {0x5A, 0x81, 0xC2, 0},
-	  {0x34, 0x46, 0x8E, 0},
-	  {0x29, 0x36, 0x48, 0},
-	  {0x34, 0x13, 0x66, 0},
-	  {0x1A, 0x14, 0x53, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 289 */
-	{"ak16s",
-	 {{0x22, 0x08, 0x26, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xF8, 0xA0, 0x4B, 0},
-	  {0x6D, 0x36, 0x2B, 0},
-	  {0xE1, 0x37, 0x28, 0},
-	  {0xF4, 0xEC, 0x64, 0},
-	  {0x5F, 0x96, 0x33, 0},
-	  {0x14, 0x47, 0x3C, 0},
-	  {0x27, 0xB0, 0x5B, 0},
-	  {0x6F, 0xE1, 0xC0, 0},
-	  {0x19, 0x9A, 0xCE, 0},
-	  {0x4A, 0x32, 0xAE, 0},
-	  {0x8A, 0x89, 0x8E, 0},
-	  {0xFF, 0xA1, 0xA8, 0},
-	  {0xE1, 0x4A, 0xA0, 0},
-	  {0x4D, 0x1A, 0x65, 0}}},
-	/* 290 */
-	{"e16",
-	 {{0x0F, 0x00, 0x12, 0},
-	  {0x00, 0x4F, 0x3F, 0},
-	  {0x00, 0x9E, 0x4A, 0},
-	  {0x1C, 0xBA, 0x33, 0},
-	  {0xD4, 0xF2, 0x50, 0},
-	  {0xFF, 0xED, 0x87, 0},
-	  {0x33, 0x00, 0x33, 0},
-	  {0xB3, 0x12, 0x2D, 0},
-	  {0xCC, 0x29, 0x29, 0},
-	  {0xE6, 0x65, 0x3A, 0},
-	  {0xFF, 0xBB, 0x5C, 0},
-	  {0x33, 0x00, 0x66, 0},
-	  {0x1A, 0x00, 0x99, 0},
-	  {0x14, 0x33, 0xCC, 0},
-	  {0x30, 0xD2, 0xF2, 0},
-	  {0x4C, 0xFF, 0xB4, 0}}},
-	/* 291 */
-	{"limit16",
-	 {{0x42, 0x00, 0x84, 0},
-	  {0xB9, 0x32, 0xC6, 0},
-	  {0xFF, 0x9D, 0xCA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x4A, 0xFF, 0xFF, 0},
-	  {0x0B, 0x82, 0xD8, 0},
-	  {0x0B, 0x12, 0x74, 0},
-	  {0x22, 0x00, 0x35, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x73, 0xFF, 0x2D, 0},
-	  {0xF9, 0xE8, 0x3F, 0},
-	  {0xCC, 0x59, 0x23, 0},
-	  {0x94, 0x11, 0x32, 0},
-	  {0x51, 0x0B, 0x22, 0},
-	  {0xA8, 0x52, 0x37, 0},
-	  {0xFF, 0xE1, 0xB9, 0}}},
-	/* 292 */
-	{"shroomywoods",
-	 {{0x2E, 0x2E, 0x3A, 0},
-	  {0x65, 0x2E, 0x49, 0},
-	  {0xB9, 0x3A, 0x52, 0},
-	  {0xEE, 0x4B, 0x6A, 0},
-	  {0x59, 0x57, 0x58, 0},
-	  {0xFF, 0xB1, 0x00, 0},
-	  {0xF7, 0xC8, 0xAB, 0},
-	  {0xEE, 0xE1, 0xD9, 0},
-	  {0x66, 0xCC, 0x7D, 0},
-	  {0x82, 0xFF, 0x9E, 0},
-	  {0x72, 0x84, 0xA8, 0},
-	  {0x90, 0xA8, 0xD7, 0},
-	  {0x4A, 0x1E, 0x4A, 0},
-	  {0x94, 0x3C, 0x94, 0},
-	  {0xB0, 0x7B, 0xAC, 0},
-	  {0xEA, 0x9E, 0xE4, 0}}},
-	/* 293 */
-	{"team16",
-	 {{0x36, 0x36, 0x38, 0},
-	  {0x65, 0x6C, 0x79, 0},
-	  {0xE4, 0xE4, 0xDE, 0},
-	  {0xED, 0xCC, 0x6B, 0},
-	  {0xD8, 0x83, 0x49, 0},
-	  {0xD5, 0x53, 0x4B, 0},
-	  {0x9A, 0x71, 0xAF, 0},
-	  {0xE9, 0xB2, 0xC3, 0},
-	  {0x94, 0x87, 0x59, 0},
-	  {0x87, 0x67, 0x3D, 0},
-	  {0x33, 0x4F, 0x51, 0},
-	  {0x55, 0x7D, 0x29, 0},
-	  {0x52, 0xAA, 0x9C, 0},
-	  {0x63, 0xAF, 0xF0, 0},
-	  {0x00, 0x83, 0xC1, 0},
-	  {0x19, 0x53, 0x91, 0}}},
-	/* 294 */
-	{"doodle16",
-	 {{0x8C, 0x47, 0x3F, 0},
-	  {0x47, 0x27, 0x2B, 0},
-	  {0x0D, 0x0B, 0x23, 0},
-	  {0x3E, 0x1F, 0x54, 0},
-	  {0x42, 0x48, 0x66, 0},
-	  {0x87, 0x9B, 0xB0, 0},
-	  {0x83, 0xE6, 0xF3, 0},
-	  {0x23, 0x96, 0xDE, 0},
-	  {0x3E, 0x40, 0xBC, 0},
-	  {0x5E, 0xB0, 0x46, 0},
-	  {0xE1, 0xE8, 0x48, 0},
-	  {0xDB, 0x88, 0x40, 0},
-	  {0xA9, 0x26, 0x2E, 0},
-	  {0xFF, 0x8A, 0xAF, 0},
-	  {0xFF, 0xD7, 0xA6, 0},
-	  {0xE8, 0xFF, 0xFB, 0}}},
-	/* 295 */
-	{"logdog",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xB6, 0xB6, 0xB6, 0},
-	  {0x6D, 0x6D, 0x6D, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xFF, 0xDB, 0xB6, 0},
-	  {0xDB, 0xB6, 0x49, 0},
-	  {0xB6, 0x92, 0x24, 0},
-	  {0x92, 0x6D, 0x24, 0},
-	  {0xDB, 0x92, 0x6D, 0},
-	  {0xDB, 0x49, 0x49, 0},
-	  {0x92, 0x24, 0x24, 0},
-	  {0x49, 0x00, 0x00, 0},
-	  {0x92, 0x92, 0xB6, 0},
-	  {0x6D, 0x6D, 0x92, 0},
-	  {0x49, 0x49, 0x6D, 0},
-	  {0x24, 0x24, 0x49, 0}}},
-	/* 296 */
-	{"oldxmas",
-	 {{0xD9, 0xD2, 0xA1, 0},
-	  {0x9D, 0x87, 0x56, 0},
-	  {0x8C, 0x6D, 0x3F, 0},
-	  {0xF6, 0x75, 0x4E, 0},
-	  {0xF5, 0x9E, 0x44, 0},
-	  {0xE6, 0x1B, 0x1F, 0},
-	  {0xAD, 0x1D, 0x23, 0},
-	  {0xA2, 0xD2, 0x65, 0},
-	  {0x53, 0x82, 0x4A, 0},
-	  {0x25, 0x2D, 0x25, 0},
-	  {0x9F, 0xD2, 0xE5, 0},
-	  {0x67, 0xA7, 0xE3, 0},
-	  {0x40, 0x47, 0x91, 0},
-	  {0x0B, 0x0B, 0x28, 0},
-	  {0xF2, 0xED, 0xF1, 0},
-	  {0xD3, 0x84, 0xC7, 0}}},
-	/* 297 */
-	{"krzywinskicolorblind16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x00, 0x49, 0x49, 0},
-	  {0x00, 0x92, 0x92, 0},
-	  {0xFF, 0x6D, 0xB6, 0},
-	  {0xFF, 0xB6, 0xDB, 0},
-	  {0x49, 0x00, 0x92, 0},
-	  {0x00, 0x6E, 0xDB, 0},
-	  {0xB6, 0x6D, 0xFF, 0},
-	  {0x6D, 0xB6, 0xFF, 0},
-	  {0xB6, 0xDB, 0xFF, 0},
-	  {0x92, 0x00, 0x00, 0},
-	  {0x92, 0x49, 0x00, 0},
-	  {0xDB, 0x6D, 0x00, 0},
-	  {0x24, 0xFF, 0x24, 0},
-	  {0xFF, 0xFF, 0x6D, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 298 */
-	{"ladder5",
-	 {{0x1D, 0x25, 0x1C, 0},
-	  {0x29, 0x4D, 0x30, 0},
-	  {0x45, 0x6D, 0x45, 0},
-	  {0x7C, 0xA9, 0x6D, 0},
-	  {0xCC, 0xB5, 0x6D, 0},
-	  {0xC9, 0x99, 0x34, 0},
-	  {0xB8, 0x6A, 0x1E, 0},
-	  {0xE1, 0x68, 0x86, 0},
-	  {0xB6, 0x33, 0x54, 0},
-	  {0x8A, 0x26, 0x40, 0},
-	  {0x2A, 0x36, 0x48, 0},
-	  {0x36, 0x61, 0x98, 0},
-	  {0x4D, 0x81, 0x95, 0},
-	  {0xC4, 0xD6, 0xEA, 0},
-	  {0x90, 0xA1, 0xB0, 0},
-	  {0x43, 0x52, 0x58, 0}}},
-	/* 299 */
-	{"deepforest16",
-	 {{0x33, 0x24, 0x2B, 0},
-	  {0x4D, 0x2E, 0x2E, 0},
-	  {0x66, 0x43, 0x38, 0},
-	  {0xD9, 0xC6, 0x8D, 0},
-	  {0x2E, 0x73, 0x50, 0},
-	  {0x2A, 0x4D, 0x44, 0},
-	  {0x23, 0x33, 0x33, 0},
-	  {0x20, 0x27, 0x29, 0},
-	  {0xBF, 0x86, 0x4D, 0},
-	  {0x99, 0x43, 0x26, 0},
-	  {0x5F, 0x31, 0x8C, 0},
-	  {0x41, 0x67, 0xD9, 0},
-	  {0x6D, 0x6D, 0x73, 0},
-	  {0x3E, 0x3C, 0x47, 0},
-	  {0x26, 0x22, 0x2E, 0},
-	  {0x16, 0x12, 0x1A, 0}}},
-	/* 300 */
-	{"vivid16",
-	 {{0xF7, 0x14, 0x6F, 0},
-	  {0xBA, 0x06, 0x06, 0},
-	  {0xD6, 0x75, 0x06, 0},
-	  {0xF0, 0xBD, 0x60, 0},
-	  {0xF5, 0xDC, 0x1D, 0},
-	  {0x52, 0xB8, 0x12, 0},
-	  {0x3A, 0xE6, 0x1C, 0},
-	  {0x07, 0xF0, 0xC5, 0},
-	  {0x00, 0xB4, 0xF0, 0},
-	  {0x16, 0x60, 0xE0, 0},
-	  {0x77, 0x08, 0xCC, 0},
-	  {0xD9, 0x0B, 0xE0, 0},
-	  {0xE8, 0xE7, 0xD1, 0},
-	  {0xF2, 0x8E, 0x66, 0},
-	  {0x9E, 0x50, 0x31, 0},
-	  {0x24, 0x0D, 0x09, 0}}},
-	/* 301 */
-	{"dimbloomcore",
-	 {{0x2A, 0x1E, 0x1E, 0},
-	  {0x66, 0x49, 0x33, 0},
-	  {0x28, 0x29, 0x1D, 0},
-	  {0x57, 0x66, 0x32, 0},
-	  {0x25, 0x1D, 0x29, 0},
-	  {0x64, 0x32, 0x66, 0},
-	  {0x29, 0x1D, 0x22, 0},
-	  {0x66, 0x32, 0x37, 0},
-	  {0x29, 0x22, 0x1D, 0},
-	  {0x66, 0x59, 0x32, 0},
-	  {0x1D, 0x26, 0x29, 0},
-	  {0x32, 0x4B, 0x66, 0},
-	  {0x1D, 0x29, 0x20, 0},
-	  {0x32, 0x66, 0x4D, 0},
-	  {0x1F, 0x1D, 0x29, 0},
-	  {0x48, 0x32, 0x66, 0}}},
-	/* 302 */
-	{"autumnal16",
-	 {{0xD3, 0xD4, 0xC1, 0},
-	  {0x87, 0xA8, 0xA2, 0},
-	  {0x33, 0x5D, 0x7D, 0},
-	  {0x30, 0x3D, 0x5E, 0},
-	  {0x3F, 0x5B, 0x5E, 0},
-	  {0x13, 0x2B, 0x2A, 0},
-	  {0x35, 0x42, 0x12, 0},
-	  {0x68, 0x68, 0x0F, 0},
-	  {0x30, 0x24, 0x18, 0},
-	  {0x60, 0x3D, 0x1A, 0},
-	  {0x88, 0x5D, 0x24, 0},
-	  {0xA1, 0x8D, 0x1B, 0},
-	  {0xC9, 0x59, 0x0E, 0},
-	  {0x94, 0x29, 0x25, 0},
-	  {0x5C, 0x29, 0x3B, 0},
-	  {0x18, 0x18, 0x1A, 0}}},
-	/* 303 */
-	{"shifty16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x55, 0x55, 0x55, 0},
-	  {0xAA, 0xAA, 0xAA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x55, 0xFF, 0xFF, 0},
-	  {0x00, 0xAA, 0xFF, 0},
-	  {0x00, 0x55, 0xFF, 0},
-	  {0x00, 0x00, 0xAA, 0},
-	  {0x55, 0x00, 0x55, 0},
-	  {0xAA, 0x00, 0x00, 0},
-	  {0xFF, 0x55, 0x00, 0},
-	  {0xFF, 0xAA, 0x00, 0},
-	  {0xFF, 0xFF, 0x55, 0},
-	  {0x55, 0xFF, 0x00, 0},
-	  {0x00, 0xAA, 0x55, 0},
-	  {0x00, 0x55, 0x55, 0}}},
-	/* 304 */
-	{"16dan",
-	 {{0x7B, 0x7B, 0x7B, 0},
-	  {0xE9, 0xAA, 0x42, 0},
-	  {0xF5, 0xD5, 0x65, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xCA, 0x55, 0x31, 0},
-	  {0xB5, 0xA8, 0x57, 0},
-	  {0xB1, 0xC0, 0x1D, 0},
-	  {0xB9, 0xF5, 0xF7, 0},
-	  {0x76, 0x3E, 0x34, 0},
-	  {0x37, 0x7E, 0x2B, 0},
-	  {0x8D, 0x93, 0xB2, 0},
-	  {0x78, 0xB0, 0xCE, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x2A, 0x2F, 0x5A, 0},
-	  {0x5C, 0x4D, 0x8F, 0},
-	  {0xBE, 0x79, 0xB4, 0}}},
-	/* 305 */
-	{"the16wonder",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xF5, 0x0F, 0x27, 0},
-	  {0xF5, 0x6C, 0x3F, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x00, 0x47, 0x85, 0},
-	  {0x03, 0x95, 0xB1, 0},
-	  {0x36, 0xEB, 0x8F, 0},
-	  {0xAB, 0xFF, 0xA8, 0},
-	  {0x8F, 0x27, 0x00, 0},
-	  {0xFF, 0x8F, 0x15, 0},
-	  {0xFF, 0xEC, 0x3C, 0},
-	  {0xE3, 0xFD, 0xAF, 0},
-	  {0x2D, 0x00, 0x6A, 0},
-	  {0x00, 0x03, 0xF5, 0},
-	  {0x6E, 0xD1, 0xF5, 0},
-	  {0xAD, 0xFF, 0xCA, 0}}},
-	/* 306 */
-	{"10plus6colorpalette",
-	 {{0xE9, 0x17, 0x17, 0},
-	  {0x88, 0x18, 0x18, 0},
-	  {0xE3, 0xE4, 0x1C, 0},
-	  {0xAD, 0x91, 0x14, 0},
-	  {0x3B, 0xDD, 0x3C, 0},
-	  {0x1E, 0x82, 0x1E, 0},
-	  {0x5D, 0xB5, 0xE3, 0},
-	  {0x18, 0x62, 0x88, 0},
-	  {0x39, 0x37, 0xE5, 0},
-	  {0x1F, 0x1F, 0x7F, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x33, 0x33, 0x33, 0},
-	  {0x66, 0x66, 0x66, 0},
-	  {0x99, 0x99, 0x99, 0},
-	  {0xCC, 0xCC, 0xCC, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 307 */
-	{"superhue16",
-	 {{0x42, 0x42, 0x42, 0},
-	  {0x8A, 0x8A, 0x8A, 0},
-	  {0xFA, 0xFA, 0xFA, 0},
-	  {0x53, 0xB6, 0xC6, 0},
-	  {0x2A, 0x61, 0x80, 0},
-	  {0x14, 0x15, 0x57, 0},
-	  {0x53, 0x10, 0x6E, 0},
-	  {0x9E, 0x24, 0x53, 0},
-	  {0xCC, 0x4E, 0x3D, 0},
-	  {0xE3, 0x8A, 0x56, 0},
-	  {0xF0, 0xC6, 0x48, 0},
-	  {0x5A, 0xAB, 0x20, 0},
-	  {0x0A, 0x57, 0x0A, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x4F, 0x13, 0x0F, 0},
-	  {0x82, 0x3B, 0x26, 0}}},
-	/* 308 */
-	{"washedover16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x55, 0x55, 0x55, 0},
-	  {0xAA, 0xAA, 0xAA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xAA, 0x33, 0x44, 0},
-	  {0x77, 0x33, 0x00, 0},
-	  {0xBB, 0x77, 0x44, 0},
-	  {0xFF, 0xBB, 0x88, 0},
-	  {0xDD, 0xDD, 0x66, 0},
-	  {0x66, 0xDD, 0x99, 0},
-	  {0x00, 0x77, 0x33, 0},
-	  {0x00, 0x33, 0x77, 0},
-	  {0x44, 0x77, 0xBB, 0},
-	  {0x88, 0xBB, 0xFF, 0},
-	  {0x88, 0x44, 0xBB, 0},
-	  {0xFF, 0x88, 0xCC, 0}}},
-	/* 309 */
-	{"drowsy16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xE7, 0xE7, 0xBF, 0},
-	  {0xB4, 0x94, 0xB4, 0},
-	  {0x91, 0x35, 0xA8, 0},
-	  {0x6A, 0x9B, 0xA8, 0},
-	  {0x68, 0x72, 0x8C, 0},
-	  {0x4A, 0x31, 0x9D, 0},
-	  {0x00, 0x0D, 0x3A, 0},
-	  {0xFF, 0xCC, 0x77, 0},
-	  {0xDB, 0x8B, 0x62, 0},
-	  {0xA8, 0x58, 0x1B, 0},
-	  {0x5E, 0x3B, 0x37, 0},
-	  {0xAB, 0x6D, 0x6D, 0},
-	  {0xB3, 0x39, 0x43, 0},
-	  {0x81, 0x99, 0x58, 0},
-	  {0x00, 0x6A, 0x66, 0}}},
-	/* 310 */
-	{"z0rn",
-	 {{0x2D, 0x2B, 0x3F, 0},
-	  {0x7F, 0x78, 0x56, 0},
-	  {0x6D, 0x52, 0x4C, 0},
-	  {0x6C, 0x40, 0x49, 0},
-	  {0x87, 0x8C, 0x99, 0},
-	  {0xBB, 0xB8, 0x8B, 0},
-	  {0xB0, 0x93, 0x8A, 0},
-	  {0xAF, 0x80, 0x88, 0},
-	  {0xD8, 0xDB, 0xDD, 0},
-	  {0xE7, 0xE5, 0xB1, 0},
-	  {0xE6, 0xCA, 0xB9, 0},
-	  {0xE6, 0xB6, 0xB7, 0},
-	  {0xF6, 0xF7, 0xF4, 0},
-	  {0xF2, 0xE5, 0x61, 0},
-	  {0xE8, 0x98, 0x60, 0},
-	  {0xE7, 0x5F, 0x5E, 0}}},
-	/* 311 */
-	{"ajspico8palette",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x55, 0x55, 0x55, 0},
-	  {0xAA, 0xAA, 0xAA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x77, 0x00, 0x55, 0},
-	  {0x77, 0x55, 0x00, 0},
-	  {0x00, 0x77, 0x33, 0},
-	  {0x33, 0x33, 0xAA, 0},
-	  {0xFF, 0x00, 0x33, 0},
-	  {0xFF, 0x99, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0x00, 0xFF, 0x55, 0},
-	  {0x00, 0xAA, 0xFF, 0},
-	  {0x99, 0x77, 0xFF, 0},
-	  {0xFF, 0x99, 0xCC, 0},
-	  {0xFF, 0xCC, 0x99, 0}}},
-	/* 312 */
-	{"iroshizuku16",
-	 {{0xE8, 0xE1, 0xD1, 0},
-	  {0xB5, 0xC3, 0xC7, 0},
-	  {0x6C, 0x77, 0x87, 0},
-	  {0x3D, 0x39, 0x45, 0},
-	  {0xC2, 0xD9, 0x68, 0},
-	  {0x53, 0xE0, 0xD0, 0},
-	  {0x49, 0x96, 0xD1, 0},
-	  {0x2E, 0x59, 0x8F, 0},
-	  {0xFF, 0xBC, 0x36, 0},
-	  {0x03, 0x80, 0x71, 0},
-	  {0xAB, 0x77, 0x74, 0},
-	  {0x5C, 0x0D, 0x33, 0},
-	  {0xE6, 0x40, 0x80, 0},
-	  {0x8C, 0x1D, 0x59, 0},
-	  {0xFA, 0x6F, 0x5A, 0},
-	  {0xB5, 0x21, 0x37, 0}}},
-	/* 313 */
-	{"starwars16",
-	 {{0x11, 0x15, 0x1A, 0},
-	  {0x46, 0x53, 0x67, 0},
-	  {0x8E, 0x9C, 0xB3, 0},
-	  {0xF1, 0xF6, 0xFF, 0},
-	  {0xEE, 0xC5, 0xB1, 0},
-	  {0xDC, 0x7A, 0x33, 0},
-	  {0x81, 0x18, 0x18, 0},
-	  {0xDA, 0x1F, 0x33, 0},
-	  {0xF2, 0xA0, 0xC9, 0},
-	  {0xDA, 0x60, 0xC4, 0},
-	  {0x77, 0x31, 0x81, 0},
-	  {0x2E, 0x16, 0x74, 0},
-	  {0x3C, 0x83, 0xCC, 0},
-	  {0x5C, 0xE7, 0xDB, 0},
-	  {0x40, 0xA6, 0x53, 0},
-	  {0x1E, 0x66, 0x65, 0}}},
-	/* 314 */
-	{"vibrantramps",
-	 {{0x07, 0x07, 0x2A, 0},
-	  {0x1D, 0x25, 0x62, 0},
-	  {0x3A, 0x70, 0xB9, 0},
-	  {0x75, 0xC1, 0xE5, 0},
-	  {0xCB, 0xFC, 0xF5, 0},
-	  {0xFF, 0xFF, 0xF6, 0},
-	  {0xE7, 0xD1, 0x84, 0},
-	  {0xA8, 0x6E, 0x29, 0},
-	  {0x7A, 0x2B, 0x20, 0},
-	  {0x4D, 0x14, 0x2F, 0},
-	  {0x2D, 0x13, 0x2B, 0},
-	  {0x1A, 0x45, 0x69, 0},
-	  {0x24, 0x95, 0x8D, 0},
-	  {0x43, 0xD8, 0x8D, 0},
-	  {0x9A, 0xE7, 0x96, 0},
-	  {0xEB, 0xEF, 0xC9, 0}}},
-	/* 315 */
-	{"mg16",
-	 {{0xF2, 0xF2, 0xF2, 0},
-	  {0xC8, 0xDB, 0xBE, 0},
-	  {0xE3, 0xCC, 0x7E, 0},
-	  {0xCC, 0xC8, 0xB3, 0},
-	  {0x6C, 0xD1, 0x6C, 0},
-	  {0xAD, 0xA0, 0xA5, 0},
-	  {0xCC, 0x5D, 0x6E, 0},
-	  {0xFF, 0x00, 0x84, 0},
-	  {0x7F, 0x78, 0x87, 0},
-	  {0x43, 0x63, 0x57, 0},
-	  {0x63, 0x4E, 0x70, 0},
-	  {0x6D, 0x40, 0x3F, 0},
-	  {0x3D, 0x3D, 0x9E, 0},
-	  {0x42, 0x37, 0x2A, 0},
-	  {0x33, 0x36, 0x51, 0},
-	  {0x26, 0x1D, 0x26, 0}}},
-	/* 316 */
-	{"arnefrontier",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x4F, 0x44, 0x40, 0},
-	  {0x93, 0x93, 0x93, 0},
-	  {0xEE, 0xEE, 0xEE, 0},
-	  {0xFA, 0x4F, 0xDF, 0},
-	  {0x9F, 0x14, 0x5F, 0},
-	  {0xEF, 0x2B, 0x2B, 0},
-	  {0xFC, 0x99, 0x0E, 0},
-	  {0xED, 0xEE, 0x00, 0},
-	  {0xA0, 0xE5, 0x46, 0},
-	  {0x43, 0xBF, 0x52, 0},
-	  {0x00, 0x66, 0x4A, 0},
-	  {0x3A, 0x3B, 0x5E, 0},
-	  {0x1C, 0x6B, 0xB6, 0},
-	  {0x6E, 0xC0, 0xD8, 0},
-	  {0x75, 0xFF, 0x9F, 0}}},
-	/* 317 */
-	{"pastellove",
-	 {{0x63, 0x16, 0x16, 0},
-	  {0x26, 0x0B, 0x1E, 0},
-	  {0x34, 0x3B, 0x22, 0},
-	  {0x7B, 0x6D, 0x32, 0},
-	  {0xAF, 0x4D, 0x4D, 0},
-	  {0x63, 0x1D, 0x84, 0},
-	  {0x30, 0x68, 0x43, 0},
-	  {0xCB, 0xAF, 0x6B, 0},
-	  {0xDE, 0xAC, 0x96, 0},
-	  {0x8F, 0x6A, 0xB8, 0},
-	  {0x77, 0xB3, 0x91, 0},
-	  {0xB1, 0xC2, 0x76, 0},
-	  {0xDE, 0xC4, 0xDC, 0},
-	  {0x9E, 0xA9, 0xCB, 0},
-	  {0x58, 0x80, 0xB3, 0},
-	  {0x38, 0x55, 0x7B, 0}}},
-	/* 318 */
-	{"king16",
-	 {{0x1D, 0x1B, 0x20, 0},
-	  {0x39, 0x2E, 0x3C, 0},
-	  {0x3D, 0x3C, 0x58, 0},
-	  {0x64, 0x3A, 0x40, 0},
-	  {0x46, 0x54, 0x3E, 0},
-	  {0x50, 0x5F, 0x93, 0},
-	  {0x51, 0x78, 0x52, 0},
-	  {0xA0, 0x53, 0x72, 0},
-	  {0x88, 0x66, 0x59, 0},
-	  {0xB9, 0x72, 0xA4, 0},
-	  {0x9E, 0x8D, 0x80, 0},
-	  {0xBC, 0xA7, 0x66, 0},
-	  {0xD1, 0xA2, 0xB9, 0},
-	  {0xC0, 0xC7, 0x83, 0},
-	  {0xC5, 0xD1, 0xB4, 0},
-	  {0xC4, 0xCC, 0xBD, 0}}},
-	/* 319 */
-	{"tymp16",
-	 {{0xC2, 0xC6, 0x30, 0},
-	  {0x3F, 0xA1, 0x30, 0},
-	  {0x4E, 0x58, 0x17, 0},
-	  {0x34, 0x2B, 0x19, 0},
-	  {0xFF, 0xD3, 0x7B, 0},
-	  {0xE1, 0x87, 0x34, 0},
-	  {0xC3, 0x4E, 0x29, 0},
-	  {0x63, 0x48, 0x05, 0},
-	  {0xC1, 0x3D, 0x95, 0},
-	  {0x8D, 0x15, 0x23, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xAD, 0xAD, 0xCB, 0},
-	  {0x59, 0x6E, 0x78, 0},
-	  {0x72, 0xB3, 0xFF, 0},
-	  {0x3D, 0x65, 0xB6, 0},
-	  {0x24, 0x44, 0x49, 0}}},
-	/* 320 */
-	{"minecraft",
-	 {{0xCF, 0xD5, 0xD6, 0},
-	  {0xE0, 0x61, 0x01, 0},
-	  {0xA9, 0x30, 0x9F, 0},
-	  {0x24, 0x89, 0xC7, 0},
-	  {0xF1, 0xAF, 0x15, 0},
-	  {0x5E, 0xA9, 0x18, 0},
-	  {0xD5, 0x65, 0x8F, 0},
-	  {0x37, 0x3A, 0x3E, 0},
-	  {0x7D, 0x7D, 0x73, 0},
-	  {0x15, 0x77, 0x88, 0},
-	  {0x64, 0x20, 0x9C, 0},
-	  {0x2D, 0x2F, 0x8F, 0},
-	  {0x60, 0x3C, 0x20, 0},
-	  {0x49, 0x5B, 0x24, 0},
-	  {0x8E, 0x21, 0x21, 0},
-	  {0x08, 0x0A, 0x0F, 0}}},
-	/* 321 */
-	{"tropicalchancer",
-	 {{0x14, 0x10, 0x10, 0},
-	  {0xFF, 0x03, 0x96, 0},
-	  {0xBF, 0x02, 0x70, 0},
-	  {0x80, 0x01, 0x4B, 0},
-	  {0x8E, 0x08, 0xCC, 0},
-	  {0x59, 0x05, 0x80, 0},
-	  {0x2C, 0x03, 0x40, 0},
-	  {0x16, 0xCC, 0xBC, 0},
-	  {0x0F, 0x8C, 0x82, 0},
-	  {0x08, 0x4D, 0x47, 0},
-	  {0xFF, 0x68, 0x03, 0},
-	  {0xFF, 0xAB, 0x0A, 0},
-	  {0xFF, 0xE1, 0x1C, 0},
-	  {0x11, 0xFF, 0x03, 0},
-	  {0x0A, 0xB3, 0x00, 0},
-	  {0xFF, 0xF0, 0xF0, 0}}},
-	/* 322 */
-	{"tydk16",
-	 {{0xDE, 0xCE, 0xB4, 0},
-	  {0xC5, 0xAE, 0x6C, 0},
-	  {0xAF, 0x88, 0x29, 0},
-	  {0xA5, 0x7A, 0x57, 0},
-	  {0x85, 0x59, 0x31, 0},
-	  {0x4A, 0x3C, 0x17, 0},
-	  {0x75, 0x4E, 0x51, 0},
-	  {0x80, 0x41, 0x35, 0},
-	  {0x43, 0x2A, 0x2E, 0},
-	  {0x6E, 0x8F, 0x8D, 0},
-	  {0x5C, 0x6A, 0x53, 0},
-	  {0x5A, 0x53, 0x4A, 0},
-	  {0x2F, 0x45, 0x41, 0},
-	  {0x3D, 0x38, 0x40, 0},
-	  {0x26, 0x29, 0x21, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 323 */
-	{"pastryshop",
-	 {{0x2E, 0x2E, 0x2E, 0},
-	  {0x61, 0x61, 0x61, 0},
-	  {0xA1, 0xA1, 0xA1, 0},
-	  {0xD1, 0xD1, 0xD1, 0},
-	  {0xFF, 0xBF, 0x00, 0},
-	  {0xE6, 0x4B, 0x17, 0},
-	  {0xCC, 0x29, 0x52, 0},
-	  {0xB3, 0x36, 0x93, 0},
-	  {0x82, 0x3D, 0x99, 0},
-	  {0x50, 0x40, 0x80, 0},
-	  {0x3D, 0x47, 0x66, 0},
-	  {0x40, 0x70, 0x80, 0},
-	  {0x3D, 0x99, 0x82, 0},
-	  {0x36, 0xB3, 0x55, 0},
-	  {0x52, 0xCC, 0x29, 0},
-	  {0xB2, 0xE6, 0x17, 0}}},
-	/* 324 */
-	{"polybius16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x24, 0x24, 0x24, 0},
-	  {0x35, 0x35, 0x35, 0},
-	  {0x49, 0x49, 0x49, 0},
-	  {0x66, 0x66, 0x66, 0},
-	  {0xE2, 0xE2, 0xE2, 0},
-	  {0x6D, 0xCF, 0xC0, 0},
-	  {0x1A, 0xAB, 0x90, 0},
-	  {0x0C, 0x78, 0x64, 0},
-	  {0x00, 0x4A, 0x3C, 0},
-	  {0x27, 0xA3, 0xFF, 0},
-	  {0x00, 0x3F, 0xE2, 0},
-	  {0x0A, 0x13, 0x8A, 0},
-	  {0xF8, 0x6A, 0x1D, 0},
-	  {0xDB, 0x00, 0x00, 0},
-	  {0x99, 0x04, 0x2E, 0}}},
-	/* 325 */
-	{"arcticlevel",
-	 {{0x1F, 0x1A, 0x1D, 0},
-	  {0x32, 0x3B, 0x95, 0},
-	  {0x44, 0x58, 0x2C, 0},
-	  {0x6B, 0x65, 0x56, 0},
-	  {0x39, 0x68, 0xBB, 0},
-	  {0x94, 0x7D, 0x4C, 0},
-	  {0x93, 0x66, 0xB5, 0},
-	  {0x8A, 0x80, 0xA3, 0},
-	  {0x64, 0x84, 0x40, 0},
-	  {0xBD, 0x9B, 0x56, 0},
-	  {0x96, 0xC3, 0x59, 0},
-	  {0x73, 0xB4, 0xF9, 0},
-	  {0x9F, 0xA7, 0xB5, 0},
-	  {0xBD, 0xC8, 0xC0, 0},
-	  {0xC0, 0xED, 0xDE, 0},
-	  {0xF2, 0xF1, 0xD6, 0}}},
-	/* 326 */
-	{"tya12k",
-	 {{0xF5, 0xF5, 0xF5, 0},
-	  {0x97, 0x8D, 0x7B, 0},
-	  {0x5C, 0x6A, 0x53, 0},
-	  {0x39, 0x39, 0x2E, 0},
-	  {0x9C, 0xE4, 0xC7, 0},
-	  {0x55, 0xAB, 0xBB, 0},
-	  {0x66, 0x77, 0x7D, 0},
-	  {0x42, 0x49, 0x5A, 0},
-	  {0x89, 0xB1, 0x52, 0},
-	  {0x34, 0x97, 0x51, 0},
-	  {0x3A, 0x53, 0x2D, 0},
-	  {0xC4, 0xCB, 0x7D, 0},
-	  {0xB1, 0x86, 0x52, 0},
-	  {0x6D, 0x61, 0x38, 0},
-	  {0xAC, 0x56, 0x3E, 0},
-	  {0x63, 0x4C, 0x52, 0}}},
-	/* 327 */
-	{"surfinginram",
-	 {{0x08, 0x08, 0x28, 0},
-	  {0x4E, 0x52, 0x5E, 0},
-	  {0xC1, 0xB6, 0xAD, 0},
-	  {0xF3, 0xFE, 0xFF, 0},
-	  {0x32, 0x9A, 0x5F, 0},
-	  {0x44, 0xC8, 0xA1, 0},
-	  {0xB0, 0xEE, 0xD3, 0},
-	  {0x1A, 0x18, 0x7D, 0},
-	  {0x48, 0x2A, 0xE4, 0},
-	  {0x94, 0x96, 0xD6, 0},
-	  {0xA4, 0x5D, 0xAD, 0},
-	  {0x60, 0x39, 0x43, 0},
-	  {0xD3, 0x24, 0x57, 0},
-	  {0xE3, 0x8C, 0xB7, 0},
-	  {0xFF, 0x63, 0x63, 0},
-	  {0xFA, 0xBB, 0x94, 0}}},
-	/* 328 */
-	{"tygos16",
-	 {{0xCB, 0xBC, 0xAA, 0},
-	  {0x72, 0xAC, 0x92, 0},
-	  {0x79, 0x79, 0x97, 0},
-	  {0x75, 0x63, 0x72, 0},
-	  {0x63, 0x8D, 0x54, 0},
-	  {0x60, 0x6A, 0x40, 0},
-	  {0x4E, 0x48, 0x43, 0},
-	  {0x1A, 0x2F, 0x27, 0},
-	  {0xB6, 0xA5, 0x88, 0},
-	  {0xA7, 0x88, 0x9F, 0},
-	  {0xA1, 0x7B, 0x6D, 0},
-	  {0x87, 0x70, 0x41, 0},
-	  {0x72, 0x53, 0x56, 0},
-	  {0x4E, 0x37, 0x2C, 0},
-	  {0x3E, 0x22, 0x30, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 329 */
-	{"rggb",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x00, 0x55, 0x00, 0},
-	  {0x00, 0xAB, 0x00, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0x00, 0x55, 0xFF, 0},
-	  {0x00, 0xAB, 0xFF, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xFF, 0x55, 0x00, 0},
-	  {0xFF, 0xAB, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0xFF, 0x55, 0xFF, 0},
-	  {0xFF, 0xAB, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 330 */
-	{"slime16",
-	 {{0x3D, 0x5A, 0x66, 0},
-	  {0x47, 0xB2, 0x92, 0},
-	  {0x6D, 0xD9, 0x79, 0},
-	  {0xF5, 0xFF, 0xCC, 0},
-	  {0x4B, 0x17, 0x17, 0},
-	  {0x9A, 0x3E, 0x3E, 0},
-	  {0xB3, 0x66, 0x47, 0},
-	  {0xE5, 0xB0, 0x5B, 0},
-	  {0x3D, 0x4E, 0x65, 0},
-	  {0x59, 0x68, 0x80, 0},
-	  {0x7A, 0x87, 0x99, 0},
-	  {0xB8, 0xC0, 0xCC, 0},
-	  {0x25, 0x28, 0x4D, 0},
-	  {0x36, 0x6A, 0xB3, 0},
-	  {0x5B, 0x95, 0xE5, 0},
-	  {0x65, 0xD1, 0xFF, 0}}},
-	/* 331 */
-	{"azionepallete",
-	 {{0x67, 0x3A, 0x61, 0},
-	  {0x98, 0x45, 0x61, 0},
-	  {0xF0, 0xA5, 0x7E, 0},
-	  {0xDA, 0x8B, 0x64, 0},
-	  {0xDF, 0xB6, 0x5D, 0},
-	  {0xF6, 0xC3, 0x8A, 0},
-	  {0xEC, 0xD6, 0xEB, 0},
-	  {0x9F, 0x90, 0xD6, 0},
-	  {0x79, 0x83, 0xD4, 0},
-	  {0x3F, 0x5D, 0xBF, 0},
-	  {0x46, 0x45, 0x95, 0},
-	  {0x2E, 0x33, 0x6B, 0},
-	  {0x25, 0x25, 0x41, 0},
-	  {0x41, 0x3E, 0x5B, 0},
-	  {0x58, 0x55, 0x72, 0},
-	  {0x2F, 0xA2, 0x70, 0}}},
-	/* 332 */
-	{"paletadracula",
-	 {{0x17, 0x17, 0x17, 0},
-	  {0x33, 0x3E, 0x09, 0},
-	  {0x48, 0x34, 0x22, 0},
-	  {0x76, 0x00, 0x64, 0},
-	  {0x36, 0x88, 0x00, 0},
-	  {0x93, 0x0B, 0x0B, 0},
-	  {0xC9, 0x00, 0xC7, 0},
-	  {0x6D, 0xB9, 0x36, 0},
-	  {0x18, 0xFE, 0x89, 0},
-	  {0xE2, 0xFD, 0x4C, 0},
-	  {0xE9, 0x6F, 0x6F, 0},
-	  {0xD8, 0x94, 0xE2, 0},
-	  {0xB5, 0xFA, 0xAA, 0},
-	  {0xE3, 0xFE, 0xB6, 0},
-	  {0xD6, 0xFF, 0xEA, 0},
-	  {0xEC, 0xF7, 0xF3, 0}}},
-	/* 333 */
-	{"daydream16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x44, 0x00, 0x88, 0},
-	  {0xCC, 0x00, 0xAA, 0},
-	  {0xFF, 0xAA, 0xBB, 0},
-	  {0x55, 0x00, 0x00, 0},
-	  {0x99, 0x33, 0x11, 0},
-	  {0xDD, 0x66, 0x44, 0},
-	  {0xFF, 0x88, 0x88, 0},
-	  {0x44, 0x44, 0xCC, 0},
-	  {0x11, 0x99, 0xCC, 0},
-	  {0x33, 0xEE, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x00, 0x99, 0x33, 0},
-	  {0x66, 0xEE, 0x11, 0},
-	  {0xEE, 0xFF, 0x77, 0},
-	  {0xFF, 0xCC, 0x88, 0}}},
-	/* 334 */
-	{"chavo8pal",
-	 {{0x20, 0x1F, 0x1A, 0},
-	  {0x56, 0x32, 0x26, 0},
-	  {0x3D, 0x4A, 0x4B, 0},
-	  {0x5D, 0x5C, 0x58, 0},
-	  {0xA6, 0x50, 0x2F, 0},
-	  {0xC2, 0x4A, 0x33, 0},
-	  {0x42, 0x68, 0x96, 0},
-	  {0x98, 0x6D, 0x61, 0},
-	  {0x5B, 0x85, 0x5F, 0},
-	  {0x8C, 0x7C, 0x86, 0},
-	  {0x70, 0x86, 0x9C, 0},
-	  {0xC1, 0x8F, 0x67, 0},
-	  {0xA4, 0x98, 0x98, 0},
-	  {0xD4, 0xAE, 0xA1, 0},
-	  {0xE0, 0xC9, 0xB5, 0},
-	  {0xF0, 0xEB, 0xE4, 0}}},
-	/* 335 */
-	{"raspberry",
-	 {{0xFE, 0xE6, 0xFF, 0},
-	  {0xFC, 0xB8, 0xE1, 0},
-	  {0xFF, 0x97, 0xBF, 0},
-	  {0xFF, 0x3C, 0x64, 0},
-	  {0xE4, 0x2A, 0x41, 0},
-	  {0xD8, 0x36, 0x68, 0},
-	  {0x9B, 0x37, 0x5D, 0},
-	  {0x93, 0x18, 0x37, 0},
-	  {0xFF, 0xFC, 0xC0, 0},
-	  {0xC9, 0xB6, 0x7B, 0},
-	  {0x97, 0xA2, 0x53, 0},
-	  {0x60, 0x87, 0x2C, 0},
-	  {0xA1, 0xBC, 0x99, 0},
-	  {0x72, 0x9E, 0x6D, 0},
-	  {0x3C, 0x77, 0x65, 0},
-	  {0x3A, 0x55, 0x42, 0}}},
-	/* 336 */
-	{"darkmatter",
-	 {{0x3A, 0x08, 0x50, 0},
-	  {0x72, 0x16, 0x80, 0},
-	  {0xF7, 0x00, 0xC2, 0},
-	  {0x00, 0xFF, 0xF2, 0},
-	  {0x07, 0x56, 0x9F, 0},
-	  {0x05, 0x14, 0x40, 0},
-	  {0x21, 0x57, 0x0A, 0},
-	  {0x5B, 0xBF, 0x0E, 0},
-	  {0xE0, 0xF0, 0x00, 0},
-	  {0xFF, 0x59, 0x00, 0},
-	  {0xB5, 0x38, 0x07, 0},
-	  {0x75, 0x05, 0x05, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x48, 0x48, 0x48, 0},
-	  {0xAF, 0xAF, 0xAF, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 337 */
-	{"basic16",
-	 {{0xF2, 0xC0, 0xA2, 0},
-	  {0xE9, 0x84, 0x72, 0},
-	  {0xD8, 0x23, 0x23, 0},
-	  {0x98, 0x18, 0x3C, 0},
-	  {0x1F, 0xCB, 0x23, 0},
-	  {0x12, 0x6D, 0x30, 0},
-	  {0x26, 0xDD, 0xDD, 0},
-	  {0x18, 0x67, 0xA0, 0},
-	  {0x93, 0x42, 0x26, 0},
-	  {0x6C, 0x25, 0x1E, 0},
-	  {0xF7, 0xE2, 0x6C, 0},
-	  {0xED, 0xB3, 0x29, 0},
-	  {0xE7, 0x6D, 0x14, 0},
-	  {0xF2, 0xF2, 0xF9, 0},
-	  {0x6A, 0x5F, 0xA0, 0},
-	  {0x16, 0x14, 0x23, 0}}},
-	/* 338 */
-	{"minecraftdyecolors",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x99, 0x99, 0x99, 0},
-	  {0x4C, 0x4C, 0x4C, 0},
-	  {0x19, 0x19, 0x19, 0},
-	  {0x66, 0x4C, 0x33, 0},
-	  {0x99, 0x33, 0x33, 0},
-	  {0xD8, 0x7F, 0x33, 0},
-	  {0xE5, 0xE5, 0x33, 0},
-	  {0x7F, 0xCC, 0x19, 0},
-	  {0x66, 0x7F, 0x33, 0},
-	  {0x4C, 0x7F, 0x99, 0},
-	  {0x66, 0x99, 0xD8, 0},
-	  {0x33, 0x4C, 0xB2, 0},
-	  {0x7F, 0x3F, 0xB2, 0},
-	  {0xB2, 0x4C, 0xD8, 0},
-	  {0xF2, 0x7F, 0xA5, 0}}},
-	/* 339 */
-	{"vnes16palette",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x45, 0xC1, 0xFF, 0},
-	  {0x00, 0x57, 0xFA, 0},
-	  {0x43, 0x00, 0xA8, 0},
-	  {0xFA, 0x0F, 0x0F, 0},
-	  {0xFA, 0x53, 0x00, 0},
-	  {0xFA, 0x99, 0x2A, 0},
-	  {0xFA, 0xE7, 0x69, 0},
-	  {0xAC, 0xAC, 0xAC, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x1B, 0x00, 0x1F, 0},
-	  {0x35, 0x00, 0x57, 0},
-	  {0xB3, 0x00, 0x3B, 0},
-	  {0x00, 0x7D, 0x4F, 0},
-	  {0x27, 0xB5, 0x00, 0},
-	  {0xB0, 0xEB, 0x0E, 0}}},
-	/* 340 */
-	{"tymd16",
-	 {{0x8F, 0xBF, 0xD5, 0},
-	  {0x83, 0x85, 0xCF, 0},
-	  {0x76, 0x55, 0xA2, 0},
-	  {0x31, 0x3A, 0x91, 0},
-	  {0xCD, 0x93, 0x73, 0},
-	  {0xB1, 0x48, 0x63, 0},
-	  {0x91, 0x31, 0x31, 0},
-	  {0xA7, 0x74, 0x34, 0},
-	  {0x78, 0x42, 0x33, 0},
-	  {0x34, 0x31, 0x1D, 0},
-	  {0x66, 0xAC, 0x7D, 0},
-	  {0x4A, 0x78, 0x33, 0},
-	  {0xED, 0xE6, 0xC8, 0},
-	  {0x80, 0x80, 0x78, 0},
-	  {0x48, 0x54, 0x54, 0},
-	  {0x37, 0x3A, 0x3E, 0}}},
-	/* 341 */
-	{"lightfantasygame",
-	 {{0xE7, 0xEB, 0xF8, 0},
-	  {0xAD, 0xB2, 0xC1, 0},
-	  {0x79, 0x7E, 0x8D, 0},
-	  {0x20, 0x20, 0x26, 0},
-	  {0xF5, 0x6C, 0x77, 0},
-	  {0xAC, 0x32, 0x32, 0},
-	  {0xF8, 0xC8, 0xAF, 0},
-	  {0xE4, 0xA6, 0x72, 0},
-	  {0xFF, 0xE7, 0x62, 0},
-	  {0x96, 0xD4, 0x5B, 0},
-	  {0x3E, 0xA1, 0x55, 0},
-	  {0x04, 0x84, 0xD1, 0},
-	  {0x20, 0x3C, 0x56, 0},
-	  {0x8D, 0x56, 0xA9, 0},
-	  {0x50, 0x52, 0x73, 0},
-	  {0x69, 0x3C, 0x36, 0}}},
-	/* 342 */
-	{"tync16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x0B, 0x15, 0x2E, 0},
-	  {0x32, 0x29, 0x3C, 0},
-	  {0x6A, 0x44, 0x5A, 0},
-	  {0x57, 0x87, 0xBA, 0},
-	  {0x9A, 0x93, 0xB7, 0},
-	  {0xBD, 0xCA, 0xCD, 0},
-	  {0x7A, 0x80, 0x75, 0},
-	  {0x37, 0x4A, 0x3D, 0},
-	  {0x6E, 0x70, 0x3E, 0},
-	  {0x96, 0xC3, 0x59, 0},
-	  {0x4C, 0x34, 0x35, 0},
-	  {0x70, 0x53, 0x36, 0},
-	  {0xCA, 0x7C, 0x3B, 0},
-	  {0xDA, 0xB3, 0x4F, 0},
-	  {0xEF, 0xAC, 0xA1, 0}}},
-	/* 343 */
-	{"grixelgrotto",
-	 {{0x09, 0x57, 0x12, 0},
-	  {0x3B, 0x8C, 0x50, 0},
-	  {0x1D, 0xAB, 0x3E, 0},
-	  {0x79, 0xC2, 0x67, 0},
-	  {0x45, 0x49, 0x9C, 0},
-	  {0x5E, 0x71, 0xEB, 0},
-	  {0x73, 0x8A, 0xFF, 0},
-	  {0x9E, 0xAE, 0xFF, 0},
-	  {0x31, 0x72, 0xD4, 0},
-	  {0x32, 0x97, 0xD6, 0},
-	  {0x7E, 0xA8, 0xE6, 0},
-	  {0xE0, 0xF3, 0xFF, 0},
-	  {0xA8, 0x91, 0x0D, 0},
-	  {0xB8, 0xA7, 0x3B, 0},
-	  {0xE8, 0xDA, 0x7F, 0},
-	  {0xFF, 0xF6, 0xBD, 0}}},
-	/* 344 */
-	{"theamazingspiderman",
-	 {{0xE0, 0xE0, 0xE0, 0},
-	  {0xA0, 0xA0, 0xA0, 0},
-	  {0x60, 0x60, 0x60, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xE0, 0xC0, 0x00, 0},
-	  {0xE0, 0x80, 0x00, 0},
-	  {0x60, 0xE0, 0xE0, 0},
-	  {0x00, 0xA0, 0xE0, 0},
-	  {0xC0, 0x40, 0xE0, 0},
-	  {0x60, 0x20, 0x80, 0},
-	  {0x20, 0xC0, 0x40, 0},
-	  {0x00, 0x60, 0x20, 0},
-	  {0xE0, 0x40, 0x00, 0},
-	  {0xA0, 0x20, 0x00, 0},
-	  {0x00, 0x60, 0xC0, 0},
-	  {0x00, 0x40, 0xA0, 0}}},
-	/* 345 */
-	{"tyfd16",
-	 {{0xDF, 0xD8, 0xC0, 0},
-	  {0x72, 0x85, 0x82, 0},
-	  {0x59, 0x5A, 0x51, 0},
-	  {0x4A, 0x44, 0x4A, 0},
-	  {0x2A, 0x2A, 0x2A, 0},
-	  {0x86, 0xAA, 0xCF, 0},
-	  {0x3C, 0x70, 0x55, 0},
-	  {0x66, 0x57, 0x75, 0},
-	  {0x36, 0x49, 0x5A, 0},
-	  {0xA6, 0xAA, 0x62, 0},
-	  {0x9A, 0x7A, 0x4C, 0},
-	  {0x7A, 0x5C, 0x54, 0},
-	  {0x4A, 0x41, 0x26, 0},
-	  {0xEA, 0xCB, 0x51, 0},
-	  {0xBF, 0x6A, 0x32, 0},
-	  {0x75, 0x41, 0x36, 0}}},
-	/* 346 */
-	{"cartooners",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x77, 0x77, 0x77, 0},
-	  {0xCC, 0x88, 0x55, 0},
-	  {0x00, 0x11, 0x11, 0},
-	  {0x44, 0x55, 0xFF, 0},
-	  {0x00, 0x88, 0x00, 0},
-	  {0xBB, 0x55, 0x00, 0},
-	  {0xDD, 0x00, 0x00, 0},
-	  {0xFF, 0x99, 0x00, 0},
-	  {0xFF, 0xEE, 0x00, 0},
-	  {0x00, 0xEE, 0x00, 0},
-	  {0xFF, 0xBB, 0xAA, 0},
-	  {0xFF, 0x22, 0xAA, 0},
-	  {0x77, 0x88, 0xFF, 0},
-	  {0xCC, 0xCC, 0xCC, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 347 */
-	{"dotpictcharacters",
-	 {{0x14, 0x13, 0x1A, 0},
-	  {0x47, 0x4D, 0x5D, 0},
-	  {0x8F, 0x9A, 0xA1, 0},
-	  {0xA7, 0x27, 0x51, 0},
-	  {0xFF, 0x3D, 0x3D, 0},
-	  {0xFF, 0xB7, 0x2A, 0},
-	  {0xF6, 0xED, 0x03, 0},
-	  {0x4B, 0xDE, 0x3C, 0},
-	  {0x33, 0x76, 0x6C, 0},
-	  {0x25, 0xBF, 0xE2, 0},
-	  {0x31, 0x7D, 0xE9, 0},
-	  {0x4A, 0x3C, 0x95, 0},
-	  {0xA5, 0x5B, 0x99, 0},
-	  {0xFE, 0x82, 0x7D, 0},
-	  {0xFE, 0xD0, 0xB1, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 348 */
-	{"spiral16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x80, 0x80, 0x80, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xCC, 0x99, 0},
-	  {0xFF, 0x99, 0xCC, 0},
-	  {0xAA, 0x55, 0xFF, 0},
-	  {0x00, 0xAA, 0xFF, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xFF, 0x80, 0x00, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xAA, 0x00, 0x55, 0},
-	  {0x55, 0x00, 0xAA, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0x00, 0xAA, 0x55, 0},
-	  {0x66, 0x33, 0x00, 0}}},
-	/* 349 */
-	{"nanoc16",
-	 {{0x2A, 0x23, 0x2D, 0},
-	  {0x3E, 0x43, 0x4B, 0},
-	  {0xB8, 0xB8, 0xAF, 0},
-	  {0x51, 0x59, 0x83, 0},
-	  {0x5C, 0x7B, 0xA0, 0},
-	  {0x7A, 0xAF, 0xC4, 0},
-	  {0xF6, 0xEB, 0xD3, 0},
-	  {0xEA, 0xCF, 0x54, 0},
-	  {0xDE, 0x71, 0x38, 0},
-	  {0x6C, 0x8D, 0x50, 0},
-	  {0x3F, 0x6D, 0x39, 0},
-	  {0x2E, 0x42, 0x36, 0},
-	  {0xDB, 0xAC, 0x89, 0},
-	  {0x8C, 0x5D, 0x53, 0},
-	  {0x53, 0x2A, 0x3A, 0},
-	  {0xA1, 0x3B, 0x3A, 0}}},
-	/* 350 */
-	{"saturation16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x42, 0x42, 0x42, 0},
-	  {0x91, 0x91, 0x91, 0},
-	  {0xB8, 0xB8, 0xB8, 0},
-	  {0xE0, 0xE0, 0xE0, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0x4B, 0x4B, 0},
-	  {0xB8, 0x29, 0x3B, 0},
-	  {0xEB, 0xFF, 0x40, 0},
-	  {0xDE, 0xB9, 0x2C, 0},
-	  {0x54, 0xFF, 0x59, 0},
-	  {0x3A, 0xC4, 0x50, 0},
-	  {0x68, 0x65, 0xFF, 0},
-	  {0x00, 0x68, 0xA1, 0},
-	  {0x98, 0x3C, 0xE8, 0},
-	  {0x79, 0x21, 0x80, 0}}},
-	/* 351 */
-	{"brilliance16",
-	 {{0x70, 0x06, 0x1F, 0},
-	  {0xFF, 0x12, 0x38, 0},
-	  {0xFF, 0x83, 0x59, 0},
-	  {0xF0, 0xFB, 0x56, 0},
-	  {0x55, 0xBA, 0x38, 0},
-	  {0x12, 0x65, 0x27, 0},
-	  {0x14, 0x20, 0x75, 0},
-	  {0x2D, 0x69, 0x9E, 0},
-	  {0x74, 0xBD, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x9D, 0x92, 0xA2, 0},
-	  {0x59, 0x4A, 0x60, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x6C, 0x3A, 0x38, 0},
-	  {0xAF, 0x6D, 0x5D, 0},
-	  {0xDE, 0xA8, 0x94, 0}}},
-	/* 352 */
-	{"crayon16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x5D, 0x25, 0x40, 0},
-	  {0xEF, 0x36, 0x4B, 0},
-	  {0x67, 0x2C, 0x26, 0},
-	  {0xFF, 0x75, 0x2A, 0},
-	  {0x6F, 0x5A, 0x1D, 0},
-	  {0xFF, 0xF3, 0x41, 0},
-	  {0x21, 0x5A, 0x39, 0},
-	  {0x49, 0xDC, 0x41, 0},
-	  {0x2E, 0x60, 0x8E, 0},
-	  {0x3B, 0xCC, 0xF8, 0},
-	  {0x2B, 0x2B, 0x63, 0},
-	  {0xA1, 0x4F, 0xF1, 0},
-	  {0x71, 0x71, 0x71, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x29, 0x29, 0x29, 0}}},
-	/* 353 */
-	{"terminal",
-	 {{0x32, 0x32, 0x32, 0},
-	  {0x53, 0x53, 0x53, 0},
-	  {0xD2, 0x52, 0x52, 0},
-	  {0xF0, 0x70, 0x70, 0},
-	  {0x7F, 0xE1, 0x73, 0},
-	  {0x9D, 0xFF, 0x91, 0},
-	  {0xFF, 0xC6, 0x6D, 0},
-	  {0xFF, 0xE4, 0x8B, 0},
-	  {0x40, 0x99, 0xFF, 0},
-	  {0x5E, 0xB7, 0xF7, 0},
-	  {0xF6, 0x80, 0xFF, 0},
-	  {0xFF, 0x9D, 0xFF, 0},
-	  {0xBE, 0xD6, 0xFF, 0},
-	  {0xDC, 0xF4, 0xFF, 0},
-	  {0xEE, 0xEE, 0xEC, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 354 */
-	{"artnouveau",
-	 {{0xE9, 0x5C, 0x4B, 0},
-	  {0xA4, 0xF4, 0xF9, 0},
-	  {0xE1, 0xA9, 0x5F, 0},
-	  {0x72, 0xA0, 0xC1, 0},
-	  {0x8A, 0x79, 0x5D, 0},
-	  {0xFF, 0xB3, 0xDE, 0},
-	  {0xFF, 0xCC, 0x33, 0},
-	  {0x55, 0x6B, 0x2F, 0},
-	  {0x55, 0x1F, 0x2F, 0},
-	  {0x08, 0x45, 0x7E, 0},
-	  {0x88, 0x78, 0xC3, 0},
-	  {0xAA, 0x6C, 0x39, 0},
-	  {0x00, 0xDE, 0xA4, 0},
-	  {0xFF, 0xE5, 0xB4, 0},
-	  {0xC5, 0xB3, 0x58, 0},
-	  {0x23, 0x1E, 0x20, 0}}},
-	/* 355 */
-	{"jw64",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x40, 0x40, 0x40, 0},
-	  {0x8C, 0x8C, 0x8C, 0},
-	  {0xC8, 0xC8, 0xC8, 0},
-	  {0x64, 0x40, 0x20, 0},
-	  {0xA8, 0x2F, 0x2F, 0},
-	  {0xB4, 0x64, 0x29, 0},
-	  {0xE0, 0x80, 0x6C, 0},
-	  {0x40, 0x3F, 0xC0, 0},
-	  {0x64, 0x96, 0xF4, 0},
-	  {0x63, 0xD4, 0xF0, 0},
-	  {0xE0, 0xE0, 0x40, 0},
-	  {0xB4, 0x37, 0xB4, 0},
-	  {0x54, 0xC0, 0x48, 0},
-	  {0xA0, 0xF6, 0x6E, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 356 */
-	{"tyba16",
-	 {{0xB2, 0xD5, 0xD1, 0},
-	  {0x9F, 0xA0, 0x89, 0},
-	  {0x68, 0x6F, 0x6F, 0},
-	  {0x33, 0x33, 0x40, 0},
-	  {0x08, 0x00, 0x1F, 0},
-	  {0x75, 0x99, 0xD0, 0},
-	  {0x4A, 0x78, 0x85, 0},
-	  {0x5C, 0x6A, 0x53, 0},
-	  {0x42, 0x53, 0x5A, 0},
-	  {0x2F, 0x45, 0x41, 0},
-	  {0xB1, 0x86, 0x52, 0},
-	  {0x9C, 0x5D, 0x36, 0},
-	  {0x61, 0x44, 0x1B, 0},
-	  {0xB5, 0x87, 0x8D, 0},
-	  {0x69, 0x5E, 0x70, 0},
-	  {0x74, 0x52, 0x42, 0}}},
-	/* 357 */
-	{"rabbitjump",
-	 {{0xE0, 0xE0, 0xE0, 0},
-	  {0xE0, 0xC0, 0x40, 0},
-	  {0xE0, 0x60, 0x20, 0},
-	  {0xE0, 0x00, 0x00, 0},
-	  {0xA0, 0x00, 0x00, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x80, 0x80, 0x80, 0},
-	  {0xA0, 0xA0, 0xA0, 0},
-	  {0xA0, 0x80, 0x40, 0},
-	  {0x00, 0x80, 0x00, 0},
-	  {0x00, 0x60, 0x00, 0},
-	  {0x00, 0x40, 0x00, 0},
-	  {0x20, 0x80, 0xA0, 0},
-	  {0x00, 0x60, 0x60, 0},
-	  {0xE0, 0xA0, 0xA0, 0},
-	  {0xC0, 0x60, 0x60, 0}}},
-	/* 358 */
-	{"kq16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xA3, 0xA3, 0xA3, 0},
-	  {0x4E, 0x4E, 0x4E, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xE5, 0xA8, 0xB9, 0},
-	  {0xCA, 0xB7, 0x8B, 0},
-	  {0x80, 0xC6, 0xB8, 0},
-	  {0x9D, 0xBB, 0xE6, 0},
-	  {0x9F, 0x67, 0x78, 0},
-	  {0x86, 0x76, 0x4C, 0},
-	  {0x3D, 0x83, 0x76, 0},
-	  {0x5A, 0x79, 0xA1, 0},
-	  {0x5D, 0x2B, 0x3C, 0},
-	  {0x46, 0x3A, 0x14, 0},
-	  {0x00, 0x44, 0x3B, 0},
-	  {0x17, 0x3D, 0x61, 0}}},
-	/* 359 */
-	{"pac16",
-	 {{0xDE, 0xDE, 0xFF, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xFF, 0xB7, 0x51, 0},
-	  {0xDE, 0x97, 0x51, 0},
-	  {0xB9, 0x68, 0x32, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x21, 0x21, 0xFF, 0},
-	  {0x4C, 0xB7, 0xD6, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0x21, 0xB8, 0x00, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0x97, 0xFF, 0x00, 0},
-	  {0xFF, 0xB7, 0xFF, 0},
-	  {0xFF, 0x21, 0xAE, 0},
-	  {0x97, 0x97, 0xAE, 0}}},
-	/* 360 */
-	{"chipschallengeamigaatarist",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xDD, 0xDD, 0xFF, 0},
-	  {0x99, 0x99, 0xDD, 0},
-	  {0x66, 0x66, 0x99, 0},
-	  {0x44, 0x44, 0x66, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xDD, 0x66, 0x99, 0},
-	  {0x00, 0xBB, 0x00, 0},
-	  {0x66, 0xFF, 0xFF, 0},
-	  {0x00, 0xBB, 0xFF, 0},
-	  {0x00, 0x66, 0xFF, 0},
-	  {0x00, 0x00, 0xBB, 0},
-	  {0xFF, 0xDD, 0x00, 0},
-	  {0xDD, 0x66, 0x00, 0},
-	  {0xBB, 0x00, 0x00, 0},
-	  {0x66, 0x44, 0x00, 0}}},
-	/* 361 */
-	{"thebtlofcol",
-	 {{0x5B, 0x2B, 0x2B, 0},
-	  {0x98, 0x4A, 0x49, 0},
-	  {0xC5, 0x93, 0x92, 0},
-	  {0xF3, 0xDC, 0xDC, 0},
-	  {0x2C, 0x49, 0x5B, 0},
-	  {0x49, 0x7A, 0x98, 0},
-	  {0x92, 0xB1, 0xC5, 0},
-	  {0xDC, 0xE9, 0xF3, 0},
-	  {0x92, 0x5F, 0x3D, 0},
-	  {0xC9, 0x93, 0x50, 0},
-	  {0xCF, 0xBD, 0x5E, 0},
-	  {0x7D, 0x83, 0x5C, 0},
-	  {0x1E, 0x1A, 0x1E, 0},
-	  {0x43, 0x3A, 0x43, 0},
-	  {0x71, 0x62, 0x71, 0},
-	  {0xAC, 0xA2, 0xAC, 0}}},
-	/* 362 */
-	{"sweets16",
-	 {{0x0C, 0x0C, 0x0C, 0},
-	  {0x18, 0x18, 0x18, 0},
-	  {0x55, 0x41, 0x5F, 0},
-	  {0x75, 0x55, 0x79, 0},
-	  {0x64, 0xB9, 0x64, 0},
-	  {0x7D, 0xDE, 0x99, 0},
-	  {0xD7, 0x73, 0x55, 0},
-	  {0xEA, 0x81, 0x65, 0},
-	  {0xE6, 0xE2, 0xCF, 0},
-	  {0xFF, 0xFB, 0xEA, 0},
-	  {0x50, 0x8C, 0xD7, 0},
-	  {0x7D, 0xAE, 0xDE, 0},
-	  {0x81, 0x91, 0x81, 0},
-	  {0x9D, 0xB2, 0x9D, 0},
-	  {0x95, 0x00, 0x48, 0},
-	  {0xB2, 0x1C, 0x65, 0}}},
-	/* 363 */
-	{"deluxepaintataristpalette",
-	 {{0x07, 0x07, 0x07, 0},
-	  {0x4A, 0x4A, 0x4A, 0},
-	  {0x8E, 0x8E, 0x8E, 0},
-	  {0xD1, 0xD1, 0xD1, 0},
-	  {0xF3, 0xF3, 0xF3, 0},
-	  {0xF3, 0xD1, 0xAF, 0},
-	  {0xD1, 0x8E, 0x6C, 0},
-	  {0x8E, 0x4A, 0x4A, 0},
-	  {0xF3, 0x07, 0x07, 0},
-	  {0xF3, 0x6C, 0x07, 0},
-	  {0xF3, 0xF3, 0x07, 0},
-	  {0x07, 0xD1, 0x07, 0},
-	  {0x07, 0x6C, 0x07, 0},
-	  {0x07, 0xD1, 0xF3, 0},
-	  {0x07, 0x07, 0xF3, 0},
-	  {0xD1, 0x07, 0xD1, 0}}},
-	/* 364 */
-	{"nethack",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x00, 0xB6, 0xFF, 0},
-	  {0xFF, 0x6C, 0x00, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0x00, 0x91, 0x00, 0},
-	  {0x6C, 0xFF, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0x91, 0x47, 0x00, 0},
-	  {0xCC, 0x4F, 0x00, 0},
-	  {0xFF, 0xB6, 0x91, 0},
-	  {0x47, 0x6C, 0x6C, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xDA, 0xDA, 0xB6, 0},
-	  {0x6C, 0x91, 0xB6, 0}}},
-	/* 365 */
-	{"pastari16",
-	 {{0x00, 0x2A, 0x33, 0},
-	  {0x40, 0x41, 0x40, 0},
-	  {0x59, 0x1A, 0x4C, 0},
-	  {0x31, 0x20, 0x98, 0},
-	  {0x90, 0x90, 0x90, 0},
-	  {0x1C, 0x5C, 0x48, 0},
-	  {0x44, 0x28, 0x00, 0},
-	  {0x85, 0x45, 0x14, 0},
-	  {0x5C, 0x9C, 0x5C, 0},
-	  {0xAC, 0x78, 0x3C, 0},
-	  {0x9C, 0x20, 0x20, 0},
-	  {0x51, 0x5C, 0xC0, 0},
-	  {0xEC, 0xEC, 0xEC, 0},
-	  {0xFC, 0xE0, 0x8C, 0},
-	  {0xFC, 0xBC, 0x94, 0},
-	  {0x56, 0xB2, 0xC0, 0}}},
-	/* 366 */
-	{"kikisaturare",
-	 {{0x97, 0xC7, 0xC3, 0},
-	  {0x8C, 0x7C, 0xC4, 0},
-	  {0x36, 0x4D, 0x6A, 0},
-	  {0xA3, 0x44, 0xA2, 0},
-	  {0xE2, 0x87, 0xB0, 0},
-	  {0x7E, 0x6A, 0x76, 0},
-	  {0x54, 0x44, 0x44, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xEF, 0xF3, 0xF3, 0},
-	  {0x27, 0x5D, 0x2F, 0},
-	  {0x43, 0x8B, 0x64, 0},
-	  {0x7F, 0xB1, 0x34, 0},
-	  {0xB7, 0xE0, 0x4F, 0},
-	  {0x74, 0x6E, 0x37, 0},
-	  {0xC4, 0x92, 0x44, 0},
-	  {0xB5, 0x50, 0x25, 0}}},
-	/* 367 */
-	{"gamebuino",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xA8, 0x99, 0x87, 0},
-	  {0x54, 0x4D, 0x43, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x96, 0x00, 0x40, 0},
-	  {0xCF, 0x44, 0x85, 0},
-	  {0xDB, 0x1D, 0x23, 0},
-	  {0xFF, 0xA8, 0x11, 0},
-	  {0xCF, 0x8E, 0x44, 0},
-	  {0xFF, 0xD6, 0x90, 0},
-	  {0xF5, 0xE7, 0x00, 0},
-	  {0x85, 0xCF, 0x44, 0},
-	  {0x00, 0x8B, 0x50, 0},
-	  {0x00, 0x43, 0x85, 0},
-	  {0x44, 0x85, 0xCF, 0},
-	  {0x7D, 0xBB, 0xFF, 0}}},
-	/* 368 */
-	{"ibm1553crt",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x00, 0x00, 0xAA, 0},
-	  {0x00, 0xC4, 0x00, 0},
-	  {0x00, 0xC4, 0xC4, 0},
-	  {0xC4, 0x00, 0x00, 0},
-	  {0xC4, 0x00, 0xC4, 0},
-	  {0xC4, 0x7E, 0x00, 0},
-	  {0xC4, 0xC4, 0xC4, 0},
-	  {0x4E, 0x4E, 0x4E, 0},
-	  {0x3E, 0x3E, 0xDC, 0},
-	  {0x4E, 0xDC, 0x4E, 0},
-	  {0x4E, 0xF3, 0xF3, 0},
-	  {0xDC, 0x4E, 0x4E, 0},
-	  {0xF3, 0x4E, 0xF3, 0},
-	  {0xF3, 0xF3, 0x4E, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 369 */
-	{"dafridgesadventures",
-	 {{0x12, 0x12, 0x14, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x92, 0x92, 0x92, 0},
-	  {0x04, 0x3D, 0x13, 0},
-	  {0x00, 0x5B, 0x04, 0},
-	  {0x72, 0x9F, 0x41, 0},
-	  {0x13, 0x34, 0x5A, 0},
-	  {0x25, 0x56, 0x8F, 0},
-	  {0x4B, 0x99, 0xB5, 0},
-	  {0x52, 0x32, 0x09, 0},
-	  {0x82, 0x51, 0x11, 0},
-	  {0xB5, 0x78, 0x28, 0},
-	  {0xEA, 0x30, 0x30, 0},
-	  {0xAC, 0x32, 0x32, 0},
-	  {0xFF, 0xA8, 0x11, 0},
-	  {0xEA, 0xD3, 0xAE, 0}}},
-	/* 370 */
-	{"magus",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x40, 0x40, 0x40, 0},
-	  {0x60, 0x60, 0x60, 0},
-	  {0x80, 0x80, 0x80, 0},
-	  {0xE0, 0xE0, 0xE0, 0},
-	  {0x40, 0x60, 0xE0, 0},
-	  {0x00, 0x20, 0xE0, 0},
-	  {0x00, 0x80, 0x00, 0},
-	  {0x00, 0xE0, 0x00, 0},
-	  {0xE0, 0xE0, 0x00, 0},
-	  {0xE0, 0x60, 0x00, 0},
-	  {0xE0, 0x00, 0x00, 0},
-	  {0x80, 0x00, 0x00, 0},
-	  {0x60, 0x20, 0x20, 0},
-	  {0x80, 0x40, 0x20, 0},
-	  {0xA0, 0x80, 0x40, 0}}},
-	/* 371 */
-	{"ggos",
-	 {{0xEF, 0xF9, 0xFF, 0},
-	  {0x7A, 0x85, 0x99, 0},
-	  {0x2A, 0x2D, 0x49, 0},
-	  {0x04, 0x00, 0x0F, 0},
-	  {0xE5, 0x19, 0x19, 0},
-	  {0xA5, 0x17, 0x23, 0},
-	  {0xF9, 0x5C, 0x22, 0},
-	  {0xF9, 0xD2, 0x22, 0},
-	  {0xFF, 0x99, 0x5E, 0},
-	  {0x22, 0xF9, 0xD2, 0},
-	  {0x0E, 0x6B, 0xB7, 0},
-	  {0x00, 0x0B, 0x89, 0},
-	  {0x00, 0x82, 0x2F, 0},
-	  {0x41, 0xEA, 0x41, 0},
-	  {0x72, 0x00, 0x33, 0},
-	  {0xEA, 0x7C, 0xC4, 0}}},
-	/* 372 */
-	{"ajmsx",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x55, 0x55, 0x55, 0},
-	  {0xAA, 0xAA, 0xAA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0xAA, 0xAA, 0},
-	  {0xAA, 0x55, 0x55, 0},
-	  {0x55, 0x00, 0x00, 0},
-	  {0x55, 0x55, 0x00, 0},
-	  {0xAA, 0xAA, 0x55, 0},
-	  {0xAA, 0xFF, 0xAA, 0},
-	  {0x55, 0xAA, 0x55, 0},
-	  {0x00, 0x55, 0x00, 0},
-	  {0x55, 0xAA, 0xAA, 0},
-	  {0xAA, 0xAA, 0xFF, 0},
-	  {0x55, 0x55, 0xAA, 0},
-	  {0xAA, 0x55, 0xAA, 0}}},
-	/* 373 */
-	{"huemeister",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x55, 0x55, 0x55, 0},
-	  {0xAA, 0xAA, 0xAA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0x33, 0x99, 0},
-	  {0xFF, 0x44, 0x44, 0},
-	  {0xEE, 0x77, 0x00, 0},
-	  {0x99, 0x99, 0x00, 0},
-	  {0x55, 0xAA, 0x00, 0},
-	  {0x00, 0xCC, 0x00, 0},
-	  {0x00, 0xCC, 0x66, 0},
-	  {0x00, 0xBB, 0xBB, 0},
-	  {0x11, 0x88, 0xFF, 0},
-	  {0x66, 0x66, 0xFF, 0},
-	  {0xAA, 0x55, 0xFF, 0},
-	  {0xFF, 0x33, 0xFF, 0}}},
-	/* 374 */
-	{"c64saturated",
-	 {{0xFF, 0x00, 0x00, 0},
-	  {0xFF, 0x80, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0x80, 0xFF, 0x80, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0x80, 0x80, 0xFF, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0xFF, 0x80, 0x80, 0},
-	  {0x80, 0x40, 0x00, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x40, 0x40, 0x40, 0},
-	  {0x80, 0x80, 0x80, 0},
-	  {0xC0, 0xC0, 0xC0, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 375 */
-	{"swordp",
-	 {{0x22, 0x5F, 0x74, 0},
-	  {0x68, 0x9B, 0xAC, 0},
-	  {0xA7, 0xD9, 0xEA, 0},
-	  {0xD7, 0xED, 0xF6, 0},
-	  {0x4D, 0x2C, 0x00, 0},
-	  {0x61, 0x41, 0x15, 0},
-	  {0x87, 0x59, 0x1A, 0},
-	  {0xC8, 0x81, 0x24, 0},
-	  {0x81, 0x3D, 0x3D, 0},
-	  {0xAB, 0x26, 0x26, 0},
-	  {0xBF, 0x41, 0x41, 0},
-	  {0xD3, 0x79, 0x79, 0},
-	  {0x43, 0x43, 0x43, 0},
-	  {0x6B, 0x6B, 0x6B, 0},
-	  {0x98, 0x98, 0x98, 0},
-	  {0xB8, 0xB8, 0xB8, 0}}},
-	/* 376 */
-	{"atarist",
-	 {{0xE0, 0xE0, 0xE0, 0},
-	  {0xA0, 0xA0, 0xA0, 0},
-	  {0x60, 0x60, 0x60, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xE0, 0xE0, 0x20, 0},
-	  {0xA0, 0x60, 0x00, 0},
-	  {0x20, 0xE0, 0xE0, 0},
-	  {0x00, 0xA0, 0xA0, 0},
-	  {0xE0, 0x20, 0xE0, 0},
-	  {0xA0, 0x00, 0xA0, 0},
-	  {0x20, 0xE0, 0x20, 0},
-	  {0x00, 0xA0, 0x00, 0},
-	  {0xE0, 0x80, 0x80, 0},
-	  {0xA0, 0x00, 0x00, 0},
-	  {0x60, 0x60, 0xE0, 0},
-	  {0x00, 0x00, 0xA0, 0}}},
-	/* 377 */
-	{"babyjoingoinghome",
-	 {{0xF0, 0xE0, 0xE0, 0},
-	  {0x90, 0x80, 0x80, 0},
-	  {0x50, 0x40, 0x40, 0},
-	  {0x30, 0x30, 0x40, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x10, 0x30, 0x20, 0},
-	  {0x30, 0x60, 0x40, 0},
-	  {0x50, 0xA0, 0x80, 0},
-	  {0x60, 0xB0, 0xF0, 0},
-	  {0x10, 0x60, 0xF0, 0},
-	  {0x30, 0x00, 0x00, 0},
-	  {0x70, 0x20, 0x20, 0},
-	  {0xE0, 0x30, 0x30, 0},
-	  {0xE0, 0x60, 0x40, 0},
-	  {0xF0, 0x80, 0x80, 0},
-	  {0xF0, 0xB0, 0x40, 0}}},
-	/* 378 */
-	{"slimep16",
-	 {{0xF7, 0xFF, 0xF4, 0},
-	  {0x6A, 0xF2, 0x40, 0},
-	  {0x1C, 0xD6, 0x4B, 0},
-	  {0x12, 0xBB, 0x69, 0},
-	  {0x07, 0x8B, 0x6E, 0},
-	  {0x01, 0x26, 0x31, 0},
-	  {0xFF, 0xA7, 0xC6, 0},
-	  {0xF4, 0x78, 0xB4, 0},
-	  {0xEC, 0x2B, 0xA2, 0},
-	  {0xB9, 0x0C, 0xBB, 0},
-	  {0x2D, 0x05, 0x3C, 0},
-	  {0x58, 0xE1, 0xF6, 0},
-	  {0x40, 0xAB, 0xE5, 0},
-	  {0x1D, 0x6D, 0xC7, 0},
-	  {0x1D, 0x27, 0xA9, 0},
-	  {0x15, 0x07, 0x65, 0}}},
-	/* 379 */
-	{"tywo16",
-	 {{0xCF, 0xCF, 0xCF, 0},
-	  {0x86, 0xAA, 0xCF, 0},
-	  {0x5C, 0x77, 0x81, 0},
-	  {0x44, 0x47, 0x60, 0},
-	  {0xDB, 0xB9, 0x58, 0},
-	  {0x84, 0x95, 0x4C, 0},
-	  {0x41, 0x65, 0x5A, 0},
-	  {0x35, 0x35, 0x35, 0},
-	  {0xC5, 0x9E, 0x77, 0},
-	  {0xC5, 0x82, 0x4D, 0},
-	  {0x85, 0x6B, 0x3E, 0},
-	  {0x5A, 0x44, 0x39, 0},
-	  {0x8A, 0x7F, 0x6C, 0},
-	  {0x81, 0x4E, 0x4A, 0},
-	  {0x45, 0x27, 0x27, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 380 */
-	{"random16",
-	 {{0x06, 0x0A, 0x0D, 0},
-	  {0x1F, 0x2D, 0x48, 0},
-	  {0x73, 0x89, 0xA4, 0},
-	  {0xAD, 0xBE, 0xC6, 0},
-	  {0xFF, 0xFA, 0xF4, 0},
-	  {0xF1, 0xE4, 0x8C, 0},
-	  {0xEE, 0xA9, 0x47, 0},
-	  {0xA1, 0x6B, 0x32, 0},
-	  {0x5F, 0x38, 0x20, 0},
-	  {0xCD, 0x59, 0x50, 0},
-	  {0xEA, 0x92, 0x7D, 0},
-	  {0xAC, 0x65, 0xD8, 0},
-	  {0x3D, 0x77, 0xB8, 0},
-	  {0x93, 0xDC, 0xEE, 0},
-	  {0x87, 0xD2, 0x37, 0},
-	  {0x25, 0x5E, 0x29, 0}}},
-	/* 381 */
-	{"cybercade",
-	 {{0xC6, 0xD7, 0xFE, 0},
-	  {0x75, 0x75, 0x75, 0},
-	  {0x33, 0x33, 0x60, 0},
-	  {0x17, 0x17, 0x22, 0},
-	  {0x00, 0x00, 0x05, 0},
-	  {0xF9, 0x7D, 0x01, 0},
-	  {0xD8, 0x09, 0x01, 0},
-	  {0x42, 0x0D, 0x1F, 0},
-	  {0x12, 0x03, 0x20, 0},
-	  {0x00, 0xB3, 0x5A, 0},
-	  {0x01, 0x89, 0x06, 0},
-	  {0x01, 0x54, 0x04, 0},
-	  {0x0F, 0x2C, 0x11, 0},
-	  {0x01, 0x55, 0xC4, 0},
-	  {0x00, 0x24, 0x98, 0},
-	  {0x00, 0x06, 0x5E, 0}}},
-	/* 382 */
-	{"def16",
-	 {{0xE8, 0xE4, 0xBA, 0},
-	  {0xE6, 0xC6, 0x6E, 0},
-	  {0x9B, 0xD9, 0x8F, 0},
-	  {0x91, 0xB5, 0x7E, 0},
-	  {0x41, 0xB5, 0x47, 0},
-	  {0xD9, 0x78, 0x4E, 0},
-	  {0xB8, 0x9F, 0x7B, 0},
-	  {0x84, 0xA2, 0xC9, 0},
-	  {0x42, 0x93, 0xAB, 0},
-	  {0x86, 0xB8, 0xB6, 0},
-	  {0xD4, 0x88, 0xAE, 0},
-	  {0xD4, 0x74, 0xD4, 0},
-	  {0x6C, 0x84, 0xC7, 0},
-	  {0xC2, 0x46, 0x95, 0},
-	  {0xA2, 0x6D, 0xC7, 0},
-	  {0x3F, 0x59, 0xD9, 0}}},
-	/* 383 */
-	{"isolated16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x55, 0x55, 0x55, 0},
-	  {0xAA, 0xAA, 0xAA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x55, 0x00, 0x00, 0},
-	  {0xAA, 0x55, 0x66, 0},
-	  {0xFF, 0xAA, 0xDD, 0},
-	  {0x55, 0x33, 0x00, 0},
-	  {0xAA, 0x99, 0x55, 0},
-	  {0xFF, 0xFF, 0xAA, 0},
-	  {0x00, 0x55, 0x44, 0},
-	  {0x55, 0xAA, 0x77, 0},
-	  {0xAA, 0xFF, 0xAA, 0},
-	  {0x00, 0x11, 0x55, 0},
-	  {0x55, 0x77, 0xAA, 0},
-	  {0xAA, 0xDD, 0xFF, 0}}},
-	/* 384 */
-	{"nyankos16",
-	 {{0x10, 0x10, 0x10, 0},
-	  {0x33, 0x33, 0x33, 0},
-	  {0x66, 0x66, 0x66, 0},
-	  {0xF8, 0xF8, 0xF8, 0},
-	  {0x9C, 0x32, 0x47, 0},
-	  {0xCC, 0x66, 0xA0, 0},
-	  {0xFF, 0x99, 0xD4, 0},
-	  {0xA0, 0x42, 0x10, 0},
-	  {0xF7, 0xC0, 0x7B, 0},
-	  {0xFF, 0xE9, 0xCC, 0},
-	  {0xE0, 0x18, 0x18, 0},
-	  {0x00, 0x4E, 0xCC, 0},
-	  {0x63, 0x9C, 0xF8, 0},
-	  {0x00, 0x7F, 0x1D, 0},
-	  {0x00, 0xD0, 0x30, 0},
-	  {0x7F, 0xFF, 0x9C, 0}}},
-	/* 385 */
-	{"retrorainbow",
-	 {{0xC3, 0xEA, 0x72, 0},
-	  {0x43, 0x69, 0x31, 0},
-	  {0x0F, 0x51, 0x3A, 0},
-	  {0xDF, 0xAF, 0x6E, 0},
-	  {0xB4, 0x5A, 0x32, 0},
-	  {0x5C, 0x12, 0x2F, 0},
-	  {0x6B, 0xD2, 0x97, 0},
-	  {0x3D, 0x46, 0x8B, 0},
-	  {0x44, 0x2F, 0x69, 0},
-	  {0x12, 0x04, 0x36, 0},
-	  {0xE1, 0xD3, 0x88, 0},
-	  {0xBF, 0xBC, 0x48, 0},
-	  {0x63, 0x72, 0x22, 0},
-	  {0xEE, 0xB8, 0xD2, 0},
-	  {0xB8, 0x4D, 0xA2, 0},
-	  {0x71, 0x2F, 0x85, 0}}},
-	/* 386 */
-	{"cgacomposite",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x00, 0x6E, 0x2D, 0},
-	  {0x2D, 0x02, 0xFF, 0},
-	  {0x00, 0x8B, 0xFF, 0},
-	  {0xA9, 0x00, 0x2D, 0},
-	  {0x77, 0x76, 0x77, 0},
-	  {0xEC, 0x09, 0xFF, 0},
-	  {0xBB, 0x92, 0xFD, 0},
-	  {0x2D, 0x5A, 0x00, 0},
-	  {0x00, 0xDC, 0x00, 0},
-	  {0x76, 0x77, 0x77, 0},
-	  {0x45, 0xF4, 0xB9, 0},
-	  {0xEA, 0x65, 0x02, 0},
-	  {0xBC, 0xE5, 0x00, 0},
-	  {0xFF, 0x80, 0xBC, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 387 */
-	{"ultimavisharpx68000",
-	 {{0xE1, 0xE1, 0xE1, 0},
-	  {0xA5, 0xA5, 0xA5, 0},
-	  {0x4B, 0x4B, 0x4B, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xE1, 0xC3, 0xB4, 0},
-	  {0xE1, 0xA5, 0x78, 0},
-	  {0xA5, 0x5A, 0x0F, 0},
-	  {0xA5, 0x00, 0x00, 0},
-	  {0xE1, 0x1E, 0x00, 0},
-	  {0xE1, 0x4B, 0xE1, 0},
-	  {0xE1, 0xE1, 0x4B, 0},
-	  {0x4B, 0xE1, 0x4B, 0},
-	  {0x00, 0xA5, 0x00, 0},
-	  {0x00, 0x00, 0xA5, 0},
-	  {0x4B, 0x4B, 0xE1, 0},
-	  {0x4B, 0xE1, 0xE1, 0}}},
-	/* 388 */
-	{"sierraadventuresatarist",
-	 {{0xE0, 0xE0, 0xE0, 0},
-	  {0xA0, 0xA0, 0xA0, 0},
-	  {0x40, 0x40, 0x40, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xE0, 0xE0, 0x40, 0},
-	  {0xA0, 0x60, 0x00, 0},
-	  {0x60, 0xE0, 0xE0, 0},
-	  {0x40, 0x80, 0x80, 0},
-	  {0xE0, 0x60, 0xE0, 0},
-	  {0x80, 0x00, 0x80, 0},
-	  {0x80, 0xE0, 0x40, 0},
-	  {0x00, 0x80, 0x00, 0},
-	  {0xE0, 0x60, 0x40, 0},
-	  {0x80, 0x00, 0x00, 0},
-	  {0x00, 0x60, 0xE0, 0},
-	  {0x00, 0x00, 0xA0, 0}}},
-	/* 389 */
-	{"birthdayspc98titlescreen",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xAA, 0xAA, 0xAA, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xBB, 0xAA, 0xFF, 0},
-	  {0x66, 0x55, 0xDD, 0},
-	  {0x99, 0x44, 0xFF, 0},
-	  {0x88, 0x44, 0xAA, 0},
-	  {0x44, 0x33, 0x77, 0},
-	  {0xDD, 0x11, 0x66, 0},
-	  {0xFF, 0xCC, 0x33, 0},
-	  {0xFF, 0x66, 0xAA, 0},
-	  {0xFF, 0x99, 0xBB, 0},
-	  {0xFF, 0xDD, 0xCC, 0},
-	  {0xEE, 0xAA, 0x99, 0},
-	  {0xDD, 0x77, 0x55, 0},
-	  {0x99, 0x44, 0x11, 0}}},
-	/* 390 */
-	{"clubseoul16",
-	 {{0xF5, 0xF6, 0xF0, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x12, 0x1C, 0x26, 0},
-	  {0x24, 0x40, 0x51, 0},
-	  {0x5D, 0x7C, 0x90, 0},
-	  {0x5A, 0xA0, 0xA0, 0},
-	  {0x6F, 0xBC, 0x92, 0},
-	  {0xC6, 0xD6, 0xCB, 0},
-	  {0xD4, 0xDF, 0xE5, 0},
-	  {0x8B, 0x84, 0x50, 0},
-	  {0xDE, 0xB4, 0x3C, 0},
-	  {0xAC, 0x9E, 0x93, 0},
-	  {0xD9, 0xCE, 0xBC, 0},
-	  {0xFA, 0xB2, 0xA3, 0},
-	  {0xAE, 0x2F, 0x36, 0},
-	  {0x43, 0x4C, 0x47, 0}}},
-	/* 391 */
-	{"superbreakoutst",
-	 {{0xEF, 0xEF, 0xEF, 0},
-	  {0xCF, 0xCF, 0xCF, 0},
-	  {0xAF, 0xAF, 0xAF, 0},
-	  {0x8F, 0x8F, 0x8F, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x0F, 0x0F, 0xEF, 0},
-	  {0x6F, 0xAF, 0xCF, 0},
-	  {0x6F, 0xCF, 0xEF, 0},
-	  {0xEF, 0x6F, 0x6F, 0},
-	  {0xCF, 0x4F, 0x4F, 0},
-	  {0xEF, 0xAF, 0x2F, 0},
-	  {0xCF, 0x8F, 0x2F, 0},
-	  {0x0F, 0xEF, 0x0F, 0},
-	  {0x0F, 0xCF, 0x0F, 0},
-	  {0xEF, 0x0F, 0xEF, 0},
-	  {0xCF, 0x0F, 0xCF, 0}}},
-	/* 392 */
-	{"lp16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x57, 0x34, 0x49, 0},
-	  {0xAF, 0x3C, 0x7B, 0},
-	  {0xC8, 0x9B, 0xE3, 0},
-	  {0x7A, 0x7D, 0x91, 0},
-	  {0x0F, 0xF8, 0xAA, 0},
-	  {0x98, 0xF3, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xE5, 0x00, 0x10, 0},
-	  {0xFF, 0x91, 0x18, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0x83, 0xE5, 0x63, 0},
-	  {0x3D, 0xB6, 0x02, 0},
-	  {0xA1, 0xA2, 0x00, 0},
-	  {0x23, 0x7B, 0x4B, 0},
-	  {0x20, 0x60, 0xCE, 0}}},
-	/* 393 */
-	{"lex500alt",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x94, 0x9F, 0xBA, 0},
-	  {0x20, 0x20, 0x20, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0xFF, 0x00, 0x4D, 0},
-	  {0x80, 0x00, 0x1E, 0},
-	  {0xFF, 0x8A, 0x00, 0},
-	  {0x9E, 0x41, 0x00, 0},
-	  {0xFF, 0xFF, 0x3C, 0},
-	  {0x74, 0xFF, 0x27, 0},
-	  {0x00, 0x58, 0x2A, 0},
-	  {0x29, 0x69, 0xFF, 0},
-	  {0x13, 0x00, 0x3C, 0},
-	  {0xBF, 0x4C, 0xF1, 0},
-	  {0x62, 0x14, 0x68, 0},
-	  {0xFF, 0x5E, 0x85, 0}}},
-	/* 394 */
-	{"linksawakening",
-	 {{0x10, 0xAD, 0x42, 0},
-	  {0x00, 0x80, 0x00, 0},
-	  {0x00, 0x40, 0x00, 0},
-	  {0x19, 0x84, 0xFF, 0},
-	  {0x00, 0x39, 0x73, 0},
-	  {0xB5, 0x9C, 0xBD, 0},
-	  {0x63, 0x42, 0x73, 0},
-	  {0x3A, 0x19, 0x52, 0},
-	  {0xFF, 0x08, 0x29, 0},
-	  {0xDE, 0x00, 0x00, 0},
-	  {0xFF, 0xBD, 0x8C, 0},
-	  {0xFF, 0xFF, 0x8C, 0},
-	  {0xFF, 0xB5, 0x31, 0},
-	  {0x80, 0x40, 0x00, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x8C, 0x8C, 0xA5, 0}}},
-	/* 395 */
-	{"tydrpg16",
-	 {{0xBC, 0xC9, 0xCB, 0},
-	  {0x72, 0xAC, 0x92, 0},
-	  {0xB1, 0x79, 0x8C, 0},
-	  {0x79, 0x79, 0x97, 0},
-	  {0xA4, 0x99, 0x83, 0},
-	  {0x87, 0x83, 0x62, 0},
-	  {0x6A, 0x6D, 0x5B, 0},
-	  {0x60, 0x6A, 0x40, 0},
-	  {0x4E, 0x48, 0x43, 0},
-	  {0x39, 0x32, 0x17, 0},
-	  {0xC6, 0x91, 0x68, 0},
-	  {0x8D, 0x69, 0x59, 0},
-	  {0x7D, 0x49, 0x48, 0},
-	  {0x4E, 0x37, 0x2C, 0},
-	  {0x3E, 0x2E, 0x3D, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 396 */
-	{"orchard16",
-	 {{0x3B, 0x21, 0x06, 0},
-	  {0x4E, 0x29, 0x06, 0},
-	  {0x72, 0x3D, 0x0C, 0},
-	  {0xB3, 0x62, 0x06, 0},
-	  {0xD6, 0x83, 0x1E, 0},
-	  {0xD3, 0x96, 0x6F, 0},
-	  {0xF6, 0xC1, 0x83, 0},
-	  {0xE3, 0xE3, 0xBC, 0},
-	  {0x53, 0x77, 0x26, 0},
-	  {0x73, 0x9B, 0x2F, 0},
-	  {0x79, 0xB6, 0x26, 0},
-	  {0xA1, 0x3E, 0x2F, 0},
-	  {0x85, 0x37, 0x26, 0},
-	  {0x8B, 0xA3, 0xB6, 0},
-	  {0x73, 0x82, 0x8E, 0},
-	  {0x5C, 0x69, 0x75, 0}}},
-	/* 397 */
-	{"ak16",
-	 {{0x3F, 0x32, 0xAE, 0},
-	  {0xE3, 0x0E, 0xC2, 0},
-	  {0xBA, 0xAA, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0x94, 0x9D, 0},
-	  {0xE8, 0x02, 0x00, 0},
-	  {0x7A, 0x24, 0x3D, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x19, 0x56, 0x48, 0},
-	  {0x6A, 0x89, 0x27, 0},
-	  {0x16, 0xED, 0x75, 0},
-	  {0x32, 0xC1, 0xC3, 0},
-	  {0x05, 0x7F, 0xC1, 0},
-	  {0x6E, 0x4E, 0x23, 0},
-	  {0xC9, 0x8F, 0x4C, 0},
-	  {0xEF, 0xE3, 0x05, 0}}},
-	/* 398 */
-	{"softboy16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xFF, 0x71, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0x59, 0x00, 0xFF, 0},
-	  {0x7F, 0x00, 0x00, 0},
-	  {0x70, 0x2C, 0x00, 0},
-	  {0x7C, 0x7C, 0x00, 0},
-	  {0x00, 0x7C, 0x00, 0},
-	  {0x00, 0x00, 0x7C, 0},
-	  {0x29, 0x00, 0x7C, 0},
-	  {0xE2, 0x9F, 0x4D, 0},
-	  {0xE2, 0x61, 0x4D, 0}}},
-	/* 399 */
-	{"shp",
-	 {{0xAA, 0x00, 0x00, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xFF, 0xAA, 0x00, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0x00, 0xA7, 0x6B, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0x00, 0x80, 0xFF, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0x74, 0x00, 0xAA, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x7F, 0x7F, 0x7F, 0},
-	  {0x55, 0x55, 0x00, 0},
-	  {0x95, 0x32, 0x00, 0},
-	  {0xC1, 0x65, 0x70, 0},
-	  {0xFF, 0xAA, 0x80, 0}}},
-	/* 400 */
-	{"decoyworld2",
-	 {{0xC8, 0xE3, 0x96, 0},
-	  {0xA9, 0xD4, 0x9D, 0},
-	  {0xAC, 0xCD, 0xE0, 0},
-	  {0xD4, 0xC1, 0x8E, 0},
-	  {0xC7, 0x9E, 0x77, 0},
-	  {0xAD, 0x8D, 0x42, 0},
-	  {0x46, 0x8C, 0x36, 0},
-	  {0x9C, 0x33, 0x5A, 0},
-	  {0xE7, 0x9E, 0xEB, 0},
-	  {0xC8, 0x88, 0xCF, 0},
-	  {0xC4, 0x5E, 0xA4, 0},
-	  {0x52, 0x83, 0xBF, 0},
-	  {0x16, 0x5E, 0x4A, 0},
-	  {0x2A, 0x47, 0x78, 0},
-	  {0x18, 0x38, 0x54, 0},
-	  {0x1F, 0x0F, 0x3D, 0}}},
-	/* 401 */
-	{"icecream16",
-	 {{0x2C, 0x2C, 0x33, 0},
-	  {0x2A, 0xE5, 0x00, 0},
-	  {0x0A, 0xD1, 0x00, 0},
-	  {0x00, 0xA5, 0x1B, 0},
-	  {0x5D, 0x5F, 0x6B, 0},
-	  {0x72, 0xC2, 0xFF, 0},
-	  {0x3A, 0xAD, 0xFF, 0},
-	  {0x21, 0x62, 0xEF, 0},
-	  {0xC4, 0xBA, 0xBA, 0},
-	  {0xFC, 0xAF, 0x0A, 0},
-	  {0xFF, 0x5A, 0x07, 0},
-	  {0xE0, 0x2C, 0x00, 0},
-	  {0xFF, 0xFC, 0xF2, 0},
-	  {0xF9, 0x9A, 0xDB, 0},
-	  {0xEF, 0x70, 0xD8, 0},
-	  {0xD6, 0x4A, 0xCC, 0}}},
-	/* 402 */
-	{"raceyouhome",
-	 {{0x10, 0x4A, 0x8E, 0},
-	  {0x16, 0x63, 0xBE, 0},
-	  {0x1B, 0x7C, 0xED, 0},
-	  {0xBA, 0xC3, 0xFF, 0},
-	  {0xCD, 0x5E, 0x77, 0},
-	  {0xE8, 0x7E, 0xA1, 0},
-	  {0xFB, 0xB7, 0xC0, 0},
-	  {0xFD, 0xE0, 0xE0, 0},
-	  {0x1E, 0x56, 0x36, 0},
-	  {0x57, 0x8C, 0x49, 0},
-	  {0x5A, 0xAC, 0x44, 0},
-	  {0x99, 0xBE, 0x8F, 0},
-	  {0x0F, 0x08, 0x0E, 0},
-	  {0x4C, 0x2B, 0x21, 0},
-	  {0x66, 0x44, 0x2C, 0},
-	  {0x7C, 0x58, 0x35, 0}}},
-	/* 403 */
-	{"p64",
-	 {{0x00, 0x2D, 0x15, 0},
-	  {0x24, 0x60, 0x40, 0},
-	  {0x51, 0xA5, 0x9E, 0},
-	  {0xC1, 0xFF, 0xF9, 0},
-	  {0x8E, 0x49, 0x3A, 0},
-	  {0xE0, 0xA5, 0x98, 0},
-	  {0x2F, 0x88, 0xD9, 0},
-	  {0x2D, 0x33, 0x7A, 0},
-	  {0x7E, 0xB7, 0x79, 0},
-	  {0x2D, 0x82, 0x25, 0},
-	  {0xC6, 0xB1, 0x0F, 0},
-	  {0x72, 0x67, 0x13, 0},
-	  {0x72, 0x47, 0x13, 0},
-	  {0x9D, 0x59, 0xB7, 0},
-	  {0x57, 0x24, 0x6B, 0},
-	  {0xB2, 0xE4, 0xFF, 0}}},
-	/* 404 */
-	{"arcadian16",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x67, 0x39, 0x31, 0},
-	  {0xFF, 0xCC, 0xAA, 0},
-	  {0xF8, 0xC5, 0x3A, 0},
-	  {0xFF, 0xF0, 0x89, 0},
-	  {0x42, 0xAA, 0x5A, 0},
-	  {0x00, 0x87, 0x51, 0},
-	  {0x3D, 0x49, 0x77, 0},
-	  {0x67, 0x72, 0xA9, 0},
-	  {0x46, 0x47, 0x62, 0},
-	  {0x3A, 0x32, 0x77, 0},
-	  {0x9C, 0x8B, 0xDB, 0},
-	  {0x90, 0x52, 0xBC, 0},
-	  {0x7E, 0x25, 0x53, 0},
-	  {0xFF, 0x77, 0xA8, 0}}},
-	/* 405 */
-	{"",
-	 {{0x10, 0x10, 0x10, 0},
-	  {0x30, 0x30, 0x30, 0},
-	  {0x4C, 0x4C, 0x4C, 0},
-	  {0x6D, 0x6D, 0x6D, 0},
-	  {0x91, 0x91, 0x91, 0},
-	  {0xAE, 0xAE, 0xAE, 0},
-	  {0xCE, 0xCE, 0xCE, 0},
-	  {0xF2, 0xF2, 0xF2, 0},
-	  {0x48, 0x00, 0x04, 0},
-	  {0x81, 0x00, 0x00, 0},
-	  {0xC2, 0x00, 0x00, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0x0C, 0x34, 0x0C, 0},
-	  {0x44, 0x6D, 0x44, 0},
-	  {0x75, 0x95, 0x75, 0},
-	  {0xDE, 0xEE, 0xDE, 0}}},
-	/* 406 */
-	{"newergraphicsadapter",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xBF, 0xBF, 0xBF, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0x7F, 0x00, 0x00, 0},
-	  {0xFF, 0xBE, 0x00, 0},
-	  {0x7F, 0x5D, 0x00, 0},
-	  {0x6A, 0xFF, 0x00, 0},
-	  {0x35, 0x7F, 0x00, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0x7F, 0x00, 0x7F, 0},
-	  {0x00, 0x95, 0x69, 0},
-	  {0x00, 0x14, 0x0E, 0},
-	  {0x1D, 0x00, 0x7F, 0},
-	  {0x3E, 0x00, 0xFF, 0},
-	  {0x7F, 0x7F, 0x7F, 0},
-	  {0x00, 0x00, 0x00, 0}}},
-	/* 407 */
-	{"",
-	 {{0xE8, 0xE4, 0xDC, 0},
-	  {0x7E, 0x75, 0x67, 0},
-	  {0x22, 0x23, 0x23, 0},
-	  {0xD6, 0x24, 0x11, 0},
-	  {0x80, 0x40, 0x00, 0},
-	  {0xFF, 0x80, 0x00, 0},
-	  {0xFF, 0xEE, 0x00, 0},
-	  {0x80, 0x80, 0x00, 0},
-	  {0x5C, 0xCF, 0x13, 0},
-	  {0x55, 0xA8, 0x94, 0},
-	  {0x00, 0xC0, 0xC0, 0},
-	  {0x89, 0xCF, 0xF0, 0},
-	  {0x00, 0x40, 0x80, 0},
-	  {0xAA, 0x00, 0xFF, 0},
-	  {0xC0, 0x00, 0xC0, 0},
-	  {0xFF, 0xC0, 0xCB, 0}}},
-	/* 408 */
-	{"dosgg",
-	 {{0x24, 0x24, 0x24, 0},
-	  {0x00, 0x55, 0x55, 0},
-	  {0x00, 0x88, 0x88, 0},
-	  {0x55, 0xBB, 0xBB, 0},
-	  {0xCC, 0xCC, 0xCC, 0},
-	  {0xCC, 0x99, 0x99, 0},
-	  {0xBB, 0x55, 0x55, 0},
-	  {0xAA, 0x00, 0x00, 0},
-	  {0x77, 0x00, 0x77, 0},
-	  {0xAA, 0x00, 0xAA, 0},
-	  {0xCC, 0x22, 0xCC, 0},
-	  {0xCC, 0x88, 0xAA, 0},
-	  {0xCC, 0xCC, 0x88, 0},
-	  {0x55, 0xCC, 0x55, 0},
-	  {0x00, 0xAA, 0x00, 0},
-	  {0x00, 0x88, 0x00, 0}}},
-	/* 409 */
-	{"supaplex",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xB0, 0xB0, 0xB0, 0},
-	  {0x90, 0x90, 0x90, 0},
-	  {0x80, 0x80, 0x80, 0},
-	  {0x70, 0x70, 0x70, 0},
-	  {0x60, 0x60, 0x60, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x80, 0x40, 0x00, 0},
-	  {0xB0, 0x00, 0x00, 0},
-	  {0xE0, 0x10, 0x10, 0},
-	  {0xF0, 0x90, 0x40, 0},
-	  {0xE0, 0xE0, 0x00, 0},
-	  {0x00, 0xB0, 0x60, 0},
-	  {0x00, 0x80, 0x50, 0},
-	  {0x70, 0x90, 0xE0, 0},
-	  {0x50, 0x50, 0xD0, 0}}},
-	/* 410 */
-	{"preanortalium",
-	 {{0x12, 0x34, 0x56, 0},
-	  {0x26, 0x27, 0x37, 0},
-	  {0x39, 0x3A, 0x49, 0},
-	  {0x60, 0x4A, 0x6C, 0},
-	  {0x95, 0x68, 0x30, 0},
-	  {0x90, 0x8D, 0x41, 0},
-	  {0x88, 0x7B, 0x51, 0},
-	  {0x80, 0x72, 0x64, 0},
-	  {0x13, 0x68, 0x3D, 0},
-	  {0x42, 0x95, 0x53, 0},
-	  {0x71, 0x8F, 0x71, 0},
-	  {0x83, 0x94, 0x82, 0},
-	  {0x95, 0x2B, 0x29, 0},
-	  {0xA9, 0x32, 0x3E, 0},
-	  {0xB1, 0x44, 0x5D, 0},
-	  {0xB4, 0x6A, 0x91, 0}}},
-	/* 411 */
-	{"anotherretro",
-	 {{0xE6, 0x6A, 0x2C, 0},
-	  {0xFF, 0xC6, 0x4A, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x2E, 0x7D, 0xE6, 0},
-	  {0x80, 0xB7, 0xFF, 0},
-	  {0x59, 0x69, 0x2E, 0},
-	  {0x62, 0xAD, 0x39, 0},
-	  {0x73, 0x2A, 0x78, 0},
-	  {0xBA, 0x41, 0x9C, 0},
-	  {0xDE, 0x98, 0x3C, 0},
-	  {0xF5, 0xD5, 0x90, 0},
-	  {0x8C, 0x2E, 0x06, 0},
-	  {0xC9, 0x52, 0x1E, 0},
-	  {0x40, 0x40, 0x40, 0},
-	  {0xC0, 0xC0, 0xC0, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 412 */
-	{"machinie",
-	 {{0xF6, 0x4E, 0xC1, 0},
-	  {0x70, 0x2B, 0x5A, 0},
-	  {0x9C, 0x42, 0x7F, 0},
-	  {0xD7, 0x7B, 0xBA, 0},
-	  {0xFF, 0x69, 0x04, 0},
-	  {0x79, 0x39, 0x0D, 0},
-	  {0xAD, 0x5A, 0x21, 0},
-	  {0xEE, 0x8F, 0x4F, 0},
-	  {0x18, 0xE1, 0x90, 0},
-	  {0x11, 0x45, 0x30, 0},
-	  {0x1F, 0x68, 0x4A, 0},
-	  {0x48, 0xA4, 0x7F, 0},
-	  {0x12, 0x28, 0xAD, 0},
-	  {0x24, 0x30, 0x79, 0},
-	  {0x37, 0x5B, 0x9C, 0},
-	  {0x6E, 0x94, 0xD8, 0}}},
-	/* 413 */
-	{"erogecopper",
-	 {{0x0D, 0x08, 0x0D, 0},
-	  {0x4F, 0x2B, 0x24, 0},
-	  {0x82, 0x5B, 0x31, 0},
-	  {0xC5, 0x91, 0x54, 0},
-	  {0xF0, 0xBD, 0x77, 0},
-	  {0xFB, 0xDF, 0x9B, 0},
-	  {0xFF, 0xF9, 0xE4, 0},
-	  {0xBE, 0xBB, 0xB2, 0},
-	  {0x7B, 0xB2, 0x4E, 0},
-	  {0x74, 0xAD, 0xBB, 0},
-	  {0x41, 0x80, 0xA0, 0},
-	  {0x32, 0x53, 0x5F, 0},
-	  {0x2A, 0x23, 0x49, 0},
-	  {0x7D, 0x38, 0x40, 0},
-	  {0xC1, 0x6C, 0x5B, 0},
-	  {0xE8, 0x99, 0x73, 0}}},
-	/* 414 */
-	{"jmpjapanesemachinepalette",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x19, 0x10, 0x28, 0},
-	  {0x46, 0xAF, 0x45, 0},
-	  {0xA1, 0xD6, 0x85, 0},
-	  {0x45, 0x3E, 0x78, 0},
-	  {0x76, 0x64, 0xFE, 0},
-	  {0x83, 0x31, 0x29, 0},
-	  {0x9E, 0xC2, 0xE8, 0},
-	  {0xDC, 0x53, 0x4B, 0},
-	  {0xE1, 0x8D, 0x79, 0},
-	  {0xD6, 0xB9, 0x7B, 0},
-	  {0xE9, 0xD8, 0xA1, 0},
-	  {0x21, 0x6C, 0x4B, 0},
-	  {0xD3, 0x65, 0xC8, 0},
-	  {0xAF, 0xAA, 0xB9, 0},
-	  {0xF5, 0xF4, 0xEB, 0}}},
-	/* 415 */
-	{"castpixel16",
-	 {{0x2D, 0x1B, 0x2E, 0},
-	  {0x21, 0x8A, 0x91, 0},
-	  {0x3C, 0xC2, 0xFA, 0},
-	  {0x9A, 0xF6, 0xFD, 0},
-	  {0x4A, 0x24, 0x7C, 0},
-	  {0x57, 0x4B, 0x67, 0},
-	  {0x93, 0x7A, 0xC5, 0},
-	  {0x8A, 0xE2, 0x5D, 0},
-	  {0x8E, 0x2B, 0x45, 0},
-	  {0xF0, 0x41, 0x56, 0},
-	  {0xF2, 0x72, 0xCE, 0},
-	  {0xD3, 0xC0, 0xA8, 0},
-	  {0xC5, 0x75, 0x4A, 0},
-	  {0xF2, 0xA7, 0x59, 0},
-	  {0xF7, 0xDB, 0x53, 0},
-	  {0xF9, 0xF4, 0xEA, 0}}},
-	/* 416 */
-	{"fantasy16",
-	 {{0x8E, 0x6D, 0x34, 0},
-	  {0x51, 0x3A, 0x18, 0},
-	  {0x33, 0x27, 0x10, 0},
-	  {0x14, 0x13, 0x0C, 0},
-	  {0x46, 0x18, 0x20, 0},
-	  {0xA6, 0x3C, 0x1E, 0},
-	  {0xD3, 0x7B, 0x1E, 0},
-	  {0xE7, 0xBC, 0x4F, 0},
-	  {0xEE, 0xEE, 0xFA, 0},
-	  {0xD9, 0xD5, 0x5B, 0},
-	  {0x75, 0x73, 0x20, 0},
-	  {0x14, 0x21, 0x0F, 0},
-	  {0x04, 0x04, 0x05, 0},
-	  {0x1C, 0x1B, 0x2F, 0},
-	  {0x43, 0x50, 0x63, 0},
-	  {0x60, 0xA1, 0x8F, 0}}},
-	/* 417 */
-	{"arne16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x49, 0x3C, 0x2B, 0},
-	  {0xBE, 0x26, 0x33, 0},
-	  {0xE0, 0x6F, 0x8B, 0},
-	  {0x9D, 0x9D, 0x9D, 0},
-	  {0xA4, 0x64, 0x22, 0},
-	  {0xEB, 0x89, 0x31, 0},
-	  {0xF7, 0xE2, 0x6B, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x1B, 0x26, 0x32, 0},
-	  {0x2F, 0x48, 0x4E, 0},
-	  {0x44, 0x89, 0x1A, 0},
-	  {0xA3, 0xCE, 0x27, 0},
-	  {0x00, 0x57, 0x84, 0},
-	  {0x31, 0xA2, 0xF2, 0},
-	  {0xB2, 0xDC, 0xEF, 0}}},
-	/* 418 */
-	{"psygnosia",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x1B, 0x1E, 0x29, 0},
-	  {0x36, 0x27, 0x47, 0},
-	  {0x44, 0x3F, 0x41, 0},
-	  {0x52, 0x52, 0x4C, 0},
-	  {0x64, 0x64, 0x7C, 0},
-	  {0x73, 0x61, 0x50, 0},
-	  {0x77, 0x78, 0x5B, 0},
-	  {0x9E, 0xA4, 0xA7, 0},
-	  {0xCB, 0xE8, 0xF7, 0},
-	  {0xE0, 0x8B, 0x79, 0},
-	  {0xA2, 0x32, 0x4E, 0},
-	  {0x00, 0x33, 0x08, 0},
-	  {0x08, 0x4A, 0x3C, 0},
-	  {0x54, 0x6A, 0x00, 0},
-	  {0x51, 0x6C, 0xBF, 0}}},
-	/* 419 */
-	{"rplace",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xE4, 0xE4, 0xE4, 0},
-	  {0x88, 0x88, 0x88, 0},
-	  {0x22, 0x22, 0x22, 0},
-	  {0xFF, 0xA7, 0xD1, 0},
-	  {0xE5, 0x00, 0x00, 0},
-	  {0xE5, 0x95, 0x00, 0},
-	  {0xA0, 0x6A, 0x42, 0},
-	  {0xE5, 0xD9, 0x00, 0},
-	  {0x94, 0xE0, 0x44, 0},
-	  {0x02, 0xBE, 0x01, 0},
-	  {0x00, 0xD3, 0xDD, 0},
-	  {0x00, 0x83, 0xC7, 0},
-	  {0x00, 0x00, 0xEA, 0},
-	  {0xCF, 0x6E, 0xE4, 0},
-	  {0x82, 0x00, 0x80, 0}}},
-	/* 420 */
-	{"cgarne",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x5E, 0x60, 0x6E, 0},
-	  {0x22, 0x34, 0xD1, 0},
-	  {0x4C, 0x81, 0xFB, 0},
-	  {0x0C, 0x7E, 0x45, 0},
-	  {0x6C, 0xD9, 0x47, 0},
-	  {0x44, 0xAA, 0xCC, 0},
-	  {0x7B, 0xE2, 0xF9, 0},
-	  {0x8A, 0x36, 0x22, 0},
-	  {0xEB, 0x8A, 0x60, 0},
-	  {0x5C, 0x2E, 0x78, 0},
-	  {0xE2, 0x3D, 0x69, 0},
-	  {0xAA, 0x5C, 0x3D, 0},
-	  {0xFF, 0xD9, 0x3F, 0},
-	  {0xB5, 0xB5, 0xB5, 0},
-	  {0xFF, 0xFF, 0xFF, 0}}},
-	/* 421 */
-	{"a64",
-	 {{0x0B, 0x0B, 0x0B, 0},
-	  {0x56, 0x62, 0x62, 0},
-	  {0x8D, 0x8D, 0x85, 0},
-	  {0xA7, 0xB5, 0xBA, 0},
-	  {0xF0, 0xE9, 0xCF, 0},
-	  {0xD3, 0x9F, 0x80, 0},
-	  {0xB0, 0x70, 0x3E, 0},
-	  {0x5A, 0x41, 0x42, 0},
-	  {0xD1, 0xD1, 0x5B, 0},
-	  {0xA7, 0xD2, 0x54, 0},
-	  {0x58, 0xA2, 0x3C, 0},
-	  {0x7A, 0xC2, 0xE0, 0},
-	  {0x78, 0x6A, 0xFF, 0},
-	  {0x3E, 0x48, 0x9D, 0},
-	  {0x83, 0x63, 0xAD, 0},
-	  {0xC1, 0x48, 0x67, 0}}},
-	/* 422 */
-	{"dinoknight16",
-	 {{0x0F, 0x15, 0x1B, 0},
-	  {0x29, 0x27, 0x32, 0},
-	  {0x53, 0x58, 0x67, 0},
-	  {0x95, 0x92, 0x8F, 0},
-	  {0xF1, 0xF1, 0xEA, 0},
-	  {0xC5, 0x8D, 0x65, 0},
-	  {0x8D, 0x52, 0x42, 0},
-	  {0x51, 0x3D, 0x3D, 0},
-	  {0xEC, 0xD5, 0x6D, 0},
-	  {0xEA, 0x77, 0x30, 0},
-	  {0xCD, 0x3D, 0x3D, 0},
-	  {0x7C, 0x3F, 0x8C, 0},
-	  {0x30, 0x42, 0x71, 0},
-	  {0x00, 0x83, 0xC8, 0},
-	  {0x47, 0xA4, 0x4D, 0},
-	  {0x1F, 0x61, 0x43, 0}}},
-	/* 423 */
-	{"zxarne52",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x3C, 0x35, 0x1F, 0},
-	  {0x31, 0x33, 0x90, 0},
-	  {0x15, 0x59, 0xDB, 0},
-	  {0xA7, 0x32, 0x11, 0},
-	  {0xD8, 0x55, 0x25, 0},
-	  {0xA1, 0x55, 0x89, 0},
-	  {0xCD, 0x7A, 0x50, 0},
-	  {0x62, 0x9A, 0x31, 0},
-	  {0x9C, 0xD3, 0x3C, 0},
-	  {0x28, 0xA4, 0xCB, 0},
-	  {0x65, 0xDC, 0xD6, 0},
-	  {0xE8, 0xBC, 0x50, 0},
-	  {0xF1, 0xE7, 0x82, 0},
-	  {0xBF, 0xBF, 0xBD, 0},
-	  {0xF2, 0xF1, 0xED, 0}}},
-	/* 424 */
-	{"chromatic16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x90, 0xB0, 0xB0, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x80, 0x00, 0x18, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xA0, 0x50, 0x00, 0},
-	  {0xFF, 0x80, 0x00, 0},
-	  {0xFF, 0xC0, 0x80, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0x20, 0xAC, 0x00, 0},
-	  {0x40, 0xFF, 0x00, 0},
-	  {0x00, 0x30, 0x70, 0},
-	  {0x30, 0x70, 0xB0, 0},
-	  {0x00, 0xD0, 0xFF, 0},
-	  {0xA0, 0x00, 0xE0, 0},
-	  {0xFF, 0x60, 0xFF, 0}}},
-	/* 425 */
-	{"easterisland",
-	 {{0xF6, 0xF6, 0xBF, 0},
-	  {0xE6, 0xD1, 0xD1, 0},
-	  {0x86, 0x86, 0x91, 0},
-	  {0x79, 0x47, 0x65, 0},
-	  {0xF5, 0xE1, 0x7A, 0},
-	  {0xED, 0xC3, 0x8D, 0},
-	  {0xCC, 0x8D, 0x86, 0},
-	  {0xCA, 0x65, 0x7E, 0},
-	  {0x39, 0xD4, 0xB9, 0},
-	  {0x8D, 0xBC, 0xD2, 0},
-	  {0x81, 0x84, 0xAB, 0},
-	  {0x68, 0x60, 0x86, 0},
-	  {0x9D, 0xC0, 0x85, 0},
-	  {0x7E, 0xA7, 0x88, 0},
-	  {0x56, 0x78, 0x64, 0},
-	  {0x05, 0x16, 0x25, 0}}},
-	/* 426 */
-	{"coppertech",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x26, 0x21, 0x44, 0},
-	  {0x35, 0x52, 0x78, 0},
-	  {0x60, 0x74, 0x8A, 0},
-	  {0x89, 0x89, 0x89, 0},
-	  {0x5A, 0xA8, 0xB2, 0},
-	  {0x91, 0xD9, 0xF3, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xF4, 0xCD, 0x72, 0},
-	  {0xBF, 0xB5, 0x88, 0},
-	  {0xC5, 0x88, 0x43, 0},
-	  {0x9E, 0x5B, 0x47, 0},
-	  {0x5F, 0x43, 0x51, 0},
-	  {0xDC, 0x39, 0x2D, 0},
-	  {0x6E, 0xA9, 0x2C, 0},
-	  {0x16, 0x51, 0xDD, 0}}},
-	/* 427 */
-	{"night16",
-	 {{0x0F, 0x0F, 0x1E, 0},
-	  {0xFF, 0xF8, 0xBC, 0},
-	  {0x0C, 0x21, 0x33, 0},
-	  {0x48, 0x58, 0x6D, 0},
-	  {0x79, 0xA0, 0xB0, 0},
-	  {0xB0, 0xCE, 0x9D, 0},
-	  {0x65, 0x7F, 0x49, 0},
-	  {0x3F, 0x45, 0x36, 0},
-	  {0xB9, 0x9D, 0x6A, 0},
-	  {0xFF, 0xDD, 0x91, 0},
-	  {0xDD, 0x94, 0x5B, 0},
-	  {0x9A, 0x51, 0x42, 0},
-	  {0x64, 0x4B, 0x48, 0},
-	  {0x33, 0x30, 0x33, 0},
-	  {0x76, 0x70, 0x88, 0},
-	  {0xC5, 0xA3, 0xB3, 0}}},
-	/* 428 */
-	{"fun16",
-	 {{0x08, 0x00, 0x08, 0},
-	  {0x5E, 0x66, 0x60, 0},
-	  {0x2A, 0x34, 0x43, 0},
-	  {0x5D, 0x46, 0x32, 0},
-	  {0x44, 0x50, 0x8C, 0},
-	  {0xA6, 0x41, 0x4D, 0},
-	  {0xC8, 0x6B, 0x36, 0},
-	  {0x83, 0x75, 0xAF, 0},
-	  {0x52, 0x90, 0x3C, 0},
-	  {0xDB, 0x7E, 0xBD, 0},
-	  {0x5B, 0x99, 0xF4, 0},
-	  {0xDE, 0xAC, 0x85, 0},
-	  {0x94, 0xCC, 0x4E, 0},
-	  {0x84, 0xDB, 0xFC, 0},
-	  {0xF2, 0xDE, 0x70, 0},
-	  {0xFC, 0xFF, 0xFE, 0}}},
-	/* 429 */
-	{"cm16",
-	 {{0xE7, 0xEB, 0xF8, 0},
-	  {0xAD, 0xB1, 0xE0, 0},
-	  {0xB0, 0x6B, 0xB5, 0},
-	  {0x6D, 0x2E, 0xA4, 0},
-	  {0xAA, 0xE4, 0x74, 0},
-	  {0x14, 0xAD, 0xA0, 0},
-	  {0x59, 0x7A, 0xCD, 0},
-	  {0x7D, 0xC9, 0xDE, 0},
-	  {0xFF, 0xF7, 0xA7, 0},
-	  {0xFF, 0xBE, 0x6C, 0},
-	  {0xFF, 0x67, 0x73, 0},
-	  {0xBB, 0x02, 0x7A, 0},
-	  {0xF8, 0xC8, 0xAF, 0},
-	  {0xA1, 0x73, 0x74, 0},
-	  {0x2E, 0x5B, 0x86, 0},
-	  {0x0C, 0x2A, 0x47, 0}}},
-	/* 430 */
-	{"grungeshift",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x24, 0x24, 0x24, 0},
-	  {0x24, 0x00, 0x24, 0},
-	  {0x48, 0x24, 0x00, 0},
-	  {0x6C, 0x24, 0x24, 0},
-	  {0xB4, 0x24, 0x00, 0},
-	  {0xD8, 0xB4, 0x90, 0},
-	  {0xB4, 0x90, 0x00, 0},
-	  {0x6C, 0x6C, 0x00, 0},
-	  {0x48, 0x48, 0x00, 0},
-	  {0x00, 0xFC, 0xD8, 0},
-	  {0x48, 0x90, 0xFC, 0},
-	  {0x48, 0x6C, 0x90, 0},
-	  {0x24, 0x48, 0x90, 0},
-	  {0x90, 0x48, 0xB4, 0},
-	  {0xD8, 0x6C, 0xB4, 0}}},
-	/* 431 */
-	{"riscos",
-	 {{0xFF, 0xFF, 0xFF, 0},
-	  {0xDC, 0xDC, 0xDC, 0},
-	  {0xB9, 0xB9, 0xB9, 0},
-	  {0x97, 0x97, 0x97, 0},
-	  {0x76, 0x76, 0x76, 0},
-	  {0x55, 0x55, 0x55, 0},
-	  {0x36, 0x36, 0x36, 0},
-	  {0x00, 0x00, 0x00, 0},
-	  {0x00, 0x45, 0x97, 0},
-	  {0xED, 0xED, 0x04, 0},
-	  {0x05, 0xCA, 0x00, 0},
-	  {0xDC, 0x00, 0x00, 0},
-	  {0xED, 0xED, 0xB9, 0},
-	  {0x55, 0x86, 0x00, 0},
-	  {0xFF, 0xB9, 0x00, 0},
-	  {0x04, 0xB9, 0xFF, 0}}},
-	/* 432 */
-	{"flyguy16",
-	 {{0x27, 0x16, 0x20, 0},
-	  {0x24, 0x2D, 0x42, 0},
-	  {0x32, 0x6B, 0x3C, 0},
-	  {0x64, 0xB4, 0x50, 0},
-	  {0xEE, 0xEA, 0x44, 0},
-	  {0xF0, 0xE9, 0xDB, 0},
-	  {0xA9, 0x36, 0x30, 0},
-	  {0x3F, 0x30, 0x25, 0},
-	  {0x53, 0x3C, 0x60, 0},
-	  {0x24, 0x49, 0x5E, 0},
-	  {0x37, 0x95, 0x89, 0},
-	  {0xA4, 0xE8, 0xDF, 0},
-	  {0xEE, 0xB6, 0x91, 0},
-	  {0xDB, 0x83, 0x33, 0},
-	  {0x78, 0x51, 0x36, 0},
-	  {0x56, 0x69, 0x69, 0}}},
-	/* 433 */
-	{"andrewkensler16",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xC9, 0x8F, 0x4C, 0},
-	  {0x6E, 0x4E, 0x23, 0},
-	  {0xE8, 0x02, 0x00, 0},
-	  {0xEF, 0xE3, 0x05, 0},
-	  {0x6A, 0x89, 0x27, 0},
-	  {0x19, 0x56, 0x48, 0},
-	  {0x16, 0xED, 0x75, 0},
-	  {0x32, 0xC1, 0xC3, 0},
-	  {0x05, 0x7F, 0xC1, 0},
-	  {0x3F, 0x32, 0xAE, 0},
-	  {0xBA, 0xAA, 0xFF, 0},
-	  {0xFF, 0x94, 0x9D, 0},
-	  {0xE3, 0x0E, 0xC2, 0},
-	  {0x7A, 0x24, 0x3D, 0}}},
-	/* 434 */
-	{"naji16",
-	 {{0x10, 0x1A, 0x3A, 0},
-	  {0x3D, 0x0E, 0x26, 0},
-	  {0x64, 0x11, 0x3D, 0},
-	  {0x48, 0x2E, 0x69, 0},
-	  {0x3F, 0x42, 0x5A, 0},
-	  {0x6A, 0x34, 0x65, 0},
-	  {0x74, 0x43, 0x4A, 0},
-	  {0x59, 0x55, 0x79, 0},
-	  {0xB7, 0x3E, 0x62, 0},
-	  {0x8D, 0x6D, 0x9C, 0},
-	  {0x64, 0x96, 0x7C, 0},
-	  {0xC0, 0x71, 0x9F, 0},
-	  {0xC8, 0x92, 0x6C, 0},
-	  {0xDC, 0xA2, 0x86, 0},
-	  {0xF2, 0xC9, 0x66, 0},
-	  {0xE6, 0xD1, 0xD5, 0}}},
-	/* 435 */
-	{"cdbac",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xDA, 0x83, 0x5C, 0},
-	  {0x7F, 0x37, 0x10, 0},
-	  {0xC4, 0xC4, 0x66, 0},
-	  {0xF4, 0xFB, 0x4A, 0},
-	  {0xC7, 0xF0, 0xDC, 0},
-	  {0x77, 0xE2, 0x8E, 0},
-	  {0x31, 0x98, 0x3F, 0},
-	  {0x37, 0x36, 0x8D, 0},
-	  {0x8E, 0x64, 0xE3, 0},
-	  {0xD6, 0x97, 0xFF, 0},
-	  {0xF5, 0xCE, 0xE6, 0},
-	  {0xFD, 0xF5, 0xF9, 0},
-	  {0xCE, 0x3F, 0x50, 0},
-	  {0x5D, 0x09, 0x29, 0},
-	  {0x30, 0x14, 0x21, 0}}},
-	/* 436 */
-	{"thomsonm05",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0xBB, 0xBB, 0xBB, 0},
-	  {0xFF, 0x00, 0x00, 0},
-	  {0xDD, 0x77, 0x77, 0},
-	  {0xEE, 0xBB, 0x00, 0},
-	  {0xFF, 0xFF, 0x00, 0},
-	  {0xDD, 0xDD, 0x77, 0},
-	  {0x00, 0xFF, 0x00, 0},
-	  {0x77, 0xDD, 0x77, 0},
-	  {0x00, 0xFF, 0xFF, 0},
-	  {0xBB, 0xFF, 0xFF, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0xFF, 0x00, 0xFF, 0},
-	  {0xDD, 0x77, 0xEE, 0},
-	  {0x00, 0x00, 0xFF, 0},
-	  {0x77, 0x77, 0xDD, 0}}},
-	/* 437 */
-	{"crimso11",
-	 {{0xFF, 0xFF, 0xE3, 0},
-	  {0xF3, 0xD7, 0x62, 0},
-	  {0xBF, 0x96, 0x51, 0},
-	  {0x76, 0x9A, 0x55, 0},
-	  {0xCB, 0x5E, 0x31, 0},
-	  {0x8E, 0x39, 0x3D, 0},
-	  {0x7A, 0x49, 0x62, 0},
-	  {0x5E, 0x45, 0x31, 0},
-	  {0x8E, 0xC3, 0xCF, 0},
-	  {0x86, 0x76, 0x96, 0},
-	  {0x45, 0x6E, 0x51, 0},
-	  {0x3D, 0x62, 0x86, 0},
-	  {0x35, 0x3D, 0x5A, 0},
-	  {0x23, 0x2E, 0x32, 0},
-	  {0x41, 0x29, 0x2D, 0},
-	  {0x11, 0x0B, 0x11, 0}}},
-	/* 438 */
-	{"thug16",
-	 {{0x50, 0x40, 0x50, 0},
-	  {0xA0, 0x40, 0x40, 0},
-	  {0xD0, 0x60, 0x60, 0},
-	  {0xF0, 0x80, 0x80, 0},
-	  {0xFF, 0xC0, 0xC0, 0},
-	  {0xB0, 0xD0, 0xE0, 0},
-	  {0x70, 0xB0, 0xC0, 0},
-	  {0x40, 0x80, 0xB0, 0},
-	  {0x00, 0x00, 0x30, 0},
-	  {0x10, 0x20, 0x40, 0},
-	  {0x20, 0x40, 0x40, 0},
-	  {0x30, 0x60, 0x50, 0},
-	  {0x40, 0x90, 0x60, 0},
-	  {0x50, 0xC0, 0x60, 0},
-	  {0x50, 0xFF, 0x90, 0},
-	  {0xF0, 0xF0, 0xD0, 0}}},
-	/* 439 */
-	{"chip16",
-	 {{0xD6, 0x4B, 0x61, 0},
-	  {0x3A, 0x23, 0x33, 0},
-	  {0x00, 0x00, 0x14, 0},
-	  {0x53, 0x8C, 0xC1, 0},
-	  {0x70, 0xC6, 0xE5, 0},
-	  {0x06, 0x3E, 0x4C, 0},
-	  {0x63, 0x72, 0x72, 0},
-	  {0x8E, 0x37, 0x37, 0},
-	  {0x59, 0x8E, 0x33, 0},
-	  {0x7C, 0xB6, 0x49, 0},
-	  {0x56, 0x53, 0x49, 0},
-	  {0xEA, 0xC8, 0x79, 0},
-	  {0xC4, 0x85, 0x4E, 0},
-	  {0x6F, 0x1A, 0x71, 0},
-	  {0xE5, 0xE5, 0xE5, 0},
-	  {0xD8, 0xA2, 0xA2, 0}}},
-	/* 440 */
-	{"super1716",
-	 {{0x24, 0x09, 0x09, 0},
-	  {0x28, 0x17, 0x1A, 0},
-	  {0x37, 0x1A, 0x2E, 0},
-	  {0x34, 0x2B, 0x41, 0},
-	  {0x57, 0x33, 0x3F, 0},
-	  {0x32, 0x37, 0x64, 0},
-	  {0x2A, 0x5A, 0x51, 0},
-	  {0x33, 0x45, 0x91, 0},
-	  {0x83, 0x48, 0x48, 0},
-	  {0xD7, 0x38, 0x60, 0},
-	  {0x50, 0x79, 0x52, 0},
-	  {0x26, 0x5A, 0xCE, 0},
-	  {0x94, 0x7A, 0x6C, 0},
-	  {0xC3, 0xB5, 0x70, 0},
-	  {0xDF, 0x8A, 0xC7, 0},
-	  {0xEA, 0xF4, 0xB7, 0}}},
-	/* 441 */
-	{"master16",
-	 {{0x14, 0x14, 0x14, 0},
-	  {0x3B, 0x31, 0x2F, 0},
-	  {0x6E, 0x65, 0x5F, 0},
-	  {0x96, 0x95, 0x90, 0},
-	  {0xEB, 0xE8, 0xDA, 0},
-	  {0xF5, 0x7D, 0x7D, 0},
-	  {0xA1, 0x1A, 0x2C, 0},
-	  {0x4A, 0x16, 0x28, 0},
-	  {0x61, 0x2A, 0x2A, 0},
-	  {0xC9, 0x65, 0x40, 0},
-	  {0xD4, 0xBE, 0x42, 0},
-	  {0xF0, 0xC2, 0x95, 0},
-	  {0x27, 0x66, 0x47, 0},
-	  {0x66, 0xBF, 0x3D, 0},
-	  {0x2B, 0x30, 0x61, 0},
-	  {0x45, 0x82, 0xCC, 0}}},
-	/* 442 */
-	{"optimum",
-	 {{0x00, 0x00, 0x00, 0},
-	  {0x57, 0x57, 0x57, 0},
-	  {0xA0, 0xA0, 0xA0, 0},
-	  {0xFF, 0xFF, 0xFF, 0},
-	  {0x2A, 0x4B, 0xD7, 0},
-	  {0x1D, 0x69, 0x14, 0},
-	  {0x81, 0x4A, 0x19, 0},
-	  {0x81, 0x26, 0xC0, 0},
-	  {0x9D, 0xAF, 0xFF, 0},
-	  {0x81, 0xC5, 0x7A, 0},
-	  {0xE9, 0xDE, 0xBB, 0},
-	  {0xAD, 0x23, 0x23, 0},
-	  {0x29, 0xD0, 0xD0, 0},
-	  {0xFF, 0xEE, 0x33, 0},
-	  {0xFF, 0x92, 0x33, 0},
-	  {0xFF, 0xCD, 0xF3, 0}}},
-	/* 443 */
-	{"pavanz16",
-	 {{0x20, 0x00, 0x37, 0},
-	  {0xFF, 0xEE, 0xDC, 0},
-	  {0x65, 0x25, 0x3F, 0},
-	  {0x33, 0x3E, 0x55, 0},
-	  {0xB4, 0x2F, 0x4B, 0},
-	  {0x84, 0x5A, 0x75, 0},
-	  {0x40, 0x6B, 0x81, 0},
-	  {0x8F, 0x69, 0x3D, 0},
-	  {0x2B, 0x7D, 0x5F, 0},
-	  {0x88, 0x8D, 0xA3, 0},
-	  {0xC7, 0x8F, 0x86, 0},
-	  {0xD8, 0x97, 0x63, 0},
-	  {0xA1, 0xB2, 0x5C, 0},
-	  {0xA2, 0xCC, 0xC9, 0},
-	  {0xE1, 0xCB, 0xC7, 0},
-	  {0xEF, 0xD4, 0x97, 0}}},
-	/* 444 */
-	{"drazile16",
-	 {{0xD1, 0xA6, 0x49, 0},
-	  {0xDD, 0x72, 0x52, 0},
-	  {0xC6, 0x4B, 0x3B, 0},
-	  {0x75, 0x46, 0x53, 0},
-	  {0x9B, 0x72, 0x69, 0},
-	  {0xBC, 0x8D, 0xAD, 0},
-	  {0xCC, 0xB4, 0xA1, 0},
-	  {0xCA, 0xD8, 0x6C, 0},
-	  {0xAB, 0xBA, 0xBC, 0},
-	  {0x6F, 0xBC, 0x6F, 0},
-	  {0x4F, 0x73, 0x7C, 0},
-	  {0x30, 0x3A, 0x35, 0},
-	  {0x5C, 0x3A, 0x96, 0},
-	  {0x8A, 0x87, 0x8E, 0},
-	  {0x6F, 0x96, 0xD6, 0},
-	  {0xE2, 0xE2, 0xC7, 0}}}};
+// Tables générées par palgen depuis palettes_hex.csv (palettes.c dans le répertoire de build)
+extern const Palette palette_table[NUM_PALETTES];
+// Couleurs ramenées au treillis Thomson, thomson_idx renseigné
+extern const Color palette_thomson[NUM_PALETTES][COLORS_PER_PALETTE];
+// Première palette ayant le même ensemble de couleurs Thomson (elle-même si elle n'est pas un alias) :
+// tramer une seule palette par ensemble suffit
+extern const int16_t palette_canonical[NUM_PALETTES];
+extern const int palette_unique_count;
+
+// Index d'une palette par son nom (hachage parfait), -1 si inconnue.
+// Pour un nom présent plusieurs fois dans le CSV, la première occurrence est retenue.
+int palette_lookup(const char *name);
+
+// Hachage des noms, partagé par palgen et palette_lookup
+static inline uint32_t palette_name_hash(const char *name, uint32_t seed)
+{
+	uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+	for (const unsigned char *c = (const unsigned char *)name; *c; c++) {
+		hash ^= *c;
+		hash *= 16777619u;
+	}
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6Bu;
+	hash ^= hash >> 13;
+	return hash;
+}
+
+// Ligne du CSV "nom,#RRGGBB,...,#RRGGBB" (modifiée en place), partagée par palgen et --palette-lib.
+// Renvoie 0, -1 si le nom est absent ou ne tient pas dans name_size, i + 1 si la couleur i est invalide.
+static inline int palette_parse_csv_line(char *line, char *name, size_t name_size, Color colors[COLORS_PER_PALETTE])
+{
+	line[strcspn(line, "\r\n")] = '\0';
+	char *field = strchr(line, ',');
+	if (!field || (size_t)(field - line) >= name_size) return -1;
+	memcpy(name, line, field - line);
+	name[field - line] = '\0';
+	for (int i = 0; i < COLORS_PER_PALETTE; i++) {
+		unsigned int rgb;
+		if (!field || sscanf(field, ",#%6x", &rgb) != 1) return i + 1;
+		colors[i].r = (rgb >> 16) & 0xFF;
+		colors[i].g = (rgb >> 8) & 0xFF;
+		colors[i].b = rgb & 0xFF;
+		colors[i].thomson_idx = 0;
+		field = strchr(field + 1, ',');
+	}
+	return 0;
+}
+
+// Clé canonique d'une palette : index 12 bits triés, sans doublons, complétés par -1.
+// Deux palettes de même clé ont les mêmes couleurs Thomson, donc le même rendu.
+static inline void palette_canonical_key(const Color snapped[COLORS_PER_PALETTE], int key[COLORS_PER_PALETTE])
+{
+	int sorted[COLORS_PER_PALETTE];
+	for (int i = 0; i < COLORS_PER_PALETTE; i++) {
+		int j = i;
+		for (; j > 0 && sorted[j - 1] > snapped[i].thomson_idx; j--) sorted[j] = sorted[j - 1];
+		sorted[j] = snapped[i].thomson_idx;
+	}
+	int n = 0;
+	for (int i = 0; i < COLORS_PER_PALETTE; i++)
+		if (n == 0 || sorted[i] != key[n - 1]) key[n++] = sorted[i];
+	while (n < COLORS_PER_PALETTE) key[n++] = -1;
+}
 
 #endif // PALETTES_H
 
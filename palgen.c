@@ -0,0 +1,204 @@
+// palgen : génère palettes.c depuis palettes_hex.csv au moment du build
+//   palgen <palettes_hex.csv> <palettes.c>
+// Une seule définition de palette_table, les palettes ramenées aux couleurs Thomson avec
+// leur index 12 bits, les alias (palettes donnant le même ensemble Thomson) et un index
+// des noms par hachage parfait (CHD : compression, hachage, déplacement).
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "global.h"
+#include "thomson.h"
+#include "palettes.h"
+
+#define HASH_BUCKETS 128 // ~3,5 noms par case
+#define HASH_SIZE 512	 // puissance de 2, taux de remplissage ~85 %
+#define MAX_SEED 65535
+
+static Palette palettes[NUM_PALETTES];
+
+static int parse_csv(const char *filename)
+{
+	FILE *f = fopen(filename, "r");
+	if (!f) {
+		fprintf(stderr, "palgen: impossible d'ouvrir %s\n", filename);
+		return -1;
+	}
+	char line[1024];
+	int count = 0, line_number = 0;
+	while (fgets(line, sizeof(line), f)) {
+		line_number++;
+		if (line[strspn(line, "\r\n")] == '\0') continue;
+		if (count == NUM_PALETTES) {
+			fprintf(stderr, "palgen: plus de %d palettes dans %s\n", NUM_PALETTES, filename);
+			fclose(f);
+			return -1;
+		}
+		Palette *palette = &palettes[count];
+		int status = palette_parse_csv_line(line, palette->name, sizeof(palette->name), palette->palette);
+		if (status != 0) {
+			if (status < 0)
+				fprintf(stderr, "palgen: %s:%d : nom absent ou trop long\n", filename, line_number);
+			else
+				fprintf(stderr, "palgen: %s:%d : couleur %d invalide\n", filename, line_number, status);
+			fclose(f);
+			return -1;
+		}
+		count++;
+	}
+	fclose(f);
+	if (count != NUM_PALETTES) {
+		fprintf(stderr, "palgen: %d palettes dans %s, NUM_PALETTES vaut %d\n", count, filename, NUM_PALETTES);
+		return -1;
+	}
+	return 0;
+}
+
+// Les noms vides ou en double ne sont pas indexés : seule la première occurrence est trouvable
+static int is_indexed(int index)
+{
+	if (palettes[index].name[0] == '\0') return 0;
+	for (int i = 0; i < index; i++)
+		if (strcmp(palettes[i].name, palettes[index].name) == 0) return 0;
+	return 1;
+}
+
+static int bucket_members[HASH_BUCKETS][NUM_PALETTES];
+static int bucket_size[HASH_BUCKETS];
+
+static int compare_buckets(const void *a, const void *b)
+{
+	int x = *(const int *)a, y = *(const int *)b;
+	if (bucket_size[x] != bucket_size[y]) return bucket_size[y] - bucket_size[x];
+	return x - y;
+}
+
+// Place les plus grosses cases d'abord, chacune avec la première graine qui envoie tous ses noms
+// sur des emplacements libres et distincts
+static int build_hash(uint16_t seeds[HASH_BUCKETS], int16_t slots[HASH_SIZE])
+{
+	for (int i = 0; i < NUM_PALETTES; i++) {
+		if (!is_indexed(i)) continue;
+		int bucket = palette_name_hash(palettes[i].name, 0) & (HASH_BUCKETS - 1);
+		bucket_members[bucket][bucket_size[bucket]++] = i;
+	}
+	int order[HASH_BUCKETS];
+	for (int i = 0; i < HASH_BUCKETS; i++) order[i] = i;
+	qsort(order, HASH_BUCKETS, sizeof(int), compare_buckets);
+
+	for (int i = 0; i < HASH_SIZE; i++) slots[i] = -1;
+	for (int o = 0; o < HASH_BUCKETS; o++) {
+		int bucket = order[o];
+		seeds[bucket] = 0;
+		if (bucket_size[bucket] == 0) continue;
+		int placed = 0;
+		for (uint32_t seed = 1; seed <= MAX_SEED && !placed; seed++) {
+			int taken[NUM_PALETTES];
+			placed = 1;
+			for (int k = 0; k < bucket_size[bucket] && placed; k++) {
+				int slot = palette_name_hash(palettes[bucket_members[bucket][k]].name, seed) & (HASH_SIZE - 1);
+				if (slots[slot] >= 0) placed = 0;
+				for (int j = 0; j < k && placed; j++)
+					if (taken[j] == slot) placed = 0;
+				taken[k] = slot;
+			}
+			if (placed) {
+				seeds[bucket] = (uint16_t)seed;
+				for (int k = 0; k < bucket_size[bucket]; k++) slots[taken[k]] = (int16_t)bucket_members[bucket][k];
+			}
+		}
+		if (!placed) {
+			fprintf(stderr, "palgen: aucune graine ne place la case %d\n", bucket);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static void write_color(FILE *out, Color c)
+{
+	fprintf(out, "{0x%02X, 0x%02X, 0x%02X, %d}", c.r, c.g, c.b, c.thomson_idx);
+}
+
+// Tableaux d'entiers : 16 valeurs par ligne
+static const char *separator(int i)
+{
+	return i == 0 ? "\n\t" : i % 16 ? ", " : ",\n\t";
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc != 3) {
+		fprintf(stderr, "Usage: palgen <palettes_hex.csv> <palettes.c>\n");
+		return 1;
+	}
+	if (parse_csv(argv[1]) != 0) return 1;
+
+	uint16_t seeds[HASH_BUCKETS];
+	int16_t slots[HASH_SIZE];
+	if (build_hash(seeds, slots) != 0) return 1;
+
+	FILE *out = fopen(argv[2], "w");
+	if (!out) {
+		fprintf(stderr, "palgen: impossible d'écrire %s\n", argv[2]);
+		return 1;
+	}
+	fprintf(out, "// Généré par palgen depuis palettes_hex.csv : ne pas modifier\n");
+	fprintf(out, "#include <string.h>\n#include \"palettes.h\"\n\n");
+
+	fprintf(out, "const Palette palette_table[NUM_PALETTES] = {\n");
+	for (int p = 0; p < NUM_PALETTES; p++) {
+		fprintf(out, "\t/* %d */ {\"%s\",\n\t\t{", p, palettes[p].name);
+		for (int i = 0; i < COLORS_PER_PALETTE; i++) {
+			write_color(out, palettes[p].palette[i]);
+			fprintf(out, i + 1 < COLORS_PER_PALETTE ? (i % 4 == 3 ? ",\n\t\t " : ", ") : "}},\n");
+		}
+	}
+	fprintf(out, "};\n\n");
+
+	static Color snapped[NUM_PALETTES][COLORS_PER_PALETTE];
+	fprintf(out, "const Color palette_thomson[NUM_PALETTES][COLORS_PER_PALETTE] = {\n");
+	for (int p = 0; p < NUM_PALETTES; p++) {
+		fprintf(out, "\t/* %d */ {", p);
+		for (int i = 0; i < COLORS_PER_PALETTE; i++) {
+			snap_to_thomson(palettes[p].palette[i], &snapped[p][i]);
+			write_color(out, snapped[p][i]);
+			fprintf(out, i + 1 < COLORS_PER_PALETTE ? (i % 4 == 3 ? ",\n\t\t " : ", ") : "},\n");
+		}
+	}
+	fprintf(out, "};\n\n");
+
+	static int keys[NUM_PALETTES][COLORS_PER_PALETTE];
+	int unique = 0;
+	fprintf(out, "const int16_t palette_canonical[NUM_PALETTES] = {");
+	for (int p = 0; p < NUM_PALETTES; p++) {
+		palette_canonical_key(snapped[p], keys[p]);
+		int canonical = p;
+		for (int q = 0; q < p && canonical == p; q++)
+			if (memcmp(keys[p], keys[q], sizeof(keys[p])) == 0) canonical = q;
+		if (canonical == p) unique++;
+		fprintf(out, "%s%d", separator(p), canonical);
+	}
+	fprintf(out, "};\n\n");
+	fprintf(out, "const int palette_unique_count = %d;\n\n", unique);
+
+	fprintf(out, "#define HASH_BUCKETS %d\n#define HASH_SIZE %d\n\n", HASH_BUCKETS, HASH_SIZE);
+	fprintf(out, "static const uint16_t hash_seeds[HASH_BUCKETS] = {");
+	for (int i = 0; i < HASH_BUCKETS; i++) fprintf(out, "%s%u", separator(i), seeds[i]);
+	fprintf(out, "};\n\n");
+	fprintf(out, "static const int16_t hash_slots[HASH_SIZE] = {");
+	for (int i = 0; i < HASH_SIZE; i++) fprintf(out, "%s%d", separator(i), slots[i]);
+	fprintf(out, "};\n\n");
+
+	fprintf(out, "int palette_lookup(const char *name)\n"
+				 "{\n"
+				 "\tuint32_t seed = hash_seeds[palette_name_hash(name, 0) & (HASH_BUCKETS - 1)];\n"
+				 "\tint index = hash_slots[palette_name_hash(name, seed) & (HASH_SIZE - 1)];\n"
+				 "\treturn index >= 0 && strcmp(palette_table[index].name, name) == 0 ? index : -1;\n"
+				 "}\n");
+	if (fclose(out) != 0) {
+		fprintf(stderr, "palgen: erreur d'écriture de %s\n", argv[2]);
+		return 1;
+	}
+	return 0;
+}
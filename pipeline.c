@@ -0,0 +1,693 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stb_image.h>
+#include <stb_image_write.h>
+#include <exoquant.h>
+#include "global.h"
+#include "clash.h"
+#include "thomson.h"
+#include "image.h"
+#include "dither.h"
+#include "palette_select.h"
+#include "palette_lib.h"
+#include "palette_opt.h"
+#include "matrix.h"
+#include "k7.h"
+#include "cache.h"
+#include "platform.h"
+#include "metric.h"
+#include "cpu.h"
+
+// Artefacts sélectionnables par --out, avec leur nom de fichier par défaut
+static const struct {
+	const char *name;
+	const char *filename;
+	int flag;
+} output_table[] = {{"resized", "resized.png", OUT_RESIZED}, {"png", "clash.png", OUT_PNG},
+					{"map", "CLASH.MAP", OUT_MAP},			{"colors", "COLORS.BIN", OUT_COLORS},
+					{"pixels", "PIXELS.BIN", OUT_PIXELS},	{"k7", "clash.k7", OUT_K7},
+					{"exo", "exo_dither.png", OUT_EXO}};
+#define OUTPUT_COUNT (sizeof(output_table) / sizeof(output_table[0]))
+
+// Convertit une liste "png,k7,..." en masque OUT_*, -1 si un nom est inconnu
+int parse_output_list(const char *list)
+{
+	int selected = 0;
+	const char *start = list;
+	while (*start) {
+		size_t len = strcspn(start, ",");
+		int found = 0;
+		if (len == 3 && strncmp(start, "all", 3) == 0) {
+			selected |= OUT_ALL;
+			found = 1;
+		}
+		for (int i = 0; i < OUTPUT_COUNT && !found; i++) {
+			if (strlen(output_table[i].name) == len && strncmp(start, output_table[i].name, len) == 0) {
+				selected |= output_table[i].flag;
+				found = 1;
+			}
+		}
+		if (!found) {
+			fprintf(stderr, "Erreur: artefact inconnu '%.*s' dans --out.\n", (int)len, start);
+			return -1;
+		}
+		start += len;
+		if (*start == ',') start++;
+	}
+	return selected;
+}
+
+static const char *output_filename(int flag)
+{
+	for (int i = 0; i < OUTPUT_COUNT; i++)
+		if (output_table[i].flag == flag) return output_table[i].filename;
+	return NULL;
+}
+
+// Ouvre la destination d'un artefact : la sortie standard ou <prefixe><nom>, NULL si non sélectionné
+static FILE *open_output(const OutputSpec *spec, int flag, char *path, size_t path_size)
+{
+	if (!(spec->selected & flag)) return NULL;
+	if (spec->stdout_stream) {
+		snprintf(path, path_size, "<stdout>");
+		return spec->stdout_stream;
+	}
+	snprintf(path, path_size, "%s%s", spec->prefix, output_filename(flag));
+	FILE *f = fopen(path, "wb");
+	if (!f) printf("Erreur: Impossible d'ouvrir '%s' en écriture\n", path);
+	return f;
+}
+
+// -1 si une écriture a échoué (disque plein, répertoire disparu...) : le job est alors en échec
+static int close_output(const OutputSpec *spec, FILE *f, const char *path)
+{
+	int failed = ferror(f);
+	if (f == spec->stdout_stream)
+		failed |= fflush(f) != 0;
+	else
+		failed |= fclose(f) != 0;
+	if (failed) printf("Erreur: Impossible d'écrire '%s'\n", path);
+	return failed ? -1 : 0;
+}
+
+static void write_to_file(void *context, void *data, int size)
+{
+	fwrite(data, 1, size, (FILE *)context);
+}
+
+// Artefacts : 0 si écrit ou non sélectionné, -1 si la destination n'a pu être ouverte ou écrite
+static int write_png_output(const OutputSpec *spec, int flag, int w, int h, int comp, const uint8_t *data)
+{
+	char path[1024];
+	FILE *f = open_output(spec, flag, path, sizeof(path));
+	if (!f) return spec->selected & flag ? -1 : 0;
+	int status = 0;
+	if (!stbi_write_png_to_func(write_to_file, f, w, h, comp, data, w * comp)) {
+		printf("Erreur: Impossible d'écrire l'image PNG '%s'\n", path);
+		status = -1;
+	}
+	if (close_output(spec, f, path) != 0) status = -1;
+	if (status == 0 && clash_verbose) printf("%s créé\n", path);
+	return status;
+}
+
+static int write_bytes_output(const OutputSpec *spec, int flag, const IntVector *bytes)
+{
+	char path[1024];
+	FILE *f = open_output(spec, flag, path, sizeof(path));
+	if (!f) return spec->selected & flag ? -1 : 0;
+	fwrite(bytes->data, 1, bytes->size, f);
+	if (close_output(spec, f, path) != 0) return -1;
+	if (clash_verbose) printf("%s créé\n", path);
+	return 0;
+}
+
+// Fichier binaire MO5 : en-tête, données, pied
+static void build_bin(IntVector *bin, const IntVector *data)
+{
+	uint8_t header[] = {0x00, 0x1F, 0x40, 0x00, 0x00};
+	uint8_t footer[] = {0xFF, 0x00, 0x00, 0x00, 0x00};
+	for (int i = 0; i < 5; i++) push_back(bin, header[i]);
+	for (size_t i = 0; i < data->size; i++) push_back(bin, data->data[i]);
+	for (int i = 0; i < 5; i++) push_back(bin, footer[i]);
+}
+
+#define EXO_FEED_CHUNK 256 // pixels RGBA passés à exq_feed en une fois
+
+// Ajoute les pixels de l'image cadrée aux cases Thomson 12 bits de histogram
+static void add_thomson_histogram(const uint8_t *framed_image, uint64_t *histogram)
+{
+	cpu_kernels.thomson_histogram(framed_image, WIDTH * HEIGHT, histogram);
+}
+
+// Quantificateur exoquant nourri d'un histogramme pondéré plutôt que des pixels : une entrée par
+// case Thomson 12 bits (couleur moyenne de la case), répétée autant de fois qu'elle compte de
+// pixels, l'API d'exoquant n'acceptant pas de poids. exq_quantize_hq ne voit ainsi que 4096
+// couleurs distinctes au plus, et l'image n'est plus copiée en RGBA.
+static exq_data *histogram_quantizer(const uint64_t *histogram)
+{
+	exq_data *exq = exq_init();
+	exq_no_transparency(exq);
+	unsigned char chunk[EXO_FEED_CHUNK * 4];
+	int pending = 0;
+	for (int b = 0; b < NUM_THOMSON_COLORS; b++) {
+		const uint64_t *bin = &histogram[b * 4];
+		for (uint64_t n = 0; n < bin[0]; n++) {
+			unsigned char *pixel = &chunk[pending * 4];
+			pixel[0] = (unsigned char)((bin[1] + bin[0] / 2) / bin[0]);
+			pixel[1] = (unsigned char)((bin[2] + bin[0] / 2) / bin[0]);
+			pixel[2] = (unsigned char)((bin[3] + bin[0] / 2) / bin[0]);
+			pixel[3] = 255;
+			if (++pending == EXO_FEED_CHUNK) {
+				exq_feed(exq, chunk, pending);
+				pending = 0;
+			}
+		}
+	}
+	if (pending) exq_feed(exq, chunk, pending);
+	return exq;
+}
+
+static exq_data *exo_quantizer(const uint8_t *framed_image, uint64_t *histogram)
+{
+	memset(histogram, 0, NUM_THOMSON_COLORS * 4 * sizeof(uint64_t));
+	add_thomson_histogram(framed_image, histogram);
+	return histogram_quantizer(histogram);
+}
+
+static void find_exo_palette(exq_data *exq, unsigned char *exo_palette) {
+    exq_quantize_hq(exq, PALETTE_SIZE);
+    exq_get_palette(exq, exo_palette, PALETTE_SIZE);
+}
+
+static void palette_to_exo(const Color *palette, unsigned char *exo_palette) {
+    for (int i = 0; i < PALETTE_SIZE; i++) {
+        exo_palette[i * 4] = palette[i].r;
+        exo_palette[i * 4 + 1] = palette[i].g;
+        exo_palette[i * 4 + 2] = palette[i].b;
+        exo_palette[i * 4 + 3] = 255;
+    }
+}
+
+static void quantize_exo_to_4096(unsigned char *exo_palette, Color *palette, Color *thomson_palette) {
+    Color optimal_palette[PALETTE_SIZE];
+    for (int i = 0; i < PALETTE_SIZE; i++) {
+        optimal_palette[i].r = exo_palette[i * 4];
+        optimal_palette[i].g = exo_palette[i * 4 + 1];
+        optimal_palette[i].b = exo_palette[i * 4 + 2];
+    }
+    find_closest_thomson_palette(optimal_palette, thomson_palette, palette);
+    palette_to_exo(palette, exo_palette);
+}
+
+// Réglages du dithering du job : --memo... et -d, qui choisit la matrice de diffusion (NULL pour
+// Ostromoukhov et les modes de ordered.c) ; les threads du job servent à ces derniers, la table de
+// mémoïsation vient des tampons de travail
+static float *dither_setup(const ClashJob *job, ClashScratch *scratch, DitherOptions *options)
+{
+	if (job->dither_options) *options = *job->dither_options;
+	options->ordered = job->dither > DITHER_OSTROMOUKHOV ? job->dither : 0;
+	options->threads = job->threads;
+	options->memo_table = scratch->memo;
+	return job->dither >= DITHER_OSTROMOUKHOV ? NULL : floyd_matrix[job->dither].matrix;
+}
+
+// -p : nom d'une palette de la bibliothèque, auto[:K] ou nearest[:K]
+int check_palette_name(const PaletteLibrary *palettes, const char *name)
+{
+	int k;
+	int parsed_auto = parse_auto_palette(name, &k), parsed_nearest = parse_nearest_palette(name, &k);
+	if (parsed_auto < 0 || parsed_nearest < 0) {
+		printf("Erreur: palette '%s' invalide (auto[:K] ou nearest[:K], K au moins 1).\n", name);
+		return -1;
+	}
+	if (parsed_auto == 0 && parsed_nearest == 0 && palette_lib_lookup(palettes, name) < 0) {
+		printf("Erreur: palette '%s' inconnue.\n", name);
+		return -1;
+	}
+	return 0;
+}
+
+// Le cadrage ne dépend que de la source (WIDTH et HEIGHT sont couverts par la version du cache)
+static uint64_t frame_key(const DecodedImage *image)
+{
+	return cache_hash_string(image->input_hash, "frame");
+}
+
+int clash_scratch_init(ClashScratch *scratch)
+{
+	init_thomson_palette(scratch->thomson_palette);
+	scratch->resized_capacity = WIDTH * HEIGHT * COLOR_COMP;
+	scratch->resized = malloc(scratch->resized_capacity);
+	scratch->framed = malloc(WIDTH * HEIGHT * COLOR_COMP);
+	scratch->rgba = malloc(WIDTH * HEIGHT * 4);
+	scratch->indexed = malloc(WIDTH * HEIGHT);
+	scratch->histogram = malloc(NUM_THOMSON_COLORS * 4 * sizeof(uint64_t));
+	scratch->distances = malloc(WIDTH * HEIGHT * PALETTE_SIZE * sizeof(int32_t));
+	scratch->error = malloc(WIDTH * HEIGHT * 3 * sizeof(double));
+	scratch->dithered = malloc(WIDTH * HEIGHT * sizeof(DitheredPixel));
+	scratch->candidate = malloc(WIDTH * HEIGHT * sizeof(DitheredPixel));
+	scratch->packed = malloc(WIDTH * HEIGHT / 2);
+	scratch->blocks = malloc(CLASH_BLOCKS * sizeof(ClashBlock));
+	scratch->rgb = malloc(WIDTH * HEIGHT * COLOR_COMP);
+	scratch->memo = dither_memo_alloc();
+	init_vector(&scratch->map);
+	init_vector(&scratch->pixels);
+	init_vector(&scratch->colors);
+	init_vector(&scratch->colors_bin);
+	init_vector(&scratch->pixels_bin);
+	if (!scratch->resized || !scratch->framed || !scratch->rgba || !scratch->indexed || !scratch->histogram || !scratch->distances ||
+		!scratch->error || !scratch->dithered || !scratch->candidate || !scratch->packed || !scratch->blocks ||
+		!scratch->rgb || !scratch->memo) {
+		printf("Erreur: Impossible d'allouer les tampons de travail.\n");
+		clash_scratch_free(scratch);
+		return -1;
+	}
+	return 0;
+}
+
+void clash_scratch_free(ClashScratch *scratch)
+{
+	free(scratch->resized);
+	free(scratch->framed);
+	free(scratch->rgba);
+	free(scratch->indexed);
+	free(scratch->histogram);
+	free(scratch->distances);
+	free(scratch->error);
+	free(scratch->dithered);
+	free(scratch->candidate);
+	free(scratch->packed);
+	free(scratch->blocks);
+	free(scratch->rgb);
+	dither_memo_free(scratch->memo);
+	free_vector(&scratch->map);
+	free_vector(&scratch->pixels);
+	free_vector(&scratch->colors);
+	free_vector(&scratch->colors_bin);
+	free_vector(&scratch->pixels_bin);
+	memset(scratch, 0, sizeof(*scratch));
+}
+
+int clash_decode(const char *input, ClashCache *cache, DecodedImage *image)
+{
+	size_t input_size = 0;
+	uint8_t *input_bytes = read_file_bytes(input, &input_size);
+	image->pixels = NULL;
+	image->framed = NULL;
+	image->width = image->height = image->channels = 0;
+	if (input_bytes) {
+		image->input_hash = cache_hash(CACHE_HASH_INIT, input_bytes, input_size);
+		if (cache) {
+			// Cadrage en cache : inutile de décoder la source
+			CacheChunk chunk = {malloc(WIDTH * HEIGHT * COLOR_COMP), WIDTH * HEIGHT * COLOR_COMP};
+			if (chunk.data && cache_load(cache, CACHE_FRAME, frame_key(image), &chunk, 1) == 0) {
+				image->framed = chunk.data;
+				free(input_bytes);
+				if (clash_verbose) printf("Image cadrée lue dans le cache: %s\n", input);
+				return 0;
+			}
+			free(chunk.data);
+		}
+		image->pixels = stbi_load_from_memory(input_bytes, (int)input_size, &image->width, &image->height,
+											  &image->channels, COLOR_COMP);
+	}
+	free(input_bytes);
+	if (!image->pixels) {
+		printf("Erreur: Impossible de charger l'image d'entrée '%s'. Vérifiez le chemin ou le format.\n", input);
+		return -1;
+	}
+	if (clash_verbose)
+		printf("Image chargée: %s (%dx%d pixels, %d canaux d'origine)\n", input, image->width, image->height,
+			   image->channels);
+	return 0;
+}
+
+void clash_decoded_free(DecodedImage *image)
+{
+	stbi_image_free(image->pixels);
+	free(image->framed);
+	image->pixels = NULL;
+	image->framed = NULL;
+}
+
+// Redimensionne et cadre la source dans scratch->framed, ou recopie le cadrage lu dans le cache
+static int frame_stage(const ClashJob *job, const DecodedImage *image, ClashScratch *scratch)
+{
+	if (image->framed) {
+		memcpy(scratch->framed, image->framed, WIDTH * HEIGHT * COLOR_COMP);
+		return 0;
+	}
+
+	int wr, hr;
+	resized_dimensions(image->width, image->height, &wr, &hr);
+	size_t resized_size = (size_t)wr * hr * COLOR_COMP;
+	if (resized_size > scratch->resized_capacity) {
+		// Image plus haute que large : la hauteur redimensionnée dépasse le canevas avant recadrage
+		uint8_t *tmp = realloc(scratch->resized, resized_size);
+		if (!tmp) {
+			printf("Erreur: Impossible d'allouer la mémoire pour l'image redimensionnée.\n");
+			return -1;
+		}
+		scratch->resized = tmp;
+		scratch->resized_capacity = resized_size;
+	}
+	uint8_t *resized_image = resize_if_necessary(image->pixels, image->width, image->height, scratch->resized, &wr, &hr);
+
+	int wf, hf;
+	frame_into_canvas(resized_image, wr, hr, scratch->framed, &wf, &hf);
+
+	if (job->cache) {
+		CacheChunk chunk = {scratch->framed, WIDTH * HEIGHT * COLOR_COMP};
+		cache_store(job->cache, CACHE_FRAME, frame_key(image), &chunk, 1);
+	}
+	return 0;
+}
+
+// Palette exoquant de l'image cadrée, ramenée aux 4096 couleurs Thomson (-m 1, -m 3 et -p nearest).
+// Le quantificateur est créé dans *exq s'il n'existe pas encore, pour resservir au tramage de -m 3.
+static void exo_palette_stage(const ClashJob *job, const DecodedImage *image, ClashScratch *scratch, exq_data **exq,
+							  unsigned char *exo_palette, Color *palette)
+{
+	// Même calcul pour -m 1 et -m 3 : la clé ne dépend que de la source et de la métrique de projection
+	uint64_t key = cache_hash_string(image->input_hash, "palette");
+	if (color_metric != METRIC_RGB) key = cache_hash_int(cache_hash_string(key, "metric"), color_metric);
+	CacheChunk chunk = {palette, PALETTE_SIZE * sizeof(Color)};
+	if (job->cache && cache_load(job->cache, CACHE_PALETTE, key, &chunk, 1) == 0) {
+		palette_to_exo(palette, exo_palette);
+		return;
+	}
+	if (!*exq) *exq = exo_quantizer(scratch->framed, scratch->histogram);
+	find_exo_palette(*exq, exo_palette);
+	quantize_exo_to_4096(exo_palette, palette, scratch->thomson_palette);
+	if (job->cache) cache_store(job->cache, CACHE_PALETTE, key, &chunk, 1);
+}
+
+// Choix de la palette, pré-tramage éventuel et dithering : palette et scratch->dithered en sortie ;
+// -1 si l'artefact du pré-tramage n'a pu être écrit
+static int render_stage(const ClashJob *job, const DecodedImage *image, ClashScratch *scratch, Color *palette)
+{
+	int status = 0;
+	const OutputSpec *outputs = &job->outputs;
+	Color *thomson_palette = scratch->thomson_palette;
+	uint8_t *framed_image = scratch->framed;
+	int val_m = job->machine;
+	int wf = WIDTH, hf = HEIGHT;
+	DitheredPixel *dithered_image = scratch->dithered;
+	int auto_k = 0, nearest_k = 0;
+	exq_data *exq = NULL; // un seul quantificateur pour la palette et le tramage exoquant
+	DitherStats stats;
+	memset(&stats, 0, sizeof(stats));
+	DitherOptions options = DITHER_OPTIONS_DEFAULT;
+	float *matrix = dither_setup(job, scratch, &options);
+	options.stats = &stats;
+
+	if (job->shared_palette) {
+		// --set : palette commune calculée sur l'histogramme de toutes les images
+		memcpy(palette, job->shared_palette, PALETTE_SIZE * sizeof(Color));
+	} else if (job->palette_name && parse_auto_palette(job->palette_name, &auto_k) == 1) {
+		// -p auto : la sélection trame déjà la palette retenue
+		int chosen_index = select_auto_palette(job->palettes, framed_image, auto_k, matrix, &options, palette,
+											   dithered_image, scratch->candidate, scratch->error);
+		if (clash_verbose) printf("Palette auto retenue : %s\n", palette_lib_name(job->palettes, chosen_index));
+	} else if (job->palette_name && parse_nearest_palette(job->palette_name, &nearest_k) == 1) {
+		// -p nearest : la palette exoquant de l'image sert de requête dans l'index de la bibliothèque
+		unsigned char exo_palette[16 * 4];
+		Color query[PALETTE_SIZE];
+		exo_palette_stage(job, image, scratch, &exq, exo_palette, query);
+		int chosen_index = select_nearest_palette(job->palettes, framed_image, query, nearest_k, matrix, &options,
+												  palette, dithered_image, scratch->candidate, scratch->error);
+		if (clash_verbose) printf("Palette la plus proche retenue : %s\n", palette_lib_name(job->palettes, chosen_index));
+	} else if (job->palette_name) {
+		// Palette déjà ramenée aux couleurs Thomson dans la bibliothèque, nom vérifié par clash_process
+		palette_lib_colors(job->palettes, palette_lib_lookup(job->palettes, job->palette_name), palette);
+	} else if (val_m == 1) {
+        // mo6 error diffusion
+//		generate_palette_wu_thomson_aware(framed_image, WIDTH, HEIGHT, thomson_palette, optimal_palette);
+//		find_closest_thomson_palette(optimal_palette, thomson_palette, palette);
+        unsigned char exo_palette[16 * 4];
+        exo_palette_stage(job, image, scratch, &exq, exo_palette, palette);
+
+	} else if (val_m == 4) {
+		// mo6 palette exoquant optimisée sous la contrainte des 2 couleurs par bloc
+		unsigned char exo_palette[16 * 4];
+		exo_palette_stage(job, image, scratch, &exq, exo_palette, palette);
+		int iterations = optimize_block_palette(framed_image, palette, scratch->distances, scratch->indexed, job->threads);
+		if (clash_verbose) printf("Palette optimisée en %d itérations\n", iterations);
+    } else if (val_m == 2 || val_m == 3) {
+        // mo6 mo5 exoquant dithering
+        if (clash_verbose) printf("exoquant mode");
+        // ici on va explorer une autre possibilite, on va d'abord tramer la source avec exoquant
+        find_closest_thomson_palette(mo5_palette, thomson_palette, palette);
+        unsigned char exo_palette[16 * 4];
+
+        if (val_m == 2) {
+            for (int i = 0; i < PALETTE_SIZE; i++) {
+                exo_palette[i * 4] = mo5_palette[i].r;
+                exo_palette[i * 4 +1] = mo5_palette[i].g;
+                exo_palette[i * 4 +2] = mo5_palette[i].b;
+                exo_palette[i * 4 +3] = 255;
+            }
+        } else if (val_m == 3) {
+            exo_palette_stage(job, image, scratch, &exq, exo_palette, palette);
+        }
+        // Palette lue dans le cache ou -m 2 : le quantificateur n'a pas encore été nourri
+        if (!exq) exq = exo_quantizer(framed_image, scratch->histogram);
+        exq_set_palette(exq, exo_palette, 16);
+
+        // dithering : seule l'image à tramer passe en RGBA
+        uint8_t *exo_image = scratch->rgba;
+        convert_rgb_to_rgba_buffer(framed_image, exo_image, wf, hf);
+        unsigned char *indexedPaletteData = scratch->indexed;
+        exq_map_image_ordered(exq, wf, hf, exo_image, indexedPaletteData);
+//        exq_map_image_dither(pExq, wf, hf, exo_image, indexedPaletteData, 0);   // random
+
+        for (int i = 0, j = 0; i < wf * hf * 4; i += 4, j++) {
+            exo_image[i] =  *(exo_palette + indexedPaletteData[j] * 4);
+            exo_image[i + 1] =  *(exo_palette + indexedPaletteData[j] * 4 + 1);
+            exo_image[i + 2] =  *(exo_palette + indexedPaletteData[j] * 4 + 2);
+            exo_image[i + 3] =  *(exo_palette + indexedPaletteData[j] * 4 + 3);
+        }
+
+        if (write_png_output(outputs, OUT_EXO, wf, hf, 4, exo_image) != 0) status = -1;
+
+        convert_rgba_to_rgb_buffer((const uint8_t *) exo_image, framed_image, wf, hf);
+
+    } else {
+        // mo5 error diffusion
+        find_closest_thomson_palette(mo5_palette, thomson_palette, palette);
+    }
+	if (exq) exq_free(exq);
+
+
+	// --- Appel de la NOUVELLE fonction de dithering avec propagation intelligente ---
+	if (!auto_k && !nearest_k)
+		block_dithering_thomson_smart_propagation_options(framed_image, dithered_image, WIDTH, HEIGHT, COLOR_COMP,
+														  palette, matrix, scratch->error, &options);
+	if (clash_verbose) dither_stats_print(&stats);
+	return status;
+}
+
+// MAP, BIN et k7 à partir des blocs natifs du rendu
+static int write_encoded_outputs(const OutputSpec *outputs, ClashScratch *scratch, Color *palette)
+{
+	int status = 0;
+	// --- Image TO-SNAP ---
+	clear_vector(&scratch->map);
+	clear_vector(&scratch->pixels);
+	clear_vector(&scratch->colors);
+	encode_as_to_snap(&scratch->map, scratch->blocks, scratch->thomson_palette, palette, &scratch->pixels,
+					  &scratch->colors);
+	if (write_bytes_output(outputs, OUT_MAP, &scratch->map) != 0) status = -1;
+
+	// --- Création des fichiers binaires couleur et forme MO5
+	clear_vector(&scratch->colors_bin);
+	clear_vector(&scratch->pixels_bin);
+	build_bin(&scratch->colors_bin, &scratch->colors);
+	build_bin(&scratch->pixels_bin, &scratch->pixels);
+	if (write_bytes_output(outputs, OUT_COLORS, &scratch->colors_bin) != 0) status = -1;
+	if (write_bytes_output(outputs, OUT_PIXELS, &scratch->pixels_bin) != 0) status = -1;
+
+	// --- Ajout dans une k7 ---
+	char path[1024];
+	FILE *fick7 = open_output(outputs, OUT_K7, path, sizeof(path));
+	if (fick7) {
+		ajouterDonnees(fick7, "CLASH.MAP", scratch->map.data, scratch->map.size);
+		ajouterDonnees(fick7, "PIXELS.BIN", scratch->pixels_bin.data, scratch->pixels_bin.size);
+		ajouterDonnees(fick7, "COLORS.BIN", scratch->colors_bin.data, scratch->colors_bin.size);
+		if (close_output(outputs, fick7, path) != 0)
+			status = -1;
+		else if (clash_verbose)
+			printf("%s créé\n", path);
+	} else if (outputs->selected & OUT_K7) {
+		status = -1;
+	}
+	return status;
+}
+
+int clash_process(const ClashJob *job, const DecodedImage *image, ClashScratch *scratch)
+{
+	const OutputSpec *outputs = &job->outputs;
+	Color palette[PALETTE_SIZE];
+	memset(palette, 0, sizeof(palette));
+
+	if (job->palette_name && check_palette_name(job->palettes, job->palette_name) != 0) return -1;
+
+	if (frame_stage(job, image, scratch) != 0) return -1;
+
+	// Un artefact non écrit met le job en échec, mais les suivants sont tout de même tentés
+	int status = write_png_output(outputs, OUT_RESIZED, WIDTH, HEIGHT, COLOR_COMP, scratch->framed);
+
+	// Le résultat dépend de la source, de -d -m -p, des palettes de --palette-lib, de la métrique et
+	// des réglages approchés du dithering ; le pré-tramage exoquant n'existe qu'en -m 2 et -m 3 sans
+	// palette imposée (-p ou --set : render_stage prend alors la branche palette)
+	int exo = !job->palette_name && !job->shared_palette && (job->machine == 2 || job->machine == 3);
+	uint64_t key = cache_hash_string(image->input_hash, "result");
+	key = cache_hash_int(key, job->dither);
+	key = cache_hash_int(key, job->machine);
+	key = cache_hash_string(key, job->palette_name);
+	if (job->palette_name && job->palettes->content_hash)
+		key = cache_hash(key, &job->palettes->content_hash, sizeof(job->palettes->content_hash));
+	if (job->shared_palette) key = cache_hash(key, job->shared_palette, PALETTE_SIZE * sizeof(Color));
+	// Réglages par défaut et rendus identiques (--memo exact, --pairs bound) : clé inchangée
+	if (color_metric != METRIC_RGB) key = cache_hash_int(cache_hash_string(key, "metric"), color_metric);
+	const DitherOptions *options = job->dither_options;
+	if (options && (options->memo == DITHER_MEMO_FAST || options->pairs == DITHER_PAIRS_TOP_K ||
+					options->pairs == DITHER_PAIRS_PCA || options->distance_cache || options->linear_light)) {
+		key = cache_hash_string(key, "dither");
+		key = cache_hash_int(key, options->memo == DITHER_MEMO_FAST);
+		key = cache_hash_int(key, options->pairs == DITHER_PAIRS_BOUND ? DITHER_PAIRS_EXHAUSTIVE : options->pairs);
+		key = cache_hash_int(key, options->pairs == DITHER_PAIRS_TOP_K ? options->top_k : 0);
+		key = cache_hash_int(key, options->distance_cache);
+		key = cache_hash_int(key, options->linear_light);
+	}
+	// Le rendu est rangé en 4 bits par pixel : le RGB et les encodages s'en déduisent
+	CacheChunk chunks[] = {{palette, sizeof(palette)},
+						   {scratch->packed, WIDTH * HEIGHT / 2},
+						   {scratch->rgba, WIDTH * HEIGHT * 4}};
+	int chunk_count = exo ? 3 : 2;
+
+	if (job->cache && cache_load(job->cache, CACHE_RESULT, key, chunks, chunk_count) == 0) {
+		if (clash_verbose) printf("Résultat lu dans le cache\n");
+		thomson_unpack_4bpp(scratch->packed, WIDTH * HEIGHT, scratch->dithered);
+		if (exo && write_png_output(outputs, OUT_EXO, WIDTH, HEIGHT, 4, scratch->rgba) != 0) status = -1;
+	} else {
+		if (render_stage(job, image, scratch, palette) != 0) status = -1;
+		if (job->cache) {
+			thomson_pack_4bpp(scratch->dithered, WIDTH * HEIGHT, scratch->packed);
+			cache_store(job->cache, CACHE_RESULT, key, chunks, chunk_count);
+		}
+	}
+	// --- Vérification (devrait toujours être 0 violations), blocs natifs et rendu RGB en une passe ---
+	ClashPostStats post;
+	thomson_post_pass(scratch->dithered, palette, scratch->blocks, scratch->rgb, &post);
+	if (clash_verbose) printf("Nombre de couleurs %d\n", post.colors);
+
+	// --- Image rgb ---
+	if (write_png_output(outputs, OUT_PNG, WIDTH, HEIGHT, 3, scratch->rgb) != 0) status = -1;
+
+	// --set : le MAP reste dans scratch->map pour la k7 commune
+	if ((outputs->selected & (OUT_MAP | OUT_COLORS | OUT_PIXELS | OUT_K7)) || job->shared_palette)
+		if (write_encoded_outputs(outputs, scratch, palette) != 0) status = -1;
+
+	return status;
+}
+
+// Un dithering chronométré, options->stats remis à zéro : durée en ms
+static double bench_pass(ClashScratch *scratch, const Color *palette, float *matrix, const DitherOptions *options)
+{
+	memset(options->stats, 0, sizeof(*options->stats));
+	double start = platform_time_ms();
+	block_dithering_thomson_smart_propagation_options(scratch->framed, scratch->dithered, WIDTH, HEIGHT, COLOR_COMP,
+													  palette, matrix, scratch->error, options);
+	return platform_time_ms() - start;
+}
+
+int clash_bench(const ClashJob *job, const DecodedImage *image, ClashScratch *scratch, int passes)
+{
+	Color palette[PALETTE_SIZE];
+	memset(palette, 0, sizeof(palette));
+	if (job->palette_name && check_palette_name(job->palettes, job->palette_name) != 0) return -1;
+	if (frame_stage(job, image, scratch) != 0) return -1;
+	int verbose = clash_verbose;
+	clash_verbose = 0;
+	render_stage(job, image, scratch, palette);
+	clash_verbose = verbose;
+
+	DitherStats stats;
+	DitherOptions options = DITHER_OPTIONS_DEFAULT;
+	float *matrix = dither_setup(job, scratch, &options);
+	options.stats = &stats;
+	// --linear : chaque passe est précédée de la même en diffusion gamma, pour mesurer le surcoût
+	// dans les mêmes conditions de charge
+	DitherOptions gamma = options;
+	gamma.linear_light = 0;
+	double total = 0, fastest = 0, gamma_fastest = 0;
+	for (int pass = 0; pass < passes; pass++) {
+		if (options.linear_light) {
+			double elapsed = bench_pass(scratch, palette, matrix, &gamma);
+			if (pass == 0 || elapsed < gamma_fastest) gamma_fastest = elapsed;
+		}
+		double elapsed = bench_pass(scratch, palette, matrix, &options);
+		total += elapsed;
+		if (pass == 0 || elapsed < fastest) fastest = elapsed;
+	}
+
+	double error = 0;
+	for (int i = 0; i < WIDTH * HEIGHT; i++) {
+		Color c = palette[scratch->dithered[i].palette_idx];
+		const uint8_t *p = &scratch->framed[i * COLOR_COMP];
+		error += distance_squared(c.r, c.g, c.b, p[0], p[1], p[2]);
+	}
+	printf("Bench %s : %d passes, %.2f ms par passe (min %.2f), erreur quadratique moyenne %.2f\n", job->input,
+		   passes, total / passes, fastest, error / (WIDTH * HEIGHT));
+	if (options.linear_light)
+		printf("Diffusion linéaire : %.2f ms par passe (min) contre %.2f en gamma, surcoût %+.1f %%\n", fastest,
+			   gamma_fastest, 100.0 * (fastest - gamma_fastest) / gamma_fastest);
+	dither_stats_print(&stats);
+	return 0;
+}
+
+int clash_set_frame(const ClashJob *job, DecodedImage *image, ClashScratch *scratch, uint64_t *histogram)
+{
+	if (frame_stage(job, image, scratch) != 0) return -1;
+	if (!image->framed) {
+		image->framed = malloc(WIDTH * HEIGHT * COLOR_COMP);
+		if (!image->framed) {
+			printf("Erreur: Impossible d'allouer l'image cadrée.\n");
+			return -1;
+		}
+		memcpy(image->framed, scratch->framed, WIDTH * HEIGHT * COLOR_COMP);
+	}
+	stbi_image_free(image->pixels);
+	image->pixels = NULL;
+	add_thomson_histogram(image->framed, histogram);
+	return 0;
+}
+
+void clash_histogram_palette(const uint64_t *histogram, Color *thomson_palette, Color palette[PALETTE_SIZE])
+{
+	unsigned char exo_palette[16 * 4];
+	exq_data *exq = histogram_quantizer(histogram);
+	find_exo_palette(exq, exo_palette);
+	exq_free(exq);
+	quantize_exo_to_4096(exo_palette, palette, thomson_palette);
+}
+
+int clash_write_set_k7(const OutputSpec *outputs, const IntVector *maps, int count)
+{
+	char path[1024];
+	FILE *fick7 = open_output(outputs, OUT_K7, path, sizeof(path));
+	if (!fick7) return outputs->selected & OUT_K7 ? -1 : 0;
+	for (int i = 0; i < count; i++) {
+		char name[24];
+		snprintf(name, sizeof(name), "CLASH%03d.MAP", i + 1);
+		ajouterDonnees(fick7, name, maps[i].data, maps[i].size);
+	}
+	if (close_output(outputs, fick7, path) != 0) return -1;
+	if (clash_verbose) printf("%s créé\n", path);
+	return 0;
+}
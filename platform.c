@@ -0,0 +1,345 @@
+#include "platform.h"
+#include <stdlib.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#include <fcntl.h>
+#include <io.h>
+#include <process.h>
+#define dup _dup
+#define dup2 _dup2
+#define fileno _fileno
+#define fdopen _fdopen
+#define stat _stat64
+#else
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+void platform_binary_stdin(void)
+{
+#ifdef _WIN32
+	_setmode(_fileno(stdin), _O_BINARY);
+#endif
+}
+
+FILE *platform_detach_stdout(void)
+{
+	fflush(stdout);
+	int fd = dup(fileno(stdout));
+	if (fd < 0) return NULL;
+#ifdef _WIN32
+	_setmode(fd, _O_BINARY);
+#endif
+	FILE *out = fdopen(fd, "wb");
+	if (!out) return NULL;
+	dup2(fileno(stderr), fileno(stdout));
+	return out;
+}
+
+#ifdef _WIN32
+typedef struct {
+	void *(*fn)(void *);
+	void *arg;
+} ThreadStart;
+
+static DWORD WINAPI thread_trampoline(LPVOID param)
+{
+	ThreadStart start = *(ThreadStart *)param;
+	free(param);
+	start.fn(start.arg);
+	return 0;
+}
+#endif
+
+int platform_thread_create(platform_thread *thread, void *(*fn)(void *), void *arg)
+{
+#ifdef _WIN32
+	ThreadStart *start = malloc(sizeof(ThreadStart));
+	if (!start) return -1;
+	start->fn = fn;
+	start->arg = arg;
+	*thread = CreateThread(NULL, 0, thread_trampoline, start, 0, NULL);
+	if (*thread == NULL) {
+		free(start);
+		return -1;
+	}
+	return 0;
+#else
+	return pthread_create(thread, NULL, fn, arg) == 0 ? 0 : -1;
+#endif
+}
+
+void platform_thread_join(platform_thread thread)
+{
+#ifdef _WIN32
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+#else
+	pthread_join(thread, NULL);
+#endif
+}
+
+void platform_mutex_init(platform_mutex *mutex)
+{
+#ifdef _WIN32
+	InitializeCriticalSection(mutex);
+#else
+	pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+void platform_mutex_lock(platform_mutex *mutex)
+{
+#ifdef _WIN32
+	EnterCriticalSection(mutex);
+#else
+	pthread_mutex_lock(mutex);
+#endif
+}
+
+void platform_mutex_unlock(platform_mutex *mutex)
+{
+#ifdef _WIN32
+	LeaveCriticalSection(mutex);
+#else
+	pthread_mutex_unlock(mutex);
+#endif
+}
+
+void platform_mutex_destroy(platform_mutex *mutex)
+{
+#ifdef _WIN32
+	DeleteCriticalSection(mutex);
+#else
+	pthread_mutex_destroy(mutex);
+#endif
+}
+
+void platform_cond_init(platform_cond *cond)
+{
+#ifdef _WIN32
+	InitializeConditionVariable(cond);
+#else
+	pthread_cond_init(cond, NULL);
+#endif
+}
+
+void platform_cond_wait(platform_cond *cond, platform_mutex *mutex)
+{
+#ifdef _WIN32
+	SleepConditionVariableCS(cond, mutex, INFINITE);
+#else
+	pthread_cond_wait(cond, mutex);
+#endif
+}
+
+void platform_cond_broadcast(platform_cond *cond)
+{
+#ifdef _WIN32
+	WakeAllConditionVariable(cond);
+#else
+	pthread_cond_broadcast(cond);
+#endif
+}
+
+void platform_cond_destroy(platform_cond *cond)
+{
+#ifdef _WIN32
+	(void)cond;
+#else
+	pthread_cond_destroy(cond);
+#endif
+}
+
+int platform_cpu_count(void)
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (int)n : 1;
+#endif
+}
+
+double platform_time_ms(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+#endif
+}
+
+#ifdef _WIN32
+// FILETIME : intervalles de 100 ns depuis 1601
+#define FILETIME_UNIX_EPOCH 116444736000000000LL
+
+static long long filetime_to_ns(FILETIME ft)
+{
+	return ((((long long)ft.dwHighDateTime << 32) | ft.dwLowDateTime) - FILETIME_UNIX_EPOCH) * 100;
+}
+#endif
+
+long long platform_clock_ns(void)
+{
+#ifdef _WIN32
+	FILETIME ft;
+	GetSystemTimeAsFileTime(&ft);
+	return filetime_to_ns(ft);
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#endif
+}
+
+int platform_is_directory(const char *path)
+{
+	struct stat st;
+	if (stat(path, &st) != 0) return 0;
+	return (st.st_mode & S_IFMT) == S_IFDIR;
+}
+
+long long platform_file_size(const char *path)
+{
+	struct stat st;
+	if (stat(path, &st) != 0) return -1;
+	return (long long)st.st_size;
+}
+
+long long platform_file_mtime_ns(const char *path)
+{
+#ifdef _WIN32
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (!GetFileAttributesExA(path, GetFileExInfoStandard, &data)) return -1;
+	return filetime_to_ns(data.ftLastWriteTime);
+#else
+	struct stat st;
+	if (stat(path, &st) != 0) return -1;
+#ifdef __APPLE__
+	return (long long)st.st_mtimespec.tv_sec * 1000000000LL + st.st_mtimespec.tv_nsec;
+#else
+	return (long long)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+#endif
+}
+
+int platform_set_file_mtime_ns(const char *path, long long ns)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+							  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return -1;
+	long long ticks = ns / 100 + FILETIME_UNIX_EPOCH;
+	FILETIME ft = {(DWORD)ticks, (DWORD)(ticks >> 32)};
+	int ok = SetFileTime(file, NULL, NULL, &ft);
+	CloseHandle(file);
+	return ok ? 0 : -1;
+#else
+	struct timespec times[2] = {{0, UTIME_OMIT}, {(time_t)(ns / 1000000000LL), (long)(ns % 1000000000LL)}};
+	return utimensat(AT_FDCWD, path, times, 0);
+#endif
+}
+
+int platform_make_directory(const char *path)
+{
+	if (platform_is_directory(path)) return 0;
+#ifdef _WIN32
+	return _mkdir(path) == 0 || platform_is_directory(path) ? 0 : -1;
+#else
+	return mkdir(path, 0777) == 0 || errno == EEXIST ? 0 : -1;
+#endif
+}
+
+int platform_process_id(void)
+{
+#ifdef _WIN32
+	return _getpid();
+#else
+	return (int)getpid();
+#endif
+}
+
+const void *platform_map_file(const char *path, size_t *size)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return NULL;
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+		CloseHandle(file);
+		return NULL;
+	}
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping) return NULL;
+	const void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping); // la vue garde la projection ouverte
+	if (data) *size = (size_t)file_size.QuadPart;
+	return data;
+#else
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) return NULL;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		close(fd);
+		return NULL;
+	}
+	void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); // la projection reste valide
+	if (data == MAP_FAILED) return NULL;
+	*size = (size_t)st.st_size;
+	return data;
+#endif
+}
+
+void platform_unmap_file(const void *data, size_t size)
+{
+	if (!data) return;
+#ifdef _WIN32
+	(void)size;
+	UnmapViewOfFile(data);
+#else
+	munmap((void *)data, size);
+#endif
+}
+
+int platform_list_directory(const char *path, void (*callback)(const char *name, void *context), void *context)
+{
+#ifdef _WIN32
+	char pattern[MAX_PATH];
+	WIN32_FIND_DATAA data;
+	snprintf(pattern, sizeof(pattern), "%s\\*", path);
+	HANDLE find = FindFirstFileA(pattern, &data);
+	if (find == INVALID_HANDLE_VALUE) return -1;
+	do {
+		if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) callback(data.cFileName, context);
+	} while (FindNextFileA(find, &data));
+	FindClose(find);
+	return 0;
+#else
+	DIR *dir = opendir(path);
+	if (!dir) return -1;
+	struct dirent *entry;
+	char full[4096];
+	while ((entry = readdir(dir)) != NULL) {
+		snprintf(full, sizeof(full), "%s/%s", path, entry->d_name);
+		struct stat st;
+		if (stat(full, &st) == 0 && (st.st_mode & S_IFMT) == S_IFREG) callback(entry->d_name, context);
+	}
+	closedir(dir);
+	return 0;
+#endif
+}
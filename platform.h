@@ -0,0 +1,59 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+typedef HANDLE platform_thread;
+typedef CRITICAL_SECTION platform_mutex;
+typedef CONDITION_VARIABLE platform_cond;
+#else
+#include <pthread.h>
+typedef pthread_t platform_thread;
+typedef pthread_mutex_t platform_mutex;
+typedef pthread_cond_t platform_cond;
+#endif
+
+// Passe stdin en mode binaire (nécessaire sous Windows pour lire une image depuis un pipe)
+void platform_binary_stdin(void);
+
+// Réserve la sortie standard à un artefact binaire : renvoie un flux sur le stdout d'origine
+// et redirige stdout vers stderr pour que les messages ne se mêlent pas aux données.
+FILE *platform_detach_stdout(void);
+
+// Threads, verrous et conditions (pthread ou API Windows)
+int platform_thread_create(platform_thread *thread, void *(*fn)(void *), void *arg);
+void platform_thread_join(platform_thread thread);
+void platform_mutex_init(platform_mutex *mutex);
+void platform_mutex_lock(platform_mutex *mutex);
+void platform_mutex_unlock(platform_mutex *mutex);
+void platform_mutex_destroy(platform_mutex *mutex);
+void platform_cond_init(platform_cond *cond);
+void platform_cond_wait(platform_cond *cond, platform_mutex *mutex);
+void platform_cond_broadcast(platform_cond *cond);
+void platform_cond_destroy(platform_cond *cond);
+int platform_cpu_count(void);
+
+// Horloge monotone en millisecondes
+double platform_time_ms(void);
+// Horloge murale en nanosecondes depuis 1970, celle des dates de fichiers
+long long platform_clock_ns(void);
+
+// Fichiers et répertoires
+int platform_is_directory(const char *path);
+long long platform_file_size(const char *path);
+long long platform_file_mtime_ns(const char *path); // nanosecondes depuis 1970, -1 si absent
+int platform_set_file_mtime_ns(const char *path, long long ns);
+int platform_make_directory(const char *path); // 0 si créé ou déjà présent
+int platform_process_id(void);
+// Projection d'un fichier en lecture seule, NULL si impossible
+const void *platform_map_file(const char *path, size_t *size);
+void platform_unmap_file(const void *data, size_t size);
+// Appelle callback pour chaque fichier régulier du répertoire (ordre non défini), -1 si illisible
+int platform_list_directory(const char *path, void (*callback)(const char *name, void *context), void *context);
+
+#endif // !PLATFORM_H
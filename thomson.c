@@ -1,4 +1,6 @@
 #include "thomson.h"
+#include "metric.h"
+#include "cpu.h"
 #include <float.h>
 #include <math.h>
 #include <string.h>
@@ -36,31 +38,13 @@ void init_thomson_palette(Color pal[4096])
 	printf("");
 }
 
+// thomson_palette n'est plus parcourue : en RGB le treillis étant séparable, snap_to_thomson
+// donne la même couleur que la recherche sur les 4096 entrées ; en OKLab la recherche se fait
+// sur la table du treillis déjà convertie
 void find_closest_thomson_palette(Color optimalPalette[PALETTE_SIZE], Color thomson_palette[NUM_THOMSON_COLORS],
 								  Color newPalette[PALETTE_SIZE])
 {
-	float currentDistance = 0;
-	for (int i = 0; i < PALETTE_SIZE; i++) {
-
-
-		float minDistance = FLT_MAX;
-		int minIndex = 0;
-		for (int j = 0; j < 4096; j++) {
-			currentDistance = sqrtf(powf(thomson_palette[j].r - optimalPalette[i].r, 2) +
-									powf(thomson_palette[j].g - optimalPalette[i].g, 2) +
-									powf(thomson_palette[j].b - optimalPalette[i].b, 2));
-			if (currentDistance < minDistance) {
-				minDistance = currentDistance;
-				minIndex = j;
-			}
-		}
-		//printf("o (%d,%d,%d)\n", optimalPalette[i].r, optimalPalette[i].g, optimalPalette[i].b);
-		//printf("t %f -> %d (%d,%d,%d)\n", minDistance, minIndex, thomson_palette[minIndex].r,
-			   //thomson_palette[minIndex].g, thomson_palette[minIndex].b);
-		newPalette[i].r = thomson_palette[minIndex].r;
-		newPalette[i].g = thomson_palette[minIndex].g;
-		newPalette[i].b = thomson_palette[minIndex].b;
-	}
+	for (int i = 0; i < PALETTE_SIZE; i++) metric_snap_to_thomson(optimalPalette[i], &newPalette[i]);
 }
 
 int find_thomson_palette_index(int r, int g, int b, Color thomson_palette[NUM_THOMSON_COLORS])
@@ -290,26 +274,18 @@ void find_back_and_front(uint8_t bloc[8], uint8_t *back, uint8_t *front)
 	}
 }
 
-void save_map_40_col(const char *filename, MAP_SEG *map_40, Color thomson_palette[NUM_THOMSON_COLORS], Color palette[PALETTE_SIZE])
+void encode_map_40_col(IntVector *out, MAP_SEG *map_40, Color thomson_palette[NUM_THOMSON_COLORS],
+					   Color palette[PALETTE_SIZE])
 {
 	IntVector buffer_list, target_buffer_list;
-	unsigned char current;
-
-	FILE *fout;
-	char map_filename[256];
 
 	init_vector(&buffer_list);
 	init_vector(&target_buffer_list);
 
-	sprintf(map_filename, "%s.MAP", filename);
-	if ((fout = fopen(map_filename, "wb")) == NULL) {
-		fprintf(stderr, "Impossible d'ouvrir le fichier données en écriture\n");
-		return;
-	}
-
 	transpose_data_map_40(map_40->columns, map_40->lines, &map_40->rama, &buffer_list);
 	compress(&target_buffer_list, &buffer_list, 1);
 
+	free_vector(&buffer_list);
 	init_vector(&buffer_list);
 
 	transpose_data_map_40(map_40->columns, map_40->lines, &map_40->ramb, &buffer_list);
@@ -333,14 +309,13 @@ void save_map_40_col(const char *filename, MAP_SEG *map_40, Color thomson_palett
 	header[6] = map_40->columns - 1;
 	header[7] = (map_40->lines - 1) / 8; // Le fichier map ne fonctionne que sur multiple de 8
 
-	fwrite(header, sizeof(uint8_t), 8, fout);
+	for (int i = 0; i < 8; i++) push_back(out, header[i]);
 
-	// Ecriture du buffer map compressé dans le fichier de sortie
+	// Ecriture du buffer map compressé
 	// cout << "ToSnap buffer size:" << target_buffer_list.size() << endl;
 	for (int i = 0; i < target_buffer_list.size; i++) {
 		// current = target_buffer_list.at(i);
-		current = target_buffer_list.data[i];
-		fwrite(&current, sizeof(uint8_t), 1, fout);
+		push_back(out, target_buffer_list.data[i]);
 	}
 
 	// Ecriture footer TO-SNAP
@@ -353,29 +328,49 @@ void save_map_40_col(const char *filename, MAP_SEG *map_40, Color thomson_palett
 
 	for (int i = 0; i < 16; i++) {
 		uint16_t thomson_palette_value = find_thomson_palette_index(palette[i].r, palette[i].g, palette[i].b, thomson_palette);
-		printf(" rgb(%d,%d,%d) -> Thomson[%d]=%d\n", palette[i].r, palette[i].g, palette[i].b, i,
-			   thomson_palette_value);
+		if (clash_verbose)
+			printf(" rgb(%d,%d,%d) -> Thomson[%d]=%d\n", palette[i].r, palette[i].g, palette[i].b, i,
+				   thomson_palette_value);
 		to_snap[5 + i * 2] = (thomson_palette_value >> 8) & 255;
 		to_snap[5 + i * 2 + 1] = thomson_palette_value & 255;
 	}
 
 	to_snap[37] = 0xA5;
 	to_snap[38] = 0x5A;
-	fwrite(to_snap, sizeof(unsigned char), 39, fout);
+	for (int i = 0; i < 39; i++) push_back(out, to_snap[i]);
 
 	// Ecriture du footer
 	unsigned char footer[] = {0, 0, 0, 0, 0};
 
 	footer[0] = 255;
-	fwrite(footer, sizeof(unsigned char), 5, fout);
+	for (int i = 0; i < 5; i++) push_back(out, footer[i]);
+
+	free_vector(&buffer_list);
+	free_vector(&target_buffer_list);
+}
+
+void save_map_40_col(const char *filename, MAP_SEG *map_40, Color thomson_palette[NUM_THOMSON_COLORS], Color palette[PALETTE_SIZE])
+{
+	IntVector map_data;
+	FILE *fout;
+	char map_filename[256];
+
+	sprintf(map_filename, "%s.MAP", filename);
+	if ((fout = fopen(map_filename, "wb")) == NULL) {
+		fprintf(stderr, "Impossible d'ouvrir le fichier données en écriture\n");
+		return;
+	}
+
+	init_vector(&map_data);
+	encode_map_40_col(&map_data, map_40, thomson_palette, palette);
+	fwrite(map_data.data, sizeof(uint8_t), map_data.size, fout);
 
 	fflush(fout);
 	fclose(fout);
 
 	//printf("TO-SNAP créé\n");
 
-	free_vector(&buffer_list);
-	free_vector(&target_buffer_list);
+	free_vector(&map_data);
 
 	// Ecriture du chargeur TO-SNAP
 	// char fname_snap_out[256];
@@ -399,51 +394,150 @@ void save_map_40_col(const char *filename, MAP_SEG *map_40, Color thomson_palett
 	// fflush(stdout);
 }
 
-void save_as_to_snap(const char *name, const uint8_t *output_image_data, Color thomson_palette[NUM_THOMSON_COLORS], Color palette[16], IntVector *pixels, IntVector *colors)
+void thomson_pack_4bpp(const DitheredPixel *indices, int pixels, uint8_t *packed)
 {
-	MAP_SEG map_40;
-	uint8_t b, f;
-	init_vector(&map_40.rama);
-	init_vector(&map_40.ramb);
-	unsigned char *clash_fragment = malloc(8 * COLOR_COMP);
-	if (!clash_fragment) return;
-	uint8_t current_bloc[8];
+	int i = 0;
+	for (; i + 1 < pixels; i += 2) packed[i / 2] = (uint8_t)(indices[i].palette_idx << 4 | indices[i + 1].palette_idx);
+	if (i < pixels) packed[i / 2] = (uint8_t)(indices[i].palette_idx << 4);
+}
+
+void thomson_unpack_4bpp(const uint8_t *packed, int pixels, DitheredPixel *indices)
+{
+	for (int i = 0; i < pixels; i++) indices[i].palette_idx = i % 2 ? packed[i / 2] & 15 : packed[i / 2] >> 4;
+}
+
+// Bits à 1 d'un octet de forme
+static int form_pixels(uint8_t form)
+{
+	int count = 0;
+	for (; form; form &= form - 1) count++;
+	return count;
+}
+
+// Bloc natif de 8 index déjà ramenés à la première entrée de palette de même couleur
+static void encode_block(const uint8_t block[8], ClashBlock *encoded)
+{
+	uint16_t used = 0;
+	for (int k = 0; k < 8; k++) used |= 1 << block[k];
+	// Les deux plus hauts index présents, 0 en forme pour un aplat
+	int back = PALETTE_SIZE - 1;
+	while (!(used & 1 << back)) back--;
+	int front = back - 1;
+	while (front > 0 && !(used & 1 << front)) front--;
+	if (front < 0) front = 0;
+
+	uint8_t back_form = 0, front_form = 0;
+	for (int k = 0; k < 8; k++) {
+		if (block[k] == back) back_form |= 0x80 >> k;
+		if (block[k] == front) front_form |= 0x80 >> k;
+	}
+	// Fond : la couleur majoritaire, la plus basse à égalité
+	if (form_pixels(back_form) <= form_pixels(front_form)) {
+		int swap = back;
+		back = front;
+		front = swap;
+		front_form = back_form;
+	}
+	encoded->form = front_form;
+	encoded->colors = (uint8_t)(front << 4 | back);
+}
+
+void thomson_post_pass(const DitheredPixel *indices, const Color palette[PALETTE_SIZE], ClashBlock *blocks,
+					   uint8_t *rgb, ClashPostStats *stats)
+{
+	if (clash_verbose) printf("\n--- Vérification finale du respect de la contrainte de 2 couleurs par bloc ---\n");
+	memset(stats, 0, sizeof(*stats));
+	// Entrée de palette retenue pour chaque index : la première de même couleur
+	uint8_t canonical[PALETTE_SIZE];
+	for (int i = 0; i < PALETTE_SIZE; i++) {
+		int j = 0;
+		while (palette[j].r != palette[i].r || palette[j].g != palette[i].g || palette[j].b != palette[i].b) j++;
+		canonical[i] = (uint8_t)j;
+	}
+
 	for (int y = 0; y < HEIGHT; y++) {
+		const DitheredPixel *row = &indices[y * WIDTH];
+		// Rendu RGB de la ligne tant qu'elle est dans le cache
+		if (rgb) cpu_kernels.expand_indices(row, WIDTH, palette, rgb + y * WIDTH * COLOR_COMP);
 		for (int x = 0; x < WIDTH; x += 8) {
-			int length = x + 8 > WIDTH ? WIDTH - x : 8;
-			memset(clash_fragment, 0, 8 * COLOR_COMP);
-			for (int i = 0; i < length; i++) {
-				int output_pixel_idx = (y * WIDTH + x + i) * COLOR_COMP;
-				uint8_t r = output_image_data[output_pixel_idx];
-				uint8_t g = output_image_data[output_pixel_idx + 1];
-				uint8_t b = output_image_data[output_pixel_idx + 2];
-				clash_fragment[i * COLOR_COMP] = r;
-				clash_fragment[i * COLOR_COMP + 1] = g;
-				clash_fragment[i * COLOR_COMP + 2] = b;
+			uint8_t block[8];
+			uint16_t used = 0;
+			for (int k = 0; k < 8; k++) {
+				int idx = row[x + k].palette_idx;
+				used |= 1 << idx;
+				stats->usage[idx]++;
+				block[k] = canonical[idx];
 			}
-			clash_fragment_to_palette_indexed_bloc(clash_fragment, current_bloc, 8, palette);
-			uint8_t ret[3];
-			thomson_encode_bloc(current_bloc, ret);
-			push_back(&map_40.rama, ret[0]);
-			push_back(&map_40.ramb, ret[1]);
-
-			// MO5 pixels and colors
-			find_back_and_front(current_bloc, &b, &f);
-			unsigned char result = 0;
-			for (int i = 0; i < 8; i++) {
-				if (current_bloc[7 - i] == f) {
-					result |= 1 << (7 - i);
-				}
+			stats->used |= used;
+			uint16_t rest = used & (used - 1); // sans la plus basse couleur
+			if (rest & (rest - 1)) {
+				stats->clash_blocks++;
+				printf("ERREUR DÉTECTÉE: Bloc à (%d, %d) contient %d couleurs uniques.\n", x, y,
+					   form_pixels((uint8_t)used) + form_pixels((uint8_t)(used >> 8)));
 			}
-			// en sortie les données pixels et forme (utils pour la sauvegarde MO5)
-			push_back(colors, 16 * f + b);
-			push_back(pixels, result);
+			if (blocks) encode_block(block, &blocks[(y * WIDTH + x) / 8]);
 		}
 	}
+
+	uint16_t distinct = 0;
+	for (int i = 0; i < PALETTE_SIZE; i++)
+		if (stats->used & 1 << i) distinct |= 1 << canonical[i];
+	stats->colors = form_pixels((uint8_t)distinct) + form_pixels((uint8_t)(distinct >> 8));
+
+	if (stats->clash_blocks == 0) {
+		if (clash_verbose) printf("RÉUSSITE : Toutes les contraintes de 2 couleurs par bloc sont respectées.\n");
+	} else {
+		printf("ATTENTION : %d blocs ne respectent PAS la contrainte de 2 couleurs. "
+			   "Ceci est inattendu avec l'algorithme actuel et pourrait indiquer une erreur de logique.\n",
+			   stats->clash_blocks);
+	}
+	if (clash_verbose) printf("-----------------------------------------------------------------\n");
+}
+
+void encode_as_to_snap(IntVector *map, const ClashBlock *blocks, Color thomson_palette[NUM_THOMSON_COLORS],
+					   Color palette[16], IntVector *pixels, IntVector *colors)
+{
+	MAP_SEG map_40;
+	init_vector(&map_40.rama);
+	init_vector(&map_40.ramb);
+	for (int b = 0; b < CLASH_BLOCKS; b++) {
+		int front = blocks[b].colors >> 4, back = blocks[b].colors & 15;
+		// TO-SNAP : le fond est la couleur du pixel de droite
+		if (blocks[b].form & 1) {
+			push_back(&map_40.rama, (uint8_t)~blocks[b].form);
+			push_back(&map_40.ramb, get_index_color_thomson_to(front, back));
+		} else {
+			push_back(&map_40.rama, blocks[b].form);
+			push_back(&map_40.ramb, get_index_color_thomson_to(back, front));
+		}
+
+		// en sortie les données pixels et forme (utils pour la sauvegarde MO5)
+		push_back(colors, blocks[b].colors);
+		push_back(pixels, blocks[b].form);
+	}
 	map_40.lines = HEIGHT;
-	map_40.columns = WIDTH / 8 + (WIDTH % 8 == 0 ? 0 : 1);
-	save_map_40_col(name, &map_40, thomson_palette, palette);
+	map_40.columns = WIDTH / 8;
+	encode_map_40_col(map, &map_40, thomson_palette, palette);
 
 	free_vector(&map_40.rama);
 	free_vector(&map_40.ramb);
 }
+
+void save_as_to_snap(const char *name, const ClashBlock *blocks, Color thomson_palette[NUM_THOMSON_COLORS], Color palette[16], IntVector *pixels, IntVector *colors)
+{
+	IntVector map_data;
+	FILE *fout;
+	char map_filename[256];
+
+	init_vector(&map_data);
+	encode_as_to_snap(&map_data, blocks, thomson_palette, palette, pixels, colors);
+
+	sprintf(map_filename, "%s.MAP", name);
+	if ((fout = fopen(map_filename, "wb")) == NULL) {
+		fprintf(stderr, "Impossible d'ouvrir le fichier données en écriture\n");
+	} else {
+		fwrite(map_data.data, sizeof(uint8_t), map_data.size, fout);
+		fclose(fout);
+	}
+	free_vector(&map_data);
+}
@@ -10,10 +10,20 @@ typedef struct {
 	uint16_t thomson_idx;
 } Color;
 
+// Plan d'index produit par le dithering : un octet par pixel, seuls les 4 bits de poids faible servent
 typedef struct {
-	int palette_idx;
+	uint8_t palette_idx;
 } DitheredPixel;
 
+// Forme native d'un bloc de 8 pixels : octet de forme (bit 7 = pixel de gauche, 1 = couleur de forme)
+// et octet de couleurs forme << 4 | fond (index de palette, format des COLORS.BIN MO5)
+typedef struct {
+	uint8_t form;
+	uint8_t colors;
+} ClashBlock;
+
+#define CLASH_BLOCKS (WIDTH / 8 * HEIGHT)
+
 typedef struct {
 	uint8_t columns;
 	uint8_t lines;
@@ -58,10 +68,53 @@ static Color blue_255[16] = {{0, 0, 0, 0},		{0, 0, 96, 256},   {0, 0, 122, 512},
 
 static Color thomson_palette_init[4096];
 
+// Niveau Thomson (0-15) le plus proche d'une composante 0-255, le plus bas en cas d'galit
+static inline int nearest_thomson_level(int value)
+{
+	int best = 0;
+	for (int i = 1; i < 16; i++) {
+		int d = red_255[i].r - value, d_best = red_255[best].r - value;
+		if (d * d < d_best * d_best) best = i;
+	}
+	return best;
+}
+
+// Le treillis Thomson est un produit de 3 gammes de 16 niveaux : la couleur la plus proche
+// s'obtient composante par composante (mmes ex aequo que la recherche sur les 4096 couleurs)
+static inline void snap_to_thomson(Color c, Color *snapped)
+{
+	int r = nearest_thomson_level(c.r);
+	int g = nearest_thomson_level(c.g);
+	int b = nearest_thomson_level(c.b);
+	snapped->r = red_255[r].r;
+	snapped->g = green_255[g].g;
+	snapped->b = blue_255[b].b;
+	snapped->thomson_idx = red_255[r].thomson_idx + green_255[g].thomson_idx + blue_255[b].thomson_idx;
+}
+
 void init_thomson_palette(Color pal[4096]);
 void find_closest_thomson_palette(Color optimalPalette[PALETTE_SIZE], Color thomson_palette[NUM_THOMSON_COLORS],
 								  Color newPalette[PALETTE_SIZE]);
 
+// Plan d'index compact : 2 pixels par octet, le premier dans les 4 bits de poids fort
+void thomson_pack_4bpp(const DitheredPixel *indices, int pixels, uint8_t *packed);
+void thomson_unpack_4bpp(const uint8_t *packed, int pixels, DitheredPixel *indices);
+
+// Bilan de thomson_post_pass
+typedef struct {
+	int clash_blocks;			  // blocs de plus de 2 couleurs (0 attendu)
+	uint16_t used;				  // masque des entres de palette prsentes
+	int colors;					  // couleurs RGB distinctes du rendu
+	uint32_t usage[PALETTE_SIZE]; // pixels par entre de palette
+} ClashPostStats;
+
+// Passe unique aprs le dithering d'un rendu WIDTH x HEIGHT, ligne par ligne : contrle des 2 couleurs
+// par bloc (masque 16 bits), usage de la palette, blocs natifs (CLASH_BLOCKS, NULL : non produits) et
+// rendu RGB (NULL : non produit). Dans les blocs, la couleur majoritaire est le fond et deux entres de
+// palette identiques sont confondues, comme sur la machine.
+void thomson_post_pass(const DitheredPixel *indices, const Color palette[PALETTE_SIZE], ClashBlock *blocks,
+					   uint8_t *rgb, ClashPostStats *stats);
+
 // TO-SNAP
 int get_index_color_thomson_to(int back_index, int fore_index);
 int get_index_color_thomson_mo(int back_index, int fore_index);
@@ -75,9 +128,13 @@ void transpose_data_map_40(int columns, int lines, IntVector *src, IntVector *ta
 int read_ahead(const IntVector *buffer_list, int idx);
 void write_segment(IntVector *target, const IntVector *buffer_list, int i, uint8_t seg_size);
 void compress(IntVector *target, IntVector *buffer_list, int enclose);
+void encode_map_40_col(IntVector *out, MAP_SEG *map_40, Color thomson_palette[NUM_THOMSON_COLORS],
+					   Color palette[PALETTE_SIZE]);
 void save_map_40_col(const char *filename, MAP_SEG *map_40, Color thomson_palette[NUM_THOMSON_COLORS],
 					 Color palette[PALETTE_SIZE]);
-void save_as_to_snap(const char *name, const uint8_t *output_image_data, Color thomson_palette[NUM_THOMSON_COLORS],
+void encode_as_to_snap(IntVector *map, const ClashBlock *blocks, Color thomson_palette[NUM_THOMSON_COLORS],
+					   Color palette[16], IntVector *pixels, IntVector *colors);
+void save_as_to_snap(const char *name, const ClashBlock *blocks, Color thomson_palette[NUM_THOMSON_COLORS],
 					 Color palette[16], IntVector *pixels, IntVector *colors);
 
 #endif
\ No newline at end of file